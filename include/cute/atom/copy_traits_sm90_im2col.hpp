@@ -41,6 +41,7 @@
 #include "cute/algorithm/prefetch.hpp"
 #include "cutlass/fast_math.h"
 #include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/tma_descriptor_cache.hpp"
 
 namespace cute
 {
@@ -454,7 +455,7 @@ make_im2col_tma_copy_desc(
   TMA::SmemSwizzleBase    swizzle_base    = detail::get_tma_swizzle_base(smem_swizzle);
   CUtensorMapSwizzle      tma_swizzle     = TMA::to_CUtensorMapSwizzle(swizzle_bits, swizzle_base);
 
-  CUresult encode_result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeIm2col)(
+  CUresult encode_result = cutlass::tma_descriptor_encode_im2col(
       &tma_desc,
       tma_format,
       num_total_modes,
@@ -43,6 +43,7 @@
 #include <cute/numeric/integral_ratio.hpp>
 
 #include <cutlass/cuda_host_adapter.hpp>
+#include <cutlass/tma_descriptor_cache.hpp>
 
 namespace cute
 {
@@ -1380,7 +1381,7 @@ make_tma_copy_desc(Tensor<GEngine,GLayout> const& gtensor,         // The origin
 
     // 调用 CUDA Driver API 创建 TMA descriptor
     // 这个 API 会验证所有参数并填充 128 字节的 descriptor 结构
-    CUresult result = CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(
+    CUresult result = cutlass::tma_descriptor_encode_tiled(
         &tma_desc,
         tma_format,                     // 数据类型
         tma_dim,                        // 维度数（1-5）
@@ -80,7 +80,7 @@ public:
   typedef value_type *pointer;
   typedef value_type const * const_pointer;
 
-  using Array = Array<T, N>;
+  using Array = cutlass::Array<T, N>;
   using reference = typename Array::reference;
   using const_reference = typename Array::const_reference;
 
@@ -62,6 +62,20 @@ int SmId() {
   return ret;
 }
 
+#elif defined(CUTLASS_HOST_EMULATION)
+
+/// Computes laneId within a warp of an emulated threadblock
+CUTLASS_DEVICE
+int LaneId() {
+  return ::cutlass::emulation::lane_idx();
+}
+
+/// Emulated threadblocks are not associated with an SM
+CUTLASS_DEVICE
+int SmId() {
+  return 0;
+}
+
 #endif
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
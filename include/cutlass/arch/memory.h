@@ -71,6 +71,8 @@ struct global_load;
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(CUTLASS_HOST_EMULATION)
+
 // The redundant mov PTX instruction is used to enforce the compiler to
 // keep the initializing code before ld.global
 template <typename AccessType>
@@ -343,6 +345,19 @@ struct global_load<AccessType,
   }
 };
 
+#else
+
+// Host emulation replaces the PTX specializations with plain predicated loads
+template <typename AccessType, int LoadBytes, CacheOperation::Kind cache_op>
+struct global_load {
+  CUTLASS_DEVICE
+  global_load(AccessType &D, void const *ptr, bool pred_guard) {
+    if (pred_guard) D = *(reinterpret_cast<AccessType const *>(ptr));
+  }
+};
+
+#endif // !defined(CUTLASS_HOST_EMULATION)
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 template <
@@ -359,6 +374,7 @@ struct global_store;
 //
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+#if !defined(CUTLASS_HOST_EMULATION)
 
 template <typename AccessType>
 struct global_store<AccessType, 64> {
@@ -479,6 +495,19 @@ struct global_store<AccessType, 1> {
   }
 };
 
+#else
+
+// Host emulation replaces the PTX specializations with plain predicated stores
+template <typename AccessType, int StoreBytes>
+struct global_store {
+  CUTLASS_DEVICE
+  global_store(AccessType const &D, void *ptr, bool pred_guard) {
+    if (pred_guard) *(reinterpret_cast<AccessType *>(ptr)) = D;
+  }
+};
+
+#endif // !defined(CUTLASS_HOST_EMULATION)
+
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
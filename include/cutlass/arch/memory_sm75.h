@@ -234,6 +234,9 @@ CUTLASS_DEVICE void shared_load(AccessType &D, void const *ptr) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+// Host emulation uses the generic shared memory load
+#if !defined(CUTLASS_HOST_EMULATION)
+
 template <typename AccessType>
 struct shared_load_op<AccessType, 16> {
   CUTLASS_DEVICE
@@ -264,6 +267,8 @@ struct shared_load_op<AccessType, 8> {
   }
 };
 
+#endif // !defined(CUTLASS_HOST_EMULATION)
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 } // namespace arch
@@ -42,6 +42,8 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/detail/layout.hpp"
 #include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/device_properties_cache.hpp"
+#include "cutlass/tma_descriptor_cache.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -142,6 +144,9 @@ private:
   /// Kernel API parameters object
   Params params_;
 
+  /// Cache of TMA descriptors encoded while lowering arguments to params_
+  TmaDescriptorCache* tma_descriptor_cache_ = nullptr;
+
 public:
 
   /// Access the Params structure
@@ -149,6 +154,12 @@ public:
     return params_;
   }
 
+  /// Reuses TMA descriptors across initialize() and update() calls whose arguments differ only in
+  /// their tensor pointers. The cache may be shared by several handles and must outlive them.
+  void set_tma_descriptor_cache(TmaDescriptorCache* cache) {
+    tma_descriptor_cache_ = cache;
+  }
+
   /// Determines whether the conv can execute the given problem.
   static Status
   can_implement(Arguments const& args) {
@@ -186,38 +197,19 @@ public:
   /// Computes the maximum number of active blocks per multiprocessor
   static int maximum_active_blocks(int /* smem_capacity */ = -1) {
     CUTLASS_TRACE_HOST("ConvUniversal::maximum_active_blocks()");
-    int max_active_blocks = -1;
     int smem_size = ConvKernel::SharedStorageSize;
 
-    // first, account for dynamic smem capacity if needed
-    cudaError_t result;
-    if (smem_size >= (48 << 10)) {
-      CUTLASS_TRACE_HOST("  Setting smem size to " << smem_size);
-      result = cudaFuncSetAttribute(
-          device_kernel<ConvKernel>,
-          cudaFuncAttributeMaxDynamicSharedMemorySize,
-          smem_size);
-      if (cudaSuccess != result) {
-        result = cudaGetLastError(); // to clear the error bit
-        CUTLASS_TRACE_HOST(
-          "  cudaFuncSetAttribute() returned error: "
-          << cudaGetErrorString(result));
-        return -1;
-      }
+    // Cached for the process. The dynamic smem limit is raised before the first occupancy query.
+    int device = DevicePropertiesCache::current_device();
+    if (device < 0) {
+      return -1;
     }
-
-    // query occupancy after setting smem size
-    result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &max_active_blocks,
+    int max_active_blocks = DevicePropertiesCache::max_active_blocks<ConvKernel>(
+        device,
         device_kernel<ConvKernel>,
         ConvKernel::MaxThreadsPerBlock,
         smem_size);
-
-    if (cudaSuccess != result) {
-      result = cudaGetLastError(); // to clear the error bit
-      CUTLASS_TRACE_HOST(
-        "  cudaOccupancyMaxActiveBlocksPerMultiprocessor() returned error: "
-        << cudaGetErrorString(result));
+    if (max_active_blocks < 0) {
       return -1;
     }
 
@@ -243,7 +235,10 @@ public:
     }
 
     // Initialize the Params structure
-    params_ = ConvKernel::to_underlying_arguments(args, workspace);
+    {
+      TmaDescriptorCache::Scope tma_descriptor_scope(tma_descriptor_cache_);
+      params_ = ConvKernel::to_underlying_arguments(args, workspace);
+    }
 
     // Don't set the function attributes - require the CudaHostAdapter to set it.
     if constexpr (kEnableCudaHostAdapter) {
@@ -279,6 +274,7 @@ public:
       return Status::kErrorWorkspaceNull;
     }
 
+    TmaDescriptorCache::Scope tma_descriptor_scope(tma_descriptor_cache_);
     params_ = ConvKernel::to_underlying_arguments(args, workspace);
     return Status::kSuccess;
   }
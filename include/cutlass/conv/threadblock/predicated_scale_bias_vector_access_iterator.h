@@ -84,8 +84,8 @@ class PredicatedScaleBiasVectorAccessIterator<ThreadblockShape_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ConstPointer = const Element *;
@@ -315,8 +315,8 @@ class PredicatedScaleBiasVectorAccessIterator<ThreadblockShape_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ConstPointer = const Element *;
@@ -83,8 +83,8 @@ class PredicatedScaleBiasVectorIterator<WarpShape_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ConstPointer = const Element *;
@@ -259,8 +259,8 @@ class PredicatedScaleBiasVectorIterator<WarpShape_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ConstPointer = const Element *;
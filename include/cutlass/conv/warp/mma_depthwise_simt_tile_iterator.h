@@ -350,7 +350,7 @@ class DepthwiseDirect2dConvSimtTileIterator<Shape_,
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -649,7 +649,7 @@ class DepthwiseDirect2dConvSimtTileIterator<Shape_,
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -37,6 +37,10 @@
 
 #include "cutlass/detail/helper_macros.hpp"
 
+#if defined(CUTLASS_HOST_EMULATION)
+#include "cutlass/host_emulation_hooks.h"
+#endif
+
 #if (__CUDACC_VER_MAJOR__ >= 13)
   #define CUDA_STD_HEADER(header) <cccl/cuda/std/header>
 #else
@@ -110,6 +114,13 @@ static const int NumThreadsPerQuadPair = NumThreadsPerQuad * 2;
 CUTLASS_HOST_DEVICE bool thread0() {
   #if defined(__CUDA_ARCH__)
     return (!threadIdx.x && !threadIdx.y && !threadIdx.z) && (!blockIdx.x && !blockIdx.y && !blockIdx.z);
+  #elif defined(CUTLASS_HOST_EMULATION)
+    if (!emulation::in_kernel()) {
+      return false;
+    }
+    uint3 thread = emulation::thread_idx();
+    uint3 block = emulation::block_idx();
+    return (!thread.x && !thread.y && !thread.z) && (!block.x && !block.y && !block.z);
   #else
     return false;
   #endif
@@ -120,6 +131,8 @@ CUTLASS_DEVICE
 int canonical_lane_idx() { 
   #if defined(__CUDA_ARCH__)
     return threadIdx.x % NumThreadsPerWarp;
+  #elif defined(CUTLASS_HOST_EMULATION)
+    return emulation::thread_idx().x % NumThreadsPerWarp;
   #else
     return 0;
   #endif
@@ -131,6 +144,8 @@ CUTLASS_DEVICE
 int canonical_warp_idx_sync() { 
   #if defined(__CUDA_ARCH__)
     return __shfl_sync(0xffffffff, threadIdx.x / NumThreadsPerWarp, 0);
+  #elif defined(CUTLASS_HOST_EMULATION)
+    return emulation::warp_broadcast(emulation::thread_idx().x / NumThreadsPerWarp, 0);
   #else
     return 0;
   #endif
@@ -142,6 +157,8 @@ CUTLASS_DEVICE
 int canonical_warp_idx() { 
   #if defined(__CUDA_ARCH__)
     return threadIdx.x / NumThreadsPerWarp;
+  #elif defined(CUTLASS_HOST_EMULATION)
+    return emulation::thread_idx().x / NumThreadsPerWarp;
   #else
     return 0;
   #endif
@@ -153,6 +170,8 @@ CUTLASS_DEVICE
 int canonical_warp_group_idx() {
   #if defined(__CUDA_ARCH__)
     return __shfl_sync(0xffffffff, threadIdx.x / NumThreadsPerWarpGroup, 0);
+  #elif defined(CUTLASS_HOST_EMULATION)
+    return emulation::warp_broadcast(emulation::thread_idx().x / NumThreadsPerWarpGroup, 0);
   #else
     return 0;
   #endif
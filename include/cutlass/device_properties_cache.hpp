@@ -0,0 +1,471 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Process-wide cache of device attributes and kernel occupancy.
+
+    Device layers query the SM count and kernel occupancy before each launch is configured. The
+    answers only depend on the device and the kernel, so they are computed once per process and
+    shared by every thread and every kernel type. Lookups are lock-free, and entries may be
+    inserted ahead of time (for example from a snapshot file, see
+    cutlass/util/device_properties_snapshot.hpp) so that no CUDA query is issued at all.
+
+    Kernels are identified by a hash of their type name, which is stable across runs of the same
+    binary. Entries are never evicted; cached values become stale if a device is reset.
+*/
+
+#pragma once
+
+#include "cutlass/cutlass.h"
+#include "cutlass/trace.h"
+
+#if !defined(__CUDACC_RTC__)
+
+#include <atomic>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <thread>
+
+#include <cuda_runtime.h>
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Device attributes held by the DevicePropertiesCache
+enum class DeviceAttribute {
+  kMultiProcessorCount,
+  kMaxSharedMemoryPerBlockOptin,
+  kMaxSharedMemoryPerMultiprocessor,
+  kMaxThreadsPerMultiProcessor,
+  kComputeCapabilityMajor,
+  kComputeCapabilityMinor,
+  kL2CacheSize,
+  kInvalid
+};
+
+inline char const *to_string(DeviceAttribute attribute) {
+  switch (attribute) {
+    case DeviceAttribute::kMultiProcessorCount: return "multiprocessor_count";
+    case DeviceAttribute::kMaxSharedMemoryPerBlockOptin: return "max_shared_memory_per_block_optin";
+    case DeviceAttribute::kMaxSharedMemoryPerMultiprocessor: return "max_shared_memory_per_multiprocessor";
+    case DeviceAttribute::kMaxThreadsPerMultiProcessor: return "max_threads_per_multiprocessor";
+    case DeviceAttribute::kComputeCapabilityMajor: return "compute_capability_major";
+    case DeviceAttribute::kComputeCapabilityMinor: return "compute_capability_minor";
+    case DeviceAttribute::kL2CacheSize: return "l2_cache_size";
+    default: break;
+  }
+  return "invalid";
+}
+
+/// Kernel properties held by the DevicePropertiesCache
+enum class KernelQuery {
+  kMaxActiveBlocks,             ///< cudaOccupancyMaxActiveBlocksPerMultiprocessor()
+  kMaxActiveClusters,           ///< cudaOccupancyMaxActiveClusters()
+  kDynamicSharedMemoryLimit,    ///< cudaFuncAttributeMaxDynamicSharedMemorySize applied by the process
+  kInvalid
+};
+
+inline char const *to_string(KernelQuery query) {
+  switch (query) {
+    case KernelQuery::kMaxActiveBlocks: return "max_active_blocks";
+    case KernelQuery::kMaxActiveClusters: return "max_active_clusters";
+    case KernelQuery::kDynamicSharedMemoryLimit: return "dynamic_shared_memory_limit";
+    default: break;
+  }
+  return "invalid";
+}
+
+/// Identifies one kernel property on one device
+struct KernelQueryKey {
+  int device = 0;
+  KernelQuery query = KernelQuery::kInvalid;
+
+  /// Hash of the kernel's type name (see DevicePropertiesCache::kernel_id())
+  uint64_t kernel = 0;
+
+  int threads = 0;
+  int smem_size = 0;
+  int cluster_x = 0;
+  int cluster_y = 0;
+  int cluster_z = 0;
+
+  /// Occupancy calculator flags
+  unsigned flags = 0;
+
+  bool operator==(KernelQueryKey const &rhs) const {
+    return device == rhs.device && query == rhs.query && kernel == rhs.kernel &&
+      threads == rhs.threads && smem_size == rhs.smem_size &&
+      cluster_x == rhs.cluster_x && cluster_y == rhs.cluster_y && cluster_z == rhs.cluster_z && flags == rhs.flags;
+  }
+
+  uint64_t hash() const {
+    uint64_t h = kernel ^ 0x9e3779b97f4a7c15ull;
+    for (int64_t field : {int64_t(device), int64_t(query), int64_t(threads), int64_t(smem_size),
+                          int64_t(cluster_x), int64_t(cluster_y), int64_t(cluster_z), int64_t(flags)}) {
+      h = (h ^ uint64_t(field)) * 0x100000001b3ull;
+      h ^= h >> 29;
+    }
+    return h;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Lock-free, insert-only cache of device attributes and kernel properties shared by the process
+class DevicePropertiesCache {
+public:
+
+  /// Devices with larger ordinals bypass the cache
+  static constexpr int kMaxDevices = 64;
+
+  /// Number of kernel property entries. Once full, further queries bypass the cache.
+  static constexpr size_t kKernelQueryCapacity = 4096;
+
+  static constexpr int kAttributeCount = int(DeviceAttribute::kInvalid);
+
+  DevicePropertiesCache(): kernel_entries_(new KernelEntry[kKernelQueryCapacity]) {
+    clear();
+  }
+
+  DevicePropertiesCache(DevicePropertiesCache const &) = delete;
+  DevicePropertiesCache &operator=(DevicePropertiesCache const &) = delete;
+
+  /// Cache shared by the process
+  static DevicePropertiesCache &instance() {
+    static DevicePropertiesCache cache;
+    return cache;
+  }
+
+  /// Identifier of a kernel type used in KernelQueryKey
+  template <typename Kernel>
+  static uint64_t kernel_id() {
+    static uint64_t const id = hash_name(type_name<Kernel>());
+    return id;
+  }
+
+  /// 64-bit FNV-1a hash of a kernel name
+  static uint64_t hash_name(char const *name) {
+    uint64_t h = 0xcbf29ce484222325ull;
+    for (; *name; ++name) {
+      h = (h ^ uint64_t(static_cast<unsigned char>(*name))) * 0x100000001b3ull;
+    }
+    return h;
+  }
+
+  static cudaDeviceAttr cuda_attribute(DeviceAttribute attribute) {
+    switch (attribute) {
+      case DeviceAttribute::kMaxSharedMemoryPerBlockOptin: return cudaDevAttrMaxSharedMemoryPerBlockOptin;
+      case DeviceAttribute::kMaxSharedMemoryPerMultiprocessor: return cudaDevAttrMaxSharedMemoryPerMultiprocessor;
+      case DeviceAttribute::kMaxThreadsPerMultiProcessor: return cudaDevAttrMaxThreadsPerMultiProcessor;
+      case DeviceAttribute::kComputeCapabilityMajor: return cudaDevAttrComputeCapabilityMajor;
+      case DeviceAttribute::kComputeCapabilityMinor: return cudaDevAttrComputeCapabilityMinor;
+      case DeviceAttribute::kL2CacheSize: return cudaDevAttrL2CacheSize;
+      default: break;
+    }
+    return cudaDevAttrMultiProcessorCount;
+  }
+
+  //
+  // Device attributes
+  //
+
+  /// Returns a cached attribute, querying the device on a miss
+  Status attribute(int &value, int device, DeviceAttribute attribute) {
+    if (find_attribute(value, device, attribute)) {
+      return Status::kSuccess;
+    }
+
+    cudaError_t result = cudaDeviceGetAttribute(&value, cuda_attribute(attribute), device);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaDeviceGetAttribute() returned error " << cudaGetErrorString(result));
+      return Status::kErrorInternal;
+    }
+
+    set_attribute(device, attribute, value);
+    return Status::kSuccess;
+  }
+
+  bool find_attribute(int &value, int device, DeviceAttribute attribute) const {
+    if (!valid(device, attribute)) {
+      return false;
+    }
+    int cached = attributes_[device][int(attribute)].load(std::memory_order_relaxed);
+    if (cached < 0) {
+      return false;
+    }
+    value = cached;
+    return true;
+  }
+
+  void set_attribute(int device, DeviceAttribute attribute, int value) {
+    if (valid(device, attribute) && value >= 0) {
+      attributes_[device][int(attribute)].store(value, std::memory_order_relaxed);
+    }
+  }
+
+  /// Calls `func(device, attribute, value)` for each cached attribute
+  template <typename Func>
+  void for_each_attribute(Func &&func) const {
+    for (int device = 0; device < kMaxDevices; ++device) {
+      for (int attribute = 0; attribute < kAttributeCount; ++attribute) {
+        int value = attributes_[device][attribute].load(std::memory_order_relaxed);
+        if (value >= 0) {
+          func(device, DeviceAttribute(attribute), value);
+        }
+      }
+    }
+  }
+
+  //
+  // Kernel properties
+  //
+
+  /// Returns a cached kernel property, calling `query(value)` on a miss. `query` returns a Status;
+  /// failed queries are not cached. Concurrent misses on the same key may each call `query`.
+  template <typename Query>
+  Status kernel_query(int &value, KernelQueryKey const &key, Query &&query) {
+    if (find(value, key)) {
+      return Status::kSuccess;
+    }
+
+    Status status = query(value);
+    if (status == Status::kSuccess) {
+      insert(key, value);
+    }
+    return status;
+  }
+
+  bool find(int &value, KernelQueryKey const &key) const {
+    size_t mask = kKernelQueryCapacity - 1;
+    size_t index = size_t(key.hash()) & mask;
+
+    for (size_t probe = 0; probe < kKernelQueryCapacity; ++probe) {
+      KernelEntry const &entry = kernel_entries_[(index + probe) & mask];
+      int state = entry.state.load(std::memory_order_acquire);
+      if (state == kEmpty) {
+        return false;
+      }
+      // An entry being written is treated as a miss rather than waited for
+      if (state == kReady && entry.key == key) {
+        value = entry.value;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Inserts an entry. Returns false if the key is already present or the cache is full.
+  bool insert(KernelQueryKey const &key, int value) {
+    size_t mask = kKernelQueryCapacity - 1;
+    size_t index = size_t(key.hash()) & mask;
+
+    for (size_t probe = 0; probe < kKernelQueryCapacity; ++probe) {
+      KernelEntry &entry = kernel_entries_[(index + probe) & mask];
+
+      int state = entry.state.load(std::memory_order_acquire);
+      if (state == kEmpty) {
+        if (entry.state.compare_exchange_strong(state, kWriting, std::memory_order_acquire)) {
+          entry.key = key;
+          entry.value = value;
+          entry.state.store(kReady, std::memory_order_release);
+          kernel_entry_count_.fetch_add(1, std::memory_order_relaxed);
+          return true;
+        }
+      }
+      // Another thread claimed this entry; wait for its key to compare against
+      while (state == kWriting) {
+        std::this_thread::yield();
+        state = entry.state.load(std::memory_order_acquire);
+      }
+      if (entry.key == key) {
+        return false;
+      }
+    }
+    return false;
+  }
+
+  /// Calls `func(key, value)` for each cached kernel property
+  template <typename Func>
+  void for_each_kernel_query(Func &&func) const {
+    for (size_t i = 0; i < kKernelQueryCapacity; ++i) {
+      KernelEntry const &entry = kernel_entries_[i];
+      if (entry.state.load(std::memory_order_acquire) == kReady) {
+        func(entry.key, entry.value);
+      }
+    }
+  }
+
+  size_t kernel_query_count() const {
+    return kernel_entry_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Removes all entries. Must not be called concurrently with other members.
+  void clear() {
+    for (int device = 0; device < kMaxDevices; ++device) {
+      for (int attribute = 0; attribute < kAttributeCount; ++attribute) {
+        attributes_[device][attribute].store(-1, std::memory_order_relaxed);
+      }
+    }
+    for (size_t i = 0; i < kKernelQueryCapacity; ++i) {
+      kernel_entries_[i].state.store(kEmpty, std::memory_order_relaxed);
+    }
+    kernel_entry_count_.store(0, std::memory_order_release);
+  }
+
+  //
+  // Queries used by the device layers
+  //
+
+  /// Returns the current device's ordinal, or -1 on error
+  static int current_device() {
+    int device = -1;
+    cudaError_t result = cudaGetDevice(&device);
+    if (result != cudaSuccess) {
+      CUTLASS_TRACE_HOST("  cudaGetDevice() returned error " << cudaGetErrorString(result));
+      return -1;
+    }
+    return device;
+  }
+
+  /// SM count of `device`, or 0 on error
+  static int multiprocessor_count(int device) {
+    int value = 0;
+    if (instance().attribute(value, device, DeviceAttribute::kMultiProcessorCount) != Status::kSuccess) {
+      return 0;
+    }
+    return value;
+  }
+
+  /// Sets cudaFuncAttributeMaxDynamicSharedMemorySize of `kernel_ptr` on the current device unless
+  /// the process already did so with the same size
+  template <typename Kernel, typename KernelPtr>
+  static Status set_max_dynamic_shared_memory(int device, KernelPtr kernel_ptr, int smem_size) {
+    KernelQueryKey key;
+    key.device = device;
+    key.query = KernelQuery::kDynamicSharedMemoryLimit;
+    key.kernel = kernel_id<Kernel>();
+    key.smem_size = smem_size;
+
+    int value = 0;
+    return instance().kernel_query(value, key, [&](int &limit) {
+      cudaError_t result = cudaFuncSetAttribute(
+        kernel_ptr, cudaFuncAttributeMaxDynamicSharedMemorySize, smem_size);
+      if (result != cudaSuccess) {
+        result = cudaGetLastError(); // to clear the error bit
+        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+      limit = smem_size;
+      return Status::kSuccess;
+    });
+  }
+
+  /// Maximum resident blocks per SM of `kernel_ptr` on `device`, or -1 on error. The dynamic shared
+  /// memory limit is raised first if `smem_size` requires it.
+  template <typename Kernel, typename KernelPtr>
+  static int max_active_blocks(
+    int device,
+    KernelPtr kernel_ptr,
+    int threads,
+    int smem_size,
+    unsigned flags = cudaOccupancyDefault) {
+    KernelQueryKey key;
+    key.device = device;
+    key.query = KernelQuery::kMaxActiveBlocks;
+    key.kernel = kernel_id<Kernel>();
+    key.threads = threads;
+    key.smem_size = smem_size;
+    key.flags = flags;
+
+    int value = -1;
+    Status status = instance().kernel_query(value, key, [&](int &max_active_blocks) {
+      if (smem_size >= (48 << 10)) {
+        Status status = set_max_dynamic_shared_memory<Kernel>(device, kernel_ptr, smem_size);
+        if (status != Status::kSuccess) {
+          return status;
+        }
+      }
+      cudaError_t result = cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags(
+        &max_active_blocks, kernel_ptr, threads, size_t(smem_size), flags);
+      if (result != cudaSuccess) {
+        result = cudaGetLastError(); // to clear the error bit
+        CUTLASS_TRACE_HOST("  cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags() returned error "
+          << cudaGetErrorString(result));
+        return Status::kErrorInternal;
+      }
+      return Status::kSuccess;
+    });
+
+    return status == Status::kSuccess ? value : -1;
+  }
+
+private:
+
+  static constexpr int kEmpty = 0;
+  static constexpr int kWriting = 1;
+  static constexpr int kReady = 2;
+
+  struct KernelEntry {
+    std::atomic<int> state{kEmpty};
+    KernelQueryKey key;
+    int value = 0;
+  };
+
+  static_assert((kKernelQueryCapacity & (kKernelQueryCapacity - 1)) == 0,
+    "kKernelQueryCapacity must be a power of two");
+
+  static bool valid(int device, DeviceAttribute attribute) {
+    return device >= 0 && device < kMaxDevices && int(attribute) >= 0 && int(attribute) < kAttributeCount;
+  }
+
+  template <typename T>
+  static char const *type_name() {
+#if defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+  }
+
+  std::atomic<int> attributes_[kMaxDevices][kAttributeCount];
+  std::unique_ptr<KernelEntry[]> kernel_entries_;
+  std::atomic<size_t> kernel_entry_count_{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+#endif // !defined(__CUDACC_RTC__)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,7 +84,7 @@ public:
   using Element = Element_;
 
   using Layout = layout::RowMajor;
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   using Index = typename Layout::Index;
@@ -811,7 +811,7 @@ public:
   using Element = Element_;
 
   using Layout = layout::ColumnMajorInterleaved<InterleavedN>;
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   using Index = typename Layout::Index;
@@ -1085,7 +1085,7 @@ public:
   using Element = Element_;
 
   using Layout = layout::TensorNCxHWx<InterleavedN>;
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   using Index = typename Layout::Index;
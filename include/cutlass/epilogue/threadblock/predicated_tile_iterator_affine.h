@@ -83,8 +83,8 @@ public:
   using Element = Element_;
 
   using Layout = layout::AffineRankN<Rank>;
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   using Index = typename Layout::Index;
@@ -92,7 +92,7 @@ public:
   using Stride = typename Layout::Stride;
   static int const kStrideRank = Layout::kStrideRank;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   using MappedLayout = layout::RowMajor;
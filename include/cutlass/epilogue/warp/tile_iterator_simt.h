@@ -77,7 +77,7 @@ public:
   using Element = Element_;
   using Layout = layout::RowMajor;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -266,7 +266,7 @@ class TileIteratorSimtDirectConv {
   using Element = Element_;
   using Layout = layout::RowMajor;
 
-  using TensorRef = TensorRef<Element, Layout>;  ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;  ///< Tensor Reference object
   using TensorCoord = MatrixCoord;               ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -426,7 +426,7 @@ class TileIteratorSimtDirect2dConv {
   using Layout = layout::RowMajor;
   using MmaSimtPolicy = MmaSimtPolicy_;
 
-  using TensorRef = TensorRef<Element, Layout>;  ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;  ///< Tensor Reference object
   using TensorCoord = MatrixCoord;               ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -551,7 +551,7 @@ public:
   using Element = Element_;
   using Layout = Layout_;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
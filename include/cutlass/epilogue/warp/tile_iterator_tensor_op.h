@@ -75,7 +75,7 @@ public:
   using Layout = layout::RowMajor;
 
   using TensorLayout = Layout;
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -254,7 +254,7 @@ public:
   using Layout = layout::ColumnMajorInterleaved<InterleavedK>;
   using TensorLayout = Layout;                ///< shared memory tensor ref layout
 
-  using TensorRef = TensorRef<Element, TensorLayout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, TensorLayout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -450,7 +450,7 @@ public:
   using Element = Element_;
   using Layout = Layout_;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
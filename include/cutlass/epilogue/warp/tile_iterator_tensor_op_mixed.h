@@ -76,7 +76,7 @@ public:
   using Layout = layout::RowMajor;
   static int const kOutputElementCount = OutputElementCount;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -323,7 +323,7 @@ public:
   using Layout = layout::RowMajor;
   static int const kOutputElementCount = 16;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -524,7 +524,7 @@ public:
   using Layout = layout::RowMajor;
   static int const kOutputElementCount = 8;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -713,7 +713,7 @@ public:
   using Layout = layout::RowMajor;
   static int const kOutputElementCount = 16;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -908,7 +908,7 @@ public:
   using Layout = layout::RowMajor;
   static int const kOutputElementCount = 8;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
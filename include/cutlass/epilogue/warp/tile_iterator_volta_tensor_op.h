@@ -72,7 +72,7 @@ public:
   using Element = half_t;
   using Layout = layout::RowMajor;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
@@ -263,7 +263,7 @@ public:
   using Element = float;
   using Layout = layout::RowMajor;
 
-  using TensorRef = TensorRef<Element, Layout>;         ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;         ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                      ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
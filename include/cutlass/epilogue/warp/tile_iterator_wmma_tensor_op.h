@@ -80,7 +80,7 @@ public:
   //
   using WmmaDataType = typename OperatorFragment::element_type;
   using Element = typename cutlass::arch::WmmaToCutlassDataType<WmmaDataType>::Type; ///< Data Type of element stored in nvcuda::wmma::frament         
-  using TensorRef = TensorRef<Element, Layout>;                                      ///< Tensor Reference object
+  using TensorRef = cutlass::TensorRef<Element, Layout>;                                      ///< Tensor Reference object
   using TensorCoord = MatrixCoord;                                                   ///< Logical coordinate in referenced tensor
   using Index = typename TensorRef::Index;
   using LongIndex = typename TensorRef::LongIndex;
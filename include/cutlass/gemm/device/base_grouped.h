@@ -43,6 +43,7 @@
 #include "cutlass/numeric_types.h"
 #include "cutlass/arch/arch.h"
 #include "cutlass/device_kernel.h"
+#include "cutlass/device_properties_cache.hpp"
 
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/threadblock/threadblock_swizzle.h"
@@ -217,35 +218,17 @@ public:
 
     CUTLASS_TRACE_HOST("  smem_size: " << smem_size << " bytes");
 
-    cudaError_t result;
-    if (smem_size > (48 << 10)) {
-      result = cudaFuncSetAttribute(Kernel<BaseKernel>,
-                                    cudaFuncAttributeMaxDynamicSharedMemorySize,
-                                    smem_size);
-
-      if (result != cudaSuccess) {
-        // Call cudaGetLastError() to clear the error bit
-        result = cudaGetLastError();
-        CUTLASS_TRACE_HOST(
-          "  cudaFuncSetAttribute() returned error "
-          << cudaGetErrorString(result));
-        return -1;
-      }
+    // Cached for the process. The dynamic smem limit is raised before the first occupancy query.
+    int device = DevicePropertiesCache::current_device();
+    if (device < 0) {
+      return -1;
     }
-
-    int max_active_blocks = -1;
-    result = cudaOccupancyMaxActiveBlocksPerMultiprocessor(
-        &max_active_blocks,
+    int max_active_blocks = DevicePropertiesCache::max_active_blocks<BaseKernel>(
+        device,
         Kernel<BaseKernel>,
         BaseKernel::kThreadCount,
         smem_size);
-
-    if (result != cudaSuccess) {
-      // Call cudaGetLastError() to clear the error bit
-      result = cudaGetLastError();
-      CUTLASS_TRACE_HOST(
-        "  cudaOccupancyMaxActiveBlocksPerMultiprocessor() returned error "
-        << cudaGetErrorString(result));
+    if (max_active_blocks < 0) {
       return -1;
     }
 
@@ -290,23 +273,13 @@ public:
                         int available_sm_count=-1) {
     // Determine the number of blocks that would be launched to fill up a single
     // wave on the GPU with each SM having maximum occupancy.
-    int device_idx;
-    cudaError_t result = cudaGetDevice(&device_idx);
-    if (result != cudaSuccess) {
-      // Call cudaGetLastError() to clear the error bit
-      result = cudaGetLastError();
-      CUTLASS_TRACE_HOST("  cudaGetDevice() returned error "
-          << cudaGetErrorString(result));
+    int device_idx = DevicePropertiesCache::current_device();
+    if (device_idx < 0) {
       return 0;
     }
 
-    int multiprocessor_count;
-    result = cudaDeviceGetAttribute(&multiprocessor_count,
-      cudaDevAttrMultiProcessorCount, device_idx);
-    if (result != cudaSuccess) {
-      CUTLASS_TRACE_HOST(
-        "  cudaDeviceGetAttribute() returned error "
-        << cudaGetErrorString(result));
+    int multiprocessor_count = DevicePropertiesCache::multiprocessor_count(device_idx);
+    if (multiprocessor_count <= 0) {
       return 0;
     }
 
@@ -45,6 +45,7 @@
 #include "cutlass/arch/arch.h"
 #include "cutlass/device_kernel.h"
 #include "cutlass/cuda_host_adapter.hpp"
+#include "cutlass/device_properties_cache.hpp"
 
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/gemm/kernel/gemm_universal.h"
@@ -109,82 +110,47 @@ public:
 
 protected:
 
-  //
-  // Device properties (uniform across all instances of the current thread)
-  //
-
-  // Device ordinal
-  CUTLASS_THREAD_LOCAL static int device_ordinal_;
-
-  /// Device SM count
-  CUTLASS_THREAD_LOCAL static int device_sms_;
-
-  /// Kernel SM occupancy (in thread blocks)
-  CUTLASS_THREAD_LOCAL static int sm_occupancy_;
-
-protected:
-
-  /// Initialize static thread-local members for the thread's current device,
-  /// if necessary.
-  static Status init_device_props()
+  /// Queries the current device's SM count and the kernel's SM occupancy, and raises the kernel's
+  /// dynamic shared memory limit if necessary. Results are shared by all threads and kernels of
+  /// the process through the DevicePropertiesCache.
+  static Status init_device_props(int &device_sms, int &sm_occupancy)
   {
     CUTLASS_TRACE_HOST("GemmUniversalBase::init_device_props()");
 
-    cudaError_t cudart_result;
-
-    // Get current device ordinal
-    int current_ordinal;
-    cudart_result = cudaGetDevice(&current_ordinal);
-    if (cudart_result != cudaSuccess) {
-      CUTLASS_TRACE_HOST("  cudaGetDevice() returned error " << cudaGetErrorString(cudart_result));
+    int current_ordinal = DevicePropertiesCache::current_device();
+    if (current_ordinal < 0) {
       return Status::kErrorInternal;
     }
 
-    // Done if matches the current static member
-    if (current_ordinal == device_ordinal_) {
-      // Already initialized
-      return Status::kSuccess;
-    }
-
-    // Update SM count member
-    cudart_result = cudaDeviceGetAttribute (&device_sms_, cudaDevAttrMultiProcessorCount, current_ordinal);
-    if (cudart_result != cudaSuccess) {
-      CUTLASS_TRACE_HOST("  cudaDeviceGetAttribute() returned error " << cudaGetErrorString(cudart_result));
+    device_sms = DevicePropertiesCache::multiprocessor_count(current_ordinal);
+    if (device_sms <= 0) {
       return Status::kErrorInternal;
     }
 
     // If requires more than 48KB: configure for extended, dynamic shared memory
     if constexpr (kSharedStorageSize >= (48 << 10))
     {
-      cudart_result = cudaFuncSetAttribute(
-        Kernel2<GemmKernel>,
-        cudaFuncAttributeMaxDynamicSharedMemorySize,
-        kSharedStorageSize);
-      if (cudart_result != cudaSuccess) {
-        CUTLASS_TRACE_HOST("  cudaFuncSetAttribute() returned error " << cudaGetErrorString(cudart_result));
-        return Status::kErrorInternal;
+      Status status = DevicePropertiesCache::set_max_dynamic_shared_memory<GemmKernel>(
+        current_ordinal, Kernel2<GemmKernel>, int(kSharedStorageSize));
+      if (status != Status::kSuccess) {
+        return status;
       }
     }
 
-    // Update SM occupancy member
-    cudart_result = cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags(
-      &sm_occupancy_,
+    sm_occupancy = DevicePropertiesCache::max_active_blocks<GemmKernel>(
+      current_ordinal,
       Kernel2<GemmKernel>,
       GemmKernel::kThreadCount,
-      kSharedStorageSize,
+      int(kSharedStorageSize),
       cudaOccupancyDisableCachingOverride);
-    if (cudart_result != cudaSuccess) {
-      CUTLASS_TRACE_HOST("  cudaOccupancyMaxActiveBlocksPerMultiprocessorWithFlags() returned error " << cudaGetErrorString(cudart_result));
+    if (sm_occupancy < 0) {
       return Status::kErrorInternal;
     }
 
-    // Update device ordinal member on success
-    device_ordinal_ = current_ordinal;
-
     CUTLASS_TRACE_HOST("  "
-      "device_ordinal: (" << device_ordinal_ << "), "
-      "device_sms: (" << device_sms_ << "), "
-      "sm_occupancy: (" << sm_occupancy_ << ") "
+      "device_ordinal: (" << current_ordinal << "), "
+      "device_sms: (" << device_sms << "), "
+      "sm_occupancy: (" << sm_occupancy << ") "
       "smem_size: (" << kSharedStorageSize << ") "
       "GemmKernel::kThreadCount: (" << GemmKernel::kThreadCount << ")");
 
@@ -237,20 +203,12 @@ protected:
     else {
       CUTLASS_ASSERT(cuda_adapter == nullptr);
 
-      // Initialize static device properties, if necessary
-      Status result = init_device_props();
+      // Query device properties through the process-wide cache
+      Status result = init_device_props(device_sms, sm_occupancy);
 
       if (result != Status::kSuccess) {
         return result;
       }
-
-      //
-      // Use thread-local static members for occupancy query initialized by call to
-      // `init_device_props()`
-      //
-
-      device_sms   = device_sms_;
-      sm_occupancy = sm_occupancy_;
     }
 
     // Initialize params member
@@ -377,15 +335,13 @@ public:
     }
     else {
       CUTLASS_ASSERT(cuda_adapter == nullptr);
-      // Initialize static device properties, if necessary
-      if (init_device_props() != Status::kSuccess) {
+      // Query device properties through the process-wide cache
+      if (init_device_props(device_sms, sm_occupancy) != Status::kSuccess) {
         return -1;
       }
-
-      sm_occupancy = sm_occupancy_;
     }
 
-    CUTLASS_TRACE_HOST("  max_active_blocks: " << sm_occupancy_);
+    CUTLASS_TRACE_HOST("  max_active_blocks: " << sm_occupancy);
     return sm_occupancy;
   }
 
@@ -496,24 +452,6 @@ public:
 };
 
 
-/////////////////////////////////////////////////////////////////////////////////////////////////
-/// Static initializers
-/////////////////////////////////////////////////////////////////////////////////////////////////
-
-/// Device ordinal
-template <typename GemmKernel_>
-CUTLASS_THREAD_LOCAL int GemmUniversalBase<GemmKernel_>::device_ordinal_ = -1;
-
-/// Device SM count
-template <typename GemmKernel_>
-CUTLASS_THREAD_LOCAL int GemmUniversalBase<GemmKernel_>::device_sms_ = -1;
-
-/// Kernel SM occupancy (in thread blocks)
-template <typename GemmKernel_>
-CUTLASS_THREAD_LOCAL int GemmUniversalBase<GemmKernel_>::sm_occupancy_ = -1;
-
-/////////////////////////////////////////////////////////////////////////////////////////////////
-
 } // namespace device
 } // namespace gemm
 } // namespace cutlass
@@ -87,7 +87,7 @@ public:
     );
   }
 
-  static CUTLASS_DEVICE
+  static CUTLASS_HOST_DEVICE
   cute::tuple<int32_t, int32_t>
   get_work_idx_m_and_n(
       uint64_t blk_per_grid_dim,
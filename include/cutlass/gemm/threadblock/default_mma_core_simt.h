@@ -227,7 +227,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 1>, ElementA_,
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -396,7 +396,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 1>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<kPaddingM, 0>,    // skew for A matrix to avoid SMEM bank conflicts
     MatrixShape<0, kPaddingN>,    // skew for B matrix to avoid SMEM bank conflicts
@@ -561,7 +561,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 1>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<kPaddingM, 0>,    // skew for A matrix to avoid SMEM bank conflicts
     MatrixShape<0, 0>,
@@ -726,7 +726,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 1>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, kPaddingN>, // skew for B matrix to avoid SMEM bank conflicts
@@ -1228,7 +1228,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 4>, int8_t,
     >;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -1391,7 +1391,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 4>, int8_t,
   static int const kPaddingN = detail::simt_transpose_padding(kWarpSize, Shape::kK, sizeof_bits<ElementB>::value);
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<kPaddingM, 0>,
     MatrixShape<0, kPaddingN>,
@@ -1550,7 +1550,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 4>, int8_t,
   static int const kPaddingN = detail::simt_transpose_padding(kWarpSize, Shape::kK, sizeof_bits<ElementB>::value);
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<kPaddingM, 0>,
     MatrixShape<0, 0>,
@@ -1710,7 +1710,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<1, 1, 4>, int8_t,
   static int const kPaddingN = detail::simt_transpose_padding(kWarpSize, Shape::kK, sizeof_bits<ElementB>::value);
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, kPaddingN>,
@@ -206,7 +206,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<8, 8, 4>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -359,7 +359,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<8, 8, 4>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -514,7 +514,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<8, 8, 4>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -669,7 +669,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, GemmShape<8, 8, 4>, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
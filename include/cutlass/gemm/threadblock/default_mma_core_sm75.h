@@ -203,7 +203,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -349,7 +349,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -500,7 +500,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -635,7 +635,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                        MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -762,7 +762,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, float,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -901,7 +901,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, float,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -1034,7 +1034,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, float,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -1153,7 +1153,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, float,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>, MatrixShape<0, 0>,
                               WarpCount::kK>;
 };
 
@@ -1304,7 +1304,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK, AccumulatorsInRowMajor>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                        MatrixShape<0, 0>, WarpCount::kK>;
 };
 
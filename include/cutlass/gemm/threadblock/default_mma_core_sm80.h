@@ -189,7 +189,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, double,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -305,7 +305,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, double,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -419,7 +419,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, double,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -537,7 +537,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, double,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1350,7 +1350,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1488,7 +1488,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1629,7 +1629,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1769,7 +1769,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1928,7 +1928,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
       ElementC, LayoutC, Operator, WarpCount::kK, AccumulatorsInRowMajor>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -2086,7 +2086,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
     >;         /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, Shape::kK / 32>,
@@ -2237,7 +2237,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
     >;         /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -2398,7 +2398,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
     >;         /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<Shape::kK / 32, 0>,
     MatrixShape<0, Shape::kK / 32>,
@@ -2555,7 +2555,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
     >;         /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<Shape::kK / 32, 0>,
     MatrixShape<0, 0>,
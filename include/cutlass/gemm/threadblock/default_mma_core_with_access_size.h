@@ -314,7 +314,7 @@ struct DefaultMmaCoreWithAccessSize<Shape_, WarpShape_, typename platform::enabl
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,
@@ -156,7 +156,7 @@ struct DefaultMmaWithReductionCore {
       ElementC, LayoutC, Operator, ReduceKForA_, WarpCount::kK>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
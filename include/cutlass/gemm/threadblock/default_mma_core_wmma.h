@@ -208,7 +208,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<kPaddingA, 0>,
     MatrixShape<0, kPaddingB>,
@@ -378,7 +378,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, kPaddingA>,
     MatrixShape<kPaddingB, 0>,
@@ -544,7 +544,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<0, kPaddingA>,
     MatrixShape<0, kPaddingB>,
@@ -696,7 +696,7 @@ struct DefaultMmaCore<Shape_, WarpShape_, InstructionShape_, ElementA_,
   >;
 
   /// Policy used to define MmaPipelined 
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaTensorOp,
     MatrixShape<kPaddingA, 0>,
     MatrixShape<kPaddingB, 0>,
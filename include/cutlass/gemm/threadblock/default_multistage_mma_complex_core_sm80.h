@@ -194,7 +194,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -324,7 +324,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -457,7 +457,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -589,7 +589,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -720,7 +720,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -850,7 +850,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -981,7 +981,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1112,7 +1112,7 @@ struct DefaultMultistageMmaComplexCore<
       Operator>::Type;
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<MmaTensorOp, MatrixShape<0, 0>,
                                         MatrixShape<0, 0>, WarpCount::kK>;
 };
 
@@ -1281,7 +1281,7 @@ struct DefaultMultistageMmaComplexCore<
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, Shape::kK / 32>,
@@ -1448,7 +1448,7 @@ struct DefaultMultistageMmaComplexCore<
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<0, 0>,
     MatrixShape<0, 0>,    // or Shape::kK / 32
@@ -1621,7 +1621,7 @@ struct DefaultMultistageMmaComplexCore<
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<Shape::kK / 32, 0>,
     MatrixShape<0, Shape::kK / 32>,
@@ -1791,7 +1791,7 @@ struct DefaultMultistageMmaComplexCore<
     >;            /// Used for partial specialization
 
   /// Policy used to define MmaPipelined
-  using MmaPolicy = MmaPolicy<
+  using MmaPolicy = cutlass::gemm::threadblock::MmaPolicy<
     MmaWarpSimt,
     MatrixShape<Shape::kK / 32, 0>,
     MatrixShape<0, 0>,    // or Shape::kK / 32
@@ -119,7 +119,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -396,7 +396,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -621,7 +621,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -838,7 +838,7 @@ class MmaTensorOpAccumulatorTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1165,7 +1165,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1450,7 +1450,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1676,7 +1676,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1912,7 +1912,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -2221,7 +2221,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
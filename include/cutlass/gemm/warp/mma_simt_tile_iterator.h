@@ -114,7 +114,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -324,7 +324,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -577,7 +577,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -787,7 +787,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1034,7 +1034,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1246,7 +1246,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1465,7 +1465,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1691,7 +1691,7 @@ public:
   using Policy = Policy_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
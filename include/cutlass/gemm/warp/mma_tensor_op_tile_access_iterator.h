@@ -115,7 +115,7 @@ class MmaTensorOpMultiplicandTileAccessIterator {
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -138,7 +138,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -536,7 +536,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -904,7 +904,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1308,7 +1308,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1711,7 +1711,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -1948,7 +1948,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -2186,7 +2186,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kPartitionsK = PartitionsK_;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -2750,7 +2750,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -2988,7 +2988,7 @@ class MmaTensorOpMultiplicandTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -3226,7 +3226,7 @@ class MmaTensorOpAccumulatorTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -3527,7 +3527,7 @@ class MmaTensorOpAccumulatorTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -3828,7 +3828,7 @@ class MmaTensorOpAccumulatorTileIterator<Shape_, Element_,
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -4132,7 +4132,7 @@ class MmaTensorOpAccumulatorTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -4421,7 +4421,7 @@ class MmaTensorOpAccumulatorTileIterator<
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -104,7 +104,7 @@ class SparseMmaTensorOpMetaTileIterator {
   static int const kSparse = 2;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
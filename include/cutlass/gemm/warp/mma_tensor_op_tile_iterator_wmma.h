@@ -128,7 +128,7 @@ class MmaTensorOpWmmaMultiplicandTileIterator<
   // Derived quantities
   //
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -376,7 +376,7 @@ class MmaTensorOpWmmaMultiplicandTileIterator<
   //
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -634,7 +634,7 @@ class MmaTensorOpWmmaAccumulatorTileIterator
   // Derived quantities
   //
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -124,7 +124,7 @@ class ScaleBiasTileIterator<Shape_, Element_, cutlass::layout::PitchLinear,
   static int const kElementsPerAccess = 128 / sizeof_bits<Element>::value;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
@@ -385,7 +385,7 @@ class ScaleBiasTileIterator<Shape_, Element_, cutlass::layout::RowMajor,
   static int const kThreads = 32;
 
   /// TensorRef type for loading element from a tensor
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
 
   /// Index type
   using Index = typename TensorRef::Index;
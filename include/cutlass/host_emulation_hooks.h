@@ -0,0 +1,67 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Interface between CUTLASS headers and a host emulation runtime.
+
+    With CUTLASS_HOST_EMULATION defined, code paths that read CUDA built-in variables or use warp
+    intrinsics outside of __CUDA_ARCH__ call the functions declared here. They are defined by the
+    runtime, cutlass/util/host_emulation.h, which must be included by every translation unit that
+    defines CUTLASS_HOST_EMULATION.
+*/
+
+#pragma once
+
+#if defined(CUTLASS_HOST_EMULATION)
+
+#include <vector_types.h>
+
+namespace cutlass {
+namespace emulation {
+
+/// Returns true if the calling host thread is executing an emulated CUDA thread
+inline bool in_kernel();
+
+/// threadIdx of the calling emulated thread
+inline uint3 thread_idx();
+
+/// blockIdx of the calling emulated thread
+inline uint3 block_idx();
+
+/// Lane of the calling emulated thread within its warp
+inline int lane_idx();
+
+/// Returns `value` of `source_lane` to every thread of the calling warp
+inline int warp_broadcast(int value, int source_lane);
+
+} // namespace emulation
+} // namespace cutlass
+
+#endif // defined(CUTLASS_HOST_EMULATION)
@@ -34,6 +34,7 @@
 #if !defined(__CUDACC_RTC__)
 #include "cuda_runtime.h"
 #include "cutlass/cluster_launch.hpp"
+#include "cutlass/device_properties_cache.hpp"
 #include "cutlass/trace.h"
 #endif
 #include <cute/int_tuple.hpp>
@@ -68,16 +69,8 @@ struct KernelHardwareInfo {
         << cudaGetErrorString(result));
       return 0;
     }
-    int multiprocessor_count;
-    result = cudaDeviceGetAttribute(&multiprocessor_count,
-      cudaDevAttrMultiProcessorCount, device_id);
-    if (result != cudaSuccess) {
-      CUTLASS_TRACE_HOST(
-        "  cudaDeviceGetAttribute() returned error "
-        << cudaGetErrorString(result));
-      return 0;
-    }
-    return multiprocessor_count;
+    // Cached for the process
+    return DevicePropertiesCache::multiprocessor_count(device_id);
   }
 
   // Query maximum number of active clusters that could co-exist on the target device
@@ -117,7 +110,30 @@ struct KernelHardwareInfo {
                       cute::size<2>(typename Kernel::ClusterShape{}));
     uint32_t threads_per_block = Kernel::MaxThreadsPerBlock;
     void const* kernel_ptr = (void*)(device_kernel<Kernel>);
-    return query_device_max_active_clusters(cluster_dims, threads_per_block, kernel_ptr);
+
+    int device_id = DevicePropertiesCache::current_device();
+    if (device_id < 0) {
+      return 0;
+    }
+
+    // Cached for the process
+    KernelQueryKey key;
+    key.device = device_id;
+    key.query = KernelQuery::kMaxActiveClusters;
+    key.kernel = DevicePropertiesCache::kernel_id<Kernel>();
+    key.threads = int(threads_per_block);
+    key.cluster_x = int(cluster_dims.x);
+    key.cluster_y = int(cluster_dims.y);
+    key.cluster_z = int(cluster_dims.z);
+
+    int max_active_clusters = 0;
+    Status status = DevicePropertiesCache::instance().kernel_query(max_active_clusters, key,
+      [&](int &value) {
+        value = query_device_max_active_clusters(cluster_dims, threads_per_block, kernel_ptr);
+        // Failed queries return 0 and are not cached
+        return value > 0 ? Status::kSuccess : Status::kErrorInternal;
+      });
+    return status == Status::kSuccess ? max_active_clusters : 0;
   }
 
   template <typename Kernel>
@@ -92,13 +92,13 @@ public:
   using Stride = typename Layout::Stride;
 
   /// TensorRef to matrix object
-  using TensorRef = TensorRef<Element, kRank, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, kRank, Layout>;
 
   /// TensorRef to constant matrix object
   using ConstTensorRef = typename TensorRef::ConstTensorRef;
 
   /// TensorRef to matrix object
-  using TensorView = TensorView<Element, kRank, Layout>;
+  using TensorView = cutlass::TensorView<Element, kRank, Layout>;
 
   /// TensorRef to constant matrix object
   using ConstTensorView = typename TensorView::ConstTensorView;
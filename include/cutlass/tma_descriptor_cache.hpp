@@ -0,0 +1,467 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Host-side cache of encoded TMA descriptors.
+
+    Encoding a TMA descriptor validates every parameter in the driver, and 3.x kernels re-encode all of
+    their descriptors each time arguments are lowered to params. Between calls that only change operand
+    pointers, the descriptors differ solely in their global address. The cache keys descriptors on every
+    other encoding parameter and derives new descriptors from a cached one with
+    cuTensorMapReplaceAddress.
+
+    The TMA descriptor constructors in CuTe consult the cache installed on the calling thread by a
+    TmaDescriptorCache::Scope, and encode descriptors directly otherwise.
+*/
+
+#pragma once
+
+#include "cutlass/cuda_host_adapter.hpp"
+
+#if !defined(__CUDACC_RTC__)
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Counters of descriptor requests served by a TmaDescriptorCache
+struct TmaDescriptorCacheStatistics {
+
+  /// Descriptors encoded from scratch
+  uint64_t encodes = 0;
+
+  /// Descriptors copied from the cache unchanged
+  uint64_t hits = 0;
+
+  /// Descriptors copied from the cache with a replaced global address
+  uint64_t address_replacements = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Least-recently-used cache of encoded TMA descriptors. Thread-safe.
+class TmaDescriptorCache {
+public:
+
+  static constexpr size_t kDefaultCapacity = 1024;
+
+  /// Installs a cache for descriptors encoded on the calling thread for the lifetime of the scope.
+  /// Scopes nest; a null cache disables caching within the scope.
+  class Scope {
+  public:
+
+    explicit Scope(TmaDescriptorCache *cache): previous_(active()) {
+      active() = cache;
+    }
+
+    ~Scope() {
+      active() = previous_;
+    }
+
+    Scope(Scope const &) = delete;
+    Scope &operator=(Scope const &) = delete;
+
+  private:
+
+    TmaDescriptorCache *previous_;
+  };
+
+  /// Descriptors are encoded through `cuda_adapter` if it is not null, and the driver otherwise
+  explicit TmaDescriptorCache(
+    size_t capacity = kDefaultCapacity,
+    CudaHostAdapter const *cuda_adapter = nullptr):
+    capacity_(capacity ? capacity : 1), cuda_adapter_(cuda_adapter) { }
+
+  TmaDescriptorCache(TmaDescriptorCache const &) = delete;
+  TmaDescriptorCache &operator=(TmaDescriptorCache const &) = delete;
+
+  /// Cache installed on the calling thread, or null
+  static TmaDescriptorCache *&active() {
+    thread_local TmaDescriptorCache *cache = nullptr;
+    return cache;
+  }
+
+  size_t capacity() const {
+    return capacity_;
+  }
+
+  size_t size() const {
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+#else
+    return 0;
+#endif
+  }
+
+  void clear() {
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+#endif
+  }
+
+  TmaDescriptorCacheStatistics statistics() const {
+    TmaDescriptorCacheStatistics stats;
+    stats.encodes = encodes_.load(std::memory_order_relaxed);
+    stats.hits = hits_.load(std::memory_order_relaxed);
+    stats.address_replacements = address_replacements_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  /// Equivalent to cuTensorMapEncodeTiled()
+  CUresult encode_tiled(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const cuuint32_t* boxDim,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) {
+
+    if (tensorRank == 0 || tensorRank > kMaxRank) {
+      return encode_tiled_uncached(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    }
+
+    Key key;
+    key.push(0);
+    key.push(tensorDataType);
+    key.push(tensorRank);
+    key.push(interleave);
+    key.push(swizzle);
+    key.push(l2Promotion);
+    key.push(oobFill);
+    for (cuuint32_t i = 0; i < tensorRank; ++i) {
+      key.push(globalDim[i]);
+      key.push(boxDim[i]);
+      key.push(elementStrides[i]);
+    }
+    for (cuuint32_t i = 0; i + 1 < tensorRank; ++i) {
+      key.push(globalStrides[i]);
+    }
+
+    return lookup_or_encode(key, tensorMap, globalAddress, [&]() {
+      return encode_tiled_uncached(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    });
+  }
+
+  /// Equivalent to cuTensorMapEncodeIm2col()
+  CUresult encode_im2col(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const int* pixelBoxLowerCorner,
+    const int* pixelBoxUpperCorner,
+    cuuint32_t channelsPerPixel,
+    cuuint32_t pixelsPerColumn,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) {
+
+    if (tensorRank < 3 || tensorRank > kMaxRank) {
+      return encode_im2col_uncached(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn,
+        elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    }
+
+    Key key;
+    key.push(1);
+    key.push(tensorDataType);
+    key.push(tensorRank);
+    key.push(interleave);
+    key.push(swizzle);
+    key.push(l2Promotion);
+    key.push(oobFill);
+    key.push(channelsPerPixel);
+    key.push(pixelsPerColumn);
+    for (cuuint32_t i = 0; i < tensorRank; ++i) {
+      key.push(globalDim[i]);
+      key.push(elementStrides[i]);
+    }
+    for (cuuint32_t i = 0; i + 1 < tensorRank; ++i) {
+      key.push(globalStrides[i]);
+    }
+    // Corners cover the spatial modes only
+    for (cuuint32_t i = 0; i + 2 < tensorRank; ++i) {
+      key.push(uint32_t(pixelBoxLowerCorner[i]));
+      key.push(uint32_t(pixelBoxUpperCorner[i]));
+    }
+
+    return lookup_or_encode(key, tensorMap, globalAddress, [&]() {
+      return encode_im2col_uncached(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn,
+        elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    });
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+private:
+
+  static constexpr uint32_t kMaxRank = 5;
+  static constexpr uint32_t kMaxKeyWords = 9 + 4 * kMaxRank + 2 * (kMaxRank - 2);
+
+  /// Every encoding parameter except the global address
+  struct Key {
+    std::array<uint64_t, kMaxKeyWords> words{};
+    uint32_t count = 0;
+
+    void push(uint64_t word) {
+      words[count++] = word;
+    }
+
+    bool operator==(Key const &rhs) const {
+      return count == rhs.count &&
+        std::memcmp(words.data(), rhs.words.data(), count * sizeof(uint64_t)) == 0;
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(Key const &key) const {
+      // FNV-1a over the key words
+      uint64_t hash = 14695981039346656037ull;
+      for (uint32_t i = 0; i < key.count; ++i) {
+        hash = (hash ^ key.words[i]) * 1099511628211ull;
+      }
+      return size_t(hash);
+    }
+  };
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  struct Entry {
+    CUtensorMap descriptor;
+    void *address;
+    std::list<Key>::iterator lru;
+  };
+
+  template <class Encode>
+  CUresult lookup_or_encode(Key const &key, CUtensorMap *tensorMap, void *globalAddress, Encode &&encode) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru);
+        *tensorMap = it->second.descriptor;
+        if (it->second.address == globalAddress) {
+          hits_.fetch_add(1, std::memory_order_relaxed);
+          return CUDA_SUCCESS;
+        }
+        CUresult result = replace_address(tensorMap, globalAddress);
+        if (result == CUDA_SUCCESS) {
+          // Remember the latest address so that repeated calls with it are plain copies
+          it->second.descriptor = *tensorMap;
+          it->second.address = globalAddress;
+          address_replacements_.fetch_add(1, std::memory_order_relaxed);
+        }
+        return result;
+      }
+    }
+
+    // Encode outside the lock, as validation in the driver is comparatively slow
+    CUresult result = encode();
+    if (result != CUDA_SUCCESS) {
+      return result;
+    }
+    encodes_.fetch_add(1, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto inserted = entries_.emplace(key, Entry{*tensorMap, globalAddress, {}});
+    if (inserted.second) {
+      lru_.push_front(key);
+      inserted.first->second.lru = lru_.begin();
+      if (entries_.size() > capacity_) {
+        entries_.erase(lru_.back());
+        lru_.pop_back();
+      }
+    }
+    return CUDA_SUCCESS;
+  }
+
+  CUresult replace_address(CUtensorMap *tensorMap, void *globalAddress) const {
+    if (cuda_adapter_) {
+      return cuda_adapter_->tensorMapReplaceAddress(tensorMap, globalAddress);
+    }
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapReplaceAddress)(tensorMap, globalAddress);
+  }
+
+  CUresult encode_tiled_uncached(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const cuuint32_t* boxDim,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) const {
+
+    if (cuda_adapter_) {
+      return cuda_adapter_->tensorMapEncodeTiled(tensorMap, tensorDataType, tensorRank, globalAddress,
+        globalDim, globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    }
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(tensorMap, tensorDataType, tensorRank,
+      globalAddress, globalDim, globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion,
+      oobFill);
+  }
+
+  CUresult encode_im2col_uncached(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const int* pixelBoxLowerCorner,
+    const int* pixelBoxUpperCorner,
+    cuuint32_t channelsPerPixel,
+    cuuint32_t pixelsPerColumn,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) const {
+
+    if (cuda_adapter_) {
+      return cuda_adapter_->tensorMapEncodeIm2col(tensorMap, tensorDataType, tensorRank, globalAddress,
+        globalDim, globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel,
+        pixelsPerColumn, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    }
+    return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeIm2col)(tensorMap, tensorDataType, tensorRank,
+      globalAddress, globalDim, globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel,
+      pixelsPerColumn, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+  }
+
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+  std::list<Key> lru_;
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  size_t capacity_;
+  CudaHostAdapter const *cuda_adapter_;
+  mutable std::mutex mutex_;
+
+  std::atomic<uint64_t> encodes_{0};
+  std::atomic<uint64_t> hits_{0};
+  std::atomic<uint64_t> address_replacements_{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/// Encodes a tiled TMA descriptor through the cache active on the calling thread, if any
+inline CUresult tma_descriptor_encode_tiled(
+  CUtensorMap* tensorMap,
+  CUtensorMapDataType tensorDataType,
+  cuuint32_t tensorRank,
+  void* globalAddress,
+  const cuuint64_t* globalDim,
+  const cuuint64_t* globalStrides,
+  const cuuint32_t* boxDim,
+  const cuuint32_t* elementStrides,
+  CUtensorMapInterleave interleave,
+  CUtensorMapSwizzle swizzle,
+  CUtensorMapL2promotion l2Promotion,
+  CUtensorMapFloatOOBfill oobFill) {
+
+  if (TmaDescriptorCache *cache = TmaDescriptorCache::active()) {
+    return cache->encode_tiled(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+      globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+  }
+  return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeTiled)(tensorMap, tensorDataType, tensorRank,
+    globalAddress, globalDim, globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion,
+    oobFill);
+}
+
+/// Encodes an im2col TMA descriptor through the cache active on the calling thread, if any
+inline CUresult tma_descriptor_encode_im2col(
+  CUtensorMap* tensorMap,
+  CUtensorMapDataType tensorDataType,
+  cuuint32_t tensorRank,
+  void* globalAddress,
+  const cuuint64_t* globalDim,
+  const cuuint64_t* globalStrides,
+  const int* pixelBoxLowerCorner,
+  const int* pixelBoxUpperCorner,
+  cuuint32_t channelsPerPixel,
+  cuuint32_t pixelsPerColumn,
+  const cuuint32_t* elementStrides,
+  CUtensorMapInterleave interleave,
+  CUtensorMapSwizzle swizzle,
+  CUtensorMapL2promotion l2Promotion,
+  CUtensorMapFloatOOBfill oobFill) {
+
+  if (TmaDescriptorCache *cache = TmaDescriptorCache::active()) {
+    return cache->encode_im2col(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+      globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn,
+      elementStrides, interleave, swizzle, l2Promotion, oobFill);
+  }
+  return CUTLASS_CUDA_DRIVER_WRAPPER_CALL(cuTensorMapEncodeIm2col)(tensorMap, tensorDataType, tensorRank,
+    globalAddress, globalDim, globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel,
+    pixelsPerColumn, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+}
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+#endif // !defined(__CUDACC_RTC__)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,8 +84,8 @@ class EllPredicatedTileAccessIterator<Shape_, Element_, layout::PitchLinear,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -594,8 +594,8 @@ class EllPredicatedTileAccessIterator<Shape_, Element_, layout::ColumnMajor,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -786,8 +786,8 @@ class EllPredicatedTileAccessIterator<Shape_, Element_, layout::RowMajor,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -982,8 +982,8 @@ class EllPredicatedTileAccessIterator<Shape_, Element_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -1177,8 +1177,8 @@ class EllPredicatedTileAccessIterator<Shape_, Element_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -163,8 +163,8 @@ class EllPredicatedTileIterator<Shape_, Element_, layout::PitchLinear, AdvanceRa
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -490,8 +490,8 @@ public:
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -718,8 +718,8 @@ public:
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -946,8 +946,8 @@ class EllPredicatedTileIterator<Shape_, Element_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -1148,8 +1148,8 @@ class EllPredicatedTileIterator<Shape_, Element_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
-  using TensorView = TensorView<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
+  using TensorView = cutlass::TensorView<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using Pointer = Element *;
@@ -77,7 +77,7 @@ class RegularScaleBiasVectorAccessIterator<Shape_, Element_, layout::PitchLinear
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   /// Element type per access
@@ -179,7 +179,7 @@ class RegularScaleBiasVectorAccessIterator<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   /// Underlying iterator type
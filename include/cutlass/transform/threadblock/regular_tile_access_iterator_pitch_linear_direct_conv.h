@@ -93,7 +93,7 @@ class RegularTileAccessIteratorDirectConv<
   using LongIndex = typename Layout::LongIndex;
   using StrideIndex = typename Layout::Stride::Index;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -246,7 +246,7 @@ class RegularTileAccessIteratorDirectConv<
   using LongIndex = typename Layout::LongIndex;
   using StrideIndex = typename Layout::Stride::Index;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -401,7 +401,7 @@ class RegularTileAccessIteratorDirectConv<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -505,7 +505,7 @@ class RegularTileAccessIteratorDirectConv<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
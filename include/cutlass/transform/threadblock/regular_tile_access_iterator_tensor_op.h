@@ -85,7 +85,7 @@ class RegularTileAccessIterator<
   using LongIndex = typename Layout::LongIndex;
   using StrideIndex = typename Layout::Stride::Index;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -259,7 +259,7 @@ class RegularTileAccessIterator<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -356,7 +356,7 @@ class RegularTileAccessIterator<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -455,7 +455,7 @@ class RegularTileAccessIterator<Shape_, Element_,
   using LongIndex = typename Layout::LongIndex;
   using StrideIndex = typename Layout::Stride::Index;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -651,7 +651,7 @@ class RegularTileAccessIterator<
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -747,7 +747,7 @@ class RegularTileAccessIterator<Shape_, Element_,
   using Index = typename Layout::Index;
   using LongIndex = typename Layout::LongIndex;
 
-  using TensorRef = TensorRef<Element, Layout>;
+  using TensorRef = cutlass::TensorRef<Element, Layout>;
   using TensorCoord = typename Layout::TensorCoord;
 
   using ThreadMap = ThreadMap_;
@@ -13,7 +13,12 @@
 This module provides jit cache load/dump helper functions
 """
 
+import ast
+import inspect
+import json
 import os
+import stat
+import sys
 import uuid
 import random
 import tempfile
@@ -152,3 +157,177 @@ def dump_cache_to_path(
         print(f"{dsl_name} failed with caching generated IR", e)
     finally:
         os.chdir(original_path)
+
+
+# =============================================================================
+# Preprocessed AST Cache Helper functions
+# =============================================================================
+
+default_preprocessed_ast_path = os.path.join(
+    default_generated_ir_path, "preprocessed_ast"
+)
+
+
+def preprocessed_ast_key(dsl_name, dsl_version, func, dialect_globals):
+    """
+    Content-addressed key of the preprocessed AST of `func`.
+
+    The transformed AST is a pure function of the source of the module
+    containing `func`, where `func` is defined in it, the DSL version and
+    the global names bound to MLIR dialect modules (the preprocessor rewrites
+    calls through those). Returns None if the source is not available.
+    """
+    try:
+        file_name = inspect.getsourcefile(func)
+        _, start_line = inspect.getsourcelines(func)
+        with open(file_name, "rb") as f:
+            source = f.read()
+    except (OSError, TypeError):
+        return None
+
+    key = hashlib.sha256()
+    key.update(dsl_name.encode())
+    key.update(dsl_version.encode())
+    key.update(sys.version.encode())
+    key.update(source)
+    key.update(
+        f"{os.path.abspath(file_name)}:{func.__qualname__}:{start_line}".encode()
+    )
+    key.update(",".join(sorted(dialect_globals)).encode())
+    return key.hexdigest()
+
+
+def _encode_ast(value):
+    """Encodes an AST as JSON-compatible data, keeping source locations."""
+    if isinstance(value, ast.AST):
+        encoded = {"_type": type(value).__name__}
+        for name in value._fields + value._attributes:
+            if hasattr(value, name):
+                encoded[name] = _encode_ast(getattr(value, name))
+        return encoded
+    if isinstance(value, list):
+        return [_encode_ast(v) for v in value]
+    if value is None or isinstance(value, (bool, int, float, str)):
+        return value
+    # Remaining constants (bytes, complex, Ellipsis, ...) round-trip as literals
+    return {"_literal": "..." if value is Ellipsis else repr(value)}
+
+
+def _decode_ast(value):
+    """
+    Inverse of `_encode_ast`. Only `ast` node classes and literals are ever
+    constructed, so a tampered file cannot run code while being loaded.
+    """
+    if isinstance(value, list):
+        return [_decode_ast(v) for v in value]
+    if not isinstance(value, dict):
+        return value
+    if "_literal" in value:
+        return ast.literal_eval(value["_literal"])
+    node_type = getattr(ast, value.get("_type", ""), None)
+    if not (isinstance(node_type, type) and issubclass(node_type, ast.AST)):
+        raise ValueError(f"unexpected AST node type {value.get('_type')!r}")
+    node = node_type()
+    for name, field in value.items():
+        if name != "_type":
+            setattr(node, name, _decode_ast(field))
+    return node
+
+
+def _is_private_dir(path):
+    """
+    Returns True if `path` is a directory only the current user can modify.
+    Every parent must be owned by the user or root, and must be sticky if
+    others can write to it, so the directory cannot be swapped out.
+    """
+    uid = os.getuid()
+    try:
+        st = os.lstat(path)
+        if not stat.S_ISDIR(st.st_mode) or st.st_uid != uid or st.st_mode & 0o077:
+            return False
+        parent = os.path.dirname(os.path.abspath(path))
+        while True:
+            st = os.stat(parent)
+            if st.st_uid not in (uid, 0):
+                return False
+            if st.st_mode & 0o022 and not st.st_mode & stat.S_ISVTX:
+                return False
+            if os.path.dirname(parent) == parent:
+                return True
+            parent = os.path.dirname(parent)
+    except OSError:
+        return False
+
+
+def _preprocessed_ast_file(dsl_name, key, path):
+    return os.path.join(path, f"{dsl_name.lower()}_{key}.ast.json")
+
+
+def load_preprocessed_ast(dsl_name, key, path=default_preprocessed_ast_path):
+    """
+    Load a preprocessed AST saved by `save_preprocessed_ast`, or None. The
+    cached AST is executed, so files are only read from a directory private
+    to the current user.
+    """
+    fname = _preprocessed_ast_file(dsl_name, key, path)
+    if not os.path.exists(fname):
+        return None
+    if not _is_private_dir(path):
+        log().warning("Ignoring preprocessed AST cache %s: not private", path)
+        return None
+    try:
+        with open(fname, "r") as f:
+            if os.fstat(f.fileno()).st_uid != os.getuid():
+                return None
+            tree = _decode_ast(json.load(f))
+    except Exception as e:
+        log().warning("Failed to load preprocessed AST %s: %s", fname, e)
+        return None
+    if not isinstance(tree, ast.Module):
+        return None
+    log().debug("Preprocessed AST loaded from %s", fname)
+    return tree
+
+
+def save_preprocessed_ast(
+    dsl_name, key, tree, cache_limit, path=default_preprocessed_ast_path
+):
+    """
+    Save a preprocessed AST under its content key. The directory is created
+    with mode 0700. Writes are atomic, so concurrent processes warming the
+    same cache never observe partial files. The oldest entries are evicted
+    beyond `cache_limit` files.
+    """
+    fname = _preprocessed_ast_file(dsl_name, key, path)
+    try:
+        os.makedirs(path, mode=0o700, exist_ok=True)
+        if not _is_private_dir(path):
+            log().warning("Not saving preprocessed AST into %s: not private", path)
+            return None
+        fd, temp_fname = tempfile.mkstemp(dir=path, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "w") as f:
+                json.dump(_encode_ast(tree), f)
+            # os.replace is atomic on POSIX systems
+            os.replace(temp_fname, fname)
+        except BaseException:
+            os.unlink(temp_fname)
+            raise
+    except Exception as e:
+        log().warning("Failed to save preprocessed AST %s: %s", fname, e)
+        return None
+    log().debug("Preprocessed AST saved into %s", fname)
+
+    # Other processes may evict concurrently, so missing files are ignored
+    try:
+        entries = []
+        for f in os.listdir(path):
+            if f.startswith(dsl_name.lower()) and f.endswith(".ast.json"):
+                entry = os.path.join(path, f)
+                entries.append((os.path.getmtime(entry), entry))
+        entries.sort()
+        for _, stale in entries[: max(0, len(entries) - int(cache_limit))]:
+            os.unlink(stale)
+    except OSError:
+        pass
+    return fname
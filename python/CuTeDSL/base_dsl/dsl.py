@@ -33,7 +33,7 @@ from functools import lru_cache, wraps
 from collections import namedtuple
 from abc import ABC, abstractmethod
 from typing import Any, Union, Tuple, get_origin, get_args
-from types import FunctionType
+from types import FunctionType, ModuleType
 import warnings
 
 from . import typing as t
@@ -233,6 +233,43 @@ def new_from_mlir_values(obj, values):
         return obj
 
 
+def _get_memoized(func, attr, inspect_fn):
+    """
+    Returns `inspect_fn(func)`, memoized on the function object so repeated
+    calls of a jit function do not re-inspect it.
+    """
+    attrs = getattr(func, "__dict__", None)
+    if attrs is None:
+        return inspect_fn(func)
+    if attr not in attrs:
+        attrs[attr] = inspect_fn(func)
+    return attrs[attr]
+
+
+def _get_signature(func):
+    return _get_memoized(func, "_dsl_signature", inspect.signature)
+
+
+def _get_arg_spec(func):
+    return _get_memoized(func, "_dsl_arg_spec", inspect.getfullargspec)
+
+
+@lru_cache(maxsize=4096)
+def _sanitize_mangled_name(function_name):
+    """Strips characters that are invalid in symbol names"""
+    # we would need a dedicated MR to follow up
+    unwanted_chars = r"'-![]#,.<>()\":{}=%?@;"
+    translation_table = str.maketrans("", "", unwanted_chars)
+    function_name = function_name.translate(translation_table)
+    # identify address and drop
+    function_name = re.sub(r"0x[a-f0-9]{8,16}", "", function_name)
+    function_name = re.sub(r"\s+", " ", function_name)
+    function_name = function_name.replace(" ", "_")
+    function_name = function_name.replace("\n", "_")
+    # max fname is 256 character, leave space
+    return function_name[:180]
+
+
 class DSLCallable:
     """
     Wrapper class for a callable object used within the DSL.
@@ -246,6 +283,8 @@ class DSLCallable:
 
     Attributes:
         func (callable): The function to be wrapped and managed.
+        source (callable): The function `func` was materialized from. Its
+            signature is memoized, as `func` is re-created on every call.
 
     Methods:
         __call__(*args, **kwargs): Calls the wrapped function and clears it.
@@ -253,8 +292,9 @@ class DSLCallable:
         get_signature(): Returns the signature of the function.
     """
 
-    def __init__(self, func):
+    def __init__(self, func, source=None):
         self.func = func
+        self.source = source
 
     def __call__(self, *args, **kwargs):
         ret = self.__func__(*args, **kwargs)
@@ -271,10 +311,10 @@ class DSLCallable:
         return self.__func__.__name__
 
     def get_arg_spec(self):
-        return inspect.getfullargspec(self.__func__)
+        return _get_arg_spec(self.source or self.__func__)
 
     def get_signature(self):
-        return inspect.signature(self.__func__)
+        return _get_signature(self.source or self.__func__)
 
 
 class BaseDSL:
@@ -450,7 +490,7 @@ class BaseDSL:
             # If the function is decorated, de-decorate it
             fcn_ptr = BaseDSL._get_original_function(fcn_ptr, func.__name__)
             func._dsl_object.frame = None
-            return DSLCallable(fcn_ptr)
+            return DSLCallable(fcn_ptr, func)
         return func
 
     def jit_runner(self, executor, frame, *dargs, **dkwargs):
@@ -563,17 +603,7 @@ class BaseDSL:
                 function_name = f"{function_name}_{'_'.join(map(str, arg))}"
             else:
                 function_name = f"{function_name}_{arg}"
-        # we would need a dedicated MR to follow up
-        unwanted_chars = r"'-![]#,.<>()\":{}=%?@;"
-        translation_table = str.maketrans("", "", unwanted_chars)
-        function_name = function_name.translate(translation_table)
-        # identify address and drop
-        function_name = re.sub(r"0x[a-f0-9]{8,16}", "", function_name)
-        function_name = re.sub(r"\s+", " ", function_name)
-        function_name = function_name.replace(" ", "_")
-        function_name = function_name.replace("\n", "_")
-        # max fname is 256 character, leave space
-        function_name = function_name[:180]
+        function_name = _sanitize_mangled_name(function_name)
         log().info(f"Final mangled function name: {function_name}")
         return function_name
 
@@ -1270,7 +1300,7 @@ class BaseDSL:
             self.funcBody = funcBody
             log().info("Started preprocessing [%s]", function_name)
             exec_globals = self._get_globals()
-            transformed_ast = self.preprocessor.transform(funcBody, exec_globals)
+            transformed_ast = self._load_or_transform(funcBody, exec_globals)
             if self.envar.print_after_preprocessor:
                 log().info(
                     f"# Printing unparsed AST after preprocess of func=`{function_name}` id=`{id(funcBody)}`"
@@ -1280,6 +1310,40 @@ class BaseDSL:
             return transformed_ast
         return None
 
+    def _load_or_transform(self, funcBody, exec_globals):
+        """
+        Returns the preprocessed AST of `funcBody`, reusing the on-disk cache
+        when file caching is enabled. A cold process skips the AST
+        transformation of every function whose module source is unchanged.
+        """
+        if self.envar.disable_file_caching:
+            return self.preprocessor.transform(funcBody, exec_globals)
+
+        dialect_globals = [
+            name
+            for name, value in exec_globals.items()
+            if isinstance(value, ModuleType)
+            and (getattr(value, "__package__", None) or "").endswith(
+                "._mlir.dialects"
+            )
+        ]
+        key = preprocessed_ast_key(
+            self.name, self.get_version().hexdigest(), funcBody, dialect_globals
+        )
+        if key is not None:
+            transformed_ast = load_preprocessed_ast(self.name, key)
+            if transformed_ast is not None:
+                log().info("Loaded preprocessed AST of [%s]", funcBody.__name__)
+                self.preprocessor.processed_functions.add(funcBody)
+                return transformed_ast
+
+        transformed_ast = self.preprocessor.transform(funcBody, exec_globals)
+        if key is not None:
+            save_preprocessed_ast(
+                self.name, key, transformed_ast, self.envar.file_caching_capacity
+            )
+        return transformed_ast
+
     def get_function_ptr(self, original_function):
         file_name = inspect.getsourcefile(original_function)
         code_object = compile(
@@ -1331,7 +1395,7 @@ class BaseDSL:
         if isinstance(self.funcBody, DSLCallable):
             sig = self.funcBody.get_signature()
         else:
-            sig = inspect.signature(self.funcBody)
+            sig = _get_signature(self.funcBody)
         function_name = self.funcBody.__name__
 
         bound_args = self._get_function_bound_args(sig, function_name, *args, **kwargs)
@@ -1385,7 +1449,7 @@ class BaseDSL:
         if isinstance(funcBody, DSLCallable):
             args_spec = funcBody.get_arg_spec()
         else:
-            args_spec = inspect.getfullargspec(funcBody)
+            args_spec = _get_arg_spec(funcBody)
 
         # Canonicalize the input arguments
         canonicalized_args, canonicalized_kwargs = self._canonicalize_args(
@@ -1590,7 +1654,7 @@ class BaseDSL:
                 if isinstance(funcBody, DSLCallable):
                     args_spec = funcBody.get_arg_spec()
                 else:
-                    args_spec = inspect.getfullargspec(funcBody)
+                    args_spec = _get_arg_spec(funcBody)
                 self.funcBody = funcBody
 
                 # Give each kernel a unique name. (The same kernel may be
@@ -257,7 +257,7 @@ class EnvironmentVarManager:
     - [DSL_NAME]_WARNINGS_AS_ERRORS: Enable warnings as error (default: False)
     - [DSL_NAME]_WARNINGS_IGNORE: Ignore warnings (default: False)
     - [DSL_NAME]_JIT_TIME_PROFILING: Whether or not to profile the IR generation/compilation/execution time (default: False)
-    - [DSL_NAME]_DISABLE_FILE_CACHING: Disable file caching (default: False)
+    - [DSL_NAME]_DISABLE_FILE_CACHING: Disable file caching of generated IR and preprocessed ASTs (default: False)
     - [DSL_NAME]_FILE_CACHING_CAPACITY: Limits the number of the cache save/load files (default: 1000)
     - [DSL_NAME]_LIBS: Path to dependent shared libraries (default: None)
     - [DSL_NAME]_NO_SOURCE_LOCATION: Generate source location (default: False)
@@ -32,6 +32,7 @@
 
 from cutlass_cppgen.backend.arguments import *
 from cutlass_cppgen.backend.c_types import *
+from cutlass_cppgen.backend.compile_queue import CompilationQueue
 from cutlass_cppgen.backend.compiler import ArtifactManager
 from cutlass_cppgen.backend.conv2d_operation import *
 from cutlass_cppgen.backend.epilogue import *
@@ -40,9 +41,11 @@ from cutlass_cppgen.backend.gemm_operation import *
 from cutlass_cppgen.backend.library import *
 from cutlass_cppgen.backend.memory_manager import PoolMemoryManager, create_memory_pool
 from cutlass_cppgen.backend.operation import *
+from cutlass_cppgen.backend.plan_cache import PlanCache
 from cutlass_cppgen.backend.reduction_operation import *
 from cutlass_cppgen.backend.type_hint import *
 from cutlass_cppgen.backend.utils import *
 from cutlass_cppgen.backend.utils.device import device_cc
 
 compiler = ArtifactManager()
+plan_cache = PlanCache()
@@ -0,0 +1,296 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Queue that compiles many operations in parallel.
+
+``ArtifactManager.add_module`` compiles the operations it is given as one module on the calling thread,
+so warming up a large number of kernels serializes on nvcc or NVRTC. A ``CompilationQueue`` accepts
+operations from any thread and returns a ``concurrent.futures.Future`` for each. Requests that arrive
+close together are grouped into batches of up to ``max_batch_size`` operations, each batch is compiled
+as one module, and at most ``max_workers`` batches are compiled at once. Operations with the same
+artifact key share one request, so submitting an operation that is already pending or compiled returns
+the existing future.
+
+.. highlight:: python
+.. code-block:: python
+
+    plan = cutlass_cppgen.op.Gemm(element=np.float16, layout=cutlass_cppgen.LayoutType.RowMajor)
+    with CompilationQueue(max_workers=8) as queue:
+        futures = [queue.submit(plan.construct(td)) for td in plan.tile_descriptions()]
+        operations = [future.result() for future in futures]
+
+The compile step is pluggable: ``compile_batch`` receives a list of submitted items and returns one result
+per item, and ``key`` maps an item to the key used to deduplicate requests. This allows the scheduling
+to be exercised without a compiler.
+"""
+
+from concurrent.futures import Future, ThreadPoolExecutor
+import os
+import threading
+import time
+
+from cutlass_cppgen import logger
+
+
+_thread_state = threading.local()
+
+
+def _make_device_current():
+    """
+    Makes the device used by ``cutlass_cppgen`` current on the calling thread so that modules compiled on
+    worker threads are loaded into the same context as those compiled on the main thread
+    """
+    if getattr(_thread_state, "device_current", False):
+        return
+
+    import cutlass_cppgen
+    from cutlass_cppgen.utils.lazy_import import lazy_import
+    cudart = lazy_import("cuda.cudart")
+
+    (err,) = cudart.cudaSetDevice(cutlass_cppgen.device_id())
+    if err != cudart.cudaError_t.cudaSuccess:
+        raise RuntimeError(f"cudaSetDevice failed with error {err}")
+    _thread_state.device_current = True
+
+
+def compile_operations(operations: list) -> list:
+    """
+    Compiles ``operations`` as one module with the process-wide ``ArtifactManager`` and returns them
+
+    :param operations: operations constructed by the frontends (e.g., ``Gemm.construct``)
+    :type operations: list
+    """
+    from cutlass_cppgen.backend import compiler
+
+    _make_device_current()
+    compiler.add_module(operations)
+    return operations
+
+
+def operation_key(operation) -> str:
+    """
+    Returns the artifact key of ``operation``, which identifies operations that compile to the same kernel
+    """
+    from cutlass_cppgen.backend import compiler
+    return compiler.operation_key(operation)
+
+
+class _Request:
+    def __init__(self, key, item):
+        self.key = key
+        self.item = item
+        self.future = Future()
+
+
+class CompilationQueue:
+    """
+    Batches, deduplicates and compiles operations on a bounded pool of worker threads
+
+    :param compile_batch: callable compiling a list of items and returning one result per item.
+                          Defaults to compiling operations with the process-wide ``ArtifactManager``.
+    :type compile_batch: callable
+    :param key: callable returning the key used to deduplicate an item. Defaults to the artifact key of an operation.
+    :type key: callable
+    :param max_workers: maximum number of batches compiled concurrently. Defaults to the number of CPUs.
+    :type max_workers: int
+    :param max_batch_size: maximum number of items compiled as one batch
+    :type max_batch_size: int
+    :param batch_window: time in seconds to wait for further submissions before dispatching a partial batch
+    :type batch_window: float
+    """
+
+    def __init__(
+        self,
+        compile_batch=None,
+        key=None,
+        max_workers: int = None,
+        max_batch_size: int = 16,
+        batch_window: float = 0.005,
+    ):
+        if max_workers is None:
+            max_workers = os.cpu_count() or 1
+        if max_workers < 1:
+            raise ValueError(f"max_workers must be positive, got {max_workers}")
+        if max_batch_size < 1:
+            raise ValueError(f"max_batch_size must be positive, got {max_batch_size}")
+
+        self.compile_batch = compile_batch if compile_batch is not None else compile_operations
+        self.key = key if key is not None else operation_key
+        self.max_workers = max_workers
+        self.max_batch_size = max_batch_size
+        self.batch_window = batch_window
+
+        # Number of items submitted, submissions served by an existing request, and batches compiled
+        self.submitted = 0
+        self.deduplicated = 0
+        self.batches = 0
+
+        self._condition = threading.Condition()
+        self._pending = []
+        self._requests = {}
+        self._active = 0
+        self._shutdown = False
+
+        self._executor = ThreadPoolExecutor(max_workers=max_workers, thread_name_prefix="cutlass-compile")
+        self._dispatcher = threading.Thread(target=self._dispatch, name="cutlass-compile-dispatch", daemon=True)
+        self._dispatcher.start()
+
+    def submit(self, item) -> Future:
+        """
+        Requests compilation of ``item``
+
+        :return: future resolving to the result of compiling ``item``
+        :rtype: concurrent.futures.Future
+        """
+        key = self.key(item)
+        with self._condition:
+            if self._shutdown:
+                raise RuntimeError("Cannot submit to a CompilationQueue that has been shut down")
+            self.submitted += 1
+            request = self._requests.get(key)
+            if request is not None:
+                self.deduplicated += 1
+                return request.future
+            request = _Request(key, item)
+            self._requests[key] = request
+            self._pending.append(request)
+            self._condition.notify_all()
+        return request.future
+
+    def submit_many(self, items) -> list:
+        """
+        Requests compilation of each of ``items``
+
+        :return: futures in the order of ``items``
+        :rtype: list
+        """
+        return [self.submit(item) for item in items]
+
+    def wait(self, timeout: float = None) -> bool:
+        """
+        Waits until all submitted requests have completed
+
+        :return: whether all requests completed before ``timeout`` expired
+        :rtype: bool
+        """
+        deadline = None if timeout is None else time.monotonic() + timeout
+        with self._condition:
+            while self._pending or self._active:
+                remaining = None if deadline is None else deadline - time.monotonic()
+                if remaining is not None and remaining <= 0:
+                    return False
+                self._condition.wait(remaining)
+        return True
+
+    def shutdown(self, wait: bool = True):
+        """
+        Stops accepting submissions. Requests already submitted are still compiled.
+
+        :param wait: whether to block until all submitted requests have completed
+        :type wait: bool
+        """
+        with self._condition:
+            self._shutdown = True
+            self._condition.notify_all()
+        if wait:
+            self._dispatcher.join()
+        self._executor.shutdown(wait=wait)
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        self.shutdown(wait=True)
+
+    def _dispatch(self):
+        while True:
+            with self._condition:
+                while not self._pending or self._active >= self.max_workers:
+                    if self._shutdown and not self._pending:
+                        return
+                    self._condition.wait()
+
+                # Give requests submitted in quick succession a chance to join a partial batch
+                deadline = time.monotonic() + self.batch_window
+                while len(self._pending) < self.max_batch_size and not self._shutdown:
+                    remaining = deadline - time.monotonic()
+                    if remaining <= 0:
+                        break
+                    self._condition.wait(remaining)
+
+                batch = self._pending[:self.max_batch_size]
+                del self._pending[:self.max_batch_size]
+                self._active += 1
+                self.batches += 1
+
+            self._executor.submit(self._run, batch)
+
+    def _compile(self, batch: list):
+        results = self.compile_batch([request.item for request in batch])
+        if len(results) != len(batch):
+            raise RuntimeError(f"Compilation of {len(batch)} items returned {len(results)} results")
+        for request, result in zip(batch, results):
+            request.future.set_result(result)
+
+    def _run(self, batch: list):
+        try:
+            try:
+                self._compile(batch)
+            except Exception as e:
+                if len(batch) == 1:
+                    raise
+                # A failing item fails the module it is compiled in. Compile the items of the batch
+                # individually so that only the failing ones report an error.
+                logger.warning(f"Compilation of a batch of {len(batch)} failed ({e}); compiling items individually")
+                for request in batch:
+                    try:
+                        self._compile([request])
+                    except Exception as item_error:
+                        self._fail([request], item_error)
+        except Exception as e:
+            self._fail(batch, e)
+        finally:
+            with self._condition:
+                self._active -= 1
+                self._condition.notify_all()
+
+    def _fail(self, batch: list, error: Exception):
+        with self._condition:
+            for request in batch:
+                # Failed requests are forgotten so that a later submission retries them
+                if self._requests.get(request.key) is request:
+                    del self._requests[request.key]
+        for request in batch:
+            if not request.future.done():
+                request.future.set_exception(error)
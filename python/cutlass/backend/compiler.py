@@ -355,9 +355,18 @@ class ArtifactManager:
 
         return cubin_image, host_lib, temp_dst
 
-    def add_module(self, operations, compile_options=None, bypass_cache=False):
+    def operation_key(self, operation) -> str:
+        """
+        Returns the key under which the compiled artifacts of ``operation`` are stored
+        """
+        return operation.rt_module.emit() + operation.procedural_name() + self.backend
+
+    def add_module(self, operations, compile_options=None, bypass_cache=False, keys=None):
         """
         Insert a new compiled device module
+
+        :param keys: artifact keys of the operations, if known from an earlier compilation. This
+            avoids emitting the source of operations that are already compiled.
         """
         include_paths = [
             cuda_install_path() + "/include",
@@ -377,9 +386,13 @@ class ArtifactManager:
         # save the cubin
         operation_key = []
         operation_list = []
-        for operation in operations:
+        for i, operation in enumerate(operations):
             # step 1: get kernel string as key
-            key = operation.rt_module.emit() + operation.procedural_name() + self.backend
+            if keys is not None:
+                key = keys[i]
+            else:
+                key = self.operation_key(operation)
+            operation.artifact_key = key
             # step 1: check if the operation is in cache
             compiled_kernel = self.compiled_cache_device.get(key)
 
@@ -48,7 +48,10 @@ from cutlass_cppgen.backend.evt.passes import (
     EVTGraphDrawer,
     EVTPassManager,
     GetSmemSize,
+    PassAlgebraicSimplification,
+    PassCommonSubexpressionElimination,
     PassDAG2Tree,
+    PassDeadNodeElimination,
     PassGetArgumentType,
     PassGetImpl,
     PassFixElementD,
@@ -82,6 +85,9 @@ class EVTFrontendBase:
                 PassGetArgumentType,
                 PassShapeTypePropagation,
                 PassLayoutManipulateElimination,
+                PassAlgebraicSimplification,
+                PassCommonSubexpressionElimination,
+                PassDeadNodeElimination,
                 PassGetImpl,
                 PassDAG2Tree,
                 PassFixElementD
@@ -121,6 +121,12 @@ class DAGIR:
         """
         return self._graph.has_node(node)
 
+    def has_edge(self, src: str, dst: str) -> bool:
+        """
+        Check if the edge src -> dst is in the graph
+        """
+        return self._graph.has_edge(src, dst)
+
     def in_degree(self, node: str):
         """
         Get the input degree of node
@@ -31,8 +31,11 @@
 #################################################################################################
 
 from cutlass_cppgen.backend.evt.passes.graph_drawer import EVTGraphDrawer
+from cutlass_cppgen.backend.evt.passes.pass_algebraic_simplification import PassAlgebraicSimplification
 from cutlass_cppgen.backend.evt.passes.pass_argument_type import PassGetArgumentType
+from cutlass_cppgen.backend.evt.passes.pass_common_subexpression_elimination import PassCommonSubexpressionElimination
 from cutlass_cppgen.backend.evt.passes.pass_dag_2_tree import PassDAG2Tree
+from cutlass_cppgen.backend.evt.passes.pass_dead_node_elimination import PassDeadNodeElimination
 from cutlass_cppgen.backend.evt.passes.pass_get_impl import PassGetImpl
 from cutlass_cppgen.backend.evt.passes.pass_fix_element_d import PassFixElementD
 from cutlass_cppgen.backend.evt.passes.pass_layout_elimination import PassLayoutManipulateElimination
@@ -0,0 +1,141 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Algebraic simplification of compute nodes in the DAG IR
+"""
+
+from copy import deepcopy
+
+from cutlass_cppgen.backend.evt.ir import ComputeNode, DAGIR, LoadNode
+from cutlass_cppgen.backend.evt.passes.pass_layout_elimination import PassLayoutManipulateElimination
+from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassBase
+from cutlass_cppgen.backend.library import ActivationOp, FunctionalOp
+
+
+class PassAlgebraicSimplification(EVTPassBase):
+    """
+    Simplify compute nodes whose result is known from their operands:
+
+    * identity(x), x * 1, 1 * x, x / 1, x + 0, 0 + x, x - 0 are replaced by x
+    * binary ops whose operands are both immediates are folded into a single immediate
+
+    Rewrites that could change the result under IEEE semantics (e.g., x * 0 -> 0) are not applied.
+    """
+    dependencies = [
+        PassLayoutManipulateElimination  # Layout nodes must be removed so that operands are final
+    ]
+
+    # For each op, the immediate value that makes the (lhs, rhs) operand an identity element
+    identity_operands = {
+        FunctionalOp.Multiplies: (1.0, 1.0),
+        FunctionalOp.Plus: (0.0, 0.0),
+        FunctionalOp.Divides: (None, 1.0),
+        FunctionalOp.Minus: (None, 0.0),
+    }
+
+    fold_fns = {
+        FunctionalOp.Plus: lambda a, b: a + b,
+        FunctionalOp.Minus: lambda a, b: a - b,
+        FunctionalOp.Multiplies: lambda a, b: a * b,
+        FunctionalOp.Divides: lambda a, b: a / b if b != 0 else None,
+        FunctionalOp.Maximum: lambda a, b: max(a, b),
+        FunctionalOp.Minimum: lambda a, b: min(a, b),
+    }
+
+    def __init__(self, dag_ir: DAGIR) -> None:
+        super().__init__(dag_ir)
+        self.fold_cnt = 0
+
+    def call(self):
+        for node in self.dag_ir.nodes_topological_order():
+            if not self.dag_ir.has_node(node):
+                continue
+            node_meta = self.dag_ir.get_node_meta(node)
+            if not isinstance(node_meta, ComputeNode):
+                continue
+
+            inputs = self.dag_ir.get_all_inputs(node)
+            values = [self.constant_value(input) for input in inputs]
+
+            if node_meta.fn == ActivationOp.Identity and len(inputs) == 1:
+                self.forward(node, inputs[0])
+            elif len(inputs) == 2 and None not in values:
+                self.fold(node, inputs, values)
+            elif len(inputs) == 2 and node_meta.fn in self.identity_operands:
+                lhs_identity, rhs_identity = self.identity_operands[node_meta.fn]
+                if rhs_identity is not None and values[1] == rhs_identity:
+                    self.forward(node, inputs[0])
+                elif lhs_identity is not None and values[0] == lhs_identity:
+                    self.forward(node, inputs[1])
+
+    def constant_value(self, node: str):
+        """
+        Returns the value of an immediate node, or None if node is not an immediate
+        """
+        node_meta = self.dag_ir.get_node_meta(node)
+        if isinstance(node_meta, LoadNode) and node_meta.tensor is not None and node_meta.tensor.is_constant:
+            return node_meta.tensor.value
+        return None
+
+    def forward(self, node: str, src: str):
+        """
+        Replace all uses of node with src when this does not change the emitted types
+        """
+        for user in self.dag_ir.get_users(node):
+            # Parallel edges would be rebuilt with an identity node, so nothing is saved
+            if self.dag_ir.has_edge(src, user):
+                return
+            # Store nodes rely on the producing compute node to convert to the output element
+            if (self.dag_ir.get_node_meta(user).op == "store" and
+                    not isinstance(self.dag_ir.get_node_meta(src), ComputeNode)):
+                return
+        self.dag_ir.replace_all_uses_with(node, src)
+
+    def fold(self, node: str, inputs, values):
+        node_meta = self.dag_ir.get_node_meta(node)
+        if node_meta.fn not in self.fold_fns:
+            return
+        value = self.fold_fns[node_meta.fn](*values)
+        if value is None:
+            return
+
+        imm_meta = deepcopy(self.dag_ir.get_node_meta(inputs[0]))
+        imm_meta.name = f"imm_{value}_folded{self.fold_cnt}".replace('.', '_').replace('-', 'neg')
+        imm_meta.tensor.value = float(value)
+        self.fold_cnt += 1
+        self.dag_ir.add_node(imm_meta)
+
+        self.forward(node, imm_meta.name)
+        if self.dag_ir.has_node(node):
+            # Folding was rejected; the unused immediate is dropped
+            self.dag_ir.remove_node(imm_meta.name)
@@ -0,0 +1,123 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Common subexpression elimination on the DAG IR.
+
+Before conversion to a tree, every node with more than one user is fused into a topological
+visitor together with its users by PassDAG2Tree. Computing the same value twice, or loading the
+same immediate twice, therefore costs both redundant work in the epilogue and larger fused
+subgraphs. This pass merges such nodes so that each value is produced once.
+"""
+
+from cutlass_cppgen.backend.evt.ir import ComputeNode, LoadNode, StoreNode
+from cutlass_cppgen.backend.evt.passes.pass_algebraic_simplification import PassAlgebraicSimplification
+from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassBase
+from cutlass_cppgen.backend.library import FunctionalOp
+
+
+class PassCommonSubexpressionElimination(EVTPassBase):
+    """
+    Merge nodes that are guaranteed to produce identical values:
+
+    * immediates with the same value, element type and layout
+    * compute nodes applying the same function to the same operands. Operands of commutative
+      functions are compared as an unordered pair.
+    * non-output store nodes (named intermediates) of the same value
+
+    Loads of user-provided tensors are never merged since each is a distinct argument.
+    """
+    dependencies = [
+        PassAlgebraicSimplification
+    ]
+
+    commutative_fns = [
+        FunctionalOp.Plus,
+        FunctionalOp.Multiplies,
+        FunctionalOp.Maximum,
+        FunctionalOp.Minimum,
+    ]
+
+    def call(self):
+        # Nodes are visited in topological order so that the operands of a node are already
+        # canonical when its key is built. The first node with a given key is kept.
+        canonical = {}
+        for node in self.dag_ir.nodes_topological_order():
+            key = self.get_key(node)
+            if key is None:
+                continue
+            if key in canonical:
+                self.dag_ir.replace_all_uses_with(node, canonical[key])
+            else:
+                canonical[key] = node
+
+    def get_key(self, node: str):
+        """
+        Returns a hashable key identifying the value produced by node, or None if the node
+        must not be merged
+        """
+        node_meta = self.dag_ir.get_node_meta(node)
+
+        if isinstance(node_meta, LoadNode):
+            tensor = node_meta.tensor
+            if not tensor.is_constant:
+                return None
+            return ("imm", tensor.value, tensor.element, tensor.shape, tensor.stride)
+
+        inputs = tuple(self.dag_ir.get_all_inputs(node))
+
+        if isinstance(node_meta, ComputeNode):
+            # Reductions are lowered to store nodes by PassPreprocessRed; guard against tuples anyway
+            if isinstance(node_meta.fn, tuple):
+                return None
+            if node_meta.fn in self.commutative_fns and len(inputs) == 2:
+                inputs = tuple(sorted(inputs))
+            return ("compute", node_meta.fn, node_meta.element_compute, node_meta.element_output,
+                    node_meta.round_style, node_meta.tensor.shape, inputs)
+
+        if isinstance(node_meta, StoreNode):
+            if node_meta.is_output:
+                return None
+            return ("store", inputs)
+
+        return None
+
+    def ensures(self) -> None:
+        # Merging two operands of the same node creates parallel edges, which DAGIR.add_edge
+        # splits with identity nodes. Those are created after PassShapeTypePropagation, so their
+        # shape and type are propagated here.
+        for node in self.dag_ir.nodes_topological_order():
+            node_meta = self.dag_ir.get_node_meta(node)
+            if node_meta.tensor is None:
+                input_node_metas = self.dag_ir.get_all_inputs_meta(node)
+                node_meta.type_propagation(input_node_metas)
+                node_meta.shape_propagation(input_node_metas)
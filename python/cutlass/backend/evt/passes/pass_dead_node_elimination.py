@@ -0,0 +1,67 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Dead node elimination on the DAG IR
+"""
+
+from cutlass_cppgen.backend.evt.ir import LoadNode, StoreNode
+from cutlass_cppgen.backend.evt.passes.pass_common_subexpression_elimination import PassCommonSubexpressionElimination
+from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassBase
+
+
+class PassDeadNodeElimination(EVTPassBase):
+    """
+    Remove nodes whose values never reach an output. Such nodes arise from unused intermediates
+    in the epilogue function and from the rewrites of PassAlgebraicSimplification and
+    PassCommonSubexpressionElimination.
+
+    Loads of user-provided tensors (including accum and C) are kept since they are part of the
+    epilogue arguments. Unused immediates are removed.
+    """
+    dependencies = [
+        PassCommonSubexpressionElimination
+    ]
+
+    def call(self):
+        # Visiting in reverse topological order removes chains of dead nodes in a single sweep
+        for node in reversed(self.dag_ir.nodes_topological_order()):
+            if self.dag_ir.out_degree(node) == 0 and self.is_removable(node):
+                self.dag_ir.remove_node(node)
+
+    def is_removable(self, node: str) -> bool:
+        node_meta = self.dag_ir.get_node_meta(node)
+        if isinstance(node_meta, StoreNode):
+            return not node_meta.is_output
+        if isinstance(node_meta, LoadNode):
+            return node_meta.tensor is not None and node_meta.tensor.is_constant
+        return True
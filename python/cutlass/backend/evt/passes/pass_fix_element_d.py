@@ -37,6 +37,7 @@ In Sm90 epilogue visitor, the node writing D to gmem does not have internal
 element converter, so the compute node producing D must have element_output = type(D).
 """
 
+from cutlass_cppgen.backend.evt.passes.pass_dead_node_elimination import PassDeadNodeElimination
 from cutlass_cppgen.backend.evt.passes.pass_layout_elimination import PassLayoutManipulateElimination
 from cutlass_cppgen.backend.evt.passes.pass_manager import EVTPassBase
 
@@ -48,7 +49,8 @@ class PassFixElementD(EVTPassBase):
     element_output = type(D)
     """
     dependencies = [
-        PassLayoutManipulateElimination
+        PassLayoutManipulateElimination,
+        PassDeadNodeElimination         # The producer of D must be final
     ]
     def get_producer(self, node, element_D):
         node_meta = self.dag_ir.get_node_meta(node)
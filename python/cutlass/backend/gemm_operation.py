@@ -172,6 +172,10 @@ class GemmArguments2x(ArgumentBase):
     :type stream: :class:`cuda.cuda.CUstream`
     """
 
+    # Whether the kernel expects its device workspace to be zero at every launch. Serial split-K
+    # semaphores are reset by the final partition of each tile, so they need no re-zeroing.
+    zero_workspace_per_launch = False
+
     def __init__(self, operation, problem_size, A, B, C, D, gemm_mode=GemmUniversalMode.Gemm, **kwargs):
         self.operation = operation
 
@@ -345,13 +349,13 @@ class GemmArguments2x(ArgumentBase):
             self.ptr_D = cuda.CUdeviceptr(workspace_ptr)
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
+        self.kernel_workspace_bytes = device_workspace_size if device_workspace else 0
 
         self.get_arguments()
 
-        arguments, grid_tiled_shape, gemm_k_size = self.arguments
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments), ctypes.c_void_p(int(device_workspace)))
-        host_workspace = bytearray(res_arg.contents)
+        self.c_arguments = self.arguments[0]
+        self.get_args_extra = (ctypes.c_void_p(int(device_workspace)),)
+        host_workspace = self.pack()
 
         device_workspace = None
 
@@ -359,6 +363,31 @@ class GemmArguments2x(ArgumentBase):
         self.device_workspace = device_workspace
         self.launch_config = launch_config
 
+    def pack(self) -> bytearray:
+        """
+        Converts ``self.c_arguments`` to the kernel's packed parameters. Fields of
+        ``self.c_arguments``, such as operand pointers, may be modified in place before repacking.
+
+        :return: packed kernel parameters
+        :rtype: bytearray
+        """
+        res_arg = self.operation.rt_module.get_args(
+            ctypes.byref(self.c_arguments), *self.get_args_extra)
+        return bytearray(res_arg.contents)
+
+    def reset_device_workspace(self):
+        """
+        Zeroes the kernel's device workspace on ``self.stream`` if the kernel expects it to be zero
+        at every launch. Only ``initialize`` zeroes it otherwise, so launches that reuse these
+        arguments call this before each launch.
+        """
+        if not self.zero_workspace_per_launch or not self.kernel_workspace_bytes:
+            return
+        err, = cuda.cuMemsetD32Async(
+            self.workspace_buffer.ptr, 0, self.kernel_workspace_bytes // 4, self.stream)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError(f"CUDA Error {err}")
+
     def sync(self, stream_sync=True):
         super().sync(stream_sync)
         if hasattr(self.output_op, "sync"):
@@ -396,6 +425,9 @@ class GemmArguments2xStreamK(GemmArguments2x):
     :type output_op: :class:`cutlass_cppgen.backend.LinearCombinationFunctorArguments`
     """
 
+    # Stream-K barrier flags accumulate arrivals and are zeroed only when the parameters are packed
+    zero_workspace_per_launch = True
+
     def __init__(self, operation, problem_size, A, B, C, D, gemm_mode=GemmUniversalMode.Gemm, **kwargs):
         if gemm_mode not in [GemmUniversalMode.Gemm, GemmUniversalMode.Batched]:
             raise Exception(f"Unsupported GEMM mode {gemm_mode}.")
@@ -449,16 +481,17 @@ class GemmArguments2xStreamK(GemmArguments2x):
             self.ptr_D = cuda.CUdeviceptr(workspace_ptr)
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
+        self.kernel_workspace_bytes = device_workspace_size if device_workspace else 0
 
         arguments = self.get_arguments()
 
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(arguments),
+        self.c_arguments = arguments
+        self.get_args_extra = (
             ctypes.c_void_p(int(device_workspace)),
             device_sm_count(),
             self.operation.rt_module.occupancy
         )
-        host_workspace = bytearray(res_arg.contents)
+        host_workspace = self.pack()
 
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(arguments),
@@ -508,6 +541,10 @@ class GemmArguments3x(GemmArguments2x):
     :type output_op: :class:`cutlass_cppgen.backend.LinearCombinationFunctorArguments`
     """
 
+    # Stream-K and split-K tile schedulers count arrivals in workspace flags, which
+    # GemmUniversal::initialize_workspace zero-fills before every launch
+    zero_workspace_per_launch = True
+
     def __init__(self, operation, problem_size, A, B, C, D, gemm_mode=GemmUniversalMode.Gemm, **kwargs):
         if gemm_mode not in [GemmUniversalMode.Gemm, GemmUniversalMode.Batched]:
             raise Exception(f"Unsupported GEMM mode {gemm_mode}.")
@@ -600,13 +637,13 @@ class GemmArguments3x(GemmArguments2x):
             self.ptr_D = cuda.CUdeviceptr(workspace_ptr)
         elif workspace_ptr is not None and self.gemm_mode == GemmUniversalMode.Gemm:
             device_workspace = workspace_ptr
+        self.kernel_workspace_bytes = device_workspace_size if device_workspace else 0
 
         self.get_arguments()
-        res_arg = self.operation.rt_module.get_args(
-            ctypes.byref(self.arguments),
-            ctypes.c_void_p(int(device_workspace)),
-        )
-        host_workspace = bytearray(res_arg.contents)
+
+        self.c_arguments = self.arguments
+        self.get_args_extra = (ctypes.c_void_p(int(device_workspace)),)
+        host_workspace = self.pack()
 
         grid = self.operation.rt_module.get_grid_shape(
             ctypes.byref(self.arguments),
@@ -40,10 +40,10 @@ _supports_cluster_launch = None
 
 
 def supports_cluster_launch():
-    from cuda import __version__ 
-    _version_splits = [int(x) for x in __version__.split("rc")[0].split(".post")[0].split(".")]
     global _supports_cluster_launch
     if _supports_cluster_launch is None:
+        from cuda import __version__
+        _version_splits = [int(x) for x in __version__.split("rc")[0].split(".post")[0].split(".")]
         major, minor = _version_splits[0], _version_splits[1]
         _supports_cluster_launch = device_cc() >= 90 and (major > 11 or (major == 11 and minor >= 8))
     return _supports_cluster_launch
@@ -134,7 +134,20 @@ class ExecutableOperation:
         packed = (ctypes.c_void_p * 1)()
         packed[0] = ctypes.addressof(cArg)
 
+        return self.launch(launch_config, packed, stream)
+
+    def launch(self, launch_config, kernel_params, stream):
+        """
+        Launches the kernel with parameters already packed into ``kernel_params``
+
+        :param launch_config: grid, block and shared memory size of the launch
+        :type launch_config: LaunchConfiguration
+        :param kernel_params: array holding a pointer to the packed kernel parameters
+        :type kernel_params: ctypes.c_void_p array
+        :param stream: stream on which to launch the kernel
+        :type stream: cuda.CUstream
+        """
         if supports_cluster_launch():
-            return self.run_with_clusters(launch_config, packed, stream)
+            return self.run_with_clusters(launch_config, kernel_params, stream)
         else:
-            return self.run_without_clusters(launch_config, packed, stream)
+            return self.run_without_clusters(launch_config, kernel_params, stream)
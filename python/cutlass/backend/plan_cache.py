@@ -0,0 +1,294 @@
+#################################################################################################
+#
+# Copyright (c) 2017 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Cache of compiled operations keyed on the class of problems they serve.
+
+The frontends (``Gemm``, ``Conv2d``) select and construct an operation on every ``run()``, and the
+compiler identifies compiled kernels by their emitted source. With dynamic shapes this repeats kernel
+selection, construction and emission for every call. A plan key captures everything the choice of
+kernel depends on -- data types, layouts, alignments, epilogue, and the problem extents rounded up to
+a power-of-two bucket -- and maps directly to the compiled, loaded operation.
+
+Plans are kept in memory in least-recently-used order. Plans whose key is stable across processes
+are also recorded on disk, next to the compiled artifacts, with the tile description they were
+constructed with and the compiler's artifact key. A later process constructs the recorded kernel and
+loads it without emitting its source, and never selects a second kernel for the same bucket.
+"""
+
+from collections import OrderedDict
+import enum
+import json
+import sqlite3
+
+from cutlass_library import (
+    DataType,
+    EpilogueScheduleType,
+    KernelScheduleType,
+    MathOperation,
+    OpcodeClass,
+    TileSchedulerType,
+)
+
+from cutlass_cppgen import CACHE_FILE
+from cutlass_cppgen.backend.library import MathInstruction, TileDescription
+
+
+def problem_bucket(extents: tuple, minimum: int = 16) -> tuple:
+    """
+    Rounds each extent up to a power of two of at least ``minimum``
+
+    :param extents: problem extents, e.g. (M, N, K) of a GEMM
+    :type extents: tuple
+    :param minimum: smallest bucket
+    :type minimum: int
+
+    :return: bucketed extents
+    :rtype: tuple
+    """
+    bucket = []
+    for extent in extents:
+        value = minimum
+        while value < extent:
+            value *= 2
+        bucket.append(value)
+    return tuple(bucket)
+
+
+def epilogue_signature(epilogue_functor) -> tuple:
+    """
+    Identifies an epilogue up to its alignment, which plan keys carry separately
+
+    :return: tuple of the signature and whether it is stable across processes
+    :rtype: tuple
+    """
+    activation = getattr(epilogue_functor, "activation_functor", None)
+    if activation is not None:
+        return activation.emit(), True
+    if hasattr(epilogue_functor, "visitor"):
+        # Visitor epilogues are emitted from a traced graph. Identify them by the functor object,
+        # which the cached operation keeps alive.
+        return f"visitor@{id(epilogue_functor):x}", False
+    return type(epilogue_functor).__name__, True
+
+
+def tile_description_to_dict(td: TileDescription) -> dict:
+    """
+    Serializes a tile description, including its math instruction
+    """
+    mi = td.math_instruction
+    name = lambda value: None if value is None else value.name
+    return {
+        "threadblock_shape": list(td.threadblock_shape),
+        "cluster_shape": list(td.cluster_shape),
+        "warp_count": None if td.warp_count is None else list(td.warp_count),
+        "stages": td.stages,
+        "kernel_schedule": name(td.kernel_schedule),
+        "epilogue_schedule": name(td.epilogue_schedule),
+        "tile_scheduler": name(td.tile_scheduler),
+        "instruction_shape": None if mi.instruction_shape is None else list(mi.instruction_shape),
+        "element_a": mi.element_a.name,
+        "element_b": mi.element_b.name,
+        "element_accumulator": mi.element_accumulator.name,
+        "opcode_class": mi.opcode_class.name,
+        "math_operation": mi.math_operation.name,
+    }
+
+
+def tile_description_from_dict(attrs: dict) -> TileDescription:
+    """
+    Reconstructs a tile description serialized by ``tile_description_to_dict``
+    """
+    enum_or_none = lambda cls, value: None if value is None else cls[value]
+    math_instruction = MathInstruction(
+        attrs["instruction_shape"],
+        DataType[attrs["element_a"]],
+        DataType[attrs["element_b"]],
+        DataType[attrs["element_accumulator"]],
+        OpcodeClass[attrs["opcode_class"]],
+        MathOperation[attrs["math_operation"]],
+    )
+    return TileDescription(
+        attrs["threadblock_shape"],
+        attrs["stages"],
+        attrs["warp_count"],
+        math_instruction,
+        cluster_shape=attrs["cluster_shape"],
+        kernel_schedule=enum_or_none(KernelScheduleType, attrs["kernel_schedule"]),
+        epilogue_schedule=enum_or_none(EpilogueScheduleType, attrs["epilogue_schedule"]),
+        tile_scheduler=enum_or_none(TileSchedulerType, attrs["tile_scheduler"]),
+    )
+
+
+def _key_field(value):
+    if isinstance(value, enum.Enum):
+        return value.name
+    if isinstance(value, TileDescription):
+        return tile_description_to_dict(value)
+    if isinstance(value, type):
+        return value.__name__
+    if isinstance(value, (list, tuple)):
+        return [_key_field(v) for v in value]
+    return value
+
+
+class PlanKey:
+    """
+    Key of a plan. Fields are compared by value; ``persistent`` is False if any field is only
+    meaningful within the current process.
+
+    :param fields: values the choice of kernel depends on
+    :type fields: tuple
+    :param persistent: whether the plan may be recorded on disk
+    :type persistent: bool
+    """
+
+    def __init__(self, fields: tuple, persistent: bool = True):
+        self.text = json.dumps(_key_field(list(fields)), separators=(",", ":"))
+        self.persistent = persistent
+
+    def __eq__(self, other):
+        return isinstance(other, PlanKey) and self.text == other.text
+
+    def __hash__(self):
+        return hash(self.text)
+
+    def __str__(self):
+        return self.text
+
+
+class PlanRecord:
+    """
+    On-disk record of a plan: the tile description its kernel was constructed with and the key
+    of the compiled artifact
+    """
+
+    def __init__(self, tile_description: TileDescription, artifact_key: str):
+        self.tile_description = tile_description
+        self.artifact_key = artifact_key
+
+
+class PlanCache:
+    """
+    Maps plan keys to compiled operations
+
+    :param capacity: maximum number of plans held in memory
+    :type capacity: int
+    :param cache_file: sqlite database in which plans are recorded, or None to keep plans in memory only
+    :type cache_file: str
+    """
+
+    def __init__(self, capacity: int = 256, cache_file: str = CACHE_FILE):
+        self.capacity = capacity
+        self.cache_file = cache_file
+        self._plans = OrderedDict()
+        self.hits = 0
+        self.misses = 0
+
+        if self.cache_file is not None:
+            connection = sqlite3.connect(self.cache_file)
+            cursor = connection.cursor()
+            cursor.execute("""
+            CREATE TABLE IF NOT EXISTS plans(plan_key TEXT NOT NULL UNIQUE,
+                                             tile_description TEXT NOT NULL,
+                                             artifact_key TEXT NOT NULL)
+            """)
+            connection.commit()
+            cursor.close()
+
+    def __len__(self):
+        return len(self._plans)
+
+    def lookup(self, key: PlanKey):
+        """
+        Returns the operation of an in-memory plan, or None
+        """
+        operation = self._plans.get(key)
+        if operation is None:
+            self.misses += 1
+            return None
+        self._plans.move_to_end(key)
+        self.hits += 1
+        return operation
+
+    def lookup_record(self, key: PlanKey):
+        """
+        Returns the on-disk record of a plan, or None
+
+        :rtype: PlanRecord
+        """
+        if self.cache_file is None or not key.persistent:
+            return None
+        connection = sqlite3.connect(self.cache_file)
+        cursor = connection.cursor()
+        cursor.execute("SELECT tile_description, artifact_key FROM plans WHERE plan_key = ?", (str(key),))
+        row = cursor.fetchone()
+        cursor.close()
+        if row is None:
+            return None
+        return PlanRecord(tile_description_from_dict(json.loads(row[0])), row[1])
+
+    def insert(self, key: PlanKey, operation):
+        """
+        Adds a compiled operation as the plan for ``key``. The operation's ``artifact_key`` is
+        recorded on disk for persistent keys.
+        """
+        self._plans[key] = operation
+        self._plans.move_to_end(key)
+        while len(self._plans) > self.capacity:
+            self._plans.popitem(last=False)
+
+        artifact_key = getattr(operation, "artifact_key", None)
+        if self.cache_file is None or not key.persistent or artifact_key is None:
+            return
+        connection = sqlite3.connect(self.cache_file)
+        cursor = connection.cursor()
+        cursor.execute(
+            "INSERT OR REPLACE INTO plans (plan_key, tile_description, artifact_key) VALUES (?, ?, ?)",
+            (str(key), json.dumps(tile_description_to_dict(operation.tile_description)), artifact_key))
+        connection.commit()
+        cursor.close()
+
+    def clear(self, records: bool = False):
+        """
+        Drops in-memory plans, and on-disk records if ``records`` is set. Compiled artifacts are kept.
+        """
+        self._plans.clear()
+        self.hits = 0
+        self.misses = 0
+        if records and self.cache_file is not None:
+            connection = sqlite3.connect(self.cache_file)
+            cursor = connection.cursor()
+            cursor.execute("DELETE FROM plans")
+            connection.commit()
+            cursor.close()
@@ -837,9 +837,20 @@ class Conv2d(OperationBase):
             epilogue_functor = self.epilogue_functor
 
         # The alignment is determined by the iterator function (I believe)
-        self.compile(tile_description=self.tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
-                     alignment_C=alignment_c, iterator_algorithm=iterator_algorithm, stride_support=stride_support,
-                     swizzling_functor=swizzling_functor, epilogue_functor=epilogue_functor, print_module=print_module)
+        fields = (
+            self.conv_kind,
+            (self._element_a, self._element_b, self._element_c, self._element_d, self._element_accumulator),
+            (self._layout_a, self._layout_b, self._layout_c),
+            (alignment_a, alignment_b, alignment_c),
+            self.opclass, self._math_operation, iterator_algorithm, stride_support, swizzling_functor,
+        )
+        implicit_gemm_size = problem_size.implicit_gemm_size(self.conv_kind)
+        self.operation = self._compile_plan(
+            fields, (implicit_gemm_size.m, implicit_gemm_size.n, implicit_gemm_size.k), epilogue_functor,
+            lambda td: self.construct(
+                td, alignment_a, alignment_b, alignment_c,
+                iterator_algorithm, stride_support, swizzling_functor, epilogue_functor),
+            print_module)
 
         # Create reduction operation for parallel split-k
         if split_k[0] == "parallel" and split_k[1] > 1:
@@ -112,6 +112,29 @@
         # Do other work...
 
         args.sync()
+
+    For repeated launches on device tensors, such as small GEMMs issued at every decoding step,
+    binding the plan reduces host overhead by reusing the packed kernel parameters of earlier
+    launches with operands of the same shapes:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        gemm = plan.bind(alpha=1.0, beta=0.0, stream=stream)
+        for step in range(steps):
+            gemm(A[step], B, C, D[step])
+
+    Compiled kernels are cached per plan, keyed on data types, layouts, alignments, epilogue, and the
+    problem extents rounded up to powers of two, so that dynamic-shape workloads reuse a bounded set
+    of kernels. The tile description of each bucket can be chosen with a selector, which is called
+    once per bucket with its (M, N, K) extents:
+
+    .. highlight:: python
+    .. code-block:: python
+
+        plan.tile_description_selector = lambda mnk: small_td if mnk[0] <= 64 else None
+        for M in sequence_lengths:
+            plan.run(A[:M], B, C[:M], D[:M])
 """
 from __future__ import annotations
 from typing import Optional
@@ -131,9 +154,11 @@ from cutlass_cppgen.backend import compiler
 from cutlass_cppgen.backend.evt import EpilogueFunctorVisitor
 from cutlass_cppgen.backend.gemm_operation import GemmArguments, GemmOperationUniversal
 from cutlass_cppgen.backend.library import TensorDescription, TileDescription
+from cutlass_cppgen.backend.packed_arguments import PackedArguments
 from cutlass_cppgen.op.op import OperationBase
 from cutlass_cppgen.shape import GemmCoord
 from cutlass_cppgen.utils import check, datatypes
+from cutlass_cppgen.utils.datatypes import is_numpy_tensor, is_torch_tensor
 
 
 class Gemm(OperationBase):
@@ -656,6 +681,24 @@ class Gemm(OperationBase):
         """
         if not stream:
             stream = cuda.CUstream(0)
+
+        arguments = self._build_arguments(A, B, C, D, alpha, beta, print_module, visitor_args, stream)
+
+        self.operation.run(arguments)
+
+        if sync:
+            arguments.sync()
+
+        return arguments
+
+    def _build_arguments(self, A, B, C, D, alpha, beta, print_module: bool,
+                         visitor_args: dict, stream: cuda.CUstream) -> GemmArguments:
+        """
+        Verifies the operands, compiles the kernel if needed, and constructs the kernel's arguments
+
+        :return: arguments to be passed to the kernel
+        :rtype: cutlass_cppgen.backend.GemmArguments
+        """
         super().run_setup()
         A = self._verify_tensor(A, self.A, self._element_a, self._layout_a, "A")
         B = self._verify_tensor(B, self.B, self._element_b, self._layout_b, "B")
@@ -678,11 +721,19 @@ class Gemm(OperationBase):
         # Set C alignment based on D.shape so as to correctly get an alignment with void-C
         # kernels, for which `C` is None.
         alignment_c = self.possible_operations.find_alignment(D.shape, self._layout_c, operand="C")
-        self.compile(self._tile_description, alignment_A=alignment_a, alignment_B=alignment_b,
-                     alignment_C=alignment_c, print_module=print_module)
 
         problem_size, mode, batch_count = self._get_problem_args(A, B, C, D)
 
+        fields = (
+            (self._element_a, self._element_b, self._element_c, self._element_d, self._element_accumulator),
+            (self._layout_a, self._layout_b, self._layout_c),
+            (alignment_a, alignment_b, alignment_c),
+            self.opclass, self._math_operation, self._swizzling_functor,
+        )
+        self.operation = self._compile_plan(
+            fields, (problem_size.m, problem_size.n, problem_size.k), self.epilogue_functor,
+            lambda td: self.construct(td, alignment_a, alignment_b, alignment_c), print_module)
+
         if mode == GemmUniversalMode.Gemm or batch_count == 1:
             kwargs = {'split_k_slices': 1}
         else:
@@ -703,7 +754,7 @@ class Gemm(OperationBase):
         else:
             output_op = self.operation.epilogue_type(alpha, beta)
 
-        arguments = GemmArguments(
+        return GemmArguments(
             operation=self.operation, problem_size=problem_size,
             A=A, B=B, C=C, D=D,
             output_op=output_op,
@@ -711,9 +762,115 @@ class Gemm(OperationBase):
             **kwargs
         )
 
-        self.operation.run(arguments)
+    def bind(self, alpha=None, beta=None, visitor_args: dict = None,
+             stream: Optional[cuda.CUstream] = None, max_shapes: int = 32) -> BoundGemm:
+        """
+        Returns a callable that launches this GEMM with fixed epilogue scalars and stream, and with
+        low host overhead across repeated launches. See :class:`BoundGemm`.
 
-        if sync:
-            arguments.sync()
+        :param alpha: scalar paramter alpha from GEMM computation that scales the product of operands A and B
+        :param beta: scalar parameter beta from GEMM operation that scales operand C
+        :param visitor_args: arguments of the epilogue visitor, if any
+        :type visitor_args: dict
+        :param stream: cuda stream, defaults to cuda.cuda.CUstream(0)
+        :type stream: :class:`cuda.cuda.CUstream`
+        :param max_shapes: number of distinct operand shapes for which packed parameters are kept
+        :type max_shapes: int
 
-        return arguments
+        :return: bound GEMM
+        :rtype: BoundGemm
+        """
+        return BoundGemm(self, alpha, beta, visitor_args, stream, max_shapes)
+
+
+def _device_pointer(tensor) -> int:
+    """
+    Returns the device address of a torch or cupy tensor
+    """
+    if tensor is None:
+        return 0
+    data_ptr = getattr(tensor, "data_ptr", None)
+    if data_ptr is not None:
+        return data_ptr()
+    return int(tensor.data.ptr)
+
+
+class BoundGemm:
+    """
+    A GEMM plan bound to its epilogue scalars and stream for repeated launches.
+
+    The first launch with operands of a given set of shapes and data types performs the same
+    verification and argument construction as :meth:`Gemm.run` and records where the operand
+    pointers are stored in the packed kernel parameters. Later launches with operands of the
+    same shapes and data types only write the new pointers into those parameters before launching,
+    which removes most of the host overhead of :meth:`Gemm.run` for small problems.
+
+    Operands must be torch or cupy tensors residing on the device. Numpy arrays, which
+    :meth:`Gemm.run` copies to and from the device, are not supported.
+    Epilogue scalars and visitor arguments are fixed at binding. Launches do not synchronize.
+    Kernels that expect a zeroed device workspace, such as stream-K kernels, have it re-zeroed
+    on the bound stream before each launch.
+
+    .. highlight:: python
+    .. code-block:: python
+
+        plan = cutlass_cppgen.op.Gemm(element=torch.float16, layout=cutlass_cppgen.LayoutType.RowMajor)
+        gemm = plan.bind(alpha=1.0, beta=0.0)
+        for A, B, C, D in requests:
+            gemm(A, B, C, D)
+    """
+
+    def __init__(self, plan: Gemm, alpha, beta, visitor_args: dict, stream, max_shapes: int):
+        self.plan = plan
+        self.alpha = alpha
+        self.beta = beta
+        self.visitor_args = visitor_args
+        self.stream = stream
+        self.max_shapes = max_shapes
+        self._packed = {}
+
+    @staticmethod
+    def _key(tensors: tuple, pointers: list) -> tuple:
+        # Operands that alias one another share fields in the packed parameters
+        aliases = tuple(pointers.index(ptr) if ptr else -1 for ptr in pointers)
+        signature = tuple(None if t is None else (tuple(t.shape), getattr(t, "dtype", None)) for t in tensors)
+        return signature, aliases
+
+    def _pack(self, tensors: tuple, pointers: list) -> PackedArguments:
+        for name, tensor in zip("ABCD", tensors):
+            if is_numpy_tensor(tensor) or (is_torch_tensor(tensor) and not tensor.is_cuda):
+                raise Exception(f"Operand {name} of a bound GEMM must reside on the device.")
+
+        stream = self.stream if self.stream else cuda.CUstream(0)
+        arguments = self.plan._build_arguments(
+            *tensors, self.alpha, self.beta, False, self.visitor_args, stream)
+
+        if len(self._packed) >= self.max_shapes:
+            evicted = self._packed.pop(next(iter(self._packed)))
+            evicted.arguments.free()
+
+        return PackedArguments(arguments, pointers)
+
+    def __call__(self, A, B, C, D):
+        """
+        Launches the GEMM on operands ``A``, ``B``, ``C``, and ``D``. ``C`` may be ``None`` for
+        GEMMs without a source operand.
+        """
+        tensors = (A, B, C, D)
+        pointers = [_device_pointer(t) for t in tensors]
+        key = self._key(tensors, pointers)
+
+        packed = self._packed.get(key)
+        if packed is None:
+            packed = self._pack(tensors, pointers)
+            self._packed[key] = packed
+        elif packed.pointers != pointers:
+            packed.update(pointers)
+
+        arguments = packed.arguments
+        arguments.reset_device_workspace()
+        err = arguments.operation.rt_module.launch(packed.launch_config, packed.kernel_params, arguments.stream)
+        if err != cuda.CUresult.CUDA_SUCCESS:
+            raise RuntimeError(f"CUDA Error {err}")
+
+    run = __call__
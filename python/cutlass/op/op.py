@@ -46,7 +46,9 @@ from cutlass_library import (
 
 import cutlass_cppgen
 from cutlass_cppgen import get_option_registry
+from cutlass_cppgen.backend import compiler, plan_cache
 from cutlass_cppgen.backend.evt import EpilogueFunctorVisitor
+from cutlass_cppgen.backend.plan_cache import PlanKey, epilogue_signature, problem_bucket
 from cutlass_cppgen.backend.utils.device import device_cc
 from cutlass_cppgen.epilogue import get_activations, get_activation_epilogue, identity
 from cutlass_cppgen.library_defaults import KernelsForDataType, _generator_ccs
@@ -75,6 +77,9 @@ class OperationBase:
         self.tile_description = None
         self._math_operation = None
 
+        # Optional callable choosing the tile description of a plan from its bucketed problem extents
+        self.tile_description_selector = None
+
         self.options = get_option_registry().options_for_cc(self.current_cc, operation_kind)
 
         if self.options is None:
@@ -428,3 +433,57 @@ class OperationBase:
         """
         # Initialize the memory pool if, if not already done
         cutlass_cppgen.get_memory_pool()
+
+    def _compile_plan(self, fields: tuple, extents: tuple, epilogue_functor, construct, print_module: bool = False):
+        """
+        Returns the compiled operation serving the class of problems described by ``fields`` and the
+        power-of-two bucket of ``extents``, constructing and compiling it on first use.
+
+        If no tile description has been set on this object and ``tile_description_selector`` is set,
+        the selector is called once per plan with the bucketed extents. Its choice does not change the
+        ``tile_description`` of this object.
+
+        :param fields: attributes, other than the epilogue and the problem extents, that the
+            constructed operation depends on
+        :type fields: tuple
+        :param extents: extents of the (implicit) GEMM as (M, N, K)
+        :type extents: tuple
+        :param epilogue_functor: epilogue functor of the operation
+        :param construct: callable returning a new operation for a given tile description, or for
+            the default tile description if passed None
+        :param print_module: whether to print the emitted C++ code. Bypasses in-memory plans.
+        :type print_module: bool
+
+        :return: compiled operation
+        """
+        bucket = problem_bucket(extents)
+        signature, persistent = epilogue_signature(epilogue_functor)
+        explicit_td = self.tile_description
+        key = PlanKey(
+            (cutlass_cppgen.__version__, compiler.backend, self.operation_kind, self.current_cc,
+             fields, signature, bucket, explicit_td),
+            persistent)
+
+        operation = None if print_module else plan_cache.lookup(key)
+        if operation is not None:
+            return operation
+
+        record = plan_cache.lookup_record(key)
+        if record is not None:
+            tile_description = record.tile_description
+        elif explicit_td is None and self.tile_description_selector is not None:
+            tile_description = self.tile_description_selector(bucket)
+        else:
+            tile_description = None
+
+        operation = construct(tile_description)
+        # Constructing with a tile description makes it the tile description of this object.
+        # Per-plan choices must not override the one set by the user.
+        self._tile_description = explicit_td
+
+        if print_module:
+            print(operation.rt_module.emit())
+
+        compiler.add_module([operation,], keys=[record.artifact_key] if record is not None else None)
+        plan_cache.insert(key, operation)
+        return operation
@@ -103,7 +103,7 @@ def get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, a
     layouts: tuple of layouts of type LayoutType
     use_fast_acc: Use fast accumulation for FP8. Ignored for other precisions
     count: Number of configs to return
-    provider: Heuristics provider to use
+    provider: Heuristics provider to use (default: create_heuristics_provider())
 
   returns:
     A list of dictionaries containing the suggested kernel configurations and additional info from the input required to define a Cutlass GemmOperation, with the following keys:
@@ -119,7 +119,7 @@ def get_single_gemm_config(m, n, k, batch_count, layouts, dtypes, alignment_a, a
       - 'raster_order': raster order for CTAs over output tiles ('along_m' or 'along_n')
   """
   if provider is None:
-    provider = MatmulHeuristics()
+    provider = create_heuristics_provider()
   return provider.get_configs(m, n, k, batch_count, dtypes, layouts, alignment_a, alignment_b, voidC=voidC, use_fast_acc=use_fast_acc, count=count)
 
 def get_gemm_configs(problems, provider=None, count=1):
@@ -354,6 +354,7 @@ def filter_manifest_and_write_heuristics_file(manifest, args):
     args: generator.py args, requires:
       - args.heuristics_problems_file
       - args.heuristics_gpu
+      - args.heuristics_provider
       - args.heuristics_testlist_file
       
   returns:
@@ -363,7 +364,7 @@ def filter_manifest_and_write_heuristics_file(manifest, args):
   with open(args.heuristics_problems_file, 'r') as f:
     heuristics_problems = json.load(f)
   gpu = None if (args.heuristics_gpu == "auto" or args.heuristics_gpu == "") else args.heuristics_gpu
-  mmh = MatmulHeuristics(gpu=gpu)
+  mmh = create_heuristics_provider(getattr(args, 'heuristics_provider', 'auto'), gpu=gpu)
   if any(('100' in arch) for arch in args.architectures.split(';')):
     mmh.set_cta_div_n(64)
   problems_with_configs = get_gemm_configs(heuristics_problems, provider=mmh, count=args.heuristics_configs_per_problem)
@@ -40,14 +40,20 @@ import glob
 import logging
 import ctypes
 import functools
+import math
+from itertools import product
 
 try:
   import builtins
   if hasattr(builtins, "CUTLASS_IGNORE_PACKAGE") and CUTLASS_IGNORE_PACKAGE == True:
     raise ImportError("Disabling attempt to import cutlass_library")
-  from cutlass_library.library import DataType, LayoutType
+  from cutlass_library.library import DataType, DataTypeSize, LayoutType
+  from cutlass_library.sm90_utils import compute_stage_count_sm90
 except ImportError:
-  from library import DataType, LayoutType
+  from library import DataType, DataTypeSize, LayoutType
+  from sm90_utils import compute_stage_count_sm90
+
+_LOGGER = logging.getLogger(__name__)
 
 class MatmulHeuristics:
 
@@ -172,3 +178,316 @@ class MatmulHeuristics:
 
     return ret
 
+
+class GpuSpec:
+  """
+  Coarse description of a GPU used by AnalyticMatmulHeuristics
+  """
+  def __init__(self, arch, sm_count, clock_ghz, dense_16bit_tflops, dram_tbps, smem_capacity_bytes):
+    self.arch = arch
+    self.sm_count = sm_count
+    self.clock_hz = clock_ghz * 1e9
+    self.dram_bytes_per_second = dram_tbps * 1e12
+    self.smem_capacity_bytes = smem_capacity_bytes
+    # Dense 16-bit tensor core FLOPs per clock per SM (FP32 accumulation)
+    self.flops_per_clock = dense_16bit_tflops * 1e12 / (sm_count * self.clock_hz)
+
+
+# Published boost clocks, dense 16-bit tensor throughput and DRAM bandwidth of the GPUs accepted by
+# --heuristics-gpu. The model only depends on their ratios, so approximate figures suffice.
+GPU_SPECS = {
+  'H100_SXM':     GpuSpec(90,  132, 1.830,  989.4,  3.35, 232448),
+  'H100_PCIE':    GpuSpec(90,  114, 1.755,  756.0,  2.00, 232448),
+  'H100_NVL':     GpuSpec(90,  132, 1.785,  835.0,  3.90, 232448),
+  'H200_SXM':     GpuSpec(90,  132, 1.830,  989.4,  4.80, 232448),
+  'H20_SXM':      GpuSpec(90,   78, 1.980,  148.0,  4.00, 232448),
+  'B200':         GpuSpec(100, 148, 1.965, 2250.0,  8.00, 232448),
+  'GB200_NVL':    GpuSpec(100, 152, 1.965, 2500.0,  8.00, 232448),
+  'RTX_5080':     GpuSpec(120,  84, 2.617,  112.6,  0.96, 101376),
+  'RTX_5090':     GpuSpec(120, 170, 2.407,  209.5,  1.79, 101376),
+  'RTX_PRO_6000': GpuSpec(120, 188, 2.617,  503.8,  1.79, 101376),
+}
+
+DEFAULT_HEURISTICS_GPU = 'H100_SXM'
+
+
+class AnalyticMatmulHeuristics:
+  """
+  Heuristics provider with the same interface as MatmulHeuristics, based on an analytic model
+  instead of nvMatmulHeuristics, so that it runs offline and always returns the same configs.
+
+  Each candidate CTA tile and cluster shape is scored by an estimated runtime combining:
+    - wave quantization of the (cluster-rounded) output tiles over the SMs
+    - tile efficiency, i.e. the work wasted on partial tiles at the problem boundary
+    - per-tile time bounded by tensor core throughput and shared memory / L2 bandwidth
+    - a DRAM bandwidth roofline over the whole problem
+    - mainloop stage count under the shared memory budget (compute_stage_count_sm90)
+  """
+
+  # L2 to SM bandwidth per SM, in bytes per clock
+  L2_BYTES_PER_CLOCK = 64
+
+  # Shared memory read bandwidth per SM, in bytes per clock
+  SMEM_BYTES_PER_CLOCK = 128
+
+  # Fixed per-tile cost of pipeline fill and epilogue setup, in clocks
+  TILE_OVERHEAD_CLOCKS = 1000
+
+  # Register budget for accumulators per consumer thread on SM90
+  SM90_ACCUMULATOR_REGISTERS = 128
+
+  # Estimated runtimes equal to this many significant digits are ties, broken by the config itself
+  RUNTIME_SIGNIFICANT_DIGITS = 6
+
+  # Shape of the DMMA instruction used for 64-bit operands, which have no WGMMA or UMMA
+  DMMA_INSTRUCTION_SHAPE = (16, 8, 4)
+
+  def __init__(self, gpu = None):
+    if gpu is None:
+      _LOGGER.info(f"No GPU given for analytic heuristics, assuming {DEFAULT_HEURISTICS_GPU}")
+      gpu = DEFAULT_HEURISTICS_GPU
+    if gpu not in GPU_SPECS:
+      raise ValueError(f"Unsupported GPU {gpu} for analytic heuristics. Supported: {', '.join(GPU_SPECS.keys())}")
+    self.gpu = gpu
+    self.spec = GPU_SPECS[gpu]
+    self.cta_div_m = 1
+    self.cta_div_n = 1
+
+  def set_cta_div_n(self, div_n):
+    self.cta_div_n = div_n
+
+  def set_cta_div_m(self, div_m):
+    self.cta_div_m = div_m
+
+  def _math_rate(self, dtypes, use_fast_acc):
+    """Tensor core FLOPs per clock per SM for the given operand types"""
+    bits = max(DataTypeSize[dtypes[0]], DataTypeSize[dtypes[1]])
+    if bits >= 64:
+      scale = 1 / 16
+    elif bits >= 32:
+      scale = 1 / 2
+    elif bits >= 16:
+      scale = 1
+    elif bits >= 8 or self.spec.arch < 100:
+      scale = 2
+    else:
+      scale = 4
+    is_fp8 = dtypes[0] in (DataType.e4m3, DataType.e5m2)
+    if is_fp8 and not use_fast_acc and self.spec.arch == 90:
+      # Periodic promotion of partial sums to FP32
+      scale *= 0.9
+    return self.spec.flops_per_clock * scale
+
+  def _candidates(self, dtypes, is_aligned):
+    """Enumerates (cta_m, cta_n, cta_k, cluster_m, cluster_n) candidates valid for the architecture"""
+    bits_a = DataTypeSize[dtypes[0]]
+    bits_b = DataTypeSize[dtypes[1]]
+    # 128B of the narrower operand along K, matching the generator's SM90 and SM100 tile shapes
+    cta_k = 1024 // min(bits_a, bits_b)
+
+    if self.spec.arch == 100:
+      tiles_m = [64, 128]
+      tiles_n = [16, 32, 64, 128, 192, 256]
+      clusters = [(1, 1), (2, 1), (4, 1), (1, 2), (2, 2), (4, 2)]
+      tiles_k = [cta_k]
+    else:
+      tiles_m = [64, 128, 256]
+      tiles_n = [16, 32, 64, 128, 192, 256]
+      clusters = [(1, 1), (2, 1), (1, 2), (2, 2)]
+      tiles_k = [cta_k, 2 * cta_k]
+
+    if not is_aligned:
+      clusters = [(1, 1)]
+
+    for cta_m, cta_n, cta_k, (cluster_m, cluster_n) in product(tiles_m, tiles_n, tiles_k, clusters):
+      if cta_m % self.cta_div_m != 0 or cta_n % self.cta_div_n != 0:
+        continue
+      if self.spec.arch != 100:
+        consumer_threads = 256 if cta_m >= 128 else 128
+        if cta_m * cta_n * DataTypeSize[dtypes[2]] // 32 // consumer_threads > self.SM90_ACCUMULATOR_REGISTERS:
+          continue
+      yield cta_m, cta_n, cta_k, cluster_m, cluster_n
+
+  def _epilogue_smem_bytes(self, dtypes, voidC):
+    """Shared memory staged by a TMA epilogue: two 64x32 subtiles of C and D"""
+    bits = DataTypeSize[dtypes[4]] + (0 if voidC else DataTypeSize[dtypes[3]])
+    return 2 * 64 * 32 * bits // 8
+
+  def _estimate(self, m, n, k, batch_count, dtypes, voidC, rate, cta_m, cta_n, cta_k, cluster_m, cluster_n, split_k):
+    """Returns (runtime, compute-bound runtime) in seconds and the stage count, or None if the config cannot run"""
+    spec = self.spec
+    bytes_a = DataTypeSize[dtypes[0]] / 8
+    bytes_b = DataTypeSize[dtypes[1]] / 8
+    bytes_acc = DataTypeSize[dtypes[2]] / 8
+    bytes_c = 0 if voidC else DataTypeSize[dtypes[3]] / 8
+    bytes_d = DataTypeSize[dtypes[4]] / 8
+
+    stages = compute_stage_count_sm90(
+      (cta_m, cta_n, cta_k), dtypes[0], dtypes[1],
+      carveout_bytes=self._epilogue_smem_bytes(dtypes, voidC),
+      capacity_bytes=spec.smem_capacity_bytes)
+    if stages < 2:
+      return None
+
+    is_2sm = spec.arch == 100 and cluster_m % 2 == 0
+    cluster_size = cluster_m * cluster_n
+    if cluster_size > spec.sm_count:
+      return None
+
+    # Wave quantization: clusters are scheduled whole, so tiles are rounded up to the cluster shape
+    tiles_m = math.ceil(math.ceil(m / cta_m) / cluster_m) * cluster_m
+    tiles_n = math.ceil(math.ceil(n / cta_n) / cluster_n) * cluster_n
+    ctas = tiles_m * tiles_n * batch_count * split_k
+    concurrent_ctas = (spec.sm_count // cluster_size) * cluster_size
+    waves = math.ceil(ctas / concurrent_ctas)
+
+    k_per_cta = math.ceil(math.ceil(k / split_k) / cta_k) * cta_k
+    k_iterations = k_per_cta // cta_k
+
+    # Per k-iteration costs of one CTA, in clocks
+    math_clocks = 2 * cta_m * cta_n * cta_k / rate
+    if spec.arch == 100:
+      smem_bytes = cta_k * (cta_m * bytes_a + (cta_n / 2 if is_2sm else cta_n) * bytes_b)
+    else:
+      # Each 64-row consumer warpgroup reads all of B
+      smem_bytes = cta_k * (cta_m * bytes_a + max(1, cta_m // 64) * cta_n * bytes_b)
+    smem_clocks = smem_bytes / self.SMEM_BYTES_PER_CLOCK
+    # TMA multicast shares A across the cluster's N dimension and B across its M dimension
+    l2_bytes = cta_k * (cta_m * bytes_a / cluster_n + cta_n * bytes_b / cluster_m)
+    l2_clocks = l2_bytes / self.L2_BYTES_PER_CLOCK
+
+    iteration_clocks = max(math_clocks, smem_clocks, l2_clocks)
+    if stages < 3:
+      # Too few stages to hide load latency behind the MMAs
+      iteration_clocks *= 1.25
+
+    epilogue_clocks = cta_m * cta_n * (bytes_d + bytes_c if split_k == 1 else bytes_acc * 2) / self.L2_BYTES_PER_CLOCK
+    tile_clocks = k_iterations * iteration_clocks + epilogue_clocks + self.TILE_OVERHEAD_CLOCKS
+    compute_seconds = waves * tile_clocks / spec.clock_hz
+
+    dram_bytes = batch_count * (m * k * bytes_a + n * k * bytes_b + m * n * (bytes_c + bytes_d))
+    if split_k > 1:
+      # Partial accumulators are written and reduced
+      dram_bytes += batch_count * m * n * bytes_acc * split_k * 2
+    dram_seconds = dram_bytes / spec.dram_bytes_per_second
+
+    return max(compute_seconds, dram_seconds), compute_seconds, stages
+
+  def _runtime_key(self, seconds):
+    """Estimated runtime rounded to RUNTIME_SIGNIFICANT_DIGITS, for ordering configs"""
+    return float(f"{seconds:.{self.RUNTIME_SIGNIFICANT_DIGITS}g}")
+
+  def _instruction_and_warp_tiles(self, dtypes, cta_m, cta_n, cluster_m):
+    """Returns (instr_m, instr_n, instr_k, warp_m, warp_n) of the MMA that computes a CTA tile"""
+    if max(DataTypeSize[dtypes[0]], DataTypeSize[dtypes[1]]) >= 64:
+      # Warp counts of the generator's SM90 DMMA tile descriptions
+      if cta_m * cta_n >= 128 * 128:
+        warps_m, warps_n = (2, 4) if cta_n > cta_m else (4, 2)
+      else:
+        warps_m, warps_n = 2, 2
+      instr_m, instr_n, instr_k = self.DMMA_INSTRUCTION_SHAPE
+      return instr_m, instr_n, instr_k, max(instr_m, cta_m // warps_m), max(instr_n, cta_n // warps_n)
+
+    is_2sm = self.spec.arch == 100 and cluster_m % 2 == 0
+    instr_m = 64 if self.spec.arch != 100 else (2 * cta_m if is_2sm else cta_m)
+    # WGMMA and UMMA consume 32B of K per instruction
+    instr_k = 256 // min(DataTypeSize[dtypes[0]], DataTypeSize[dtypes[1]])
+    # One warpgroup computes 64 rows of the tile
+    return instr_m, cta_n, instr_k, min(cta_m, 64), cta_n
+
+  def get_configs(self, m, n, k, batch_count, dtypes, layouts, align_a, align_b, voidC=False, use_fast_acc=True, count=1):
+    is_aligned = (align_a * DataTypeSize[dtypes[0]] >= 128) and (align_b * DataTypeSize[dtypes[1]] >= 128)
+    rate = self._math_rate(dtypes, use_fast_acc)
+
+    scored = []
+    for cta_m, cta_n, cta_k, cluster_m, cluster_n in self._candidates(dtypes, is_aligned):
+      tiles = math.ceil(m / cta_m) * math.ceil(n / cta_n) * batch_count
+      split_ks = [1]
+      if tiles < self.spec.sm_count // 2:
+        split_ks += [s for s in (2, 3, 4) if k // s >= 4 * cta_k]
+
+      for split_k in split_ks:
+        estimate = self._estimate(m, n, k, batch_count, dtypes, voidC, rate,
+                                  cta_m, cta_n, cta_k, cluster_m, cluster_n, split_k)
+        if estimate is None:
+          continue
+        runtime, compute_runtime, stages = estimate
+        # Among DRAM-bound configs, prefer the least compute time. Remaining ties, including
+        # runtimes that differ only by rounding, are broken towards smaller clusters, fewer splits
+        # and larger tiles, so that the order is total and does not depend on enumeration order.
+        order = (self._runtime_key(runtime), self._runtime_key(compute_runtime),
+                 cluster_m * cluster_n, split_k, -cta_m * cta_n, -cta_m, cta_k, cluster_m)
+        scored.append((order, runtime, (cta_m, cta_n, cta_k, cluster_m, cluster_n, split_k, stages)))
+
+    scored.sort(key=lambda entry: entry[0])
+
+    ret = []
+    for order, runtime, (cta_m, cta_n, cta_k, cluster_m, cluster_n, split_k, stages) in scored[:count]:
+      tiles_m = math.ceil(m / cta_m)
+      tiles_n = math.ceil(n / cta_n)
+      # Same choice as RasterOrderOptions::Heuristic in the SM90 tile schedulers
+      along_m = tiles_n > tiles_m
+      tiles_across = tiles_n if along_m else tiles_m
+      swizzle = 1
+      while swizzle < 8 and swizzle * 2 <= tiles_across and tiles_m * tiles_n > self.spec.sm_count:
+        swizzle *= 2
+
+      instr_m, instr_n, instr_k, warp_m, warp_n = self._instruction_and_warp_tiles(dtypes, cta_m, cta_n, cluster_m)
+
+      r = {}
+      r['estimated_runtime'] = runtime
+      r['cta_tile_m'] = cta_m
+      r['cta_tile_n'] = cta_n
+      r['cta_tile_k'] = cta_k
+      r['instr_tile_m'] = instr_m
+      r['instr_tile_n'] = instr_n
+      r['instr_tile_k'] = instr_k
+      r['warp_tile_m'] = warp_m
+      r['warp_tile_n'] = warp_n
+      r['warp_tile_k'] = cta_k
+      r['cluster_m'] = cluster_m
+      r['cluster_n'] = cluster_n
+      r['cluster_k'] = 1
+      r['stages'] = stages
+      r['layout_a'] = layouts[0]
+      r['layout_b'] = layouts[1]
+      r['layout_d'] = layouts[2]
+      r['dtype_a'] = dtypes[0]
+      r['dtype_b'] = dtypes[1]
+      r['dtype_acc'] = dtypes[2]
+      r['dtype_c'] = dtypes[3]
+      r['dtype_d'] = dtypes[4]
+      r['alignment_a'] = align_a
+      r['alignment_b'] = align_b
+      r['swizzle_size'] = swizzle
+      r['raster_order'] = 'along_m' if along_m else 'along_n'
+      r['split_k_slices'] = split_k
+      r['use_fast_acc'] = use_fast_acc
+      r['voidC'] = voidC
+
+      ret.append(r)
+
+    return ret
+
+
+HEURISTICS_PROVIDERS = ['auto', 'nvmmh', 'analytic']
+
+def create_heuristics_provider(provider = 'auto', gpu = None):
+  """
+  Creates a heuristics provider.
+
+  args:
+    provider: 'nvmmh' for MatmulHeuristics, 'analytic' for AnalyticMatmulHeuristics, or 'auto' to
+              use nvMatmulHeuristics when it can be imported and the analytic model otherwise
+    gpu: GPU name, or None to autodetect (nvmmh) or use DEFAULT_HEURISTICS_GPU (analytic)
+  """
+  if provider not in HEURISTICS_PROVIDERS:
+    raise ValueError(f"Unknown heuristics provider {provider}. Expected one of {HEURISTICS_PROVIDERS}")
+  if provider in ('auto', 'nvmmh'):
+    try:
+      return MatmulHeuristics(gpu=gpu)
+    except ImportError:
+      if provider == 'nvmmh':
+        raise
+      _LOGGER.warning("nvMatmulHeuristics is not available, using analytic heuristics")
+  return AnalyticMatmulHeuristics(gpu=gpu)
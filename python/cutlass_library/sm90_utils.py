@@ -440,8 +440,299 @@ def can_tile_desc_use_shmem_in_epilogue(tile_description, data_types):
     return True
 
 
+# Shared memory capacity of a single SM90 CTA (detail::sm90_smem_capacity_bytes in sm90_common.inl)
+SM90_SMEM_CAPACITY_BYTES = 232448
+
+# Bytes of mainloop pipeline barriers per stage (sizeof(PipelineTmaAsync<1>::SharedStorage))
+SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE = 16
+
+
+def compute_stage_count_sm90(tile_shape, element_a, element_b, carveout_bytes=0,
+                             capacity_bytes=SM90_SMEM_CAPACITY_BYTES, alignment=128):
+    """
+    Number of mainloop stages the collective builder selects for StageCountAutoCarveout<carveout_bytes>.
+    Mirrors detail::compute_stage_count_or_override in sm90_common.inl.
+    """
+    def round_up(value, multiple):
+        return (value + multiple - 1) // multiple * multiple
+
+    a_bytes = (DataTypeSize[element_a] * tile_shape[0] * tile_shape[2] + 7) // 8
+    b_bytes = (DataTypeSize[element_b] * tile_shape[1] * tile_shape[2] + 7) // 8
+    stage_bytes = round_up(a_bytes + b_bytes, alignment) + SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE
+    capacity = capacity_bytes // alignment * alignment
+    return (capacity - round_up(carveout_bytes, alignment)) // stage_bytes
+
+
+# Shared memory of a TMA descriptor (sizeof(cute::TmaDescriptor))
+SM90_TMA_DESCRIPTOR_BYTES = 128
+
+# Register file of a single SM90 SM, in 32-bit registers
+SM90_REGISTERS_PER_SM = 65536
+
+# Kernel schedules covered by compute_kernel_resources_sm90
+SM90_MODELED_KERNEL_SCHEDULES = (
+    KernelScheduleType.ScheduleAuto,
+    KernelScheduleType.CpAsyncWarpSpecialized,
+    KernelScheduleType.CpAsyncWarpSpecializedPingpong,
+    KernelScheduleType.CpAsyncWarpSpecializedCooperative,
+    KernelScheduleType.TmaWarpSpecialized,
+    KernelScheduleType.TmaWarpSpecializedPingpong,
+    KernelScheduleType.TmaWarpSpecializedCooperative,
+    KernelScheduleType.TmaWarpSpecializedFP8FastAccum,
+    KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum,
+    KernelScheduleType.TmaWarpSpecializedPingpongFP8FastAccum,
+    KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
+    KernelScheduleType.PtrArrayTmaWarpSpecializedCooperativeFP8FastAccum,
+    KernelScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+    KernelScheduleType.PtrArrayTmaWarpSpecializedPingpongFP8FastAccum,
+)
+
+# Estimated registers per MMA thread for addresses, predicates, loop state and epilogue
+# fragments, on top of the accumulators
+SM90_REGISTER_OVERHEAD_PER_THREAD = 32
+
+
+def _round_up(value, multiple):
+    return (value + multiple - 1) // multiple * multiple
+
+
+def _sm90_swizzle_alignment(major_extent, element_bits):
+    """
+    Shared memory alignment of the widest GMMA swizzle atom tiling a major-mode extent.
+    Mirrors the atom choice of ss_smem_selector / sm90_get_epilogue_smem_swizzle_layout_atom
+    together with detail::alignment_for_swizzle.
+    """
+    major_bytes = major_extent * element_bits // 8
+    for atom_bytes, alignment in ((128, 1024), (64, 512), (32, 256)):
+        if major_bytes % atom_bytes == 0:
+            return alignment
+    return 128
+
+
+def sm90_epilogue_tile(tile_shape, epilogue_schedule, element_d):
+    """
+    Epilogue subtile chosen by EpilogueTileAuto (sm90_compute_tile_shape_or_override in sm90_builder.inl)
+    """
+    cta_m, cta_n = tile_shape[0], tile_shape[1]
+    if epilogue_schedule in (EpilogueScheduleType.TmaWarpSpecializedCooperative,
+                             EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative):
+        return min(128, cta_m), math.gcd(min(32, cta_n), cta_n)
+
+    n_perf = 64 if DataTypeSize[element_d] == 8 and cta_n % 64 == 0 else 32
+    return min(64, cta_m), math.gcd(min(n_perf, cta_n), cta_n)
+
+
+def is_tma_epilogue_sm90(epilogue_schedule):
+    return epilogue_schedule in (
+        EpilogueScheduleType.TmaWarpSpecialized,
+        EpilogueScheduleType.TmaWarpSpecializedCooperative,
+        EpilogueScheduleType.PtrArrayTmaWarpSpecializedPingpong,
+        EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative,
+    )
+
+
+def compute_epilogue_smem_sm90(tile_shape, epilogue_schedule, element_c, element_d, layout_c=LayoutType.RowMajor):
+    """
+    Returns (sizeof(SharedStorage), sizeof(TensorStorage), alignment, stages_c) of the SM90 collective
+    epilogue. Mirrors the stage counts and storage layout of CollectiveEpilogue<Sm90TmaWarpSpecialized...>
+    for the default linear combination fusion. Epilogues without smem report an empty struct.
+    """
+    if not is_tma_epilogue_sm90(epilogue_schedule):
+        return 1, 1, 1, 0
+
+    epi_m, epi_n = sm90_epilogue_tile(tile_shape, epilogue_schedule, element_d)
+    is_void_c = element_c == DataType.void
+    bits_c = 0 if is_void_c else DataTypeSize[element_c]
+    bits_d = DataTypeSize[element_d]
+
+    epi_tiles = (tile_shape[0] // epi_m) * (tile_shape[1] // epi_n)
+    stages_d = min(epi_tiles, 2)
+    reuse_smem_c = bits_c == bits_d and bits_d > 8
+    stages_c = max(min(epi_tiles, 4), stages_d + 1) if reuse_smem_c else min(epi_tiles, 4)
+
+    # Void-C kernels still size the (unused) C buffer layout after D
+    smem_bits_c = bits_d if is_void_c else bits_c
+    major_extent = epi_n if layout_c == LayoutType.RowMajor else epi_m
+    alignment = max(_sm90_swizzle_alignment(major_extent, smem_bits_c),
+                    _sm90_swizzle_alignment(major_extent, bits_d))
+
+    bytes_c = epi_m * epi_n * stages_c * smem_bits_c // 8
+    bytes_d = epi_m * epi_n * (stages_c if reuse_smem_c else stages_d) * bits_d // 8
+    if is_void_c:
+        collective_bytes = bytes_d
+    elif reuse_smem_c:
+        collective_bytes = max(bytes_c, bytes_d)
+    else:
+        collective_bytes = _round_up(bytes_c, alignment) + bytes_d
+
+    # One byte for the empty fusion callbacks storage of a linear combination
+    tensor_bytes = _round_up(collective_bytes + 1, alignment)
+    shared_bytes = _round_up(tensor_bytes + SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE * stages_c, alignment)
+    return shared_bytes, tensor_bytes, alignment, stages_c
+
+
+class Sm90KernelResources:
+    """
+    Static shared memory and register footprint of an SM90 GEMM configuration
+    """
+    def __init__(self):
+        self.stages = 0
+        self.mainloop_smem_bytes = 0
+        self.epilogue_smem_bytes = 0
+        self.smem_bytes = 0
+        self.smem_capacity_bytes = SM90_SMEM_CAPACITY_BYTES
+        self.accumulator_registers = 0
+        self.registers = 0
+        self.register_budget = 0
+
+    def fits_smem(self):
+        return self.stages >= 2 and self.smem_bytes <= self.smem_capacity_bytes
+
+    def fits_registers(self):
+        return self.registers <= self.register_budget
+
+    def __repr__(self):
+        return (f"Sm90KernelResources(stages={self.stages}, smem={self.smem_bytes}/{self.smem_capacity_bytes}, "
+                f"mainloop_smem={self.mainloop_smem_bytes}, epilogue_smem={self.epilogue_smem_bytes}, "
+                f"registers={self.registers}/{self.register_budget})")
+
+
+def compute_kernel_resources_sm90(tile_description, data_types, layout, kernel_schedule, epilogue_schedule):
+    """
+    Models the resources of a dense SM90 GEMM kernel as instantiated by the emitter, i.e. with
+    StageCountAutoCarveout<sizeof(Epilogue::SharedStorage)> and EpilogueTileAuto.
+
+    Returns None for configurations the model does not cover (sparse kernels and schedules outside
+    SM90_MODELED_KERNEL_SCHEDULES); callers should keep those unchanged.
+    """
+    if tile_description.math_instruction.opcode_class == OpcodeClass.SparseTensorOp:
+        return None
+
+    if kernel_schedule not in SM90_MODELED_KERNEL_SCHEDULES:
+        return None
+
+    cta_m, cta_n, cta_k = tile_description.threadblock_shape
+    element_a, element_b = data_types["a_type"], data_types["b_type"]
+    bits_a, bits_b = DataTypeSize[element_a], DataTypeSize[element_b]
+    is_mixed_input = bits_a != bits_b
+    is_fp8 = element_a in (DataType.e4m3, DataType.e5m2) and element_b in (DataType.e4m3, DataType.e5m2)
+    name = kernel_schedule.name
+    grouped = name.startswith("PtrArray")
+
+    is_cp_async = name.startswith("CpAsync")
+    if kernel_schedule == KernelScheduleType.ScheduleAuto:
+        # KernelScheduleAuto resolves to a persistent TMA kernel with a smem-less epilogue
+        kernel = "pingpong" if cta_m == 64 else "cooperative"
+        if epilogue_schedule == EpilogueScheduleType.ScheduleAuto:
+            epilogue_schedule = EpilogueScheduleType.NoSmemWarpSpecialized
+    elif "Pingpong" in name:
+        kernel = "pingpong"
+    elif "Cooperative" in name:
+        kernel = "cooperative"
+    else:
+        kernel = "basic"
+
+    resources = Sm90KernelResources()
+
+    # Epilogue
+    epilogue_shared, epilogue_tensors, epilogue_alignment, epilogue_stages = compute_epilogue_smem_sm90(
+        tile_description.threadblock_shape, epilogue_schedule, data_types["c_type"], data_types["d_type"], layout[2][0])
+    resources.epilogue_smem_bytes = epilogue_tensors
+
+    # Mainloop
+    capacity = SM90_SMEM_CAPACITY_BYTES
+    if grouped:
+        capacity -= 2 * SM90_TMA_DESCRIPTOR_BYTES + 8 * SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE
+    mainloop_alignment = 128
+    if is_mixed_input:
+        major_a = cta_k if layout[0][0] == LayoutType.RowMajor else cta_m
+        major_b = cta_k if layout[1][0] == LayoutType.ColumnMajor else cta_n
+        mainloop_alignment = max(_sm90_swizzle_alignment(major_a, bits_a), _sm90_swizzle_alignment(major_b, bits_b))
+    resources.smem_capacity_bytes = capacity
+    resources.stages = compute_stage_count_sm90(
+        tile_description.threadblock_shape, element_a, element_b, carveout_bytes=epilogue_shared,
+        capacity_bytes=capacity, alignment=mainloop_alignment)
+
+    a_bytes = (bits_a * cta_m * cta_k + 7) // 8 * resources.stages
+    b_bytes = (bits_b * cta_n * cta_k + 7) // 8 * resources.stages
+    resources.mainloop_smem_bytes = _round_up(_round_up(a_bytes, 16) + b_bytes, 128)
+
+    # Kernel SharedStorage
+    pipeline_bytes = _round_up(SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE * resources.stages, 16)
+    pipeline_bytes += _round_up(SM90_MAINLOOP_PIPELINE_BYTES_PER_STAGE * epilogue_stages, 16) if epilogue_stages else 16
+    tensor_alignment = max(128, epilogue_alignment)
+    if kernel == "basic":
+        tensor_bytes = _round_up(max(resources.mainloop_smem_bytes, epilogue_tensors), tensor_alignment)
+        resources.smem_bytes = _round_up(tensor_bytes + pipeline_bytes, tensor_alignment)
+    else:
+        # Load order barrier, plus the math warp group order barrier of ping-pong kernels
+        pipeline_bytes += 16 if kernel == "cooperative" else 32
+        # Tile scheduler storage
+        header_bytes = _round_up(pipeline_bytes, 16) + 16
+        tensor_bytes = _round_up(_round_up(epilogue_tensors, 128) + resources.mainloop_smem_bytes, tensor_alignment)
+        resources.smem_bytes = _round_up(header_bytes, tensor_alignment) + tensor_bytes
+
+    # Registers of an MMA thread
+    num_mma_threads = 256 if kernel == "cooperative" else 128
+    acc_bits = DataTypeSize[data_types["acc_type"]]
+    resources.accumulator_registers = cta_m * cta_n // num_mma_threads * acc_bits // 32
+    registers = resources.accumulator_registers
+    if is_fp8 and "FastAccum" not in name:
+        # Two-level accumulation keeps a second set of accumulators for promotion
+        registers *= 2
+    if is_mixed_input:
+        # Converted A fragments of one k-block are staged through registers
+        registers += 64 * cta_k * 16 // 32 // 128
+    resources.registers = registers + SM90_REGISTER_OVERHEAD_PER_THREAD
+
+    if not is_cp_async and kernel != "basic":
+        # warpgroup_reg_alloc<MmaRegisterRequirement> in the persistent TMA kernels
+        resources.register_budget = 240 if resources.accumulator_registers >= 208 else 232
+    else:
+        threads = 256 if kernel == "basic" else 384
+        resources.register_budget = min(255, SM90_REGISTERS_PER_SM // threads // 8 * 8)
+
+    return resources
+
+
+def is_kernel_viable_sm90(tile_description, data_types, layout, kernel_schedule, epilogue_schedule,
+                          prune_register_spills=True):
+    """
+    Returns False if a configuration is known to exceed the SM90 shared memory capacity (it would fail to
+    compile or fail can_implement), or, when prune_register_spills is set, is expected to spill registers.
+    """
+    resources = compute_kernel_resources_sm90(
+        tile_description, data_types, layout, kernel_schedule, epilogue_schedule)
+    if resources is None:
+        return True
+    if not resources.fits_smem():
+        return False
+    return not prune_register_spills or resources.fits_registers()
+
+
 def get_valid_schedules(tile_description, cuda_version, is_aligned, data_types, layout,
                         instantiation_level, enable_fp8_fast_acc=True, gemm_kind=GemmKind.Universal3x):
+    """
+    Returns the kernel and stream-K schedules to stamp out for a tile description, dropping those
+    the SM90 resource model rejects. Configurations exceeding shared memory are dropped at every
+    level; configurations expected to spill registers are dropped from pruning level 1 onwards,
+    leaving the curated level-0 set as is.
+    """
+    schedules, stream_k_schedules = _enumerate_valid_schedules(
+        tile_description, cuda_version, is_aligned, data_types, layout,
+        instantiation_level, enable_fp8_fast_acc, gemm_kind)
+
+    prune_register_spills = get_pruning_level_from_global_level(instantiation_level) >= 1
+    def is_viable(schedule):
+        return is_kernel_viable_sm90(tile_description, data_types, layout, schedule[0], schedule[1],
+                                     prune_register_spills)
+
+    return ([s for s in schedules if is_viable(s)],
+            [s for s in stream_k_schedules if is_viable(s)])
+
+
+def _enumerate_valid_schedules(tile_description, cuda_version, is_aligned, data_types, layout,
+                               instantiation_level, enable_fp8_fast_acc, gemm_kind):
     # Level 0: prune according to existing generator.py behavior
     # Level >= 1: no pruning
     level = get_pruning_level_from_global_level(instantiation_level)
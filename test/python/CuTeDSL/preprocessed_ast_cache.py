@@ -0,0 +1,256 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Tests for the on-disk cache of preprocessed ASTs and the memoized signatures of jit functions.
+These tests only exercise host-side Python and do not require a GPU.
+"""
+
+import ast
+import functools
+import inspect
+import json
+import os
+import stat
+import tempfile
+import textwrap
+import types
+import unittest
+from unittest import mock
+
+from cutlass.base_dsl import cache_helpers
+from cutlass.base_dsl import dsl as dsl_module
+from cutlass.base_dsl.dsl import BaseDSL, DSLCallable, _get_arg_spec, _get_signature
+
+
+SOURCE = textwrap.dedent('''
+    def kernel(a, b=2):
+        data = b"\\x00\\x01"
+        scale = 1.5 + 2j
+        rest = ...
+        for i in range(a):
+            b = b + i
+        return b
+''')
+
+
+def load_function(path, source=SOURCE, name="kernel"):
+    """Writes `source` to `path` and returns function `name` defined in it"""
+    with open(path, "w") as f:
+        f.write(source)
+    scope = {}
+    exec(compile(source, path, "exec"), scope)
+    return scope[name]
+
+
+class PreprocessedAstFormatTest(unittest.TestCase):
+    def test_round_trip_keeps_locations(self):
+        tree = ast.parse(SOURCE)
+        ast.increment_lineno(tree, 41)
+        restored = cache_helpers._decode_ast(json.loads(json.dumps(cache_helpers._encode_ast(tree))))
+
+        self.assertEqual(ast.dump(tree, include_attributes=True), ast.dump(restored, include_attributes=True))
+        compile(restored, "<restored>", "exec")
+
+    def test_rejects_non_ast_types(self):
+        for name in ("literal_eval", "parse", "NodeVisitor", "os"):
+            with self.assertRaises(ValueError):
+                cache_helpers._decode_ast({"_type": name})
+        with self.assertRaises(ValueError):
+            cache_helpers._decode_ast({"_literal": "__import__('os').getcwd()"})
+
+
+class PreprocessedAstStoreTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        os.chmod(self.tmp.name, 0o700)
+        self.path = os.path.join(self.tmp.name, "preprocessed_ast")
+
+    def test_save_and_load(self):
+        tree = ast.parse(SOURCE)
+        fname = cache_helpers.save_preprocessed_ast("dsl", "k0", tree, 8, path=self.path)
+
+        self.assertIsNotNone(fname)
+        self.assertEqual(stat.S_IMODE(os.stat(self.path).st_mode), 0o700)
+        restored = cache_helpers.load_preprocessed_ast("dsl", "k0", path=self.path)
+        self.assertEqual(ast.dump(tree, include_attributes=True), ast.dump(restored, include_attributes=True))
+        self.assertIsNone(cache_helpers.load_preprocessed_ast("dsl", "k1", path=self.path))
+
+    def test_refuses_shared_directory(self):
+        tree = ast.parse(SOURCE)
+        cache_helpers.save_preprocessed_ast("dsl", "k0", tree, 8, path=self.path)
+        os.chmod(self.path, 0o777)
+
+        self.assertIsNone(cache_helpers.load_preprocessed_ast("dsl", "k0", path=self.path))
+        self.assertIsNone(cache_helpers.save_preprocessed_ast("dsl", "k1", tree, 8, path=self.path))
+
+    def test_eviction(self):
+        tree = ast.parse("x = 1")
+        for i in range(4):
+            fname = cache_helpers.save_preprocessed_ast("dsl", f"k{i}", tree, 2, path=self.path)
+            os.utime(fname, (i, i))
+
+        self.assertEqual(sorted(os.listdir(self.path)), ["dsl_k2.ast.json", "dsl_k3.ast.json"])
+
+    def test_corrupt_entry(self):
+        os.makedirs(self.path, mode=0o700)
+        with open(os.path.join(self.path, "dsl_k0.ast.json"), "w") as f:
+            f.write("not json")
+
+        self.assertIsNone(cache_helpers.load_preprocessed_ast("dsl", "k0", path=self.path))
+
+
+class PreprocessedAstKeyTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        self.file = os.path.join(self.tmp.name, "module.py")
+
+    def key(self, func, version="v0", dialects=("arith",)):
+        return cache_helpers.preprocessed_ast_key("dsl", version, func, list(dialects))
+
+    def test_stable(self):
+        self.assertEqual(self.key(load_function(self.file)), self.key(load_function(self.file)))
+
+    def test_invalidation(self):
+        base = self.key(load_function(self.file))
+
+        self.assertNotEqual(base, self.key(load_function(self.file), version="v1"))
+        self.assertNotEqual(base, self.key(load_function(self.file), dialects=("arith", "scf")))
+        # Edits anywhere in the module invalidate the entry, as may moving the function
+        self.assertNotEqual(base, self.key(load_function(self.file, SOURCE + "\nLIMIT = 4\n")))
+        self.assertNotEqual(base, self.key(load_function(self.file, "\n" + SOURCE)))
+
+    def test_missing_source(self):
+        scope = {}
+        exec("def kernel():\n    pass\n", scope)
+        self.assertIsNone(self.key(scope["kernel"]))
+
+
+class FakePreprocessor:
+    def __init__(self):
+        self.processed_functions = set()
+        self.transformed = []
+
+    def transform(self, func, exec_globals):
+        self.transformed.append(func)
+        self.processed_functions.add(func)
+        return ast.parse(inspect.getsource(func))
+
+
+class LoadOrTransformTest(unittest.TestCase):
+    def setUp(self):
+        self.tmp = tempfile.TemporaryDirectory()
+        self.addCleanup(self.tmp.cleanup)
+        os.chmod(self.tmp.name, 0o700)
+        self.file = os.path.join(self.tmp.name, "module.py")
+        path = os.path.join(self.tmp.name, "preprocessed_ast")
+        for name in ("load_preprocessed_ast", "save_preprocessed_ast"):
+            patcher = mock.patch.object(
+                dsl_module, name, functools.partial(getattr(cache_helpers, name), path=path))
+            patcher.start()
+            self.addCleanup(patcher.stop)
+
+    def make_dsl(self, disable_file_caching=False, version="v0"):
+        return types.SimpleNamespace(
+            name="dsl",
+            envar=types.SimpleNamespace(disable_file_caching=disable_file_caching, file_caching_capacity=8),
+            get_version=lambda: types.SimpleNamespace(hexdigest=lambda: version),
+            preprocessor=FakePreprocessor(),
+        )
+
+    def run_transform(self, dsl, func):
+        return BaseDSL._load_or_transform(dsl, func, {"os": os})
+
+    def test_warm_process_skips_transform(self):
+        cold = self.make_dsl()
+        expected = self.run_transform(cold, load_function(self.file))
+        self.assertEqual(len(cold.preprocessor.transformed), 1)
+
+        warm = self.make_dsl()
+        func = load_function(self.file)
+        tree = self.run_transform(warm, func)
+
+        self.assertEqual(warm.preprocessor.transformed, [])
+        self.assertIn(func, warm.preprocessor.processed_functions)
+        self.assertEqual(ast.dump(expected, include_attributes=True), ast.dump(tree, include_attributes=True))
+
+    def test_invalidated_entry_is_transformed(self):
+        self.run_transform(self.make_dsl(), load_function(self.file))
+
+        edited = self.make_dsl()
+        self.run_transform(edited, load_function(self.file, SOURCE + "\nLIMIT = 4\n"))
+        self.assertEqual(len(edited.preprocessor.transformed), 1)
+
+        upgraded = self.make_dsl(version="v1")
+        self.run_transform(upgraded, load_function(self.file))
+        self.assertEqual(len(upgraded.preprocessor.transformed), 1)
+
+    def test_disabled_file_caching(self):
+        self.run_transform(self.make_dsl(), load_function(self.file))
+
+        dsl = self.make_dsl(disable_file_caching=True)
+        self.run_transform(dsl, load_function(self.file))
+        self.assertEqual(len(dsl.preprocessor.transformed), 1)
+
+
+class MemoizedSignatureTest(unittest.TestCase):
+    def test_signature_is_inspected_once(self):
+        def kernel(a, b=2):
+            return a + b
+
+        with mock.patch.object(inspect, "signature", wraps=inspect.signature) as signature, \
+             mock.patch.object(inspect, "getfullargspec", wraps=inspect.getfullargspec) as getfullargspec:
+            first = _get_signature(kernel)
+            self.assertIs(first, _get_signature(kernel))
+            self.assertIs(_get_arg_spec(kernel), _get_arg_spec(kernel))
+
+        self.assertEqual(signature.call_count, 1)
+        self.assertEqual(getfullargspec.call_count, 1)
+        self.assertEqual(list(first.parameters), ["a", "b"])
+
+    def test_callable_uses_source_signature(self):
+        def source(a, b=2):
+            return a + b
+
+        materialized = [lambda *args: sum(args) for _ in range(2)]
+        signatures = [DSLCallable(f, source).get_signature() for f in materialized]
+
+        self.assertIs(signatures[0], signatures[1])
+        self.assertIs(signatures[0], _get_signature(source))
+        self.assertEqual(DSLCallable(materialized[0]).get_arg_spec().varargs, "args")
+
+
+if __name__ == '__main__':
+    unittest.main()
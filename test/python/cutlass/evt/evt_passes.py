@@ -0,0 +1,177 @@
+################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+################################################################################
+
+"""
+Unit test for the DAG IR simplification passes of EVT. The tests trace epilogues for SM90 and
+check the emitted C++ types, so they do not require a GPU.
+"""
+
+import logging
+import re
+import unittest
+
+import cutlass_cppgen
+from cutlass_cppgen import LayoutType, Tensor
+from cutlass_cppgen.backend.evt.backend.emitter_base import FusionCallbacks
+from cutlass_cppgen.epilogue import *
+from cutlass_library import DataType
+
+cutlass_cppgen.set_log_level(logging.WARNING)
+
+
+class TestEVTPasses(unittest.TestCase):
+
+    def setUp(self) -> None:
+        self.l, self.m, self.n = 2, 256, 512
+        self.element = DataType.f16
+
+    def fake_tensor(self, shape):
+        return Tensor(element=self.element, shape=shape, layout_tag=LayoutType.RowMajor)
+
+    def example_inputs(self, **scalars):
+        inputs = {
+            "accum": self.fake_tensor((self.l, self.m, self.n)),
+            "C": self.fake_tensor((self.l, self.m, self.n)),
+            "bias": self.fake_tensor((self.m, 1)),
+            "D": self.fake_tensor((self.l, self.m, self.n)),
+        }
+        inputs.update(scalars)
+        return inputs
+
+    def trace(self, fn, example_inputs):
+        visitor = cutlass_cppgen.epilogue.trace(fn, example_inputs, cc=90)
+        decl, _ = FusionCallbacks(visitor.dag_ir, cc=90, emit_CD=False).emit()
+        return visitor, decl
+
+    @staticmethod
+    def count(decl, node_type):
+        """
+        Number of emitted EVT nodes of the given type
+        """
+        return len(re.findall(rf"= cutlass::epilogue::fusion::{node_type}<", decl))
+
+    def test_common_subexpression(self):
+        """
+        Repeated subexpressions are computed once
+        """
+        def evt_repeated(accum, C, alpha, bias):
+            t0 = relu(accum * alpha + bias)
+            t1 = relu(alpha * accum + bias)
+            D = t0 * C + t1
+            return D
+
+        def evt_shared(accum, C, alpha, bias):
+            t0 = relu(accum * alpha + bias)
+            D = t0 * C + t0
+            return D
+
+        example_inputs = self.example_inputs(alpha=1.5)
+        _, repeated = self.trace(evt_repeated, example_inputs)
+        _, shared = self.trace(evt_shared, example_inputs)
+
+        self.assertEqual(self.count(repeated, "Sm90Compute"), self.count(shared, "Sm90Compute"))
+        self.assertEqual(self.count(repeated, "Sm90ColBroadcast"), 1)
+        self.assertEqual(self.count(repeated, "Sm90ScalarBroadcast"), 1)
+
+    def test_immediate_deduplication(self):
+        """
+        Identical immediates are loaded once
+        """
+        def evt_imm(accum, C):
+            D = accum * 2.0 + C * 2.0 - 0.5
+            return D
+
+        visitor, decl = self.trace(evt_imm, self.example_inputs())
+
+        self.assertEqual(self.count(decl, "Sm90ScalarBroadcast"), 2)
+        self.assertEqual(self.count(decl, "Sm90Compute"), 4)
+
+    def test_algebraic_simplification(self):
+        """
+        Identity operations are removed and immediate operations are folded
+        """
+        def evt_identity(accum, bias):
+            D = relu(identity(accum * 1.0) + (bias + 0.0) / 1.0)
+            return D
+
+        _, decl = self.trace(evt_identity, self.example_inputs())
+
+        self.assertEqual(self.count(decl, "Sm90Compute"), 2)
+        self.assertEqual(self.count(decl, "Sm90ScalarBroadcast"), 0)
+
+        def evt_fold(accum):
+            D = accum * (2.0 * 3.0)
+            return D
+
+        visitor, decl = self.trace(evt_fold, self.example_inputs())
+
+        self.assertEqual(self.count(decl, "Sm90Compute"), 1)
+        self.assertEqual(self.count(decl, "Sm90ScalarBroadcast"), 1)
+        immediates = [
+            meta for meta in visitor.dag_ir.nodes_meta
+            if meta.op == "load" and meta.tensor.is_constant]
+        self.assertEqual([meta.tensor.value for meta in immediates], [6.0])
+
+    def test_dead_node_elimination(self):
+        """
+        Intermediates that do not reach an output are removed
+        """
+        def evt_dead(accum, C, bias):
+            unused = relu(accum + bias) * 3.0
+            D = accum + C
+            return D
+
+        visitor, decl = self.trace(evt_dead, self.example_inputs())
+
+        self.assertEqual(self.count(decl, "Sm90Compute"), 1)
+        self.assertEqual(self.count(decl, "Sm90ScalarBroadcast"), 0)
+        self.assertFalse(visitor.dag_ir.has_node("unused"))
+        # Arguments are kept even when they are unused
+        self.assertTrue(visitor.dag_ir.has_node("bias"))
+
+    def test_store_producer_is_kept(self):
+        """
+        D is still produced by a compute node that converts to its element type
+        """
+        def evt_store(accum):
+            D = accum * 1.0
+            return D
+
+        visitor, decl = self.trace(evt_store, self.example_inputs())
+
+        self.assertEqual(self.count(decl, "Sm90Compute"), 1)
+        producer = visitor.dag_ir.get_all_inputs("D")[0]
+        self.assertEqual(visitor.dag_ir.get_node_meta(producer).element_output, self.element)
+
+
+if __name__ == '__main__':
+    unittest.main()
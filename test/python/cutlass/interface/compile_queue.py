@@ -0,0 +1,159 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Tests for the scheduling of the parallel compilation queue. Compilation is replaced by a stub that
+sleeps and returns fake binaries, so these tests do not require a GPU or a compiler.
+"""
+
+import threading
+import time
+import unittest
+
+from cutlass_cppgen.backend.compile_queue import CompilationQueue
+
+
+class StubCompiler:
+    """
+    Sleeps for ``latency`` seconds per batch and returns a fake binary per item. Items named
+    in ``failing`` fail any batch they are part of.
+    """
+
+    def __init__(self, latency=0.05, failing=()):
+        self.latency = latency
+        self.failing = set(failing)
+        self.batches = []
+        self.running = 0
+        self.max_running = 0
+        self.lock = threading.Lock()
+
+    def __call__(self, items):
+        with self.lock:
+            self.batches.append(list(items))
+            self.running += 1
+            self.max_running = max(self.max_running, self.running)
+        try:
+            time.sleep(self.latency)
+            bad = [item for item in items if item in self.failing]
+            if bad:
+                raise RuntimeError(f"Failed to compile {bad}")
+            return [f"cubin:{item}".encode() for item in items]
+        finally:
+            with self.lock:
+                self.running -= 1
+
+    @property
+    def compiled(self):
+        return [item for batch in self.batches for item in batch]
+
+
+class CompilationQueueTest(unittest.TestCase):
+
+    def test_results(self):
+        stub = StubCompiler(latency=0.01)
+        with CompilationQueue(stub, key=str, max_workers=2) as queue:
+            futures = queue.submit_many(range(10))
+            self.assertEqual([f.result() for f in futures], [f"cubin:{i}".encode() for i in range(10)])
+
+    def test_deduplication(self):
+        stub = StubCompiler()
+        with CompilationQueue(stub, key=str, max_workers=4) as queue:
+            first = queue.submit("gemm_f16")
+            second = queue.submit("gemm_f16")
+            self.assertIs(first, second)
+            first.result()
+
+            # Completed requests are served without recompiling
+            self.assertIs(queue.submit("gemm_f16"), first)
+
+        self.assertEqual(stub.compiled, ["gemm_f16"])
+        self.assertEqual(queue.submitted, 3)
+        self.assertEqual(queue.deduplicated, 2)
+
+    def test_batching(self):
+        stub = StubCompiler(latency=0.01)
+        with CompilationQueue(stub, key=str, max_workers=1, max_batch_size=4, batch_window=0.2) as queue:
+            futures = queue.submit_many(range(10))
+            queue.wait()
+            self.assertTrue(all(f.done() for f in futures))
+
+        self.assertEqual(sorted(stub.compiled), list(range(10)))
+        self.assertTrue(all(len(batch) <= 4 for batch in stub.batches))
+        self.assertEqual(len(stub.batches), 3)
+        self.assertEqual(queue.batches, 3)
+
+    def test_bounded_concurrency(self):
+        stub = StubCompiler(latency=0.1)
+        start = time.monotonic()
+        with CompilationQueue(stub, key=str, max_workers=3, max_batch_size=1, batch_window=0) as queue:
+            futures = queue.submit_many(range(9))
+            for future in futures:
+                future.result()
+        elapsed = time.monotonic() - start
+
+        self.assertEqual(stub.max_running, 3)
+        self.assertEqual(len(stub.batches), 9)
+        # Nine compilations of 0.1s each on three workers take three rounds rather than nine
+        self.assertLess(elapsed, 0.6)
+
+    def test_failure_is_isolated(self):
+        stub = StubCompiler(latency=0.01, failing=["bad"])
+        with CompilationQueue(stub, key=str, max_workers=1, max_batch_size=8, batch_window=0.2) as queue:
+            futures = queue.submit_many(["a", "bad", "b"])
+            queue.wait()
+
+            self.assertEqual(futures[0].result(), b"cubin:a")
+            self.assertEqual(futures[2].result(), b"cubin:b")
+            with self.assertRaises(RuntimeError):
+                futures[1].result()
+
+            # Failed requests are retried when submitted again
+            stub.failing.clear()
+            retry = queue.submit("bad")
+            self.assertIsNot(retry, futures[1])
+            self.assertEqual(retry.result(), b"cubin:bad")
+
+    def test_result_count_mismatch(self):
+        with CompilationQueue(lambda items: [], key=str, max_workers=1) as queue:
+            with self.assertRaises(RuntimeError):
+                queue.submit("a").result()
+
+    def test_submit_after_shutdown(self):
+        queue = CompilationQueue(StubCompiler(latency=0), key=str)
+        queue.shutdown()
+        with self.assertRaises(RuntimeError):
+            queue.submit("a")
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,398 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests and host overhead benchmark for bound GEMMs (``Gemm.bind``). The compiled runtime module
+is replaced by a host-only stand-in and device memory by host memory, so these tests do not
+require a GPU. The argument classes, their packing and their workspace handling are the backend's own.
+"""
+
+import ctypes
+import struct
+import sys
+import time
+import types
+import unittest
+from unittest import mock
+
+import numpy as np
+
+try:
+    from cuda import cuda
+except ImportError:
+    # Provide the members used when launching so that the tests run without cuda-python
+    cuda = types.ModuleType("cuda.cuda")
+    cuda.CUresult = types.SimpleNamespace(CUDA_SUCCESS=0)
+    cuda.CUstream = lambda handle=0: handle
+    package = types.ModuleType("cuda")
+    package.cuda = cuda
+    sys.modules["cuda"] = package
+    sys.modules["cuda.cuda"] = cuda
+
+from cutlass_library import GemmUniversalMode
+
+from cutlass_cppgen.backend import gemm_operation
+from cutlass_cppgen.backend.c_types import GemmCoord_, dim3_, get_gemm_arguments, get_gemm_arguments_streamk
+from cutlass_cppgen.backend.gemm_operation import GemmArguments2x, GemmArguments2xStreamK
+from cutlass_cppgen.backend.operation import LaunchConfiguration
+from cutlass_cppgen.op.gemm import BoundGemm
+from cutlass_cppgen.shape import GemmCoord
+
+
+class FakeTensor:
+    """
+    Device tensor exposing the attributes used by a bound GEMM
+    """
+    def __init__(self, shape, ptr, dtype="f16"):
+        self.shape = shape
+        self.dtype = dtype
+        self.ptr = ptr
+
+    def data_ptr(self):
+        return self.ptr
+
+
+class FakeDevice:
+    """
+    Stands in for device allocations and the driver calls the arguments make on them
+    """
+    CUresult = types.SimpleNamespace(CUDA_SUCCESS=0)
+    CUdeviceptr = int
+
+    def __init__(self):
+        self.allocations = []
+        self.async_memsets = 0
+
+    def alloc(self, size):
+        buffer = ctypes.create_string_buffer(size)
+        self.allocations.append(buffer)
+        return types.SimpleNamespace(ptr=ctypes.addressof(buffer))
+
+    def cuMemsetD32(self, ptr, value, count):
+        (ctypes.c_uint32 * count).from_address(int(ptr))[:] = [value] * count
+        return (self.CUresult.CUDA_SUCCESS,)
+
+    def cuMemsetD32Async(self, ptr, value, count, stream):
+        self.async_memsets += 1
+        return self.cuMemsetD32(ptr, value, count)
+
+
+class EpilogueParams(ctypes.Structure):
+    _fields_ = [
+        ("alpha", ctypes.c_float),
+        ("beta", ctypes.c_float),
+    ]
+
+
+EPILOGUE_FUNCTOR = types.SimpleNamespace(epilogue_type=EpilogueParams)
+
+
+# Layout of the packed parameters: problem size, a derived value, operand pointers in an order
+# different from that of the arguments, and the device workspace
+PARAMS_FORMAT = "<iiiiQQQQQ"
+DESCRIPTOR_KEY = 0x5555_0000_1111
+
+
+class FakeRuntime:
+    """
+    Stands in for a compiled runtime module of a CUTLASS 2 GEMM, using the backend's ctypes
+    argument structures. ``encode_A`` mimics parameters that store operand A in an encoded form,
+    such as a TMA descriptor.
+    """
+    threads = 128
+    shared_memory_capacity = 0
+    occupancy = 1
+
+    def __init__(self, stream_k=False, encode_A=False, workspace_bytes=0):
+        self.encode_A = encode_A
+        self.workspace_bytes = workspace_bytes
+        self.launches = []
+        get_arguments = get_gemm_arguments_streamk if stream_k else get_gemm_arguments
+        self.argument_type, self.epilogue_type = get_arguments(EPILOGUE_FUNCTOR)
+
+    def plan(self, arguments):
+        arguments.grid_tiled_shape = dim3_(1, 1, 1)
+        arguments.gemm_k_size = arguments.problem_size.k
+        return LaunchConfiguration([1, 1, 1], [self.threads, 1, 1], self.shared_memory_capacity)
+
+    def get_device_workspace_size(self, arguments, *args):
+        return self.workspace_bytes
+
+    def get_grid_shape(self, *args):
+        # Only stream-K arguments query the grid, which their module returns as a GemmCoord
+        return GemmCoord_(1, 1, 1)
+
+    def get_args(self, argument_ref, workspace, *args):
+        args = argument_ref._obj
+        m, n, k = args.problem_size.m, args.problem_size.n, args.problem_size.k
+        ptr_A = args.ptr_A ^ DESCRIPTOR_KEY if self.encode_A else args.ptr_A
+        params = struct.pack(PARAMS_FORMAT, m, n, k, (m + 127) // 128,
+                             args.ptr_B, args.ptr_D, args.ptr_C or 0, ptr_A, workspace.value or 0)
+        return ctypes.pointer((ctypes.c_char * len(params)).from_buffer_copy(params))
+
+    def unpack(self, params: bytes) -> dict:
+        m, n, k, _, ptr_B, ptr_D, ptr_C, ptr_A, workspace = struct.unpack(PARAMS_FORMAT, params)
+        if self.encode_A:
+            ptr_A ^= DESCRIPTOR_KEY
+        return {"shape": (m, n, k), "A": ptr_A, "B": ptr_B, "C": ptr_C, "D": ptr_D, "workspace": workspace}
+
+    def launch(self, launch_config, kernel_params, stream):
+        launch = self.unpack(ctypes.string_at(kernel_params[0], struct.calcsize(PARAMS_FORMAT)))
+        if launch["workspace"]:
+            # Tiles count their arrivals in the workspace, which must start out zeroed
+            flags = (ctypes.c_uint32 * (self.workspace_bytes // 4)).from_address(launch["workspace"])
+            launch["workspace_zeroed"] = not any(flags)
+            flags[:] = [flag + 1 for flag in flags]
+        self.launches.append(launch)
+        return cuda.CUresult.CUDA_SUCCESS
+
+
+class TracksFree:
+    freed = False
+
+    def free(self):
+        self.freed = True
+        super().free()
+
+
+class Arguments2x(TracksFree, GemmArguments2x):
+    pass
+
+
+class Arguments2xStreamK(TracksFree, GemmArguments2xStreamK):
+    pass
+
+
+def make_arguments(argument_class, rt_module, A, B, C, D, stream):
+    """
+    Constructs arguments of ``argument_class`` for FakeTensor operands. The constructor's tensor
+    conversion and operation introspection are skipped; ``initialize`` and ``pack`` are the backend's.
+    """
+    arguments = argument_class.__new__(argument_class)
+    arguments.operation = types.SimpleNamespace(rt_module=rt_module, argument_type=rt_module.argument_type)
+    arguments.stream = stream
+    arguments.buffers = {}
+    arguments.problem_size = GemmCoord(A.shape[0], B.shape[1], A.shape[1])
+    arguments.ptr_A = A.ptr
+    arguments.ptr_B = B.ptr
+    arguments.ptr_C = C.ptr if C is not None else 0
+    arguments.ptr_D = D.ptr
+    arguments.lda, arguments.ldb = A.shape[1], B.shape[1]
+    arguments.ldc = arguments.ldd = D.shape[1]
+    arguments.gemm_mode = GemmUniversalMode.Gemm
+    arguments.batch_count = arguments.split_k_slices = 1
+    arguments.batched_stride_A = arguments.batched_stride_B = 0
+    arguments.batched_stride_C = arguments.batched_stride_D = 0
+    arguments.output_op = rt_module.epilogue_type(1.0, 0.0)
+    arguments.initialize()
+    return arguments
+
+
+class FakePlan:
+    """
+    Stands in for ``cutlass_cppgen.op.Gemm``, counting how often arguments are constructed
+    """
+    def __init__(self, stream_k=False, encode_A=False, workspace_bytes=0):
+        self.rt_module = FakeRuntime(stream_k, encode_A, workspace_bytes)
+        self.argument_class = Arguments2xStreamK if stream_k else Arguments2x
+        self.built = []
+
+    def _build_arguments(self, A, B, C, D, alpha, beta, print_module, visitor_args, stream):
+        arguments = make_arguments(self.argument_class, self.rt_module, A, B, C, D, stream)
+        self.built.append(arguments)
+        return arguments
+
+
+def operands(m, n, k, base, alias_CD=False):
+    A = FakeTensor((m, k), base + 0x10000)
+    B = FakeTensor((k, n), base + 0x20000)
+    D = FakeTensor((m, n), base + 0x30000)
+    C = D if alias_CD else FakeTensor((m, n), base + 0x40000)
+    return A, B, C, D
+
+
+class GemmBindTest(unittest.TestCase):
+
+    def setUp(self):
+        self.device = FakeDevice()
+        for name, value in (("cuda", self.device), ("device_mem_alloc", self.device.alloc),
+                            ("device_sm_count", lambda: 132)):
+            patcher = mock.patch.object(gemm_operation, name, value)
+            patcher.start()
+            self.addCleanup(patcher.stop)
+
+    def check_launch(self, launch, A, B, C, D):
+        self.assertEqual(launch["shape"], (A.shape[0], B.shape[1], A.shape[1]))
+        self.assertEqual(launch["A"], A.ptr)
+        self.assertEqual(launch["B"], B.ptr)
+        self.assertEqual(launch["C"], C.ptr if C is not None else 0)
+        self.assertEqual(launch["D"], D.ptr)
+
+    def test_patches_pointers(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        for step in range(4):
+            tensors = operands(16, 256, 128, base=0x7F00_0000_0000 + step * 0x100_0000)
+            gemm(*tensors)
+            self.check_launch(plan.rt_module.launches[-1], *tensors)
+
+        self.assertEqual(len(plan.built), 1)
+        self.assertTrue(next(iter(gemm._packed.values())).patches_bytes)
+
+    def test_shapes_are_packed_once(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        shapes = [(16, 256, 128), (32, 256, 128), (16, 256, 128), (32, 256, 128), (64, 512, 64)]
+        for step, shape in enumerate(shapes):
+            tensors = operands(*shape, base=0x7F00_0000_0000 + step * 0x100_0000)
+            gemm(*tensors)
+            self.check_launch(plan.rt_module.launches[-1], *tensors)
+
+        self.assertEqual(len(plan.built), 3)
+
+    def test_aliased_operands(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 1.0, None, None, max_shapes=8)
+
+        for step, alias in enumerate([True, False, True, False]):
+            tensors = operands(16, 64, 32, base=0x7F00_0000_0000 + step * 0x100_0000, alias_CD=alias)
+            gemm(*tensors)
+            self.check_launch(plan.rt_module.launches[-1], *tensors)
+
+        # In-place and out-of-place launches use separate packed parameters
+        self.assertEqual(len(plan.built), 2)
+
+    def test_void_source(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        for step in range(3):
+            A, B, _, D = operands(16, 64, 32, base=0x7F00_0000_0000 + step * 0x100_0000)
+            gemm(A, B, None, D)
+            self.check_launch(plan.rt_module.launches[-1], A, B, None, D)
+
+        self.assertEqual(len(plan.built), 1)
+
+    def test_encoded_pointers_are_repacked(self):
+        plan = FakePlan(encode_A=True)
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        for step in range(3):
+            tensors = operands(16, 256, 128, base=0x7F00_0000_0000 + step * 0x100_0000)
+            gemm(*tensors)
+            self.check_launch(plan.rt_module.launches[-1], *tensors)
+
+        self.assertEqual(len(plan.built), 1)
+        self.assertFalse(next(iter(gemm._packed.values())).patches_bytes)
+
+    def test_packs_backend_arguments(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+        A, B, C, D = operands(16, 256, 128, base=0x7F00_0000_0000)
+        gemm(A, B, C, D)
+
+        arguments = plan.built[0]
+        self.assertIsInstance(arguments.c_arguments, plan.rt_module.argument_type)
+        self.assertEqual((arguments.c_arguments.ptr_A, arguments.c_arguments.ptr_D), (A.ptr, D.ptr))
+        self.assertEqual(bytes(arguments.pack()), bytes(arguments.host_workspace))
+
+    def test_stream_k_workspace_is_zeroed_per_launch(self):
+        plan = FakePlan(stream_k=True, workspace_bytes=256)
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        for step in range(4):
+            # Repeat the same operands as well as switching to new ones
+            tensors = operands(16, 256, 128, base=0x7F00_0000_0000 + step // 2 * 0x100_0000)
+            gemm(*tensors)
+            self.check_launch(plan.rt_module.launches[-1], *tensors)
+
+        self.assertEqual(len(plan.built), 1)
+        workspace = plan.built[0].workspace_buffer.ptr
+        for launch in plan.rt_module.launches:
+            self.assertEqual(launch["workspace"], workspace)
+            self.assertTrue(launch["workspace_zeroed"])
+        self.assertEqual(self.device.async_memsets, 4)
+
+    def test_serial_split_k_workspace_is_not_rezeroed(self):
+        # Serial split-K semaphores are reset by the kernel itself
+        plan = FakePlan(workspace_bytes=256)
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        for step in range(3):
+            gemm(*operands(16, 256, 128, base=0x7F00_0000_0000 + step * 0x100_0000))
+
+        self.assertTrue(plan.rt_module.launches[0]["workspace_zeroed"])
+        self.assertEqual(self.device.async_memsets, 0)
+
+    def test_eviction(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=2)
+
+        for m in [16, 32, 64]:
+            gemm(*operands(m, 64, 32, base=0x7F00_0000_0000))
+
+        self.assertEqual(len(gemm._packed), 2)
+        self.assertTrue(plan.built[0].freed)
+        self.assertFalse(plan.built[2].freed)
+
+    def test_rejects_host_operands(self):
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+        A, B, C, D = operands(16, 64, 32, base=0x7F00_0000_0000)
+        with self.assertRaises(Exception):
+            gemm(np.zeros((16, 32), dtype=np.float16), B, C, D)
+        self.assertEqual(len(plan.built), 0)
+
+    def test_host_overhead(self):
+        """
+        Reports the host time per launch of a bound GEMM once its parameters are packed
+        """
+        plan = FakePlan()
+        gemm = BoundGemm(plan, 1.0, 0.0, None, None, max_shapes=8)
+
+        batches = [operands(16, 4096, 4096, base=0x7F00_0000_0000 + i * 0x100_0000) for i in range(64)]
+        gemm(*batches[0])
+
+        iterations = 20000
+        start = time.perf_counter()
+        for i in range(iterations):
+            gemm(*batches[i % len(batches)])
+        elapsed_us = (time.perf_counter() - start) * 1e6 / iterations
+
+        print(f"\nBound GEMM host overhead: {elapsed_us:.2f} us/launch")
+        self.assertEqual(len(plan.built), 1)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,240 @@
+#################################################################################################
+#
+# Copyright (c) 2023 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+
+"""
+Tests for the plan cache used by the ``Gemm`` and ``Conv2d`` frontends. Compilation is replaced
+by a host-only stand-in, so these tests do not require a GPU.
+"""
+
+import os
+import tempfile
+import types
+import unittest
+
+from cutlass_library import DataType, KernelScheduleType, EpilogueScheduleType, OpcodeClass, OperationKind
+
+import cutlass_cppgen
+from cutlass_cppgen.backend.library import MathInstruction, TileDescription
+from cutlass_cppgen.backend.plan_cache import (
+    PlanCache,
+    PlanKey,
+    epilogue_signature,
+    problem_bucket,
+    tile_description_from_dict,
+    tile_description_to_dict,
+)
+from cutlass_cppgen.epilogue import relu
+import cutlass_cppgen.op.op as op_module
+from cutlass_cppgen.op.op import OperationBase
+
+
+def make_td(tile_m=128, kernel_schedule=None, epilogue_schedule=None):
+    math_instruction = MathInstruction([16, 8, 16], DataType.f16, DataType.f16, DataType.f32, OpcodeClass.TensorOp)
+    return TileDescription([tile_m, 128, 32], 3, [2, 2, 1], math_instruction,
+                           kernel_schedule=kernel_schedule, epilogue_schedule=epilogue_schedule)
+
+
+class FakeOperation:
+    def __init__(self, tile_description):
+        self.tile_description = tile_description
+        self.rt_module = types.SimpleNamespace(emit=lambda: "")
+
+
+class FakeCompiler:
+    """
+    Stands in for the artifact manager, recording which operations were compiled
+    """
+    backend = "nvcc"
+
+    def __init__(self):
+        self.compiled = []
+
+    def add_module(self, operations, keys=None):
+        for i, operation in enumerate(operations):
+            operation.artifact_key = keys[i] if keys is not None else f"artifact-{len(self.compiled)}"
+            self.compiled.append((operation, keys))
+
+
+class FakePlan(OperationBase):
+    """
+    Frontend with the attributes used by ``OperationBase._compile_plan``
+    """
+    def __init__(self):
+        self.operation_kind = OperationKind.Gemm
+        self.current_cc = 80
+        self._tile_description = None
+        self.tile_description_selector = None
+        self.constructed = []
+
+    @property
+    def tile_description(self):
+        return self._tile_description
+
+    @tile_description.setter
+    def tile_description(self, td):
+        self._tile_description = td
+
+    def construct(self, td):
+        # Constructing with an explicit tile description records it, as Gemm.construct does
+        if td is not None:
+            self._tile_description = td
+        self.constructed.append(td)
+        return FakeOperation(td if td is not None else make_td())
+
+    def run(self, M, N=256, K=64, epilogue_functor=None):
+        return self._compile_plan(
+            (DataType.f16, "row"), (M, N, K), epilogue_functor or types.SimpleNamespace(), self.construct)
+
+
+class PlanCacheTest(unittest.TestCase):
+
+    def setUp(self):
+        handle, self.cache_file = tempfile.mkstemp(suffix=".db")
+        os.close(handle)
+        self.saved = (op_module.compiler, op_module.plan_cache)
+        op_module.compiler = FakeCompiler()
+        op_module.plan_cache = PlanCache(cache_file=self.cache_file)
+
+    def tearDown(self):
+        op_module.compiler, op_module.plan_cache = self.saved
+        os.remove(self.cache_file)
+
+    def test_problem_bucket(self):
+        self.assertEqual(problem_bucket((1, 16, 17)), (16, 16, 32))
+        self.assertEqual(problem_bucket((1000, 1024, 1025)), (1024, 1024, 2048))
+        self.assertEqual(problem_bucket((3,), minimum=1), (4,))
+
+    def test_key_equality(self):
+        td = make_td()
+        a = PlanKey((OperationKind.Gemm, 80, (DataType.f16, DataType.f32), td))
+        b = PlanKey((OperationKind.Gemm, 80, (DataType.f16, DataType.f32), make_td()))
+        c = PlanKey((OperationKind.Gemm, 80, (DataType.f16, DataType.f16), td))
+        self.assertEqual(a, b)
+        self.assertEqual(hash(a), hash(b))
+        self.assertNotEqual(a, c)
+
+    def test_epilogue_signature(self):
+        functor = types.SimpleNamespace(activation_functor=relu)
+        self.assertEqual(epilogue_signature(functor), (relu.emit(), True))
+        visitor = types.SimpleNamespace(visitor=object())
+        signature, persistent = epilogue_signature(visitor)
+        self.assertFalse(persistent)
+        self.assertNotEqual(signature, epilogue_signature(types.SimpleNamespace(visitor=object()))[0])
+
+    def test_tile_description_round_trip(self):
+        td = make_td(256, KernelScheduleType.TmaWarpSpecializedCooperative,
+                     EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        restored = tile_description_from_dict(tile_description_to_dict(td))
+        self.assertEqual(tile_description_to_dict(restored), tile_description_to_dict(td))
+        self.assertEqual(restored.kernel_schedule, KernelScheduleType.TmaWarpSpecializedCooperative)
+        self.assertEqual(restored.math_instruction.element_accumulator, DataType.f32)
+
+    def test_lru_eviction(self):
+        cache = PlanCache(capacity=2, cache_file=None)
+        keys = [PlanKey((i,)) for i in range(3)]
+        cache.insert(keys[0], FakeOperation(make_td()))
+        cache.insert(keys[1], FakeOperation(make_td()))
+        self.assertIsNotNone(cache.lookup(keys[0]))
+        cache.insert(keys[2], FakeOperation(make_td()))
+        self.assertEqual(len(cache), 2)
+        self.assertIsNone(cache.lookup(keys[1]))
+        self.assertIsNotNone(cache.lookup(keys[0]))
+        self.assertEqual((cache.hits, cache.misses), (2, 1))
+
+    def test_dynamic_shapes_reuse_plans(self):
+        plan = FakePlan()
+        first = plan.run(M=100)
+        for M in (65, 99, 127, 128):
+            self.assertIs(plan.run(M=M), first)
+        self.assertIsNot(plan.run(M=129), first)
+        self.assertEqual(len(op_module.compiler.compiled), 2)
+
+    def test_plan_key_includes_epilogue(self):
+        plan = FakePlan()
+        identity_op = plan.run(M=64)
+        relu_op = plan.run(M=64, epilogue_functor=types.SimpleNamespace(activation_functor=relu))
+        self.assertIsNot(identity_op, relu_op)
+
+    def test_selector_called_once_per_bucket(self):
+        plan = FakePlan()
+        calls = []
+        small = make_td(64)
+        def selector(mnk):
+            calls.append(mnk)
+            return small if mnk[0] <= 64 else None
+        plan.tile_description_selector = selector
+
+        for M in (33, 40, 64, 300, 500):
+            plan.run(M=M)
+
+        self.assertEqual(calls, [(64, 256, 64), (512, 256, 64)])
+        self.assertEqual(plan.constructed, [small, None])
+        # The per-bucket choice does not become the plan's tile description
+        self.assertIsNone(plan.tile_description)
+
+    def test_explicit_tile_description_bypasses_selector(self):
+        plan = FakePlan()
+        plan.tile_description = make_td(256)
+        plan.tile_description_selector = lambda mnk: self.fail("selector must not be called")
+        plan.run(M=32)
+        self.assertEqual(plan.constructed, [None])
+
+    def test_records_reload_in_new_process(self):
+        plan = FakePlan()
+        plan.tile_description_selector = lambda mnk: make_td(64)
+        plan.run(M=48)
+        artifact_key = op_module.compiler.compiled[0][0].artifact_key
+
+        # A new process starts with empty in-memory caches and a selector that would choose differently
+        op_module.compiler = FakeCompiler()
+        op_module.plan_cache = PlanCache(cache_file=self.cache_file)
+        plan = FakePlan()
+        plan.tile_description_selector = lambda mnk: self.fail("recorded plans must not be reselected")
+        operation = plan.run(M=60)
+
+        self.assertEqual(operation.tile_description.threadblock_shape, [64, 128, 32])
+        self.assertEqual(op_module.compiler.compiled[0][1], [artifact_key])
+
+    def test_visitor_plans_stay_in_memory(self):
+        plan = FakePlan()
+        visitor = types.SimpleNamespace(visitor=object())
+        first = plan.run(M=32, epilogue_functor=visitor)
+        self.assertIs(plan.run(M=32, epilogue_functor=visitor), first)
+
+        op_module.plan_cache = PlanCache(cache_file=self.cache_file)
+        plan.run(M=32, epilogue_functor=visitor)
+        self.assertIsNone(op_module.compiler.compiled[-1][1])
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,142 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests for the analytic GEMM heuristics provider. They run offline and do not require a GPU.
+"""
+
+import unittest
+
+from cutlass_library import DataType, LayoutType
+from cutlass_library.heuristics_provider import AnalyticMatmulHeuristics, GPU_SPECS, create_heuristics_provider
+
+
+F16 = (DataType.f16, DataType.f16, DataType.f32, DataType.f16, DataType.f16)
+F64 = (DataType.f64, DataType.f64, DataType.f64, DataType.f64, DataType.f64)
+TN = (LayoutType.RowMajor, LayoutType.ColumnMajor, LayoutType.ColumnMajor)
+
+
+def summary(config):
+    return tuple(config[key] for key in (
+        'cta_tile_m', 'cta_tile_n', 'cta_tile_k', 'cluster_m', 'cluster_n', 'split_k_slices', 'stages'))
+
+
+class AnalyticHeuristicsTest(unittest.TestCase):
+
+    def test_ties_are_broken_deterministically(self):
+        heuristics = AnalyticMatmulHeuristics('H100_SXM')
+        # Several tile shapes have the same estimated runtime for this problem
+        configs = heuristics.get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=8)
+        self.assertEqual(configs[0]['estimated_runtime'], configs[1]['estimated_runtime'])
+
+        # The order does not depend on the order in which candidates are enumerated
+        candidates = AnalyticMatmulHeuristics._candidates
+        reversed_heuristics = AnalyticMatmulHeuristics('H100_SXM')
+        reversed_heuristics._candidates = lambda dtypes, is_aligned: reversed(list(candidates(reversed_heuristics, dtypes, is_aligned)))
+        reversed_configs = reversed_heuristics.get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=8)
+        self.assertEqual([summary(c) for c in configs], [summary(c) for c in reversed_configs])
+
+    def test_rounding_differences_are_ties(self):
+        heuristics = AnalyticMatmulHeuristics('H100_SXM')
+        estimate = heuristics._estimate
+
+        # Perturb the estimates below the significant digits compared, favoring fewer rows per tile
+        def perturbed(m, n, k, batch_count, dtypes, voidC, rate, cta_m, cta_n, *args):
+            result = estimate(m, n, k, batch_count, dtypes, voidC, rate, cta_m, cta_n, *args)
+            if result is None:
+                return None
+            runtime, compute_runtime, stages = result
+            scale = 1 + 1e-12 * cta_m
+            return runtime * scale, compute_runtime * scale, stages
+
+        heuristics._estimate = perturbed
+        expected = AnalyticMatmulHeuristics('H100_SXM').get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=4)
+        configs = heuristics.get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=4)
+        self.assertEqual([summary(c) for c in configs], [summary(c) for c in expected])
+
+    def test_f64_uses_dmma_shapes(self):
+        for gpu in ('H100_SXM', 'B200'):
+            heuristics = AnalyticMatmulHeuristics(gpu)
+            for config in heuristics.get_configs(4096, 4096, 4096, 1, F64, TN, 1, 1, count=10):
+                self.assertEqual((config['instr_tile_m'], config['instr_tile_n'], config['instr_tile_k']), (16, 8, 4))
+                self.assertEqual(config['cta_tile_m'] % config['warp_tile_m'], 0)
+                self.assertEqual(config['cta_tile_n'] % config['warp_tile_n'], 0)
+                self.assertEqual(config['warp_tile_m'] % config['instr_tile_m'], 0)
+                self.assertEqual(config['warp_tile_n'] % config['instr_tile_n'], 0)
+
+    def test_sm90_f16_uses_wgmma_shapes(self):
+        heuristics = AnalyticMatmulHeuristics('H100_SXM')
+        for config in heuristics.get_configs(2048, 2048, 2048, 1, F16, TN, 8, 8, count=10):
+            self.assertEqual(config['instr_tile_m'], 64)
+            self.assertEqual(config['instr_tile_n'], config['cta_tile_n'])
+            self.assertEqual(config['instr_tile_k'], 16)
+
+    def test_problem_shapes(self):
+        heuristics = AnalyticMatmulHeuristics('H100_SXM')
+
+        # Large problems fill the GPU without splitting K
+        self.assertEqual(heuristics.get_configs(8192, 8192, 8192, 1, F16, TN, 8, 8)[0]['split_k_slices'], 1)
+
+        # A single output tile with a long K is split
+        self.assertGreater(heuristics.get_configs(128, 128, 16384, 1, F16, TN, 8, 8)[0]['split_k_slices'], 1)
+
+        # Misaligned operands cannot use TMA multicast across a cluster
+        for config in heuristics.get_configs(1000, 1000, 1000, 1, F16, TN, 1, 1, count=10):
+            self.assertEqual((config['cluster_m'], config['cluster_n']), (1, 1))
+
+    def test_cta_divisibility(self):
+        heuristics = AnalyticMatmulHeuristics('H100_SXM')
+        heuristics.set_cta_div_m(128)
+        heuristics.set_cta_div_n(64)
+        for config in heuristics.get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=20):
+            self.assertEqual(config['cta_tile_m'] % 128, 0)
+            self.assertEqual(config['cta_tile_n'] % 64, 0)
+
+    def test_configs_fit_shared_memory(self):
+        for gpu, spec in GPU_SPECS.items():
+            heuristics = AnalyticMatmulHeuristics(gpu)
+            configs = heuristics.get_configs(4096, 4096, 4096, 1, F16, TN, 8, 8, count=5)
+            self.assertTrue(configs, gpu)
+            for config in configs:
+                self.assertGreaterEqual(config['stages'], 2)
+                self.assertLessEqual(config['cluster_m'] * config['cluster_n'], spec.sm_count)
+
+    def test_unknown_gpu_and_provider(self):
+        with self.assertRaises(ValueError):
+            AnalyticMatmulHeuristics('not_a_gpu')
+        with self.assertRaises(ValueError):
+            create_heuristics_provider('not_a_provider')
+        self.assertIsInstance(create_heuristics_provider('analytic'), AnalyticMatmulHeuristics)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,199 @@
+#################################################################################################
+#
+# Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice, this
+# list of conditions and the following disclaimer.
+#
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+# this list of conditions and the following disclaimer in the documentation
+# and/or other materials provided with the distribution.
+#
+# 3. Neither the name of the copyright holder nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+# DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+# SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+# CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+# OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#
+#################################################################################################
+
+"""
+Tests for the SM90 shared memory and register model used to prune generated kernels. They pin the
+estimates of known configurations and run offline without a GPU.
+"""
+
+import unittest
+
+from cutlass_library import (
+    DataType,
+    EpilogueScheduleType,
+    KernelScheduleType,
+    LayoutType,
+    MathInstruction,
+    MathOperation,
+    OpcodeClass,
+    TileDescription,
+)
+from cutlass_library.sm90_utils import (
+    compute_epilogue_smem_sm90,
+    compute_kernel_resources_sm90,
+    compute_stage_count_sm90,
+    is_kernel_viable_sm90,
+)
+
+
+TN = [[LayoutType.RowMajor, 8], [LayoutType.ColumnMajor, 8], [LayoutType.RowMajor, 8]]
+
+
+def data_types(element_ab, element_cd):
+    return {'a_type': element_ab, 'b_type': element_ab, 'c_type': element_cd, 'd_type': element_cd,
+            'acc_type': DataType.f32, 'epi_type': DataType.f32}
+
+
+F16 = data_types(DataType.f16, DataType.f16)
+E4M3 = data_types(DataType.e4m3, DataType.f16)
+
+
+def tile(shape, element, opcode_class=OpcodeClass.TensorOp):
+    math_instruction = MathInstruction([64, shape[1], 16], element, element, DataType.f32,
+                                       opcode_class, MathOperation.multiply_add)
+    return TileDescription(list(shape), 0, [4, 1, 1], math_instruction, 90, 90, [1, 1, 1])
+
+
+def resources(shape, types, kernel_schedule, epilogue_schedule):
+    return compute_kernel_resources_sm90(
+        tile(shape, types['a_type']), types, TN, kernel_schedule, epilogue_schedule)
+
+
+class Sm90StageCountTest(unittest.TestCase):
+
+    def test_stage_count_without_carveout(self):
+        # (16 KiB of A + 16 KiB of B + 16 B of barriers) per stage in 227 KiB
+        self.assertEqual(compute_stage_count_sm90((128, 128, 64), DataType.f16, DataType.f16), 7)
+
+    def test_stage_count_with_carveout(self):
+        self.assertEqual(compute_stage_count_sm90(
+            (128, 128, 64), DataType.f16, DataType.f16, carveout_bytes=33792), 6)
+
+    def test_cooperative_epilogue_smem(self):
+        # 128x32 subtiles, four stages of C reused for D, 512 B swizzle alignment
+        self.assertEqual(compute_epilogue_smem_sm90(
+            (128, 128, 64), EpilogueScheduleType.TmaWarpSpecializedCooperative, DataType.f16, DataType.f16),
+            (33792, 33280, 512, 4))
+
+    def test_no_smem_epilogue(self):
+        self.assertEqual(compute_epilogue_smem_sm90(
+            (128, 128, 64), EpilogueScheduleType.NoSmemWarpSpecialized, DataType.f16, DataType.f16),
+            (1, 1, 1, 0))
+
+
+class Sm90KernelResourcesTest(unittest.TestCase):
+
+    def assertResources(self, result, stages, smem, mainloop_smem, epilogue_smem, registers, register_budget):
+        self.assertEqual(
+            (result.stages, result.smem_bytes, result.mainloop_smem_bytes, result.epilogue_smem_bytes,
+             result.registers, result.register_budget),
+            (stages, smem, mainloop_smem, epilogue_smem, registers, register_budget))
+
+    def test_f16_cooperative_tma_epilogue(self):
+        result = resources((128, 128, 64), F16, KernelScheduleType.TmaWarpSpecializedCooperative,
+                           EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertResources(result, 6, 230400, 196608, 33280, 96, 232)
+        self.assertEqual(result.accumulator_registers, 64)
+        self.assertTrue(result.fits_smem())
+        self.assertTrue(result.fits_registers())
+
+    def test_f16_pingpong_tma_epilogue(self):
+        result = resources((64, 128, 64), F16, KernelScheduleType.TmaWarpSpecializedPingpong,
+                           EpilogueScheduleType.TmaWarpSpecialized)
+        self.assertResources(result, 8, 214016, 196608, 16896, 96, 232)
+
+    def test_f16_basic_no_smem_epilogue(self):
+        # Non-persistent kernels use __launch_bounds__ rather than setmaxnreg
+        result = resources((128, 128, 64), F16, KernelScheduleType.TmaWarpSpecialized,
+                           EpilogueScheduleType.NoSmemWarpSpecialized)
+        self.assertResources(result, 7, 229504, 229376, 1, 160, 255)
+
+    def test_auto_schedule_resolves_to_persistent_kernel(self):
+        result = resources((128, 128, 64), F16, KernelScheduleType.ScheduleAuto, EpilogueScheduleType.ScheduleAuto)
+        self.assertResources(result, 7, 229760, 229376, 1, 96, 232)
+
+    def test_cp_async_budget_is_launch_bounds(self):
+        result = resources((128, 128, 64), F16, KernelScheduleType.CpAsyncWarpSpecializedCooperative,
+                           EpilogueScheduleType.NoSmemWarpSpecialized)
+        self.assertResources(result, 7, 229760, 229376, 1, 96, 168)
+
+    def test_grouped_gemm_reserves_descriptors(self):
+        result = resources((128, 128, 64), F16, KernelScheduleType.PtrArrayTmaWarpSpecializedCooperative,
+                           EpilogueScheduleType.PtrArrayTmaWarpSpecializedCooperative)
+        self.assertResources(result, 6, 230400, 196608, 33280, 96, 232)
+        self.assertEqual(result.smem_capacity_bytes, 232064)
+
+    def test_fp8_two_level_accumulation_spills(self):
+        result = resources((128, 256, 128), E4M3, KernelScheduleType.TmaWarpSpecializedCooperative,
+                           EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertResources(result, 4, 230400, 196608, 33280, 288, 232)
+        self.assertTrue(result.fits_smem())
+        self.assertFalse(result.fits_registers())
+
+    def test_fp8_fast_accumulation_fits(self):
+        result = resources((128, 256, 128), E4M3, KernelScheduleType.TmaWarpSpecializedCooperativeFP8FastAccum,
+                           EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertResources(result, 4, 230400, 196608, 33280, 160, 232)
+        self.assertTrue(result.fits_registers())
+
+    def test_large_accumulators_raise_the_budget(self):
+        result = resources((128, 256, 64), F16, KernelScheduleType.TmaWarpSpecializedPingpong,
+                           EpilogueScheduleType.TmaWarpSpecialized)
+        self.assertEqual(result.accumulator_registers, 256)
+        self.assertResources(result, 4, 214016, 196608, 16896, 288, 240)
+
+    def test_single_stage_does_not_fit(self):
+        result = resources((256, 256, 128), F16, KernelScheduleType.TmaWarpSpecializedCooperative,
+                           EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertEqual(result.stages, 1)
+        self.assertFalse(result.fits_smem())
+
+    def test_unmodeled_kernels(self):
+        sparse = tile((128, 128, 128), DataType.f16, OpcodeClass.SparseTensorOp)
+        self.assertIsNone(compute_kernel_resources_sm90(
+            sparse, F16, TN, KernelScheduleType.TmaWarpSpecializedCooperative,
+            EpilogueScheduleType.TmaWarpSpecializedCooperative))
+        self.assertTrue(is_kernel_viable_sm90(
+            sparse, F16, TN, KernelScheduleType.TmaWarpSpecializedCooperative,
+            EpilogueScheduleType.TmaWarpSpecializedCooperative))
+
+
+class Sm90ViabilityTest(unittest.TestCase):
+
+    def viable(self, shape, types, kernel_schedule, epilogue_schedule, prune_register_spills=True):
+        return is_kernel_viable_sm90(tile(shape, types['a_type']), types, TN, kernel_schedule, epilogue_schedule,
+                                     prune_register_spills)
+
+    def test_register_spills_are_pruned_only_when_requested(self):
+        args = ((128, 256, 128), E4M3, KernelScheduleType.TmaWarpSpecializedCooperative,
+                EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertFalse(self.viable(*args))
+        self.assertTrue(self.viable(*args, prune_register_spills=False))
+
+    def test_smem_overflow_is_always_pruned(self):
+        args = ((256, 256, 128), F16, KernelScheduleType.TmaWarpSpecializedCooperative,
+                EpilogueScheduleType.TmaWarpSpecializedCooperative)
+        self.assertFalse(self.viable(*args, prune_register_spills=False))
+
+
+if __name__ == '__main__':
+    unittest.main()
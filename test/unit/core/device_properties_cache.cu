@@ -0,0 +1,291 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the process-wide device properties and occupancy cache
+*/
+
+#include <atomic>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/device_properties_cache.hpp"
+#include "cutlass/util/device_properties_snapshot.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+struct KernelA { };
+struct KernelB { };
+
+cutlass::KernelQueryKey make_key(int device, uint64_t kernel, int threads, int smem_size) {
+  cutlass::KernelQueryKey key;
+  key.device = device;
+  key.query = cutlass::KernelQuery::kMaxActiveBlocks;
+  key.kernel = kernel;
+  key.threads = threads;
+  key.smem_size = smem_size;
+  return key;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DevicePropertiesCache, attributes) {
+
+  cutlass::DevicePropertiesCache cache;
+
+  int value = 0;
+  EXPECT_FALSE(cache.find_attribute(value, 0, cutlass::DeviceAttribute::kMultiProcessorCount));
+
+  cache.set_attribute(0, cutlass::DeviceAttribute::kMultiProcessorCount, 132);
+  cache.set_attribute(1, cutlass::DeviceAttribute::kL2CacheSize, 50 << 20);
+
+  ASSERT_TRUE(cache.find_attribute(value, 0, cutlass::DeviceAttribute::kMultiProcessorCount));
+  EXPECT_EQ(value, 132);
+  ASSERT_TRUE(cache.find_attribute(value, 1, cutlass::DeviceAttribute::kL2CacheSize));
+  EXPECT_EQ(value, 50 << 20);
+  EXPECT_FALSE(cache.find_attribute(value, 1, cutlass::DeviceAttribute::kMultiProcessorCount));
+
+  // Out-of-range devices bypass the cache
+  cache.set_attribute(cutlass::DevicePropertiesCache::kMaxDevices, cutlass::DeviceAttribute::kMultiProcessorCount, 1);
+  EXPECT_FALSE(cache.find_attribute(value, cutlass::DevicePropertiesCache::kMaxDevices, cutlass::DeviceAttribute::kMultiProcessorCount));
+  EXPECT_FALSE(cache.find_attribute(value, -1, cutlass::DeviceAttribute::kMultiProcessorCount));
+
+  cache.clear();
+  EXPECT_FALSE(cache.find_attribute(value, 0, cutlass::DeviceAttribute::kMultiProcessorCount));
+}
+
+TEST(DevicePropertiesCache, kernel_id) {
+  using Cache = cutlass::DevicePropertiesCache;
+  EXPECT_EQ(Cache::kernel_id<KernelA>(), Cache::kernel_id<KernelA>());
+  EXPECT_NE(Cache::kernel_id<KernelA>(), Cache::kernel_id<KernelB>());
+}
+
+TEST(DevicePropertiesCache, kernel_query) {
+
+  cutlass::DevicePropertiesCache cache;
+
+  int calls = 0;
+  auto query = [&](int &value) {
+    ++calls;
+    value = 3;
+    return cutlass::Status::kSuccess;
+  };
+
+  auto key = make_key(0, cutlass::DevicePropertiesCache::kernel_id<KernelA>(), 256, 98304);
+
+  int value = 0;
+  EXPECT_EQ(cache.kernel_query(value, key, query), cutlass::Status::kSuccess);
+  EXPECT_EQ(cache.kernel_query(value, key, query), cutlass::Status::kSuccess);
+  EXPECT_EQ(value, 3);
+  EXPECT_EQ(calls, 1);
+
+  // Any field of the key distinguishes entries
+  auto other_device = key;
+  other_device.device = 1;
+  auto other_smem = key;
+  other_smem.smem_size = 0;
+  auto other_flags = key;
+  other_flags.flags = 1;
+  auto other_query = key;
+  other_query.query = cutlass::KernelQuery::kMaxActiveClusters;
+
+  for (auto const &other : {other_device, other_smem, other_flags, other_query}) {
+    EXPECT_FALSE(cache.find(value, other));
+  }
+  EXPECT_EQ(cache.kernel_query_count(), 1);
+
+  // Failed queries are not cached
+  auto failing = [&](int &) {
+    ++calls;
+    return cutlass::Status::kErrorInternal;
+  };
+  EXPECT_EQ(cache.kernel_query(value, other_device, failing), cutlass::Status::kErrorInternal);
+  EXPECT_EQ(cache.kernel_query(value, other_device, failing), cutlass::Status::kErrorInternal);
+  EXPECT_EQ(calls, 3);
+  EXPECT_FALSE(cache.find(value, other_device));
+
+  // Existing entries are not replaced
+  EXPECT_FALSE(cache.insert(key, 7));
+  ASSERT_TRUE(cache.find(value, key));
+  EXPECT_EQ(value, 3);
+}
+
+TEST(DevicePropertiesCache, full_cache_bypasses) {
+
+  cutlass::DevicePropertiesCache cache;
+
+  size_t const capacity = cutlass::DevicePropertiesCache::kKernelQueryCapacity;
+  for (size_t i = 0; i < capacity; ++i) {
+    ASSERT_TRUE(cache.insert(make_key(0, i, 128, 0), int(i)));
+  }
+
+  auto key = make_key(0, capacity, 128, 0);
+  EXPECT_FALSE(cache.insert(key, 1));
+
+  int calls = 0;
+  int value = 0;
+  auto query = [&](int &result) {
+    ++calls;
+    result = 5;
+    return cutlass::Status::kSuccess;
+  };
+  EXPECT_EQ(cache.kernel_query(value, key, query), cutlass::Status::kSuccess);
+  EXPECT_EQ(cache.kernel_query(value, key, query), cutlass::Status::kSuccess);
+  EXPECT_EQ(value, 5);
+  EXPECT_EQ(calls, 2);
+
+  ASSERT_TRUE(cache.find(value, make_key(0, capacity - 1, 128, 0)));
+  EXPECT_EQ(value, int(capacity - 1));
+}
+
+TEST(DevicePropertiesCache, concurrent_queries) {
+
+  cutlass::DevicePropertiesCache cache;
+
+  int const kThreads = 8;
+  int const kKernels = 500;
+
+  std::atomic<int> calls{0};
+  std::atomic<int> mismatches{0};
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&, t]() {
+      for (int i = 0; i < kKernels; ++i) {
+        int kernel = (i * 7 + t) % kKernels;
+        int value = 0;
+        cache.kernel_query(value, make_key(0, uint64_t(kernel), 128, kernel), [&](int &result) {
+          calls.fetch_add(1);
+          result = kernel % 16;
+          return cutlass::Status::kSuccess;
+        });
+        if (value != kernel % 16) {
+          mismatches.fetch_add(1);
+        }
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(mismatches.load(), 0);
+  EXPECT_EQ(cache.kernel_query_count(), size_t(kKernels));
+  EXPECT_GE(calls.load(), kKernels);
+  EXPECT_LT(calls.load(), kThreads * kKernels);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DevicePropertiesCache, snapshot) {
+
+  cutlass::DevicePropertiesCache cache;
+  cache.set_attribute(0, cutlass::DeviceAttribute::kMultiProcessorCount, 132);
+  cache.set_attribute(2, cutlass::DeviceAttribute::kComputeCapabilityMajor, 9);
+
+  auto blocks = make_key(0, cutlass::DevicePropertiesCache::kernel_id<KernelA>(), 384, 232448);
+  blocks.flags = 1;
+
+  cutlass::KernelQueryKey clusters;
+  clusters.query = cutlass::KernelQuery::kMaxActiveClusters;
+  clusters.kernel = cutlass::DevicePropertiesCache::kernel_id<KernelB>();
+  clusters.threads = 256;
+  clusters.cluster_x = 2;
+  clusters.cluster_y = 1;
+  clusters.cluster_z = 1;
+
+  auto limit = make_key(0, cutlass::DevicePropertiesCache::kernel_id<KernelA>(), 0, 232448);
+  limit.query = cutlass::KernelQuery::kDynamicSharedMemoryLimit;
+
+  cache.insert(blocks, 1);
+  cache.insert(clusters, 66);
+  cache.insert(limit, 232448);
+
+  std::stringstream snapshot;
+  cutlass::save_device_properties_snapshot(snapshot, cache);
+
+  cutlass::DevicePropertiesCache restored;
+  EXPECT_EQ(cutlass::load_device_properties_snapshot(snapshot, restored), 4);
+
+  int value = 0;
+  ASSERT_TRUE(restored.find_attribute(value, 0, cutlass::DeviceAttribute::kMultiProcessorCount));
+  EXPECT_EQ(value, 132);
+  ASSERT_TRUE(restored.find_attribute(value, 2, cutlass::DeviceAttribute::kComputeCapabilityMajor));
+  EXPECT_EQ(value, 9);
+  ASSERT_TRUE(restored.find(value, blocks));
+  EXPECT_EQ(value, 1);
+  ASSERT_TRUE(restored.find(value, clusters));
+  EXPECT_EQ(value, 66);
+
+  // The process must still configure its own kernels
+  EXPECT_FALSE(restored.find(value, limit));
+}
+
+TEST(DevicePropertiesCache, snapshot_errors) {
+
+  cutlass::DevicePropertiesCache cache;
+
+  for (char const *text : {
+         "attribute = 0 multiprocessor_count",
+         "attribute = 0 warp_size 32",
+         "kernel = dynamic_shared_memory_limit 0 0123 0 0 0 0 0 0 1",
+         "occupancy = 1 2 3 4",
+         "multiprocessor_count 132"}) {
+    std::stringstream snapshot(text);
+    EXPECT_THROW(cutlass::load_device_properties_snapshot(snapshot, cache), std::runtime_error) << text;
+  }
+
+  std::stringstream comments("# comment\n\n   \n");
+  EXPECT_EQ(cutlass::load_device_properties_snapshot(comments, cache), 0);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(DevicePropertiesCache, multiprocessor_count) {
+
+  int device = cutlass::DevicePropertiesCache::current_device();
+  ASSERT_GE(device, 0);
+
+  int expected = 0;
+  ASSERT_EQ(cudaDeviceGetAttribute(&expected, cudaDevAttrMultiProcessorCount, device), cudaSuccess);
+
+  EXPECT_EQ(cutlass::DevicePropertiesCache::multiprocessor_count(device), expected);
+  EXPECT_EQ(cutlass::DevicePropertiesCache::multiprocessor_count(device), expected);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,368 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the host-side TMA descriptor cache, driven by a mock CudaHostAdapter
+*/
+
+#include <cstdint>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/tma_descriptor_cache.hpp"
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Adapter that fabricates descriptors and counts driver calls. Word 0 of a fabricated descriptor
+/// holds its global address and word 1 a digest of the remaining parameters.
+struct MockCudaHostAdapter : cutlass::CudaHostAdapter {
+
+  mutable int encode_calls = 0;
+  mutable int replace_calls = 0;
+
+  cutlass::Status query_occupancy(int32_t *, int32_t *, int32_t, int32_t, int32_t) const override {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  cutlass::Status launch(dim3 const, dim3 const, size_t const, cudaStream_t, void**, int32_t) const override {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  cutlass::Status launch(dim3 const, dim3 const, dim3 const, size_t const, cudaStream_t, void**, int32_t) const override {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  cutlass::Status launch(dim3 const, dim3 const, dim3 const, dim3 const, size_t const, cudaStream_t, void**, int32_t) const override {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+  CUresult tensorMapEncodeIm2col(
+    CUtensorMap* tensorMap, CUtensorMapDataType tensorDataType, cuuint32_t tensorRank, void* globalAddress,
+    const cuuint64_t* globalDim, const cuuint64_t* globalStrides, const int* pixelBoxLowerCorner,
+    const int* pixelBoxUpperCorner, cuuint32_t channelsPerPixel, cuuint32_t pixelsPerColumn,
+    const cuuint32_t* elementStrides, CUtensorMapInterleave, CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion, CUtensorMapFloatOOBfill) const override {
+
+    ++encode_calls;
+    uint64_t digest = uint64_t(tensorDataType) * 31 + swizzle;
+    for (cuuint32_t i = 0; i < tensorRank; ++i) {
+      digest = digest * 31 + globalDim[i] + elementStrides[i];
+    }
+    for (cuuint32_t i = 0; i + 2 < tensorRank; ++i) {
+      digest = digest * 31 + uint64_t(pixelBoxLowerCorner[i] - pixelBoxUpperCorner[i]);
+    }
+    digest = digest * 31 + globalStrides[0] + channelsPerPixel * 7 + pixelsPerColumn;
+    return fabricate(tensorMap, globalAddress, digest);
+  }
+
+  CUresult tensorMapEncodeTiled(
+    CUtensorMap* tensorMap, CUtensorMapDataType tensorDataType, cuuint32_t tensorRank, void* globalAddress,
+    const cuuint64_t* globalDim, const cuuint64_t* globalStrides, const cuuint32_t* boxDim,
+    const cuuint32_t* elementStrides, CUtensorMapInterleave, CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion, CUtensorMapFloatOOBfill) const override {
+
+    ++encode_calls;
+    uint64_t digest = uint64_t(tensorDataType) * 31 + swizzle;
+    for (cuuint32_t i = 0; i < tensorRank; ++i) {
+      digest = digest * 31 + globalDim[i] * 3 + boxDim[i] * 5 + elementStrides[i];
+    }
+    for (cuuint32_t i = 0; i + 1 < tensorRank; ++i) {
+      digest = digest * 31 + globalStrides[i];
+    }
+    return fabricate(tensorMap, globalAddress, digest);
+  }
+
+  CUresult tensorMapReplaceAddress(CUtensorMap* tensorMap, void* globalAddress) const override {
+    ++replace_calls;
+    if (reinterpret_cast<uintptr_t>(globalAddress) % 16) {
+      return CUDA_ERROR_UNKNOWN;
+    }
+    reinterpret_cast<uint64_t *>(tensorMap)[0] = reinterpret_cast<uintptr_t>(globalAddress);
+    return CUDA_SUCCESS;
+  }
+
+protected:
+
+  cutlass::Status memsetDeviceImpl(void*, void const*, size_t, size_t, cudaStream_t) const override {
+    return cutlass::Status::kErrorNotSupported;
+  }
+
+private:
+
+  static CUresult fabricate(CUtensorMap* tensorMap, void* globalAddress, uint64_t digest) {
+    if (reinterpret_cast<uintptr_t>(globalAddress) % 16) {
+      return CUDA_ERROR_UNKNOWN;
+    }
+    *tensorMap = CUtensorMap{};
+    reinterpret_cast<uint64_t *>(tensorMap)[0] = reinterpret_cast<uintptr_t>(globalAddress);
+    reinterpret_cast<uint64_t *>(tensorMap)[1] = digest;
+    return CUDA_SUCCESS;
+  }
+};
+
+/// A K-major operand tile of a GEMM with M x K elements
+struct TiledOperand {
+  cuuint64_t dims[3];
+  cuuint64_t strides[2];
+  cuuint32_t box[3] = {64, 128, 1};
+  cuuint32_t element_strides[3] = {1, 1, 1};
+
+  TiledOperand(cuuint64_t m, cuuint64_t k, cuuint64_t batch = 1):
+    dims{k, m, batch}, strides{k * 2, k * m * 2} { }
+
+  CUresult encode(cutlass::TmaDescriptorCache &cache, CUtensorMap *desc, void *address) const {
+    return cache.encode_tiled(desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 3, address, dims, strides, box,
+      element_strides, CU_TENSOR_MAP_INTERLEAVE_NONE, CU_TENSOR_MAP_SWIZZLE_128B,
+      CU_TENSOR_MAP_L2_PROMOTION_L2_128B, CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE);
+  }
+
+  CUresult encode(MockCudaHostAdapter const &adapter, CUtensorMap *desc, void *address) const {
+    return adapter.tensorMapEncodeTiled(desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 3, address, dims, strides,
+      box, element_strides, CU_TENSOR_MAP_INTERLEAVE_NONE, CU_TENSOR_MAP_SWIZZLE_128B,
+      CU_TENSOR_MAP_L2_PROMOTION_L2_128B, CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE);
+  }
+};
+
+bool same_descriptor(CUtensorMap const &lhs, CUtensorMap const &rhs) {
+  return std::memcmp(&lhs, &rhs, sizeof(CUtensorMap)) == 0;
+}
+
+void *address(uintptr_t value) {
+  return reinterpret_cast<void *>(value);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TmaDescriptorCache, reuses_and_patches_address) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(16, &adapter);
+  TiledOperand operand(4096, 1024);
+
+  CUtensorMap first, second, third, reference;
+
+  ASSERT_EQ(operand.encode(cache, &first, address(0x10000)), CUDA_SUCCESS);
+  ASSERT_EQ(operand.encode(cache, &second, address(0x10000)), CUDA_SUCCESS);
+  ASSERT_EQ(operand.encode(cache, &third, address(0x20000)), CUDA_SUCCESS);
+
+  EXPECT_EQ(adapter.encode_calls, 1);
+  EXPECT_EQ(adapter.replace_calls, 1);
+  EXPECT_TRUE(same_descriptor(first, second));
+
+  // A patched descriptor matches one encoded from scratch at the new address
+  ASSERT_EQ(operand.encode(adapter, &reference, address(0x20000)), CUDA_SUCCESS);
+  EXPECT_TRUE(same_descriptor(third, reference));
+
+  auto stats = cache.statistics();
+  EXPECT_EQ(stats.encodes, 1u);
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.address_replacements, 1u);
+}
+
+TEST(TmaDescriptorCache, distinguishes_encoding_parameters) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(16, &adapter);
+  CUtensorMap desc;
+
+  TiledOperand operand(4096, 1024);
+  ASSERT_EQ(operand.encode(cache, &desc, address(0x10000)), CUDA_SUCCESS);
+
+  TiledOperand other_shape(4096, 2048);
+  ASSERT_EQ(other_shape.encode(cache, &desc, address(0x10000)), CUDA_SUCCESS);
+
+  TiledOperand other_box = operand;
+  other_box.box[1] = 256;
+  ASSERT_EQ(other_box.encode(cache, &desc, address(0x10000)), CUDA_SUCCESS);
+
+  ASSERT_EQ(cache.encode_tiled(&desc, CU_TENSOR_MAP_DATA_TYPE_BFLOAT16, 3, address(0x10000), operand.dims,
+    operand.strides, operand.box, operand.element_strides, CU_TENSOR_MAP_INTERLEAVE_NONE,
+    CU_TENSOR_MAP_SWIZZLE_128B, CU_TENSOR_MAP_L2_PROMOTION_L2_128B, CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE),
+    CUDA_SUCCESS);
+
+  ASSERT_EQ(cache.encode_tiled(&desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 3, address(0x10000), operand.dims,
+    operand.strides, operand.box, operand.element_strides, CU_TENSOR_MAP_INTERLEAVE_NONE,
+    CU_TENSOR_MAP_SWIZZLE_64B, CU_TENSOR_MAP_L2_PROMOTION_L2_128B, CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE),
+    CUDA_SUCCESS);
+
+  EXPECT_EQ(adapter.encode_calls, 5);
+  EXPECT_EQ(cache.size(), 5u);
+}
+
+TEST(TmaDescriptorCache, im2col) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(16, &adapter);
+
+  cuuint64_t dims[4] = {64, 56, 56, 8};
+  cuuint64_t strides[3] = {128, 128 * 56, 128 * 56 * 56};
+  cuuint32_t element_strides[4] = {1, 1, 1, 1};
+  int lower[2] = {-1, -1};
+  int upper[2] = {-1, -1};
+
+  auto encode = [&](CUtensorMap *desc, void *ptr, int pixels) {
+    return cache.encode_im2col(desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 4, ptr, dims, strides, lower, upper,
+      64, pixels, element_strides, CU_TENSOR_MAP_INTERLEAVE_NONE, CU_TENSOR_MAP_SWIZZLE_128B,
+      CU_TENSOR_MAP_L2_PROMOTION_L2_128B, CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE);
+  };
+
+  CUtensorMap desc;
+  ASSERT_EQ(encode(&desc, address(0x40000), 128), CUDA_SUCCESS);
+  ASSERT_EQ(encode(&desc, address(0x80000), 128), CUDA_SUCCESS);
+  ASSERT_EQ(encode(&desc, address(0x80000), 256), CUDA_SUCCESS);
+
+  // Tiled and im2col descriptors never alias
+  TiledOperand operand(56, 64);
+  ASSERT_EQ(operand.encode(cache, &desc, address(0x80000)), CUDA_SUCCESS);
+
+  EXPECT_EQ(adapter.encode_calls, 3);
+  EXPECT_EQ(adapter.replace_calls, 1);
+}
+
+TEST(TmaDescriptorCache, evicts_least_recently_used) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(2, &adapter);
+  CUtensorMap desc;
+
+  TiledOperand a(128, 64), b(256, 64), c(512, 64);
+  ASSERT_EQ(a.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);
+  ASSERT_EQ(b.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);
+  ASSERT_EQ(a.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);
+  ASSERT_EQ(c.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);  // evicts b
+  EXPECT_EQ(adapter.encode_calls, 3);
+
+  ASSERT_EQ(a.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);
+  EXPECT_EQ(adapter.encode_calls, 3);
+  ASSERT_EQ(b.encode(cache, &desc, address(0x1000)), CUDA_SUCCESS);
+  EXPECT_EQ(adapter.encode_calls, 4);
+  EXPECT_EQ(cache.size(), 2u);
+}
+
+TEST(TmaDescriptorCache, propagates_errors) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(16, &adapter);
+  TiledOperand operand(4096, 1024);
+  CUtensorMap desc;
+
+  // Failed encodes are not cached
+  EXPECT_NE(operand.encode(cache, &desc, address(0x10008)), CUDA_SUCCESS);
+  EXPECT_EQ(cache.size(), 0u);
+
+  ASSERT_EQ(operand.encode(cache, &desc, address(0x10000)), CUDA_SUCCESS);
+  EXPECT_NE(operand.encode(cache, &desc, address(0x20008)), CUDA_SUCCESS);
+
+  // The cached descriptor is unaffected by the failed replacement
+  CUtensorMap reference;
+  ASSERT_EQ(operand.encode(cache, &desc, address(0x10000)), CUDA_SUCCESS);
+  ASSERT_EQ(operand.encode(adapter, &reference, address(0x10000)), CUDA_SUCCESS);
+  EXPECT_TRUE(same_descriptor(desc, reference));
+}
+
+TEST(TmaDescriptorCache, scope_routes_encodes) {
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(16, &adapter);
+  TiledOperand operand(4096, 1024);
+  CUtensorMap desc;
+
+  EXPECT_EQ(cutlass::TmaDescriptorCache::active(), nullptr);
+  {
+    cutlass::TmaDescriptorCache::Scope scope(&cache);
+    EXPECT_EQ(cutlass::TmaDescriptorCache::active(), &cache);
+    for (uintptr_t i = 1; i <= 4; ++i) {
+      ASSERT_EQ(cutlass::tma_descriptor_encode_tiled(&desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 3,
+        address(i << 16), operand.dims, operand.strides, operand.box, operand.element_strides,
+        CU_TENSOR_MAP_INTERLEAVE_NONE, CU_TENSOR_MAP_SWIZZLE_128B, CU_TENSOR_MAP_L2_PROMOTION_L2_128B,
+        CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE), CUDA_SUCCESS);
+    }
+    {
+      cutlass::TmaDescriptorCache::Scope disabled(nullptr);
+      EXPECT_EQ(cutlass::TmaDescriptorCache::active(), nullptr);
+    }
+    EXPECT_EQ(cutlass::TmaDescriptorCache::active(), &cache);
+  }
+  EXPECT_EQ(cutlass::TmaDescriptorCache::active(), nullptr);
+
+  EXPECT_EQ(adapter.encode_calls, 1);
+  EXPECT_EQ(adapter.replace_calls, 3);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Requests served when lowering the A, B, C and D descriptors of a sequence of launches, with the
+/// weights fixed and the other pointers rotating between launches as in a decode loop. Host timing
+/// against the driver lives in examples/92_tma_descriptor_cache.
+TEST(TmaDescriptorCache, counters_per_launch) {
+
+  constexpr int kLaunches = 64;
+  constexpr int kBuffers = 4;
+
+  TiledOperand operands[4] = {
+    TiledOperand(4096, 4096), TiledOperand(128, 4096), TiledOperand(4096, 128), TiledOperand(4096, 128)
+  };
+
+  MockCudaHostAdapter adapter;
+  cutlass::TmaDescriptorCache cache(64, &adapter);
+  CUtensorMap desc;
+
+  for (int launch = 0; launch < kLaunches; ++launch) {
+    for (int i = 0; i < 4; ++i) {
+      uintptr_t buffer = (i == 0) ? kBuffers + 1 : launch % kBuffers + 1;
+      void *ptr = address((buffer << 32) + (uintptr_t(i) << 24));
+      ASSERT_EQ(operands[i].encode(cache, &desc, ptr), CUDA_SUCCESS);
+    }
+  }
+
+  // C and D share their encoding parameters, and hence a cache entry, so only A, B and C miss.
+  // A holds the weights and hits on every later launch; B, C and D replace the cached address.
+  cutlass::TmaDescriptorCacheStatistics stats = cache.statistics();
+  EXPECT_EQ(stats.encodes, 3u);
+  EXPECT_EQ(stats.hits, uint64_t(kLaunches - 1));
+  EXPECT_EQ(stats.address_replacements, uint64_t(3 * kLaunches - 2));
+  EXPECT_EQ(stats.encodes + stats.hits + stats.address_replacements, uint64_t(4 * kLaunches));
+  EXPECT_EQ(cache.size(), 3u);
+
+  EXPECT_EQ(adapter.encode_calls, 3);
+  EXPECT_EQ(adapter.replace_calls, 3 * kLaunches - 2);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
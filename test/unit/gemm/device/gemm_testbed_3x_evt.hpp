@@ -36,6 +36,11 @@
 #pragma once
 #include "gemm_testbed_3x.hpp" 
 
+#include <array>
+#include <vector>
+
+#include "cutlass/util/host_thread_pool.h"
+
 namespace test {
 namespace gemm {
 namespace device {
@@ -1274,21 +1279,37 @@ public:
     static int constexpr kBlockM = 64;
     static int constexpr kBlockN = 64;
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int64_t l = 0; l < cute::size<2>(mainloop_params.A.layout()); ++l) {
-      for (int64_t m = 0; m < cute::size<0>(mainloop_params.A.layout()); m += kBlockM) {
-        for (int64_t n = 0; n < cute::size<0>(mainloop_params.B.layout()); n += kBlockN) {
-          ElementAccumulator acc[kBlockM][kBlockN];
-          gett_mainloop(mainloop_params, m, n, l, acc);
-          /// Epilogue EVT
+    int64_t blocks_l = cute::size<2>(mainloop_params.A.layout());
+    int64_t blocks_m = (cute::size<0>(mainloop_params.A.layout()) + kBlockM - 1) / kBlockM;
+    int64_t blocks_n = (cute::size<0>(mainloop_params.B.layout()) + kBlockN - 1) / kBlockN;
+
+    // Mainloops run on the host thread pool. The EVT visitors accumulate reductions, so the
+    // epilogue visits the blocks serially and in order.
+    using BlockAccumulator = std::array<std::array<ElementAccumulator, kBlockN>, kBlockM>;
+    std::vector<BlockAccumulator> block_acc(size_t(blocks_l * blocks_m * blocks_n));
+
+    cutlass::host_thread_pool().parallel_for(int64_t(block_acc.size()), [&](int64_t begin, int64_t end) {
+      for (int64_t block = begin; block < end; ++block) {
+        ElementAccumulator acc[kBlockM][kBlockN];
+        gett_mainloop(mainloop_params, (block / blocks_n % blocks_m) * kBlockM,
+                      (block % blocks_n) * kBlockN, block / blocks_n / blocks_m, acc);
+        for (int m_b = 0; m_b < kBlockM; ++m_b) {
           for (int n_b = 0; n_b < kBlockN; ++n_b) {
-            for (int m_b = 0; m_b < kBlockM; ++m_b) {
-              if (m + m_b < cute::size<0>(LayoutD) && n + n_b < cute::size<1>(LayoutD)) {
-                host_reference.visit(m, n, l, m_b, n_b, acc[m_b][n_b]);
-              }
-            }
+            block_acc[size_t(block)][m_b][n_b] = acc[m_b][n_b];
+          }
+        }
+      }
+    });
+
+    for (int64_t block = 0; block < int64_t(block_acc.size()); ++block) {
+      int64_t l = block / blocks_n / blocks_m;
+      int64_t m = (block / blocks_n % blocks_m) * kBlockM;
+      int64_t n = (block % blocks_n) * kBlockN;
+      /// Epilogue EVT
+      for (int n_b = 0; n_b < kBlockN; ++n_b) {
+        for (int m_b = 0; m_b < kBlockM; ++m_b) {
+          if (m + m_b < cute::size<0>(LayoutD) && n + n_b < cute::size<1>(LayoutD)) {
+            host_reference.visit(m, n, l, m_b, n_b, block_acc[size_t(block)][m_b][n_b]);
           }
         }
       }
@@ -1528,21 +1549,37 @@ public:
     static int constexpr kBlockM = 64;
     static int constexpr kBlockN = 64;
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int64_t l = 0; l < cute::size<2>(mainloop_params.A.layout()); ++l) {
-      for (int64_t m = 0; m < cute::size<0>(mainloop_params.A.layout()); m += kBlockM) {
-        for (int64_t n = 0; n < cute::size<0>(mainloop_params.B.layout()); n += kBlockN) {
-          ElementAccumulator acc[kBlockM][kBlockN];
-          gett_mainloop(mainloop_params, m, n, l, acc);
-          /// Epilogue EVT
+    int64_t blocks_l = cute::size<2>(mainloop_params.A.layout());
+    int64_t blocks_m = (cute::size<0>(mainloop_params.A.layout()) + kBlockM - 1) / kBlockM;
+    int64_t blocks_n = (cute::size<0>(mainloop_params.B.layout()) + kBlockN - 1) / kBlockN;
+
+    // Mainloops run on the host thread pool. The EVT visitors accumulate reductions, so the
+    // epilogue visits the blocks serially and in order.
+    using BlockAccumulator = std::array<std::array<ElementAccumulator, kBlockN>, kBlockM>;
+    std::vector<BlockAccumulator> block_acc(size_t(blocks_l * blocks_m * blocks_n));
+
+    cutlass::host_thread_pool().parallel_for(int64_t(block_acc.size()), [&](int64_t begin, int64_t end) {
+      for (int64_t block = begin; block < end; ++block) {
+        ElementAccumulator acc[kBlockM][kBlockN];
+        gett_mainloop(mainloop_params, (block / blocks_n % blocks_m) * kBlockM,
+                      (block % blocks_n) * kBlockN, block / blocks_n / blocks_m, acc);
+        for (int m_b = 0; m_b < kBlockM; ++m_b) {
           for (int n_b = 0; n_b < kBlockN; ++n_b) {
-            for (int m_b = 0; m_b < kBlockM; ++m_b) {
-              if (m + m_b < cute::size<0>(LayoutD) && n + n_b < cute::size<1>(LayoutD)) {
-                host_reference.visit(m, n, l, m_b, n_b, acc[m_b][n_b]);
-              }
-            }
+            block_acc[size_t(block)][m_b][n_b] = acc[m_b][n_b];
+          }
+        }
+      }
+    });
+
+    for (int64_t block = 0; block < int64_t(block_acc.size()); ++block) {
+      int64_t l = block / blocks_n / blocks_m;
+      int64_t m = (block / blocks_n % blocks_m) * kBlockM;
+      int64_t n = (block % blocks_n) * kBlockN;
+      /// Epilogue EVT
+      for (int n_b = 0; n_b < kBlockN; ++n_b) {
+        for (int m_b = 0; m_b < kBlockM; ++m_b) {
+          if (m + m_b < cute::size<0>(LayoutD) && n + n_b < cute::size<1>(LayoutD)) {
+            host_reference.visit(m, n, l, m_b, n_b, block_acc[size_t(block)][m_b][n_b]);
           }
         }
       }
@@ -43,6 +43,8 @@
 #include "testbed_utils.h"
 #include "gemm_testbed_3x.hpp"
 
+#include "cutlass/util/host_thread_pool.h"
+
 namespace test {
 namespace gemm {
 namespace device {
@@ -296,11 +298,19 @@ struct Testbed3xTensorBroadcast {
     cutlass::NumericConverter<ElementD, ElementCompute, Epilogue::ThreadEpilogueOp::kRound> destination_converter;
     cutlass::multiplies<ElementCompute> mul;
 
+    int64_t extent_m = cute::size<0>(A.layout());
+    int64_t extent_n = cute::size<0>(B.layout());
+    int64_t extent_l = cute::size<2>(A.layout());
+
+    // Outputs narrower than a byte may share bytes with the outputs of another thread
+    constexpr bool kParallel = cute::sizeof_bits_v<ElementD> >= 8;
+
     // Compute broadcast operations atop the reference
-    #pragma omp parallel for collapse(3)
-    for (int64_t l = 0; l < cute::size<2>(A.layout()); ++l) {
-      for (int64_t m = 0; m < cute::size<0>(A.layout()); ++m) {
-        for (int64_t n = 0; n < cute::size<0>(B.layout()); ++n) {
+    cutlass::host_thread_pool().parallel_for(extent_l * extent_m, [&](int64_t begin, int64_t end) {
+      for (int64_t lm = begin; lm < end; ++lm) {
+        int64_t l = lm / extent_m;
+        int64_t m = lm % extent_m;
+        for (int64_t n = 0; n < extent_n; ++n) {
           ElementCompute intermediate = RefComputeOut(m, n, l);
           // Apply BinaryOp0, if needed
           if constexpr (IsBinaryOp0Enabled) {
@@ -325,7 +335,7 @@ struct Testbed3xTensorBroadcast {
           D(m, n, l) = destination_converter(intermediate);
         }
       }
-    }
+    }, 1, kParallel ? 0 : 1);
 
     return compare_reference(problem_shape_MNKL, alpha, beta, use_bias);
   }
@@ -0,0 +1,199 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests comparing the runtime-dispatched host GEMM reference with the typed reference
+*/
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/library/library.h"
+
+#include "reference/gemm_reference_operation.h"
+#include "reference/gemm_host_reference_operation.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using cutlass::ComplexTransform;
+using cutlass::layout::ColumnMajor;
+using cutlass::layout::RowMajor;
+using cutlass::library::GemmUniversalArguments;
+using cutlass::library::GemmUniversalConfiguration;
+using cutlass::library::GemmUniversalMode;
+using cutlass::library::Provider;
+
+/// Small integers, some of which overflow narrow outputs once accumulated
+template <typename Element>
+std::vector<Element> random_matrix(size_t count, int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(-7, 7);
+  std::vector<Element> data(count);
+  for (auto &x : data) {
+    if constexpr (cutlass::is_complex<Element>::value) {
+      x = Element(float(dist(rng)), float(dist(rng)));
+    }
+    else {
+      x = Element(float(dist(rng)));
+    }
+  }
+  return data;
+}
+
+template <typename Layout>
+int64_t leading_dim(int rows, int columns) {
+  return std::is_same_v<Layout, RowMajor> ? columns : rows;
+}
+
+/// Runs the typed and runtime-dispatched host references on the same batched problem and
+/// returns true if D is bitwise identical
+template <
+  typename ElementA, typename LayoutA, ComplexTransform TransformA,
+  typename ElementB, typename LayoutB, ComplexTransform TransformB,
+  typename ElementC, typename LayoutC,
+  typename ElementCompute, typename ElementAccumulator, typename ElementD,
+  typename ConvertOp = cutlass::NumericConverter<ElementD, ElementCompute>
+>
+bool host_references_match(cutlass::gemm::GemmCoord problem, int batch_count) {
+
+  using TypedOperation = cutlass::library::GemmReferenceOperation<
+    Provider::kReferenceHost,
+    ElementA, LayoutA, TransformA,
+    ElementB, LayoutB, TransformB,
+    ElementC, LayoutC,
+    ElementCompute, ElementAccumulator, ElementD,
+    ConvertOp
+  >;
+
+  using Support = cutlass::library::GemmHostReferenceSupport<
+    ElementA, ElementB, ElementC, ElementCompute, ElementAccumulator, ElementD,
+    ConvertOp, cutlass::multiply_add<ElementAccumulator>>;
+
+  static_assert(Support::kValue, "types must be supported by the runtime-dispatched reference");
+
+  TypedOperation typed;
+  cutlass::library::GemmHostReferenceOperation dispatched(
+    cutlass::library::make_gemm_reference_description<
+      ElementA, LayoutA, TransformA,
+      ElementB, LayoutB, TransformB,
+      ElementC, LayoutC,
+      ElementCompute, ElementAccumulator, ElementD
+    >(Provider::kReferenceHost),
+    Support::kClamp);
+
+  int const M = problem.m();
+  int const N = problem.n();
+  int const K = problem.k();
+
+  GemmUniversalConfiguration config;
+  config.mode = GemmUniversalMode::kBatched;
+  config.problem_size = problem;
+  config.batch_count = batch_count;
+  config.lda = leading_dim<LayoutA>(M, K);
+  config.ldb = leading_dim<LayoutB>(K, N);
+  config.ldc = leading_dim<LayoutC>(M, N);
+  config.ldd = config.ldc;
+
+  auto A = random_matrix<ElementA>(size_t(M) * K * batch_count, 1);
+  auto B = random_matrix<ElementB>(size_t(K) * N * batch_count, 2);
+  auto C = random_matrix<ElementC>(size_t(M) * N * batch_count, 3);
+  std::vector<ElementD> D_typed(size_t(M) * N * batch_count);
+  std::vector<ElementD> D_dispatched(size_t(M) * N * batch_count);
+
+  ElementCompute alpha = ElementCompute(2);
+  ElementCompute beta = ElementCompute(-1);
+
+  GemmUniversalArguments args;
+  args.problem_size = problem;
+  args.batch_count = batch_count;
+  args.A = A.data();
+  args.B = B.data();
+  args.C = C.data();
+  args.alpha = &alpha;
+  args.beta = &beta;
+  args.batch_stride_A = int64_t(M) * K;
+  args.batch_stride_B = int64_t(K) * N;
+  args.batch_stride_C = int64_t(M) * N;
+  args.batch_stride_D = int64_t(M) * N;
+
+  for (auto *op : {static_cast<cutlass::library::Operation const *>(&typed),
+                   static_cast<cutlass::library::Operation const *>(&dispatched)}) {
+
+    std::vector<uint8_t> host_workspace(op->get_host_workspace_size(&config));
+    args.D = (op == &typed ? D_typed.data() : D_dispatched.data());
+
+    EXPECT_EQ(op->initialize(&config, host_workspace.data()), cutlass::Status::kSuccess);
+    EXPECT_EQ(op->run(&args, host_workspace.data()), cutlass::Status::kSuccess);
+  }
+
+  return std::memcmp(D_typed.data(), D_dispatched.data(), D_typed.size() * sizeof(ElementD)) == 0;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GemmHostReferenceOperation, f16_f32_matches_typed_reference) {
+  for (cutlass::gemm::GemmCoord problem : {cutlass::gemm::GemmCoord(1, 1, 1),
+                                           cutlass::gemm::GemmCoord(37, 21, 19)}) {
+    EXPECT_TRUE((host_references_match<
+      cutlass::half_t, RowMajor, ComplexTransform::kNone,
+      cutlass::half_t, ColumnMajor, ComplexTransform::kNone,
+      float, ColumnMajor,
+      float, float, cutlass::half_t
+    >(problem, 2)));
+  }
+}
+
+TEST(GemmHostReferenceOperation, s8_clamp_matches_typed_reference) {
+  EXPECT_TRUE((host_references_match<
+    int8_t, ColumnMajor, ComplexTransform::kNone,
+    int8_t, RowMajor, ComplexTransform::kNone,
+    int32_t, RowMajor,
+    float, int32_t, int8_t,
+    cutlass::NumericConverterClamp<int8_t, float>
+  >(cutlass::gemm::GemmCoord(24, 17, 40), 3)));
+}
+
+TEST(GemmHostReferenceOperation, cf32_conjugate_matches_typed_reference) {
+  EXPECT_TRUE((host_references_match<
+    cutlass::complex<float>, ColumnMajor, ComplexTransform::kConjugate,
+    cutlass::complex<float>, RowMajor, ComplexTransform::kNone,
+    cutlass::complex<float>, ColumnMajor,
+    cutlass::complex<float>, cutlass::complex<float>, cutlass::complex<float>
+  >(cutlass::gemm::GemmCoord(13, 29, 11), 2)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
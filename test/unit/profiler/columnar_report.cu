@@ -0,0 +1,270 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the columnar report sink of the profiler
+*/
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/profiler/columnar_report.h"
+
+using namespace cutlass::profiler;
+using cutlass::TimingStatistics;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::vector<std::string> const kArguments = {"m", "n"};
+
+std::string report_path(char const *name) {
+  std::string path = ::testing::TempDir() + "cutlass_test_" + name + ".cprof";
+  std::remove(path.c_str());
+  return path;
+}
+
+PerformanceResult make_result(size_t index, bool with_statistics = false) {
+  PerformanceResult result;
+  result.problem_index = index;
+  result.provider = cutlass::library::Provider::kCUTLASS;
+  result.op_kind = cutlass::library::OperationKind::kGemm;
+  result.disposition = index % 3 ? Disposition::kPassed : Disposition::kNotVerified;
+  result.status = cutlass::Status::kSuccess;
+  result.operation_name = "gemm_" + std::to_string(index % 2);
+  result.arguments = {{"m", std::to_string(128 * (index % 4))}, {"n", "64"}};
+  result.bytes = int64_t(1000 + index);
+  result.flops = int64_t(2000 * index);
+  result.runtime = 0.5 + double(index);
+  result.runtime_vector = {result.runtime, result.runtime + 0.25};
+
+  if (with_statistics && index % 2) {
+    TimingStatistics &stats = result.runtime_statistics;
+    stats.samples = int(10 + index);
+    stats.outliers = int(index % 3);
+    stats.mean = result.runtime;
+    stats.median = result.runtime - 0.125;
+    stats.p90 = result.runtime + 0.25;
+    stats.p99 = result.runtime + 0.5;
+    stats.min = result.runtime - 0.25;
+    stats.max = result.runtime + 1;
+    stats.stddev = 0.0625;
+    stats.confidence_half_width = 0.03125;
+  }
+  return result;
+}
+
+void write_report(
+  std::string const &path,
+  size_t first,
+  size_t count,
+  bool append = false,
+  bool with_statistics = false,
+  size_t row_group_size = 3) {
+
+  ColumnarReportWriter writer(path, {{"tag", "x"}}, kArguments, 2, with_statistics, append, row_group_size);
+  ASSERT_TRUE(writer.good());
+  for (size_t i = first; i < first + count; ++i) {
+    writer.append(make_result(i, with_statistics));
+  }
+  writer.close();
+  EXPECT_EQ(writer.rows_written(), count);
+}
+
+/// Reads every row of a report, counting segments
+std::vector<PerformanceResult> read_report(std::string const &path, int *segments = nullptr) {
+  std::vector<PerformanceResult> results;
+  ColumnarReportReader reader(path);
+  EXPECT_TRUE(reader.good());
+  int schemas = 0;
+  while (reader.next()) {
+    schemas += reader.schema_changed();
+    EXPECT_EQ(reader.schema().argument_names, kArguments);
+    EXPECT_EQ(reader.schema().num_devices, 2u);
+    for (size_t row = 0; row < reader.row_group().num_rows; ++row) {
+      results.push_back(reader.result(row));
+    }
+  }
+  EXPECT_TRUE(reader.good());
+  if (segments) {
+    *segments = schemas;
+  }
+  return results;
+}
+
+void expect_equal(PerformanceResult const &actual, PerformanceResult const &expected) {
+  EXPECT_EQ(actual.problem_index, expected.problem_index);
+  EXPECT_EQ(actual.provider, expected.provider);
+  EXPECT_EQ(actual.op_kind, expected.op_kind);
+  EXPECT_EQ(actual.disposition, expected.disposition);
+  EXPECT_EQ(actual.status, expected.status);
+  EXPECT_EQ(actual.operation_name, expected.operation_name);
+  EXPECT_EQ(actual.arguments, expected.arguments);
+  EXPECT_EQ(actual.bytes, expected.bytes);
+  EXPECT_EQ(actual.flops, expected.flops);
+  EXPECT_EQ(actual.runtime, expected.runtime);
+  EXPECT_EQ(actual.runtime_vector, expected.runtime_vector);
+
+  TimingStatistics const &a = actual.runtime_statistics;
+  TimingStatistics const &b = expected.runtime_statistics;
+  EXPECT_EQ(a.samples, b.samples);
+  EXPECT_EQ(a.outliers, b.outliers);
+  EXPECT_EQ(a.mean, b.mean);
+  EXPECT_EQ(a.median, b.median);
+  EXPECT_EQ(a.p90, b.p90);
+  EXPECT_EQ(a.p99, b.p99);
+  EXPECT_EQ(a.min, b.min);
+  EXPECT_EQ(a.max, b.max);
+  EXPECT_EQ(a.stddev, b.stddev);
+  EXPECT_EQ(a.confidence_half_width, b.confidence_half_width);
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Profiler_ColumnarReport, round_trip) {
+
+  for (bool with_statistics : {false, true}) {
+    std::string path = report_path("round_trip");
+
+    // 8 rows in groups of 3 leave a partial final row group
+    write_report(path, 0, 8, false, with_statistics);
+
+    int segments = 0;
+    std::vector<PerformanceResult> results = read_report(path, &segments);
+
+    EXPECT_EQ(segments, 1);
+    ASSERT_EQ(results.size(), 8u);
+    for (size_t i = 0; i < results.size(); ++i) {
+      expect_equal(results[i], make_result(i, with_statistics));
+    }
+  }
+}
+
+TEST(Profiler_ColumnarReport, append) {
+
+  std::string path = report_path("append");
+
+  // Appending to a missing file starts a new report
+  write_report(path, 0, 4, true);
+  write_report(path, 4, 5, true);
+
+  int segments = 0;
+  std::vector<PerformanceResult> results = read_report(path, &segments);
+
+  EXPECT_EQ(segments, 2);
+  ASSERT_EQ(results.size(), 9u);
+  for (size_t i = 0; i < results.size(); ++i) {
+    expect_equal(results[i], make_result(i));
+  }
+}
+
+TEST(Profiler_ColumnarReport, append_truncated) {
+
+  std::string path = report_path("append_truncated");
+
+  write_report(path, 0, 7, false, false, 3);
+
+  uint64_t complete_bytes = 0;
+  {
+    // Position after the second row group, leaving the third row group and footer
+    ColumnarReportReader reader(path);
+    ASSERT_TRUE(reader.next());
+    ASSERT_TRUE(reader.next());
+    complete_bytes = reader.valid_bytes();
+  }
+
+  // Interrupted sweep: the file ends part way through the third row group
+  std::filesystem::resize_file(path, complete_bytes + 10);
+  EXPECT_EQ(read_report(path).size(), 6u);
+
+  write_report(path, 6, 2, true);
+
+  EXPECT_GT(std::filesystem::file_size(path), complete_bytes);
+
+  int segments = 0;
+  std::vector<PerformanceResult> results = read_report(path, &segments);
+
+  EXPECT_EQ(segments, 2);
+  ASSERT_EQ(results.size(), 8u);
+  for (size_t i = 0; i < results.size(); ++i) {
+    expect_equal(results[i], make_result(i));
+  }
+}
+
+TEST(Profiler_ColumnarReport, append_rejects_other_files) {
+
+  std::string path = report_path("append_rejects");
+  {
+    std::ofstream out(path);
+    out << "Problem,Provider\n0,CUTLASS\n";
+  }
+  uint64_t bytes = std::filesystem::file_size(path);
+
+  ColumnarReportWriter writer(path, {}, kArguments, 2, false, true);
+
+  EXPECT_FALSE(writer.good());
+  EXPECT_EQ(std::filesystem::file_size(path), bytes);
+}
+
+TEST(Profiler_ColumnarReport, print_csv) {
+
+  std::string path = report_path("print_csv");
+  write_report(path, 0, 2, false, true);
+
+  std::ostringstream csv;
+  EXPECT_EQ(ColumnarReportReader::print_csv(path, csv), 0);
+
+  std::istringstream lines(csv.str());
+  std::string header, first, second;
+  std::getline(lines, header);
+  std::getline(lines, first);
+  std::getline(lines, second);
+
+  EXPECT_EQ(header,
+    "tag,Problem,Provider,OperationKind,Operation,Disposition,Status,m,n,Bytes,Flops,Flops/Byte,"
+    "Runtime,Runtime_0,Runtime_1,GB/s,GFLOPs,"
+    "Samples,Outliers,Runtime_median,Runtime_p90,Runtime_p99,Runtime_stddev");
+
+  // Rows without statistics leave the statistics columns empty
+  EXPECT_EQ(first.substr(first.size() - 6), std::string(6, ','));
+  EXPECT_EQ(second.substr(second.rfind(",1.375,")), ",1.375,1.75,2,0.0625");
+  EXPECT_NE(second.find(",11,1,"), std::string::npos);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,108 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the golden fingerprint store of the profiler
+*/
+
+#include <sstream>
+#include <string>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/profiler/fingerprint_store.h"
+
+using namespace cutlass::profiler;
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::string const kKey = "gemm_f16 m=128 n=128 k=64 initialization=device dist=default seed=2019";
+
+FingerprintEntry make_entry(uint64_t exact, uint64_t quantized) {
+  FingerprintEntry entry;
+  entry.fingerprint.exact = exact;
+  entry.fingerprint.quantized = quantized;
+  entry.mantissa_bits = 10;
+  return entry;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(FingerprintStore, records_only_passed_outputs) {
+
+  FingerprintStore store;
+
+  for (Disposition disposition : {
+      Disposition::kFailed,
+      Disposition::kIncorrect,
+      Disposition::kNotVerified,
+      Disposition::kNotRun,
+      Disposition::kNotSupported}) {
+
+    EXPECT_FALSE(store.record(kKey, make_entry(1, 2), disposition)) << to_string(disposition);
+    EXPECT_EQ(store.lookup(kKey), nullptr) << to_string(disposition);
+  }
+
+  EXPECT_TRUE(store.empty());
+
+  EXPECT_TRUE(store.record(kKey, make_entry(1, 2), Disposition::kPassed));
+  ASSERT_NE(store.lookup(kKey), nullptr);
+  EXPECT_EQ(store.lookup(kKey)->fingerprint.exact, 1u);
+  EXPECT_EQ(store.lookup(kKey)->fingerprint.quantized, 2u);
+}
+
+TEST(FingerprintStore, failing_output_does_not_replace_golden) {
+
+  FingerprintStore store;
+  ASSERT_TRUE(store.record(kKey, make_entry(0x1111, 0x2222), Disposition::kPassed));
+
+  // A later recording run whose output fails verification leaves the golden entry untouched,
+  // both in memory and in the saved file
+  EXPECT_FALSE(store.record(kKey, make_entry(0x3333, 0x4444), Disposition::kIncorrect));
+
+  std::stringstream file;
+  store.write(file);
+
+  FingerprintStore loaded;
+  ASSERT_TRUE(loaded.read(file));
+  ASSERT_EQ(loaded.size(), 1u);
+
+  FingerprintEntry const *golden = loaded.lookup(kKey);
+  ASSERT_NE(golden, nullptr);
+  EXPECT_EQ(golden->fingerprint.exact, 0x1111u);
+  EXPECT_EQ(golden->fingerprint.quantized, 0x2222u);
+  EXPECT_EQ(golden->mantissa_bits, 10);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
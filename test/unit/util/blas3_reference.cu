@@ -0,0 +1,392 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests comparing the blocked BLAS3 references with dense products
+*/
+
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/rank_2k.h"
+#include "cutlass/util/reference/host/rank_k_complex.h"
+#include "cutlass/util/reference/host/symm.h"
+#include "cutlass/util/reference/host/symm_complex.h"
+#include "cutlass/util/reference/host/trmm.h"
+#include "cutlass/util/reference/host/trmm_complex.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using Layout = cutlass::layout::ColumnMajor;
+using Matrix = cutlass::HostTensor<double, Layout>;
+using Complex = cutlass::complex<double>;
+using ComplexMatrix = cutlass::HostTensor<Complex, Layout>;
+
+/// Small integers keep every product exact, so results are compared for equality
+template <typename Element>
+void fill(cutlass::HostTensor<Element, Layout> &matrix, int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  for (size_t i = 0; i < matrix.size(); ++i) {
+    if constexpr (cutlass::is_complex<Element>::value) {
+      matrix.host_data()[i] = Element(dist(rng), dist(rng));
+    }
+    else {
+      matrix.host_data()[i] = Element(dist(rng));
+    }
+  }
+}
+
+bool in_triangle(cutlass::FillMode fill_mode, int row, int col) {
+  return fill_mode == cutlass::FillMode::kLower ? row >= col : row <= col;
+}
+
+/// Dense copy of the matrix defined by the stored triangle of `a`. Hermitian matrices mirror the
+/// conjugate of the stored triangle and have a real diagonal.
+template <typename Element>
+cutlass::HostTensor<Element, Layout> expand(
+  cutlass::HostTensor<Element, Layout> &a,
+  cutlass::FillMode fill_mode,
+  bool symmetric,
+  bool unit_diagonal,
+  bool hermitian = false) {
+
+  int n = a.extent().row();
+  cutlass::HostTensor<Element, Layout> full({n, n}, false);
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j < n; ++j) {
+      Element value = Element(0);
+      if (in_triangle(fill_mode, i, j)) {
+        value = a.at({i, j});
+      }
+      else if (symmetric) {
+        value = a.at({j, i});
+      }
+      if constexpr (cutlass::is_complex<Element>::value) {
+        if (hermitian) {
+          value = (i == j) ? Element(cutlass::real(value)) :
+                  (in_triangle(fill_mode, i, j) ? value : cutlass::conj(value));
+        }
+      }
+      if (i == j && unit_diagonal) {
+        value = Element(1);
+      }
+      full.at({i, j}) = value;
+    }
+  }
+  return full;
+}
+
+template <typename Element>
+Element dot(cutlass::HostTensor<Element, Layout> &x, int row, cutlass::HostTensor<Element, Layout> &y, int col) {
+  Element sum = Element(0);
+  for (int k = 0; k < x.extent().column(); ++k) {
+    sum += x.at({row, k}) * y.at({k, col});
+  }
+  return sum;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(BLAS3Reference, rank_2k) {
+
+  for (auto fill_mode : {cutlass::FillMode::kLower, cutlass::FillMode::kUpper}) {
+    // The largest problem is split across host threads
+    for (int n : {1, 16, 45, 200}) {
+
+      int k = n < 200 ? 23 : 120;
+      Matrix A({n, k}, false), B({n, k}, false), C({n, n}, false), D({n, n}, false);
+      fill(A, 1);
+      fill(B, 2);
+      fill(C, 3);
+      fill(D, 4);
+      std::vector<double> D_initial(D.host_data(), D.host_data() + D.size());
+
+      if (fill_mode == cutlass::FillMode::kLower) {
+        cutlass::reference::host::compute_rank2k<double, Layout, double, Layout, double, Layout,
+          cutlass::FillMode::kLower, double, double>(
+            {n, n, k}, 2.0, A.host_ref(), B.host_ref(), -1.0, C.host_ref(), D.host_ref(), 0.0);
+      }
+      else {
+        cutlass::reference::host::compute_rank2k<double, Layout, double, Layout, double, Layout,
+          cutlass::FillMode::kUpper, double, double>(
+            {n, n, k}, 2.0, A.host_ref(), B.host_ref(), -1.0, C.host_ref(), D.host_ref(), 0.0);
+      }
+
+      for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+          if (in_triangle(fill_mode, i, j)) {
+            double sum = 0;
+            for (int kk = 0; kk < k; ++kk) {
+              sum += A.at({i, kk}) * B.at({j, kk}) + B.at({i, kk}) * A.at({j, kk});
+            }
+            EXPECT_EQ(D.at({i, j}), 2.0 * sum - C.at({i, j})) << "n=" << n << " (" << i << ", " << j << ")";
+          }
+          else {
+            // Elements outside the referenced triangle are never written
+            EXPECT_EQ(D.at({i, j}), D_initial[D.layout()({i, j})]);
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(BLAS3Reference, herk) {
+
+  int n = 37;
+  int k = 19;
+  ComplexMatrix A({n, k}, false), C({n, n}, false), D({n, n}, false);
+
+  std::mt19937 rng(5);
+  std::uniform_int_distribution<int> dist(-3, 3);
+  for (size_t i = 0; i < A.size(); ++i) {
+    A.host_data()[i] = Complex(dist(rng), dist(rng));
+  }
+  for (size_t i = 0; i < C.size(); ++i) {
+    C.host_data()[i] = Complex(dist(rng), dist(rng));
+  }
+
+  cutlass::reference::host::Rank2KComplex<Complex, Layout, Complex, Layout, Complex, Complex>(
+    {n, n, k}, Complex(2), A.host_ref(), cutlass::ComplexTransform::kNone, Complex(1),
+    C.host_ref(), D.host_ref(), Complex(0), cutlass::FillMode::kLower, cutlass::BlasMode::kHermitian);
+
+  for (int i = 0; i < n; ++i) {
+    for (int j = 0; j <= i; ++j) {
+      Complex sum(0);
+      for (int kk = 0; kk < k; ++kk) {
+        sum += A.at({i, kk}) * cutlass::conj(A.at({j, kk}));
+      }
+      Complex c = (i == j) ? Complex(cutlass::real(C.at({i, j}))) : C.at({i, j});
+      Complex expected = Complex(2) * sum + c;
+      if (i == j) {
+        expected = Complex(cutlass::real(expected));
+      }
+      EXPECT_EQ(D.at({i, j}), expected) << "(" << i << ", " << j << ")";
+    }
+  }
+}
+
+TEST(BLAS3Reference, symm) {
+
+  using cutlass::FillMode;
+  using cutlass::SideMode;
+
+  int m = 35;
+  int n = 21;
+
+  auto run = [&](auto side_mode, auto fill_mode) {
+
+    constexpr SideMode kSide = decltype(side_mode)::value;
+    constexpr FillMode kFill = decltype(fill_mode)::value;
+
+    int k = kSide == SideMode::kLeft ? m : n;
+    Matrix A({k, k}, false), B({m, n}, false), C({m, n}, false), D({m, n}, false);
+    fill(A, 6);
+    fill(B, 7);
+    fill(C, 8);
+
+    cutlass::reference::host::compute_symm<double, Layout, kSide, kFill, double, Layout, double, Layout, double, double>(
+      {m, n, k}, 3.0, A.host_ref(), B.host_ref(), 0.5, C.host_ref(), D.host_ref(), 0.0);
+
+    Matrix full = expand(A, kFill, true, false);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double product = kSide == SideMode::kLeft ? dot(full, i, B, j) : dot(B, i, full, j);
+        EXPECT_EQ(D.at({i, j}), 3.0 * product + 0.5 * C.at({i, j}));
+      }
+    }
+  };
+
+  run(std::integral_constant<SideMode, SideMode::kLeft>{}, std::integral_constant<FillMode, FillMode::kLower>{});
+  run(std::integral_constant<SideMode, SideMode::kLeft>{}, std::integral_constant<FillMode, FillMode::kUpper>{});
+  run(std::integral_constant<SideMode, SideMode::kRight>{}, std::integral_constant<FillMode, FillMode::kLower>{});
+  run(std::integral_constant<SideMode, SideMode::kRight>{}, std::integral_constant<FillMode, FillMode::kUpper>{});
+}
+
+TEST(BLAS3Reference, trmm) {
+
+  using cutlass::DiagType;
+  using cutlass::FillMode;
+  using cutlass::SideMode;
+
+  int m = 50;
+  int n = 27;
+
+  auto run = [&](auto side_mode, auto fill_mode, auto diag_type) {
+
+    constexpr SideMode kSide = decltype(side_mode)::value;
+    constexpr FillMode kFill = decltype(fill_mode)::value;
+    constexpr DiagType kDiag = decltype(diag_type)::value;
+
+    int k = kSide == SideMode::kLeft ? m : n;
+    Matrix A({k, k}, false), B({m, n}, false), D({m, n}, false);
+    fill(A, 9);
+    fill(B, 10);
+
+    cutlass::reference::host::compute_trmm<double, Layout, kSide, kFill, kDiag, double, Layout, double, Layout, double, double>(
+      {m, n, k}, 2.0, A.host_ref(), B.host_ref(), D.host_ref(), 0.0);
+
+    Matrix full = expand(A, kFill, false, kDiag == DiagType::kUnit);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double product = kSide == SideMode::kLeft ? dot(full, i, B, j) : dot(B, i, full, j);
+        EXPECT_EQ(D.at({i, j}), 2.0 * product);
+      }
+    }
+  };
+
+  for (int unit = 0; unit < 2; ++unit) {
+    auto lower = std::integral_constant<FillMode, FillMode::kLower>{};
+    auto upper = std::integral_constant<FillMode, FillMode::kUpper>{};
+    auto left = std::integral_constant<SideMode, SideMode::kLeft>{};
+    auto right = std::integral_constant<SideMode, SideMode::kRight>{};
+    if (unit) {
+      auto diag = std::integral_constant<DiagType, DiagType::kUnit>{};
+      run(left, lower, diag); run(left, upper, diag); run(right, lower, diag); run(right, upper, diag);
+    }
+    else {
+      auto diag = std::integral_constant<DiagType, DiagType::kNonUnit>{};
+      run(left, lower, diag); run(left, upper, diag); run(right, lower, diag); run(right, upper, diag);
+    }
+  }
+}
+
+TEST(BLAS3Reference, symm_complex) {
+
+  using cutlass::BlasMode;
+  using cutlass::FillMode;
+  using cutlass::SideMode;
+
+  int m = 35;
+  int n = 21;
+
+  auto run = [&](auto side_mode, auto fill_mode, auto blas_mode) {
+
+    constexpr SideMode kSide = decltype(side_mode)::value;
+    constexpr FillMode kFill = decltype(fill_mode)::value;
+    constexpr BlasMode kBlasMode = decltype(blas_mode)::value;
+
+    int k = kSide == SideMode::kLeft ? m : n;
+    ComplexMatrix A({k, k}, false), B({m, n}, false), C({m, n}, false), D({m, n}, false);
+    fill(A, 11);
+    fill(B, 12);
+    fill(C, 13);
+
+    cutlass::reference::host::compute_symm_complex<Complex, Layout, kSide, kFill, Complex, Layout,
+      Complex, Layout, Complex, Complex, kBlasMode>(
+        {m, n, k}, Complex(2, 1), A.host_ref(), B.host_ref(), Complex(0, -1), C.host_ref(), D.host_ref(), Complex(0));
+
+    ComplexMatrix full = expand(A, kFill, true, false, kBlasMode == BlasMode::kHermitian);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        Complex product = kSide == SideMode::kLeft ? dot(full, i, B, j) : dot(B, i, full, j);
+        EXPECT_EQ(D.at({i, j}), Complex(2, 1) * product + Complex(0, -1) * C.at({i, j}))
+          << "(" << i << ", " << j << ")";
+      }
+    }
+  };
+
+  auto left = std::integral_constant<SideMode, SideMode::kLeft>{};
+  auto right = std::integral_constant<SideMode, SideMode::kRight>{};
+  auto lower = std::integral_constant<FillMode, FillMode::kLower>{};
+  auto upper = std::integral_constant<FillMode, FillMode::kUpper>{};
+  auto symmetric = std::integral_constant<BlasMode, BlasMode::kSymmetric>{};
+  auto hermitian = std::integral_constant<BlasMode, BlasMode::kHermitian>{};
+
+  run(left, lower, symmetric); run(left, upper, symmetric); run(right, lower, symmetric); run(right, upper, symmetric);
+  run(left, lower, hermitian); run(left, upper, hermitian); run(right, lower, hermitian); run(right, upper, hermitian);
+}
+
+TEST(BLAS3Reference, trmm_complex) {
+
+  using cutlass::ComplexTransform;
+  using cutlass::DiagType;
+  using cutlass::FillMode;
+  using cutlass::SideMode;
+
+  int m = 50;
+  int n = 27;
+
+  auto run = [&](auto side_mode, auto fill_mode, auto diag_type, auto transform) {
+
+    constexpr SideMode kSide = decltype(side_mode)::value;
+    constexpr FillMode kFill = decltype(fill_mode)::value;
+    constexpr DiagType kDiag = decltype(diag_type)::value;
+    constexpr ComplexTransform kTransform = decltype(transform)::value;
+
+    int k = kSide == SideMode::kLeft ? m : n;
+    ComplexMatrix A({k, k}, false), B({m, n}, false), D({m, n}, false);
+    fill(A, 14);
+    fill(B, 15);
+
+    cutlass::reference::host::compute_trmm_complex<Complex, Layout, kTransform, kSide, kFill, kDiag,
+      Complex, Layout, ComplexTransform::kNone, Complex, Layout, Complex, Complex>(
+        {m, n, k}, Complex(1, 2), A.host_ref(), B.host_ref(), D.host_ref(), Complex(0));
+
+    // The transform applies to the triangular operand only
+    ComplexMatrix full = expand(A, kFill, false, kDiag == DiagType::kUnit);
+    if (kTransform == ComplexTransform::kConjugate) {
+      for (size_t i = 0; i < full.size(); ++i) {
+        full.host_data()[i] = cutlass::conj(full.host_data()[i]);
+      }
+    }
+
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        Complex product = kSide == SideMode::kLeft ? dot(full, i, B, j) : dot(B, i, full, j);
+        EXPECT_EQ(D.at({i, j}), Complex(1, 2) * product) << "(" << i << ", " << j << ")";
+      }
+    }
+  };
+
+  auto left = std::integral_constant<SideMode, SideMode::kLeft>{};
+  auto right = std::integral_constant<SideMode, SideMode::kRight>{};
+  auto lower = std::integral_constant<FillMode, FillMode::kLower>{};
+  auto upper = std::integral_constant<FillMode, FillMode::kUpper>{};
+  auto unit = std::integral_constant<DiagType, DiagType::kUnit>{};
+  auto non_unit = std::integral_constant<DiagType, DiagType::kNonUnit>{};
+  auto none = std::integral_constant<ComplexTransform, ComplexTransform::kNone>{};
+  auto conjugate = std::integral_constant<ComplexTransform, ComplexTransform::kConjugate>{};
+
+  run(left, lower, non_unit, none); run(left, upper, unit, none);
+  run(right, lower, unit, none); run(right, upper, non_unit, none);
+  run(left, lower, unit, conjugate); run(left, upper, non_unit, conjugate);
+  run(right, lower, non_unit, conjugate); run(right, upper, unit, conjugate);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,265 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for the convolution to implicit GEMM mapping analyzer
+*/
+
+#include <sstream>
+#include <stdexcept>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/conv_implicit_gemm_analyzer.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+cutlass::ConvLayerShape make_layer(
+  int n, int h, int w, int c, int k, int r, int s, int pad, int stride, char const *name = "layer") {
+
+  cutlass::conv::Conv2dProblemSize problem(
+    n, h, w, c, k, r, s,
+    (h + 2 * pad - r) / stride + 1, (w + 2 * pad - s) / stride + 1,
+    pad, pad, stride, stride, 1, 1, cutlass::conv::Mode::kCrossCorrelation);
+
+  return cutlass::ConvLayerShape(problem, name);
+}
+
+cutlass::ConvImplicitGemmAnalysis const *find(
+  std::vector<cutlass::ConvImplicitGemmAnalysis> const &candidates,
+  cutlass::conv::IteratorAlgorithm algorithm,
+  bool padded = false) {
+
+  for (auto const &candidate : candidates) {
+    if (candidate.algorithm == algorithm && candidate.padded_channels == padded) {
+      return &candidate;
+    }
+  }
+  return nullptr;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(ConvImplicitGemmAnalyzer, fprop_extents_and_efficiency) {
+
+  cutlass::ConvImplicitGemmAnalyzerConfig config;
+  config.tile = {128, 128, 32};
+  config.sm_count = 10;
+
+  cutlass::ConvImplicitGemmAnalyzer analyzer(config);
+  auto layer = make_layer(1, 56, 56, 64, 64, 3, 3, 1, 1);
+
+  auto a = analyzer.analyze(layer, cutlass::conv::Operator::kFprop,
+                            cutlass::conv::IteratorAlgorithm::kOptimized, 64, 64);
+
+  ASSERT_TRUE(a.supported);
+  EXPECT_EQ(a.gemm_extent, cutlass::gemm::GemmCoord(3136, 64, 576));
+  EXPECT_EQ(a.grid, cutlass::gemm::GemmCoord(25, 1, 1));
+  EXPECT_EQ(a.k_iterations, 18);
+
+  // Each spatial dimension has 56 * 3 output-tap pairs, two of which fall into the padding
+  EXPECT_EQ(a.useful_macs, int64_t(64) * 64 * 166 * 166);
+  EXPECT_EQ(a.issued_macs, int64_t(25) * 128 * 128 * 32 * 18);
+
+  EXPECT_DOUBLE_EQ(a.tile_efficiency, 3136.0 * 64 / (3200.0 * 128));
+  EXPECT_DOUBLE_EQ(a.k_efficiency, 1.0);
+  EXPECT_DOUBLE_EQ(a.mma_efficiency, double(a.useful_macs) / double(a.issued_macs));
+  EXPECT_NEAR(a.predicated_fraction(), 1.0 - a.mma_efficiency, 1e-12);
+
+  EXPECT_DOUBLE_EQ(a.waves, 2.5);
+  EXPECT_DOUBLE_EQ(a.wave_efficiency, 25.0 / 30.0);
+  EXPECT_EQ(a.mainloop_iterations, 3 * 18);
+}
+
+TEST(ConvImplicitGemmAnalyzer, wgrad_and_dgrad_extents) {
+
+  cutlass::ConvImplicitGemmAnalyzer analyzer;
+  auto layer = make_layer(2, 28, 28, 128, 256, 3, 3, 1, 1);
+
+  auto wgrad = analyzer.analyze(layer, cutlass::conv::Operator::kWgrad,
+                                cutlass::conv::IteratorAlgorithm::kAnalytic, 128, 256);
+  EXPECT_EQ(wgrad.gemm_extent, cutlass::gemm::GemmCoord(256, 1152, 2 * 28 * 28));
+  EXPECT_EQ(wgrad.k_iterations, 49);
+
+  auto dgrad = analyzer.analyze(layer, cutlass::conv::Operator::kDgrad,
+                                cutlass::conv::IteratorAlgorithm::kAnalytic, 128, 256);
+  EXPECT_EQ(dgrad.gemm_extent, cutlass::gemm::GemmCoord(2 * 28 * 28, 128, 9 * 256));
+  EXPECT_EQ(dgrad.k_iterations, 9 * 8);
+
+  // All three operators compute the same convolution
+  EXPECT_EQ(wgrad.useful_macs, dgrad.useful_macs);
+}
+
+TEST(ConvImplicitGemmAnalyzer, small_channels_prefer_fixed_or_few_channels) {
+
+  cutlass::ConvImplicitGemmAnalyzer analyzer;
+  auto layer = make_layer(8, 224, 224, 4, 64, 7, 7, 3, 2, "conv1");
+
+  auto candidates = analyzer.analyze(layer, cutlass::conv::Operator::kFprop);
+
+  auto analytic = find(candidates, cutlass::conv::IteratorAlgorithm::kAnalytic);
+  ASSERT_NE(analytic, nullptr);
+  EXPECT_FALSE(analytic->supported);
+
+  auto padded = find(candidates, cutlass::conv::IteratorAlgorithm::kAnalytic, true);
+  ASSERT_NE(padded, nullptr);
+  EXPECT_TRUE(padded->supported);
+  EXPECT_EQ(padded->C, 8);
+  EXPECT_EQ(padded->k_iterations, 49);
+
+  auto fixed = find(candidates, cutlass::conv::IteratorAlgorithm::kFixedChannels);
+  ASSERT_NE(fixed, nullptr);
+  ASSERT_TRUE(fixed->supported);
+  EXPECT_EQ(fixed->k_iterations, 7);
+
+  auto few = find(candidates, cutlass::conv::IteratorAlgorithm::kFewChannels);
+  ASSERT_NE(few, nullptr);
+  ASSERT_TRUE(few->supported);
+  EXPECT_EQ(few->k_iterations, 7);
+
+  EXPECT_GT(fixed->mma_efficiency, 4 * padded->mma_efficiency);
+
+  int best_count = 0;
+  for (auto const &candidate : candidates) {
+    if (candidate.best) {
+      ++best_count;
+      EXPECT_TRUE(candidate.algorithm == cutlass::conv::IteratorAlgorithm::kFixedChannels ||
+                  candidate.algorithm == cutlass::conv::IteratorAlgorithm::kFewChannels);
+    }
+  }
+  EXPECT_EQ(best_count, 1);
+
+  // Three channels cannot use the fixed channel iterator
+  auto rgb = analyzer.analyze(make_layer(8, 224, 224, 3, 64, 7, 7, 3, 2), cutlass::conv::Operator::kFprop);
+  EXPECT_FALSE(find(rgb, cutlass::conv::IteratorAlgorithm::kFixedChannels)->supported);
+  EXPECT_TRUE(find(rgb, cutlass::conv::IteratorAlgorithm::kFewChannels)->supported);
+  EXPECT_EQ(analyzer.channel_access_size(3), 1);
+  EXPECT_EQ(analyzer.channel_access_size(12), 4);
+
+  // Only fprop has fixed and few channel iterators
+  auto dgrad = analyzer.analyze(layer, cutlass::conv::Operator::kDgrad);
+  EXPECT_FALSE(find(dgrad, cutlass::conv::IteratorAlgorithm::kFewChannels)->supported);
+}
+
+TEST(ConvImplicitGemmAnalyzer, strided_dgrad_skips_holes) {
+
+  cutlass::ConvImplicitGemmAnalyzerConfig config;
+  config.tile = {64, 64, 32};
+  cutlass::ConvImplicitGemmAnalyzer analyzer(config);
+
+  // Strided 2-D dgrad is decomposed by starting filter position
+  auto layer2d = make_layer(4, 56, 56, 64, 128, 3, 3, 1, 2);
+  auto strided = analyzer.analyze(layer2d, cutlass::conv::Operator::kDgrad,
+                                  cutlass::conv::IteratorAlgorithm::kOptimized, 64, 128);
+
+  ASSERT_TRUE(strided.supported);
+  int tile_m_per_filter = (4 * 28 * 28 + 63) / 64;
+  EXPECT_EQ(strided.grid.m(), 4 * tile_m_per_filter);
+  EXPECT_EQ(strided.k_iterations, 4 * 4);
+
+  // Filter positions per group are 2x2, 2x1, 1x2 and 1x1
+  EXPECT_EQ(strided.issued_macs, int64_t(tile_m_per_filter) * 64 * 64 * 32 * 4 * (4 + 2 + 2 + 1));
+
+  // 3-D dgrad iterates every tap and predicates off the holes
+  cutlass::ConvLayerShape layer3d = layer2d;
+  layer3d.spatial_dims = 3;
+  auto holes = analyzer.analyze(layer3d, cutlass::conv::Operator::kDgrad,
+                                cutlass::conv::IteratorAlgorithm::kAnalytic, 64, 128);
+
+  ASSERT_TRUE(holes.supported);
+  EXPECT_EQ(holes.useful_macs, strided.useful_macs);
+  EXPECT_LT(holes.mma_efficiency, 0.3);
+  EXPECT_GT(strided.mma_efficiency, 0.6);
+
+  auto optimized3d = analyzer.analyze(layer3d, cutlass::conv::Operator::kDgrad,
+                                      cutlass::conv::IteratorAlgorithm::kOptimized, 64, 128);
+  EXPECT_FALSE(optimized3d.supported);
+}
+
+TEST(ConvImplicitGemmAnalyzer, unsupported_layers) {
+
+  cutlass::ConvImplicitGemmAnalyzer analyzer;
+
+  auto grouped = make_layer(1, 14, 14, 64, 64, 3, 3, 1, 1);
+  grouped.groups = 2;
+  for (auto const &candidate : analyzer.analyze(grouped, cutlass::conv::Operator::kFprop)) {
+    EXPECT_FALSE(candidate.supported);
+    EXPECT_FALSE(candidate.best);
+  }
+
+  auto large_filter = make_layer(1, 64, 64, 64, 64, 33, 33, 16, 1);
+  auto candidates = analyzer.analyze(large_filter, cutlass::conv::Operator::kFprop);
+  EXPECT_TRUE(find(candidates, cutlass::conv::IteratorAlgorithm::kAnalytic)->supported);
+  EXPECT_FALSE(find(candidates, cutlass::conv::IteratorAlgorithm::kOptimized)->supported);
+}
+
+TEST(ConvImplicitGemmAnalyzer, parse_layers) {
+
+  std::istringstream in(
+    "# ResNet-50 stem\n"
+    "conv1 n=32 h=224 w=224 c=3 k=64 r=7 s=7 pad_h=3 pad_w=3 stride_h=2 stride_w=2\n"
+    "\n"
+    "n=2 d=16 h=32 w=32 c=32 k=64 t=3 r=3 s=3 pad_d=1 pad_h=1 pad_w=1\n");
+
+  auto layers = cutlass::parse_conv_layers(in);
+  ASSERT_EQ(layers.size(), size_t(2));
+
+  EXPECT_EQ(layers[0].name, "conv1");
+  EXPECT_EQ(layers[0].spatial_dims, 2);
+  EXPECT_EQ(layers[0].output[1], 112);
+  EXPECT_EQ(layers[0].output[2], 112);
+
+  EXPECT_EQ(layers[1].name, "layer1");
+  EXPECT_EQ(layers[1].spatial_dims, 3);
+  EXPECT_EQ(layers[1].output[0], 16);
+
+  std::istringstream unknown("conv n=1 h=8 w=8 c=8 k=8 r=1 s=1 bogus=3\n");
+  EXPECT_THROW(cutlass::parse_conv_layers(unknown), std::invalid_argument);
+
+  cutlass::ConvImplicitGemmAnalyzer analyzer;
+  auto analyses = analyzer.analyze(layers);
+  EXPECT_FALSE(analyses.empty());
+
+  std::ostringstream csv;
+  cutlass::print_conv_analysis_csv(csv, analyses);
+  std::string line;
+  std::istringstream rows(csv.str());
+  size_t row_count = 0;
+  while (std::getline(rows, line)) {
+    ++row_count;
+  }
+  EXPECT_EQ(row_count, analyses.size() + 1);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,313 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the recording and replaying CudaHostAdapter implementations
+*/
+
+// Operators route all device interaction through the CudaHostAdapter
+#define CUTLASS_ENABLE_CUDA_HOST_ADAPTER true
+
+#include <sstream>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/gemm/device/gemm_universal.h"
+#include "cutlass/util/cuda_host_adapter_replay.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(CudaHostAdapterDeviceProfile, occupancy_model) {
+
+  cutlass::CudaHostAdapterDeviceProfile profile;
+
+  // Limited by threads: 2048 / 128
+  EXPECT_EQ(profile.query_occupancy(0, 128, 0), 16);
+  // Partial warps are rounded up: 2048 / 128
+  EXPECT_EQ(profile.query_occupancy(0, 100, 0), 16);
+  // Limited by blocks per SM
+  EXPECT_EQ(profile.query_occupancy(0, 32, 0), 32);
+  // Limited by shared memory: 233472 / (102400 + 1024)
+  EXPECT_EQ(profile.query_occupancy(0, 128, 102400), 2);
+  // Exceeding per-block limits
+  EXPECT_EQ(profile.query_occupancy(0, 128, 232449), 0);
+  EXPECT_EQ(profile.query_occupancy(0, 2048, 0), 0);
+
+  // Recorded answers take precedence over the model
+  profile.occupancy[{1, 128, 0}] = 3;
+  EXPECT_EQ(profile.query_occupancy(1, 128, 0), 3);
+  EXPECT_EQ(profile.query_occupancy(0, 128, 0), 16);
+}
+
+TEST(CudaHostAdapterDeviceProfile, save_load) {
+
+  cutlass::CudaHostAdapterDeviceProfile profile;
+  profile.name = "A100 SXM4";
+  profile.sm_count = 108;
+  profile.shared_memory_per_sm = 167936;
+  profile.occupancy[{0, 256, 49152}] = 2;
+  profile.occupancy[{1, 384, 200000}] = 1;
+
+  std::stringstream buffer;
+  profile.save(buffer);
+
+  auto loaded = cutlass::CudaHostAdapterDeviceProfile::load(buffer);
+  EXPECT_EQ(loaded.name, "A100 SXM4");
+  EXPECT_EQ(loaded.sm_count, 108);
+  EXPECT_EQ(loaded.shared_memory_per_sm, 167936);
+  EXPECT_EQ(loaded.max_threads_per_sm, profile.max_threads_per_sm);
+  EXPECT_EQ(loaded.occupancy, profile.occupancy);
+}
+
+TEST(CudaHostAdapterDeviceProfile, load_partial_and_invalid) {
+
+  std::istringstream partial(
+    "# comment\n"
+    "\n"
+    "  sm_count = 8 \n");
+  auto profile = cutlass::CudaHostAdapterDeviceProfile::load(partial);
+  EXPECT_EQ(profile.sm_count, 8);
+  EXPECT_EQ(profile.max_threads_per_sm, 2048);
+
+  std::istringstream unknown_key("sm_counts = 8\n");
+  EXPECT_THROW(cutlass::CudaHostAdapterDeviceProfile::load(unknown_key), std::runtime_error);
+
+  std::istringstream bad_value("sm_count = many\n");
+  EXPECT_THROW(cutlass::CudaHostAdapterDeviceProfile::load(bad_value), std::runtime_error);
+
+  std::istringstream bad_occupancy("occupancy = 0 128\n");
+  EXPECT_THROW(cutlass::CudaHostAdapterDeviceProfile::load(bad_occupancy), std::runtime_error);
+
+  EXPECT_THROW(cutlass::CudaHostAdapterDeviceProfile::load_file("/nonexistent/device.profile"), std::runtime_error);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(ReplayCudaHostAdapter, validates_launches) {
+
+  cutlass::ReplayCudaHostAdapter replay;
+  int params = 0;
+  void *kernel_params[] = {&params};
+
+  int32_t device_sms = 0, sm_occupancy = 0;
+  EXPECT_EQ(replay.query_occupancy(&device_sms, &sm_occupancy, 0, 256, 16384), cutlass::Status::kSuccess);
+  EXPECT_EQ(device_sms, 132);
+  EXPECT_EQ(sm_occupancy, 8);
+
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(256, 1, 1), 16384, nullptr, kernel_params, 0),
+    cutlass::Status::kSuccess);
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(2048, 1, 1), 0, nullptr, kernel_params, 0),
+    cutlass::Status::kErrorInternal);
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(256, 1, 1), 300000, nullptr, kernel_params, 0),
+    cutlass::Status::kErrorInternal);
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(256, 1, 1), 0, nullptr, nullptr, 0),
+    cutlass::Status::kErrorInternal);
+
+  // Grids must be divisible by the cluster shape, and clusters within the profile limit
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(2, 1, 1), dim3(384, 1, 1), 0, nullptr, kernel_params, 0),
+    cutlass::Status::kSuccess);
+  EXPECT_EQ(replay.launch(dim3(63, 2, 1), dim3(2, 1, 1), dim3(384, 1, 1), 0, nullptr, kernel_params, 0),
+    cutlass::Status::kErrorInternal);
+  EXPECT_EQ(replay.launch(dim3(64, 32, 1), dim3(2, 16, 1), dim3(384, 1, 1), 0, nullptr, kernel_params, 0),
+    cutlass::Status::kErrorInternal);
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(4, 1, 1), dim3(3, 1, 1), dim3(384, 1, 1), 0, nullptr,
+    kernel_params, 0), cutlass::Status::kErrorInternal);
+  EXPECT_EQ(replay.launch(dim3(64, 2, 1), dim3(4, 1, 1), dim3(2, 1, 1), dim3(384, 1, 1), 0, nullptr,
+    kernel_params, 0), cutlass::Status::kSuccess);
+
+  // Fills are discarded without touching the destination
+  void *workspace = reinterpret_cast<void *>(uintptr_t(0x1000));
+  EXPECT_EQ(replay.memsetDevice(workspace, uint32_t(0), 1024, nullptr), cutlass::Status::kSuccess);
+}
+
+TEST(ReplayCudaHostAdapter, kernel_index) {
+
+  void *handles[2] = {nullptr, nullptr};
+  cutlass::ReplayCudaHostAdapter replay(cutlass::CudaHostAdapterDeviceProfile(), handles, 2);
+  int params = 0;
+  void *kernel_params[] = {&params};
+
+  EXPECT_EQ(replay.launch(dim3(1, 1, 1), dim3(128, 1, 1), 0, nullptr, kernel_params, 1), cutlass::Status::kSuccess);
+  EXPECT_EQ(replay.launch(dim3(1, 1, 1), dim3(128, 1, 1), 0, nullptr, kernel_params, 2), cutlass::Status::kErrorInternal);
+}
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+TEST(ReplayCudaHostAdapter, tensor_maps) {
+
+  cutlass::ReplayCudaHostAdapter replay;
+  cuuint64_t dims[2] = {1024, 512};
+  cuuint64_t strides[1] = {2048};
+  cuuint32_t box[2] = {64, 64};
+  cuuint32_t element_strides[2] = {1, 1};
+
+  CUtensorMap desc;
+  EXPECT_EQ(replay.tensorMapEncodeTiled(&desc, CU_TENSOR_MAP_DATA_TYPE_FLOAT16, 2,
+    reinterpret_cast<void *>(uintptr_t(0x10000)), dims, strides, box, element_strides,
+    CU_TENSOR_MAP_INTERLEAVE_NONE, CU_TENSOR_MAP_SWIZZLE_128B, CU_TENSOR_MAP_L2_PROMOTION_L2_128B,
+    CU_TENSOR_MAP_FLOAT_OOB_FILL_NONE), CUDA_SUCCESS);
+  EXPECT_EQ(replay.tensorMapReplaceAddress(&desc, reinterpret_cast<void *>(uintptr_t(0x20000))), CUDA_SUCCESS);
+
+  // Misaligned addresses are rejected like the driver does
+  EXPECT_NE(replay.tensorMapReplaceAddress(&desc, reinterpret_cast<void *>(uintptr_t(0x20008))), CUDA_SUCCESS);
+}
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(RecordingCudaHostAdapter, records_calls) {
+
+  cutlass::ReplayCudaHostAdapter replay;
+  cutlass::RecordingCudaHostAdapter recorder(&replay);
+  int params = 0;
+  void *kernel_params[] = {&params};
+
+  int32_t device_sms = 0, sm_occupancy = 0;
+  EXPECT_EQ(recorder.query_occupancy(&device_sms, &sm_occupancy, 0, 256, 16384), cutlass::Status::kSuccess);
+  EXPECT_EQ(sm_occupancy, 8);
+  EXPECT_EQ(recorder.launch(dim3(8, 4, 1), dim3(2, 1, 1), dim3(256, 1, 1), 16384, nullptr, kernel_params, 0),
+    cutlass::Status::kSuccess);
+  EXPECT_EQ(recorder.launch(dim3(8, 4, 1), dim3(2048, 1, 1), 0, nullptr, kernel_params, 0),
+    cutlass::Status::kErrorInternal);
+  EXPECT_EQ(recorder.memsetDevice(reinterpret_cast<void *>(uintptr_t(0x1000)), uint16_t(7), 64, nullptr),
+    cutlass::Status::kSuccess);
+
+  auto calls = recorder.calls();
+  ASSERT_EQ(calls.size(), 4u);
+
+  EXPECT_EQ(calls[0].kind, cutlass::CudaHostAdapterCallKind::kQueryOccupancy);
+  EXPECT_EQ(calls[0].sm_occupancy, 8);
+  EXPECT_EQ(calls[0].device_sms, 132);
+
+  EXPECT_EQ(calls[1].kind, cutlass::CudaHostAdapterCallKind::kLaunchCluster);
+  EXPECT_EQ(calls[1].grid_dims.x, 8u);
+  EXPECT_EQ(calls[1].cluster_dims.x, 2u);
+  EXPECT_EQ(calls[1].smem_size, 16384u);
+  EXPECT_EQ(calls[1].result, int32_t(cutlass::Status::kSuccess));
+
+  EXPECT_EQ(calls[2].kind, cutlass::CudaHostAdapterCallKind::kLaunch);
+  EXPECT_EQ(calls[2].result, int32_t(cutlass::Status::kErrorInternal));
+
+  EXPECT_EQ(calls[3].kind, cutlass::CudaHostAdapterCallKind::kMemset);
+  EXPECT_EQ(calls[3].fill_size, 2u);
+  EXPECT_EQ(calls[3].fill_count, 64u);
+
+  for (auto const &call : calls) {
+    EXPECT_GE(call.duration_us, 0.0);
+  }
+  EXPECT_EQ(recorder.count(cutlass::CudaHostAdapterCallKind::kLaunch), 1u);
+
+  std::ostringstream csv;
+  recorder.write_csv(csv);
+  std::string text = csv.str();
+  EXPECT_EQ(std::count(text.begin(), text.end(), '\n'), 5);
+  EXPECT_NE(text.find("launch_cluster,0,"), std::string::npos);
+
+  recorder.clear();
+  EXPECT_TRUE(recorder.calls().empty());
+}
+
+TEST(RecordingCudaHostAdapter, exports_profile) {
+
+  cutlass::CudaHostAdapterDeviceProfile device;
+  device.sm_count = 20;
+  device.occupancy[{0, 256, 1000}] = 5;
+  cutlass::ReplayCudaHostAdapter replay(device);
+  cutlass::RecordingCudaHostAdapter recorder(&replay);
+
+  int32_t device_sms = 0, sm_occupancy = 0;
+  recorder.query_occupancy(&device_sms, &sm_occupancy, 0, 256, 1000);
+  recorder.query_occupancy(&device_sms, &sm_occupancy, 0, 128, 0);
+
+  // The exported profile reproduces the recorded answers on any machine
+  std::stringstream buffer;
+  recorder.profile().save(buffer);
+  cutlass::ReplayCudaHostAdapter replayed(cutlass::CudaHostAdapterDeviceProfile::load(buffer));
+
+  replayed.query_occupancy(&device_sms, &sm_occupancy, 0, 256, 1000);
+  EXPECT_EQ(device_sms, 20);
+  EXPECT_EQ(sm_occupancy, 5);
+  replayed.query_occupancy(&device_sms, &sm_occupancy, 0, 128, 0);
+  EXPECT_EQ(sm_occupancy, 16);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// The host path of a device-wide operator runs without a GPU
+TEST(RecordingCudaHostAdapter, gemm_universal_host_path) {
+
+  using Gemm = cutlass::gemm::device::GemmUniversal<
+    float, cutlass::layout::RowMajor,
+    float, cutlass::layout::ColumnMajor,
+    float, cutlass::layout::RowMajor,
+    float,
+    cutlass::arch::OpClassSimt,
+    cutlass::arch::Sm50>;
+
+  cutlass::gemm::GemmCoord problem_size(1024, 512, 256);
+
+  // Operands are never dereferenced on the host
+  float *ptr_A = reinterpret_cast<float *>(uintptr_t(0x1000000));
+  float *ptr_B = reinterpret_cast<float *>(uintptr_t(0x2000000));
+  float *ptr_C = reinterpret_cast<float *>(uintptr_t(0x3000000));
+  float *ptr_D = reinterpret_cast<float *>(uintptr_t(0x4000000));
+
+  typename Gemm::Arguments args(
+    cutlass::gemm::GemmUniversalMode::kGemm,
+    problem_size,
+    1,
+    {1.0f, 0.0f},
+    ptr_A, ptr_B, ptr_C, ptr_D,
+    0, 0, 0, 0,
+    problem_size.k(), problem_size.k(), problem_size.n(), problem_size.n());
+
+  cutlass::ReplayCudaHostAdapter replay;
+  cutlass::RecordingCudaHostAdapter recorder(&replay);
+
+  EXPECT_EQ(Gemm::can_implement(args, &recorder), cutlass::Status::kSuccess);
+  EXPECT_EQ(Gemm::get_workspace_size(args, &recorder), 0u);
+
+  Gemm gemm_op;
+  EXPECT_EQ(gemm_op.initialize(args, nullptr, nullptr, &recorder), cutlass::Status::kSuccess);
+  EXPECT_EQ(gemm_op.run(nullptr, &recorder), cutlass::Status::kSuccess);
+
+  EXPECT_GE(recorder.count(cutlass::CudaHostAdapterCallKind::kQueryOccupancy), 1u);
+  ASSERT_EQ(recorder.count(cutlass::CudaHostAdapterCallKind::kLaunch), 1u);
+
+  auto launch = recorder.calls().back();
+  EXPECT_EQ(launch.kind, cutlass::CudaHostAdapterCallKind::kLaunch);
+  EXPECT_EQ(launch.block_dims.x, unsigned(Gemm::GemmKernel::kThreadCount));
+  EXPECT_EQ(launch.grid_dims.x * launch.grid_dims.y * launch.grid_dims.z,
+    unsigned(problem_size.m() / Gemm::ThreadblockShape::kM * problem_size.n() / Gemm::ThreadblockShape::kN));
+  EXPECT_GE(recorder.total_duration_us(), 0.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
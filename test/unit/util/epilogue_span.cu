@@ -0,0 +1,273 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests comparing span epilogues and activations against the fragment functors
+*/
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/epilogue/thread/linear_combination_gelu.h"
+#include "cutlass/epilogue/thread/linear_combination_silu.h"
+#include "cutlass/util/reference/host/epilogue_span.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+bool within_span_tolerance(double vector, double scalar, double output_rounding = 0) {
+  if (std::isnan(scalar)) {
+    return std::isnan(vector);
+  }
+  if (std::isinf(scalar)) {
+    return vector == scalar;
+  }
+  return std::abs(vector - scalar) <=
+    (cutlass::reference::host::kEpilogueSpanRelativeTolerance + output_rounding) * std::abs(scalar) +
+    cutlass::reference::host::kEpilogueSpanAbsoluteTolerance;
+}
+
+/// Dense sweep over [-120, 120], a fine sweep around zero, and special values
+std::vector<float> activation_inputs() {
+  std::vector<float> x;
+  for (float v = -120.0f; v <= 120.0f; v += 0.0031f) {
+    x.push_back(v);
+  }
+  for (float v = -1.0e-3f; v <= 1.0e-3f; v += 1.0e-6f) {
+    x.push_back(v);
+  }
+  x.push_back(0.0f);
+  x.push_back(-0.0f);
+  x.push_back(std::numeric_limits<float>::infinity());
+  x.push_back(-std::numeric_limits<float>::infinity());
+  x.push_back(std::numeric_limits<float>::max());
+  x.push_back(std::numeric_limits<float>::lowest());
+  x.push_back(std::numeric_limits<float>::denorm_min());
+  return x;
+}
+
+template <typename Activation>
+void verify_activation_span() {
+
+  static_assert(cutlass::reference::host::ActivationSpan<Activation>::kVectorized, "");
+
+  std::vector<float> x = activation_inputs();
+  std::vector<float> y = x;
+  cutlass::reference::host::ActivationSpan<Activation>{}(y.data(), int64_t(y.size()));
+
+  Activation op;
+  int failures = 0;
+  for (size_t i = 0; i < x.size() && failures < 10; ++i) {
+    float expected = op(x[i]);
+    if (!within_span_tolerance(y[i], expected)) {
+      ADD_FAILURE() << "x = " << x[i] << ": span " << y[i] << ", scalar " << expected;
+      ++failures;
+    }
+  }
+
+  // NaN propagates
+  float nan = std::numeric_limits<float>::quiet_NaN();
+  cutlass::reference::host::ActivationSpan<Activation>{}(&nan, 1);
+  EXPECT_TRUE(std::isnan(nan));
+}
+
+template <typename OutputOp>
+void verify_epilogue_span(typename OutputOp::Params const &params, bool exact, int64_t count = 1000) {
+
+  // Results within tolerance may still round to adjacent values of a narrow output type
+  double output_rounding = (cutlass::sizeof_bits<typename OutputOp::ElementOutput>::value < 32) ?
+    double(std::numeric_limits<typename OutputOp::ElementOutput>::epsilon()) : 0.0;
+
+  using Span = cutlass::reference::host::EpilogueSpan<OutputOp>;
+  using ElementOutput = typename Span::ElementOutput;
+  using ElementAccumulator = typename Span::ElementAccumulator;
+  using ElementSource = typename Span::ElementSource;
+
+  std::mt19937 rng(2025);
+  std::normal_distribution<float> dist(0.0f, 4.0f);
+
+  std::vector<ElementAccumulator> accum(count);
+  std::vector<ElementSource> source(count);
+  for (int64_t i = 0; i < count; ++i) {
+    accum[i] = ElementAccumulator(dist(rng));
+    source[i] = ElementSource(dist(rng));
+  }
+
+  std::vector<ElementOutput> D(count);
+  Span span(params);
+  span(D.data(), accum.data(), source.data(), count);
+
+  OutputOp op(params);
+  int const kCount = OutputOp::kCount;
+
+  for (int64_t offset = 0; offset + kCount <= count; offset += kCount) {
+    typename OutputOp::FragmentAccumulator frag_accum;
+    typename OutputOp::FragmentSource frag_source;
+    for (int i = 0; i < kCount; ++i) {
+      frag_accum[i] = accum[offset + i];
+      frag_source[i] = source[offset + i];
+    }
+
+    auto expected = op.is_source_needed() ? op(frag_accum, frag_source) : op(frag_accum);
+
+    for (int i = 0; i < kCount; ++i) {
+      if (exact) {
+        ASSERT_EQ(D[offset + i], expected[i]) << "element " << offset + i;
+      }
+      else {
+        ASSERT_TRUE(within_span_tolerance(float(D[offset + i]), float(expected[i]), output_rounding))
+          << "element " << offset + i << ": span " << float(D[offset + i])
+          << ", fragment " << float(expected[i]);
+      }
+    }
+  }
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(EpilogueSpan, sigmoid) {
+  verify_activation_span<cutlass::epilogue::thread::Sigmoid<float>>();
+}
+
+TEST(EpilogueSpan, silu) {
+  verify_activation_span<cutlass::epilogue::thread::SiLu<float>>();
+}
+
+TEST(EpilogueSpan, tanh) {
+  verify_activation_span<cutlass::epilogue::thread::Tanh<float>>();
+}
+
+TEST(EpilogueSpan, gelu) {
+  verify_activation_span<cutlass::epilogue::thread::GELU<float>>();
+}
+
+TEST(EpilogueSpan, gelu_taylor) {
+  verify_activation_span<cutlass::epilogue::thread::GELU_taylor<float>>();
+}
+
+TEST(EpilogueSpan, scalar_fallback_is_exact) {
+  using Activation = cutlass::epilogue::thread::GELU<double>;
+  static_assert(!cutlass::reference::host::ActivationSpan<Activation>::kVectorized, "");
+
+  std::vector<double> x = {-3.0, -0.5, 0.0, 0.25, 7.0};
+  std::vector<double> y = x;
+  cutlass::reference::host::ActivationSpan<Activation>{}(y.data(), int64_t(y.size()));
+
+  Activation op;
+  for (size_t i = 0; i < x.size(); ++i) {
+    EXPECT_EQ(y[i], op(x[i]));
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(EpilogueSpan, linear_combination_is_exact) {
+  using OutputOp = cutlass::epilogue::thread::LinearCombination<cutlass::half_t, 8, float, float>;
+  verify_epilogue_span<OutputOp>(OutputOp::Params(1.5f, -0.75f), true);
+  verify_epilogue_span<OutputOp>(OutputOp::Params(2.0f), true);
+
+  float alpha = 0.5f;
+  float beta = 1.25f;
+  verify_epilogue_span<OutputOp>(OutputOp::Params(&alpha, &beta), true);
+}
+
+TEST(EpilogueSpan, linear_combination_scale_types) {
+  using NoBeta = cutlass::epilogue::thread::LinearCombination<
+    float, 4, float, float, cutlass::epilogue::thread::ScaleType::NoBetaScaling>;
+  verify_epilogue_span<NoBeta>(NoBeta::Params(3.0f, 0.0f), true);
+
+  using Nothing = cutlass::epilogue::thread::LinearCombination<
+    float, 4, float, float, cutlass::epilogue::thread::ScaleType::Nothing>;
+  verify_epilogue_span<Nothing>(Nothing::Params(3.0f, 2.0f), true);
+}
+
+TEST(EpilogueSpan, linear_combination_gelu) {
+  using OutputOp = cutlass::epilogue::thread::LinearCombinationGELU<cutlass::half_t, 8, float, float>;
+  static_assert(cutlass::reference::host::EpilogueSpan<OutputOp>::kVectorized, "");
+
+  verify_epilogue_span<OutputOp>(OutputOp::Params(1.0f, 0.5f), false, 4099);
+}
+
+TEST(EpilogueSpan, linear_combination_silu) {
+  using OutputOp = cutlass::epilogue::thread::LinearCombinationSilu<float, 4, float, float>;
+  verify_epilogue_span<OutputOp>(OutputOp::Params(0.5f, 1.0f), false, 4099);
+}
+
+TEST(EpilogueSpan, bias_elementwise) {
+  using OutputOp = cutlass::epilogue::thread::LinearCombinationBiasElementwise<
+    float, float, float, float, float, 4, cutlass::epilogue::thread::GELU_taylor<float>>;
+  using Span = cutlass::reference::host::EpilogueSpan<OutputOp>;
+
+  int const kRows = 3;
+  int const kColumns = 301;
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(-6.0f, 6.0f);
+
+  std::vector<float> accum(kRows * kColumns), source(kRows * kColumns), bias(kColumns);
+  for (auto &v : accum) { v = dist(rng); }
+  for (auto &v : source) { v = dist(rng); }
+  for (auto &v : bias) { v = dist(rng); }
+
+  OutputOp::Params params(2.0f, 0.5f);
+  Span span(params);
+
+  std::vector<float> Z(kRows * kColumns), T(kRows * kColumns);
+  for (int row = 0; row < kRows; ++row) {
+    int64_t offset = int64_t(row) * kColumns;
+    span(Z.data() + offset, T.data() + offset, accum.data() + offset, source.data() + offset,
+         bias.data(), kColumns);
+  }
+
+  cutlass::epilogue::thread::GELU_taylor<float> gelu;
+  for (int row = 0; row < kRows; ++row) {
+    for (int column = 0; column < kColumns; ++column) {
+      int64_t i = int64_t(row) * kColumns + column;
+      float z = 2.0f * accum[i] + 0.5f * source[i] + bias[column];
+      ASSERT_EQ(T[i], z);
+      ASSERT_TRUE(within_span_tolerance(Z[i], gelu(z))) << "element " << i;
+    }
+  }
+
+  // A bias stride of zero broadcasts one value
+  std::vector<float> Z0(kColumns), T0(kColumns);
+  span(Z0.data(), T0.data(), accum.data(), source.data(), bias.data() + 5, kColumns, 0);
+  for (int column = 0; column < kColumns; ++column) {
+    EXPECT_EQ(T0[column], 2.0f * accum[column] + 0.5f * source[column] + bias[5]);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,299 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests comparing the blocked complex GEMM references with element-wise products
+*/
+
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/host_tensor_planar_complex.h"
+#include "cutlass/util/reference/host/gemm_complex.h"
+#include "cutlass/util/reference/host/gemm_planar_complex.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using Complex = cutlass::complex<double>;
+using ColumnMajor = cutlass::layout::ColumnMajor;
+using RowMajor = cutlass::layout::RowMajor;
+
+/// Small integers keep every product exact, so results are compared for equality
+template <typename Tensor>
+void fill(Tensor &tensor, int seed) {
+  std::mt19937 rng(seed);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    tensor.host_data()[i] = typename Tensor::Element(dist(rng), dist(rng));
+  }
+}
+
+Complex transform(Complex x, cutlass::ComplexTransform t) {
+  return t == cutlass::ComplexTransform::kConjugate ? cutlass::conj(x) : x;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GemmComplexReference, algorithms_and_transforms) {
+
+  using cutlass::ComplexTransform;
+  using cutlass::reference::host::ComplexGemmAlgorithm;
+
+  // 200 x 150 x 120 is split across host threads
+  for (cutlass::gemm::GemmCoord problem : {cutlass::gemm::GemmCoord(1, 1, 1),
+                                           cutlass::gemm::GemmCoord(37, 21, 19),
+                                           cutlass::gemm::GemmCoord(200, 150, 120)}) {
+
+    int m = problem.m(), n = problem.n(), k = problem.k();
+
+    cutlass::HostTensor<Complex, ColumnMajor> A({m, k}, false);
+    cutlass::HostTensor<Complex, RowMajor> B({k, n}, false);
+    cutlass::HostTensor<Complex, ColumnMajor> C({m, n}, false), D({m, n}, false);
+    fill(A, 1);
+    fill(B, 2);
+    fill(C, 3);
+
+    Complex alpha(2, -1), beta(1, 3);
+
+    for (auto algorithm : {ComplexGemmAlgorithm::kElementwise, ComplexGemmAlgorithm::k4M, ComplexGemmAlgorithm::k3M}) {
+      for (auto transform_a : {ComplexTransform::kNone, ComplexTransform::kConjugate}) {
+        for (auto transform_b : {ComplexTransform::kNone, ComplexTransform::kConjugate}) {
+
+          cutlass::reference::host::GemmComplex<
+            Complex, ColumnMajor, Complex, RowMajor, Complex, ColumnMajor, Complex, Complex>(
+              problem, alpha, A.host_ref(), transform_a, B.host_ref(), transform_b,
+              beta, C.host_ref(), D.host_ref(), Complex(0), 1, 0, 0, 0, 0, algorithm);
+
+          for (int i = 0; i < m; ++i) {
+            for (int j = 0; j < n; ++j) {
+              Complex sum(0);
+              for (int kk = 0; kk < k; ++kk) {
+                sum += transform(A.at({i, kk}), transform_a) * transform(B.at({kk, j}), transform_b);
+              }
+              ASSERT_EQ(D.at({i, j}), alpha * sum + beta * C.at({i, j}))
+                << "problem " << m << "x" << n << "x" << k << " (" << i << ", " << j << ")";
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(GemmComplexReference, batched) {
+
+  int m = 20, n = 17, k = 9, batch_count = 3;
+
+  cutlass::HostTensor<Complex, ColumnMajor> A({m, k * batch_count}, false);
+  cutlass::HostTensor<Complex, ColumnMajor> B({k, n * batch_count}, false);
+  cutlass::HostTensor<Complex, ColumnMajor> C({m, n * batch_count}, false), D({m, n * batch_count}, false);
+  fill(A, 4);
+  fill(B, 5);
+  fill(C, 6);
+
+  cutlass::reference::host::GemmComplex<
+    Complex, ColumnMajor, Complex, ColumnMajor, Complex, ColumnMajor, Complex, Complex>(
+      {m, n, k}, Complex(1), A.host_ref(), cutlass::ComplexTransform::kNone,
+      B.host_ref(), cutlass::ComplexTransform::kNone, Complex(-1), C.host_ref(), D.host_ref(),
+      Complex(0), batch_count, m * k, k * n, m * n, m * n);
+
+  for (int b = 0; b < batch_count; ++b) {
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        Complex sum(0);
+        for (int kk = 0; kk < k; ++kk) {
+          sum += A.at({i, b * k + kk}) * B.at({kk, b * n + j});
+        }
+        EXPECT_EQ(D.at({i, b * n + j}), sum - C.at({i, b * n + j}));
+      }
+    }
+  }
+}
+
+TEST(GemmComplexReference, real_compute_type) {
+
+  int m = 33, n = 18, k = 40;
+
+  cutlass::HostTensor<float, ColumnMajor> A({m, k}, false), B({k, n}, false), C({m, n}, false), D({m, n}, false);
+
+  std::mt19937 rng(7);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  for (auto *tensor : {&A, &B, &C}) {
+    for (size_t i = 0; i < tensor->size(); ++i) {
+      tensor->host_data()[i] = float(dist(rng));
+    }
+  }
+
+  cutlass::reference::host::GemmComplex<
+    float, ColumnMajor, float, ColumnMajor, float, ColumnMajor, float, float>(
+      {m, n, k}, 1.5f, A.host_ref(), cutlass::ComplexTransform::kNone,
+      B.host_ref(), cutlass::ComplexTransform::kNone, 0.5f, C.host_ref(), D.host_ref(), 0.0f);
+
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      float sum = 0;
+      for (int kk = 0; kk < k; ++kk) {
+        sum += A.at({i, kk}) * B.at({kk, j});
+      }
+      EXPECT_EQ(D.at({i, j}), 1.5f * sum + 0.5f * C.at({i, j}));
+    }
+  }
+}
+
+TEST(GemmComplexReference, planar_complex) {
+
+  using cutlass::reference::host::ComplexGemmAlgorithm;
+
+  int m = 45, n = 23, k = 31;
+
+  cutlass::HostTensorPlanarComplex<double, ColumnMajor> A({m, k}), B({k, n}), C({m, n}), D({m, n});
+
+  std::mt19937 rng(8);
+  std::uniform_int_distribution<int> dist(-4, 4);
+  for (auto *tensor : {&A, &B, &C}) {
+    for (size_t i = 0; i < tensor->capacity() * 2; ++i) {
+      tensor->host_data()[i] = double(dist(rng));
+    }
+  }
+
+  for (auto algorithm : {ComplexGemmAlgorithm::kElementwise, ComplexGemmAlgorithm::k4M, ComplexGemmAlgorithm::k3M}) {
+
+    cutlass::reference::host::GemmPlanarComplex<
+      double, ColumnMajor, double, ColumnMajor, double, ColumnMajor, double, double>(
+        {m, n, k}, Complex(1, 1), A.host_ref(), cutlass::ComplexTransform::kConjugate,
+        B.host_ref(), cutlass::ComplexTransform::kNone, Complex(2), C.host_ref(), D.host_ref(),
+        Complex(0), algorithm);
+
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        Complex sum(0);
+        for (int kk = 0; kk < k; ++kk) {
+          sum += cutlass::conj(Complex(A.host_ref().at({i, kk}))) * Complex(B.host_ref().at({kk, j}));
+        }
+        EXPECT_EQ(Complex(D.host_ref().at({i, j})), Complex(1, 1) * sum + Complex(2) * Complex(C.host_ref().at({i, j})));
+      }
+    }
+  }
+}
+
+TEST(GemmComplexReference, float_rounding) {
+
+  using ComplexF = cutlass::complex<float>;
+  using cutlass::reference::host::ComplexGemmAlgorithm;
+
+  int m = 48, n = 40, k = 512;
+
+  cutlass::HostTensor<ComplexF, ColumnMajor> A({m, k}, false), C({m, n}, false), D({m, n}, false);
+  cutlass::HostTensor<ComplexF, RowMajor> B({k, n}, false);
+
+  std::mt19937 rng(9);
+  std::uniform_real_distribution<float> dist(-1, 1);
+  for (size_t i = 0; i < A.size(); ++i) {
+    A.host_data()[i] = ComplexF(dist(rng), dist(rng));
+  }
+  for (size_t i = 0; i < B.size(); ++i) {
+    B.host_data()[i] = ComplexF(dist(rng), dist(rng));
+  }
+  C.sync_host();
+
+  auto run = [&](ComplexGemmAlgorithm algorithm) {
+    cutlass::reference::host::GemmComplex<
+      ComplexF, ColumnMajor, ComplexF, RowMajor, ComplexF, ColumnMajor, ComplexF, ComplexF>(
+        {m, n, k}, ComplexF(1), A.host_ref(), cutlass::ComplexTransform::kNone,
+        B.host_ref(), cutlass::ComplexTransform::kNone, ComplexF(0), C.host_ref(), D.host_ref(),
+        ComplexF(0), 1, 0, 0, 0, 0, algorithm);
+  };
+
+  // The default keeps the rounding of one complex multiply-add per term in increasing order of k
+  cutlass::reference::host::GemmComplex<
+    ComplexF, ColumnMajor, ComplexF, RowMajor, ComplexF, ColumnMajor, ComplexF, ComplexF>(
+      {m, n, k}, ComplexF(1), A.host_ref(), cutlass::ComplexTransform::kNone,
+      B.host_ref(), cutlass::ComplexTransform::kNone, ComplexF(0), C.host_ref(), D.host_ref(),
+      ComplexF(0));
+
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      ComplexF sum(0);
+      for (int kk = 0; kk < k; ++kk) {
+        sum = cutlass::multiply_add<ComplexF>()(A.at({i, kk}), B.at({kk, j}), sum);
+      }
+      ASSERT_EQ(D.at({i, j}), sum) << "(" << i << ", " << j << ")";
+    }
+  }
+
+  // Split-plane products round differently, but stay within the usual bound of a K-term dot
+  // product: |error| <= c * K * eps * sum |a| |b|. The imaginary part of 3M sums three products
+  // of larger magnitude, so its error is larger than that of 4M.
+  double const eps = std::numeric_limits<float>::epsilon();
+  double elementwise_worst = 0;
+
+  for (auto algorithm : {ComplexGemmAlgorithm::kElementwise, ComplexGemmAlgorithm::k4M, ComplexGemmAlgorithm::k3M}) {
+
+    run(algorithm);
+
+    double worst = 0;
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        Complex exact(0);
+        double magnitude = 0;
+        for (int kk = 0; kk < k; ++kk) {
+          Complex a(A.at({i, kk}).real(), A.at({i, kk}).imag());
+          Complex b(B.at({kk, j}).real(), B.at({kk, j}).imag());
+          exact += a * b;
+          magnitude += (std::abs(a.real()) + std::abs(a.imag())) * (std::abs(b.real()) + std::abs(b.imag()));
+        }
+        double error = std::max(
+          std::abs(double(D.at({i, j}).real()) - exact.real()),
+          std::abs(double(D.at({i, j}).imag()) - exact.imag()));
+        worst = std::max(worst, error / (double(k) * eps * magnitude));
+      }
+    }
+
+    // 2 (4M) and 3 (3M) are worst-case bounds. Random data sit far below them, so the split-plane
+    // errors are also compared with the element-wise error of the same problem.
+    EXPECT_LT(worst, algorithm == ComplexGemmAlgorithm::k3M ? 3.0 : 2.0) << int(algorithm);
+    if (algorithm == ComplexGemmAlgorithm::kElementwise) {
+      elementwise_worst = worst;
+    }
+    else {
+      EXPECT_LT(worst, 4 * elementwise_worst) << int(algorithm);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
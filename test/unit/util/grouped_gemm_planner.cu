@@ -0,0 +1,320 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for the grouped GEMM planner and the multithreaded grouped GETT reference
+*/
+
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/grouped_gemm_planner.hpp"
+#include "cutlass/util/host_thread_pool.h"
+#include "cutlass/util/reference/host/grouped_gett.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+cutlass::KernelHardwareInfo make_hw_info(int sm_count) {
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = sm_count;
+  return hw_info;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GroupedGemmPlanner, moe_problem_sizes) {
+  auto problems = cutlass::GroupedGemmPlanner::moe_problem_sizes({5, 0, 300}, 512, 256);
+  ASSERT_EQ(problems.size(), 3u);
+  EXPECT_EQ(problems[0], cutlass::gemm::GemmCoord(5, 512, 256));
+  EXPECT_EQ(problems[1], cutlass::gemm::GemmCoord(0, 512, 256));
+
+  auto swapped = cutlass::GroupedGemmPlanner::moe_problem_sizes({5}, 512, 256, true);
+  EXPECT_EQ(swapped[0], cutlass::gemm::GemmCoord(512, 5, 256));
+}
+
+TEST(GroupedGemmPlanner, uniform_routing_is_balanced) {
+
+  cutlass::GroupedGemmPlanner planner({128, 128, 64}, {1, 1, 1}, make_hw_info(132));
+
+  // 64 experts with 256 tokens and N = 2176: 2 x 17 tiles per expert, 2176 tiles in total
+  auto problems = cutlass::GroupedGemmPlanner::moe_problem_sizes(std::vector<int>(64, 256), 2176, 1024);
+  auto plan = planner.plan(problems);
+
+  EXPECT_EQ(plan.grid_size, 132);
+  EXPECT_EQ(plan.total_tiles(), 64u * 34u);
+  EXPECT_EQ(plan.groups[1].start_linear_idx, 34u);
+
+  // Tiles are dealt round-robin: no CTA receives more than one tile above the mean
+  for (int64_t tiles : plan.cta_tiles) {
+    EXPECT_GE(tiles, 16);
+    EXPECT_LE(tiles, 17);
+  }
+  EXPECT_LT(plan.imbalance(), 1.05);
+  EXPECT_DOUBLE_EQ(plan.padding_efficiency(), 1.0);
+}
+
+TEST(GroupedGemmPlanner, grid_is_truncated_to_problem) {
+  cutlass::GroupedGemmPlanner planner({128, 128, 64}, {1, 1, 1}, make_hw_info(132));
+  auto plan = planner.plan(cutlass::GroupedGemmPlanner::moe_problem_sizes({100, 0, 30}, 256, 512));
+  EXPECT_EQ(plan.total_tiles(), 4u);
+  EXPECT_EQ(plan.grid_size, 4);
+  EXPECT_EQ(plan.groups[1].tiles(), 0u);
+}
+
+TEST(GroupedGemmPlanner, skewed_routing) {
+
+  cutlass::GroupedGemmPlanner planner({128, 128, 64}, {1, 1, 1}, make_hw_info(132));
+
+  // Same total token count, routed uniformly and to a few hot experts
+  std::vector<int> uniform(64, 128);
+  std::vector<int> skewed(64, 8);
+  skewed[0] = skewed[1] = skewed[2] = skewed[3] = (64 * 128 - 60 * 8) / 4;
+
+  auto uniform_plan = planner.plan(cutlass::GroupedGemmPlanner::moe_problem_sizes(uniform, 4096, 1024));
+  auto skewed_plan = planner.plan(cutlass::GroupedGemmPlanner::moe_problem_sizes(skewed, 4096, 1024));
+
+  // Tiny experts pad a full 128-row tile for 8 tokens
+  EXPECT_LT(skewed_plan.padding_efficiency(), uniform_plan.padding_efficiency());
+  EXPECT_DOUBLE_EQ(uniform_plan.padding_efficiency(), 1.0);
+  EXPECT_GT(skewed_plan.total_load(), uniform_plan.total_load());
+}
+
+TEST(GroupedGemmPlanner, varying_k_imbalance) {
+
+  cutlass::GroupedGemmTileCostModel cost;
+  cost.tile_overhead = 0;
+
+  cutlass::GroupedGemmPlanner planner({128, 128, 64}, {1, 1, 1}, make_hw_info(4),
+    1, cutlass::GroupedGemmPlanner::RasterOrderOptions::Heuristic, cost);
+
+  // One tile per group; groups alternate between 1 and 9 K tiles, so CTAs 0 and 2 get all the
+  // short tiles and CTAs 1 and 3 all the long ones.
+  std::vector<cutlass::gemm::GemmCoord> problems;
+  for (int g = 0; g < 8; ++g) {
+    problems.push_back({128, 128, g % 2 ? 576 : 64});
+  }
+
+  auto plan = planner.plan(problems);
+  ASSERT_EQ(plan.grid_size, 4);
+  EXPECT_DOUBLE_EQ(plan.cta_load[0], 2.0);
+  EXPECT_DOUBLE_EQ(plan.cta_load[1], 18.0);
+  EXPECT_DOUBLE_EQ(plan.makespan(), 18.0);
+  EXPECT_DOUBLE_EQ(plan.imbalance(), 1.8);
+}
+
+TEST(GroupedGemmPlanner, tiles_cover_each_output_once) {
+
+  using RasterOrderOptions = cutlass::GroupedGemmPlanner::RasterOrderOptions;
+
+  for (auto raster : {RasterOrderOptions::AlongM, RasterOrderOptions::AlongN}) {
+    for (cutlass::gemm::GemmCoord cluster : {cutlass::gemm::GemmCoord(1, 1, 1), cutlass::gemm::GemmCoord(2, 1, 1), cutlass::gemm::GemmCoord(1, 2, 1)}) {
+
+      cutlass::GroupedGemmPlanner planner({64, 128, 64}, cluster, make_hw_info(16), 1, raster);
+      auto problems = cutlass::GroupedGemmPlanner::moe_problem_sizes({1, 200, 0, 333, 64}, 300, 128);
+      auto plan = planner.plan(problems, true);
+
+      ASSERT_EQ(plan.tiles.size(), size_t(plan.total_tiles()));
+
+      std::set<std::tuple<int, int, int>> seen;
+      for (auto const &tile : plan.tiles) {
+        auto const &group = plan.groups[tile.group];
+        EXPECT_GE(tile.m, 0);
+        EXPECT_LT(tile.m, group.tiles_m);
+        EXPECT_GE(tile.n, 0);
+        EXPECT_LT(tile.n, group.tiles_n);
+        EXPECT_TRUE(seen.insert({tile.group, tile.m, tile.n}).second);
+      }
+
+      // Cluster rounding of the 1-token expert pads a tile along M when clustering along M
+      int padded = 0;
+      for (auto const &tile : plan.tiles) {
+        padded += tile.padding;
+      }
+      EXPECT_EQ(padded > 0, cluster.m() > 1 || cluster.n() > 1);
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(GroupedGett, matches_per_group_gett) {
+
+  using namespace cute;
+
+  std::mt19937 rng(2025);
+  std::uniform_int_distribution<int> dist(-3, 3);
+
+  int const N = 72;
+  int const K = 40;
+  std::vector<int> tokens = {0, 1, 3, 130, 7, 0, 65, 2};
+
+  using Stride = Stride<int64_t, _1, int64_t>;
+  using Layout = decltype(make_layout(make_shape(0, 0, 0), Stride{}));
+  using Tensor = decltype(make_tensor(static_cast<float *>(nullptr), Layout{}));
+
+  using MainloopParams = cutlass::reference::host::GettMainloopParams<float, Tensor, Tensor>;
+  using EpilogueParams = cutlass::reference::host::GettEpilogueParams<float, float, float, float, Tensor, Tensor>;
+
+  std::vector<std::vector<float>> A(tokens.size()), B(tokens.size()), C(tokens.size());
+  std::vector<std::vector<float>> D(tokens.size()), D_ref(tokens.size());
+
+  std::vector<MainloopParams> mainloop;
+  std::vector<EpilogueParams> epilogue;
+  std::vector<EpilogueParams> epilogue_ref;
+
+  for (size_t g = 0; g < tokens.size(); ++g) {
+    int M = tokens[g];
+    A[g].resize(M * K);
+    B[g].resize(N * K);
+    C[g].resize(M * N);
+    D[g].assign(M * N, 0.f);
+    D_ref[g].assign(M * N, 0.f);
+    for (auto &x : A[g]) { x = float(dist(rng)); }
+    for (auto &x : B[g]) { x = float(dist(rng)); }
+    for (auto &x : C[g]) { x = float(dist(rng)); }
+
+    auto layout_A = make_layout(make_shape(M, K, 1), Stride{K, _1{}, int64_t(M) * K});
+    auto layout_B = make_layout(make_shape(N, K, 1), Stride{K, _1{}, int64_t(N) * K});
+    auto layout_C = make_layout(make_shape(M, N, 1), Stride{N, _1{}, int64_t(M) * N});
+
+    mainloop.emplace_back(make_tensor(A[g].data(), layout_A), make_tensor(B[g].data(), layout_B));
+    epilogue.emplace_back(2.f, 0.5f, make_tensor(C[g].data(), layout_C), make_tensor(D[g].data(), layout_C));
+    epilogue_ref.emplace_back(2.f, 0.5f, make_tensor(C[g].data(), layout_C), make_tensor(D_ref[g].data(), layout_C));
+  }
+
+  for (size_t g = 0; g < tokens.size(); ++g) {
+    cutlass::reference::host::Gett(mainloop[g], epilogue_ref[g]);
+  }
+
+  for (int num_threads : {1, 3, 16}) {
+    for (auto &d : D) {
+      std::fill(d.begin(), d.end(), 0.f);
+    }
+    cutlass::reference::host::GroupedGett(mainloop, epilogue, num_threads);
+    for (size_t g = 0; g < tokens.size(); ++g) {
+      EXPECT_EQ(D[g], D_ref[g]) << "group " << g << " with " << num_threads << " threads";
+    }
+  }
+}
+
+TEST(GroupedGett, subbyte_output) {
+
+  using namespace cute;
+
+  std::mt19937 rng(2025);
+  std::uniform_int_distribution<int> dist(-1, 1);
+
+  // An odd N makes rows of neighboring blocks along M share a byte of D
+  int const N = 71;
+  int const K = 4;
+  std::vector<int> tokens = {130, 1, 67, 200};
+
+  using Stride = Stride<int64_t, _1, int64_t>;
+  using Layout = decltype(make_layout(make_shape(0, 0, 0), Stride{}));
+  using Tensor = decltype(make_tensor(static_cast<float *>(nullptr), Layout{}));
+  using TensorD = decltype(make_tensor(subbyte_iterator<cutlass::int4b_t>(static_cast<uint8_t *>(nullptr)), Layout{}));
+
+  using MainloopParams = cutlass::reference::host::GettMainloopParams<float, Tensor, Tensor>;
+  using EpilogueParams = cutlass::reference::host::GettEpilogueParams<float, float, float, float, Tensor, TensorD>;
+
+  std::vector<std::vector<float>> A(tokens.size()), B(tokens.size()), C(tokens.size());
+  std::vector<std::vector<uint8_t>> D(tokens.size()), D_ref(tokens.size());
+
+  std::vector<MainloopParams> mainloop;
+  std::vector<EpilogueParams> epilogue;
+  std::vector<EpilogueParams> epilogue_ref;
+
+  for (size_t g = 0; g < tokens.size(); ++g) {
+    int M = tokens[g];
+    A[g].resize(M * K);
+    B[g].resize(N * K);
+    C[g].assign(M * N, 0.f);
+    D[g].assign((M * N + 1) / 2, 0);
+    D_ref[g].assign((M * N + 1) / 2, 0);
+    for (auto &x : A[g]) { x = float(dist(rng)); }
+    for (auto &x : B[g]) { x = float(dist(rng)); }
+
+    auto layout_A = make_layout(make_shape(M, K, 1), Stride{K, _1{}, int64_t(M) * K});
+    auto layout_B = make_layout(make_shape(N, K, 1), Stride{K, _1{}, int64_t(N) * K});
+    auto layout_C = make_layout(make_shape(M, N, 1), Stride{N, _1{}, int64_t(M) * N});
+
+    mainloop.emplace_back(make_tensor(A[g].data(), layout_A), make_tensor(B[g].data(), layout_B));
+    epilogue.emplace_back(1.f, 0.f, make_tensor(C[g].data(), layout_C),
+      make_tensor(subbyte_iterator<cutlass::int4b_t>(D[g].data()), layout_C));
+    epilogue_ref.emplace_back(1.f, 0.f, make_tensor(C[g].data(), layout_C),
+      make_tensor(subbyte_iterator<cutlass::int4b_t>(D_ref[g].data()), layout_C));
+  }
+
+  for (size_t g = 0; g < tokens.size(); ++g) {
+    cutlass::reference::host::Gett(mainloop[g], epilogue_ref[g]);
+  }
+
+  for (int iteration = 0; iteration < 4; ++iteration) {
+    for (auto &d : D) {
+      std::fill(d.begin(), d.end(), uint8_t(0));
+    }
+    cutlass::reference::host::GroupedGett(mainloop, epilogue, 16);
+    for (size_t g = 0; g < tokens.size(); ++g) {
+      EXPECT_EQ(D[g], D_ref[g]) << "group " << g;
+    }
+  }
+}
+
+TEST(GroupedGett, work_stealing_visits_each_item_once) {
+
+  // Costs concentrated at the front leave most threads idle after the initial partition
+  std::vector<double> costs(1000, 1.0);
+  for (int i = 0; i < 10; ++i) {
+    costs[i] = 500.0;
+  }
+
+  std::vector<std::atomic<int>> visits(costs.size());
+  for (auto &v : visits) {
+    v = 0;
+  }
+
+  cutlass::host_thread_pool().parallel_for_weighted(costs, [&](uint32_t item) {
+    visits[item].fetch_add(1);
+  }, 8);
+
+  for (auto const &v : visits) {
+    EXPECT_EQ(v.load(), 1);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,203 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for HostAllocator policies and their use as HostTensor storage
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/layout/matrix.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/host_allocator.h"
+#include "cutlass/util/host_tensor.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostAllocator, uninitialized_construct) {
+
+  using Allocator = cutlass::HostAllocator<int, cutlass::HostAllocation::kUninitialized>;
+
+  // Construct into storage holding a sentinel: value-initialization would overwrite it
+  int storage = 0x5a5a5a5a;
+  Allocator allocator;
+  std::allocator_traits<Allocator>::construct(allocator, &storage);
+  EXPECT_EQ(storage, 0x5a5a5a5a);
+
+  std::allocator_traits<Allocator>::construct(allocator, &storage, 7);
+  EXPECT_EQ(storage, 7);
+
+  cutlass::HostAllocator<int> default_allocator;
+  std::allocator_traits<cutlass::HostAllocator<int>>::construct(default_allocator, &storage);
+  EXPECT_EQ(storage, 0);
+}
+
+TEST(HostAllocator, mapped_allocations) {
+
+  using Allocator = cutlass::HostAllocator<float,
+    cutlass::HostAllocation::kUninitialized |
+    cutlass::HostAllocation::kTransparentHugePages |
+    cutlass::HostAllocation::kParallelFirstTouch>;
+
+  // Large enough to be mapped, and not a multiple of the huge page size
+  std::vector<float, Allocator> buffer((size_t(5) << 20) + 3);
+
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    buffer[i] = float(i % 1024);
+  }
+  EXPECT_EQ(buffer.back(), float((buffer.size() - 1) % 1024));
+
+  // Small allocations fall back to operator new
+  std::vector<float, Allocator> small(16, 1.0f);
+  EXPECT_EQ(small[15], 1.0f);
+}
+
+TEST(HostAllocator, arena_recycles_buffers) {
+
+  constexpr unsigned kFlags = cutlass::HostAllocation::kUninitialized | cutlass::HostAllocation::kArena;
+  using Allocator = cutlass::HostAllocator<double, kFlags>;
+  auto &arena = cutlass::HostAllocationArena<kFlags>::instance();
+  arena.release();
+
+  Allocator allocator;
+  double *first = allocator.allocate(1000);
+  allocator.deallocate(first, 1000);
+  EXPECT_EQ(arena.cached_bytes(), 1000 * sizeof(double));
+
+  // A smaller request reuses the cached block; a much smaller one does not
+  double *tiny = allocator.allocate(10);
+  EXPECT_NE(tiny, first);
+  double *second = allocator.allocate(800);
+  EXPECT_EQ(second, first);
+  EXPECT_EQ(arena.cached_bytes(), 0u);
+
+  allocator.deallocate(second, 800);
+  allocator.deallocate(tiny, 10);
+  arena.release();
+  EXPECT_EQ(arena.cached_bytes(), 0u);
+}
+
+TEST(HostAllocator, over_aligned_elements) {
+
+  struct alignas(256) Element {
+    float value;
+  };
+
+  constexpr unsigned kFlags = cutlass::HostAllocation::kArena;
+  auto &arena = cutlass::HostAllocationArena<kFlags>::instance();
+  arena.release();
+
+  // A cached block of a less aligned type is not reused for an over-aligned one
+  cutlass::HostAllocator<char, kFlags> bytes;
+  char *block = bytes.allocate(64 * sizeof(Element) + 1);
+  bytes.deallocate(block, 64 * sizeof(Element) + 1);
+
+  std::vector<Element, cutlass::HostAllocator<Element>> plain(64);
+  std::vector<Element, cutlass::HostAllocator<Element, kFlags>> cached(64);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(plain.data()) % alignof(Element), 0u);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(cached.data()) % alignof(Element), 0u);
+
+  arena.release();
+}
+
+namespace {
+
+/// Destroyed during program exit, after the arena it returns its memory to was first used
+std::vector<double, cutlass::HostAllocator<double, cutlass::HostAllocation::kArena>> static_buffer;
+
+} // namespace
+
+TEST(HostAllocator, arena_outlives_static_containers) {
+  static_buffer.assign(4096, 1.0);
+  EXPECT_EQ(static_buffer[4095], 1.0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostTensor, default_allocator_zero_fills) {
+  cutlass::HostTensor<float, cutlass::layout::RowMajor> tensor({64, 32}, false);
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    EXPECT_EQ(tensor.host_data(i), 0.0f);
+  }
+}
+
+TEST(HostTensor, allocator_policy) {
+
+  constexpr unsigned kFlags = cutlass::HostAllocation::kUninitialized | cutlass::HostAllocation::kArena;
+  auto &arena = cutlass::HostAllocationArena<kFlags>::instance();
+  arena.release();
+
+  using Tensor = cutlass::HostTensor<
+    cutlass::half_t, cutlass::layout::ColumnMajor, cutlass::HostAllocator<cutlass::half_t, kFlags>>;
+
+  Tensor tensor({128, 64}, false);
+  EXPECT_EQ(tensor.capacity(), 128 * 64);
+
+  cutlass::half_t *data = tensor.host_data();
+  tensor.at({5, 7}) = cutlass::half_t(3);
+  EXPECT_EQ(tensor.host_data(5 + 7 * 128), cutlass::half_t(3));
+
+  // Shrinking keeps the allocation and its contents
+  tensor.resize({64, 64}, false);
+  EXPECT_EQ(tensor.host_data(), data);
+  EXPECT_EQ(tensor.host_data(5 + 7 * 128), cutlass::half_t(3));
+
+  // Growing releases the old buffer to the arena before allocating
+  tensor.reset({256, 64}, false);
+  EXPECT_EQ(arena.cached_bytes(), 128 * 64 * sizeof(cutlass::half_t));
+
+  // A new tensor of the original size reuses the cached buffer
+  Tensor other({128, 64}, false);
+  EXPECT_EQ(other.host_data(), data);
+  EXPECT_EQ(arena.cached_bytes(), 0u);
+}
+
+TEST(HostTensor, allocator_policy_subbyte) {
+
+  using Tensor = cutlass::HostTensor<
+    cutlass::int4b_t, cutlass::layout::RowMajor,
+    cutlass::HostAllocator<cutlass::int4b_t, cutlass::HostAllocation::kUninitialized>>;
+
+  Tensor tensor({8, 9}, false);
+  EXPECT_GE(tensor.capacity(), 72);
+
+  for (int i = 0; i < 8; ++i) {
+    for (int j = 0; j < 9; ++j) {
+      tensor.at({i, j}) = cutlass::int4b_t((i + j) % 8 - 4);
+    }
+  }
+  EXPECT_EQ(int(tensor.at({3, 4})), 3);
+  EXPECT_EQ(int(tensor.at({0, 0})), -4);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,341 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for executing CUTLASS kernels on the host with emulated threadblocks
+*/
+
+// Must precede all other CUTLASS headers
+#include "cutlass/util/host_emulation.h"
+
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm/gemm.h"
+#include "cutlass/gemm/kernel/default_gemm.h"
+#include "cutlass/gemm/threadblock/threadblock_swizzle.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::vector<cutlass::emulation::Backend> backends() {
+  std::vector<cutlass::emulation::Backend> result{cutlass::emulation::Backend::kThreads};
+#if defined(CUTLASS_HOST_EMULATION_FIBERS)
+  result.push_back(cutlass::emulation::Backend::kFibers);
+#endif
+  return result;
+}
+
+/// Sums each block's values with a shared memory tree reduction
+void block_sums(std::vector<int> const &input, std::vector<int> &output, int block_size,
+                cutlass::emulation::LaunchOptions const &options) {
+
+  int blocks = int(input.size()) / block_size;
+  output.assign(size_t(blocks), 0);
+
+  cutlass::emulation::launch(dim3(blocks, 1, 1), dim3(block_size, 1, 1), block_size * sizeof(int),
+    [&](void *shared_memory) {
+
+      int *smem = static_cast<int *>(shared_memory);
+      int tid = int(threadIdx.x);
+
+      smem[tid] = input[blockIdx.x * block_size + tid];
+      __syncthreads();
+
+      for (int stride = block_size / 2; stride > 0; stride /= 2) {
+        if (tid < stride) {
+          smem[tid] += smem[tid + stride];
+        }
+        __syncthreads();
+      }
+
+      if (tid == 0) {
+        output[blockIdx.x] = smem[0];
+      }
+    },
+    options);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostEmulation, syncthreads_reduction) {
+
+  int const kBlockSize = 128;
+  std::vector<int> input(kBlockSize * 13);
+  for (size_t i = 0; i < input.size(); ++i) {
+    input[i] = int(i % 37) - 11;
+  }
+
+  for (auto backend : backends()) {
+    cutlass::emulation::LaunchOptions options;
+    options.backend = backend;
+    options.num_workers = 3;
+
+    std::vector<int> output;
+    block_sums(input, output, kBlockSize, options);
+
+    for (int b = 0; b < 13; ++b) {
+      int expected = 0;
+      for (int i = 0; i < kBlockSize; ++i) {
+        expected += input[size_t(b * kBlockSize + i)];
+      }
+      EXPECT_EQ(output[size_t(b)], expected) << "block " << b;
+    }
+  }
+}
+
+TEST(HostEmulation, builtin_variables) {
+
+  dim3 grid(3, 2, 2);
+  dim3 block(4, 2, 3);
+
+  int threads_per_block = int(block.x * block.y * block.z);
+  int blocks = int(grid.x * grid.y * grid.z);
+  std::vector<int> visits(size_t(blocks * threads_per_block), 0);
+
+  cutlass::emulation::launch(grid, block, 0, [&](void *) {
+    EXPECT_EQ(blockDim.y, 2u);
+    EXPECT_EQ(gridDim.z, 2u);
+    int b = int(blockIdx.x + gridDim.x * (blockIdx.y + gridDim.y * blockIdx.z));
+    int t = int(threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z));
+    ++visits[size_t(b * threads_per_block + t)];
+  });
+
+  for (int v : visits) {
+    EXPECT_EQ(v, 1);
+  }
+
+  EXPECT_FALSE(cutlass::thread0());
+  EXPECT_FALSE(cutlass::emulation::in_kernel());
+  EXPECT_THROW(cutlass::emulation::thread_idx(), std::logic_error);
+
+  // Built-in variables are ordinary identifiers, so other declarations may reuse their names
+  struct { unsigned threadIdx = 7; } shadow;
+  EXPECT_EQ(shadow.threadIdx, 7u);
+}
+
+TEST(HostEmulation, integer_intrinsics) {
+  EXPECT_EQ(__byte_perm(0x33221100u, 0x77665544u, 0x5410u), 0x55441100u);
+  EXPECT_EQ(__byte_perm(0x33221100u, 0x77665544u, 0x0040u), 0x00004400u);
+  EXPECT_EQ(__dp4a(0x01020304u, 0x01010101u, 10u), 20u);
+  EXPECT_EQ(__dp4a(int(0xff000001u), 0x01010101, 0), 0);
+}
+
+TEST(HostEmulation, warp_shuffle) {
+
+  for (auto backend : backends()) {
+
+    cutlass::emulation::LaunchOptions options;
+    options.backend = backend;
+
+    // 80 threads: two full warps and a partial warp of 16 lanes
+    int const kThreads = 80;
+    std::vector<int> reduced(kThreads), broadcast(kThreads), up(kThreads), down(kThreads);
+    std::vector<int> warp_idx(kThreads), lane_idx(kThreads);
+
+    cutlass::emulation::launch(dim3(1, 1, 1), dim3(kThreads, 1, 1), 0, [&](void *) {
+      int tid = int(threadIdx.x);
+
+      int sum = tid;
+      for (int mask = 4; mask > 0; mask /= 2) {
+        sum += __shfl_xor_sync(0xffffffff, sum, mask, 8);
+      }
+      reduced[tid] = sum;
+      broadcast[tid] = __shfl_sync(0xffffffff, tid * 10, 3, 16);
+      up[tid] = __shfl_up_sync(0xffffffff, tid, 1);
+      down[tid] = __shfl_down_sync(0xffffffff, tid, 2);
+      warp_idx[tid] = cutlass::canonical_warp_idx_sync();
+      lane_idx[tid] = cutlass::canonical_lane_idx();
+    }, options);
+
+    for (int tid = 0; tid < kThreads; ++tid) {
+      int lane = tid % 32;
+      int group = tid / 8 * 8;
+      EXPECT_EQ(reduced[tid], 8 * group + 28) << tid;
+      EXPECT_EQ(broadcast[tid], (tid / 16 * 16 + 3) * 10) << tid;
+      EXPECT_EQ(up[tid], lane == 0 ? tid : tid - 1) << tid;
+      if (lane < 30 && tid + 2 < kThreads) {
+        EXPECT_EQ(down[tid], tid + 2) << tid;
+      }
+      EXPECT_EQ(warp_idx[tid], tid / 32);
+      EXPECT_EQ(lane_idx[tid], lane);
+    }
+  }
+}
+
+TEST(HostEmulation, early_exit_does_not_block_barriers) {
+
+  for (auto backend : backends()) {
+    cutlass::emulation::LaunchOptions options;
+    options.backend = backend;
+
+    std::vector<int> output;
+    int passes = 0;
+
+    cutlass::emulation::launch(dim3(1, 1, 1), dim3(64, 1, 1), 0, [&](void *) {
+      if (threadIdx.x >= 48) {
+        return;
+      }
+      __syncthreads();
+      __syncwarp();
+      __syncthreads();
+      if (threadIdx.x == 0) {
+        ++passes;
+      }
+    }, options);
+
+    EXPECT_EQ(passes, 1);
+  }
+}
+
+#if defined(CUTLASS_HOST_EMULATION_FIBERS)
+
+TEST(HostEmulation, divergent_barrier_is_reported) {
+
+  cutlass::emulation::LaunchOptions options;
+  options.backend = cutlass::emulation::Backend::kFibers;
+
+  EXPECT_THROW(
+    cutlass::emulation::launch(dim3(2, 1, 1), dim3(64, 1, 1), 0, [](void *) {
+      // Half of each warp waits for the other half, which waits for the whole block
+      if (threadIdx.x % 32 < 16) {
+        __syncwarp();
+      }
+      else {
+        __syncthreads();
+      }
+    }, options),
+    std::runtime_error);
+}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostEmulation, simt_sgemm) {
+
+  using ElementAccumulator = float;
+  using ThreadblockShape = cutlass::gemm::GemmShape<64, 64, 8>;
+  using WarpShape = cutlass::gemm::GemmShape<32, 32, 8>;
+
+  using GemmKernel = typename cutlass::gemm::kernel::DefaultGemm<
+    float, cutlass::layout::ColumnMajor, 1,
+    float, cutlass::layout::RowMajor, 1,
+    float, cutlass::layout::RowMajor,
+    ElementAccumulator,
+    cutlass::arch::OpClassSimt,
+    cutlass::arch::Sm50,
+    ThreadblockShape,
+    WarpShape,
+    cutlass::gemm::GemmShape<1, 1, 1>,
+    cutlass::epilogue::thread::LinearCombination<float, 1, float, float>,
+    cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<>,
+    2,
+    false,
+    cutlass::arch::OpMultiplyAdd
+  >::GemmKernel;
+
+  // Partial tiles in every dimension
+  cutlass::gemm::GemmCoord problem_size(100, 72, 44);
+  int M = problem_size.m();
+  int N = problem_size.n();
+  int K = problem_size.k();
+
+  std::mt19937 rng(2025);
+  std::uniform_int_distribution<int> dist(-4, 4);
+
+  std::vector<float> A(size_t(M * K)), B(size_t(K * N)), C(size_t(M * N)), D(size_t(M * N));
+  for (auto &x : A) { x = float(dist(rng)); }
+  for (auto &x : B) { x = float(dist(rng)); }
+  for (auto &x : C) { x = float(dist(rng)); }
+
+  float alpha = 2;
+  float beta = -1;
+
+  cutlass::gemm::threadblock::GemmIdentityThreadblockSwizzle<> swizzle;
+  cutlass::gemm::GemmCoord grid_tiled_shape = swizzle.get_tiled_shape(
+    problem_size, {ThreadblockShape::kM, ThreadblockShape::kN, ThreadblockShape::kK}, 1);
+
+  typename GemmKernel::Params params(
+    problem_size,
+    grid_tiled_shape,
+    {A.data(), cutlass::layout::ColumnMajor(M)},
+    {B.data(), cutlass::layout::RowMajor(N)},
+    {C.data(), cutlass::layout::RowMajor(N)},
+    {D.data(), cutlass::layout::RowMajor(N)},
+    {alpha, beta});
+
+  for (auto backend : backends()) {
+
+    std::fill(D.begin(), D.end(), 0.0f);
+
+    cutlass::emulation::LaunchOptions options;
+    options.backend = backend;
+
+    cutlass::emulation::launch_kernel<GemmKernel>(
+      swizzle.get_grid_shape(grid_tiled_shape),
+      dim3(GemmKernel::kThreadCount, 1, 1),
+      params,
+      options);
+
+    int errors = 0;
+    for (int m = 0; m < M; ++m) {
+      for (int n = 0; n < N; ++n) {
+        float accum = 0;
+        for (int k = 0; k < K; ++k) {
+          accum += A[size_t(m + k * M)] * B[size_t(k * N + n)];
+        }
+        float expected = alpha * accum + beta * C[size_t(m * N + n)];
+        if (D[size_t(m * N + n)] != expected && ++errors < 8) {
+          ADD_FAILURE() << "D(" << m << ", " << n << ") = " << D[size_t(m * N + n)]
+                        << ", expected " << expected;
+        }
+      }
+    }
+    EXPECT_EQ(errors, 0);
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char *argv[]) {
+  ::testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
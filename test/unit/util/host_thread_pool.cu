@@ -0,0 +1,194 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for the work-stealing host thread pool
+*/
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/coord.h"
+#include "cutlass/util/host_thread_pool.h"
+#include "cutlass/util/reference/host/tensor_foreach.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(HostThreadPool, parallel_for_visits_each_index_once) {
+
+  cutlass::HostThreadPool pool(4);
+  EXPECT_EQ(pool.num_threads(), 4);
+
+  for (int64_t grain : {1, 7, 64, 5000}) {
+    std::vector<std::atomic<int>> visits(3001);
+    for (auto &v : visits) {
+      v = 0;
+    }
+
+    pool.parallel_for(int64_t(visits.size()), [&](int64_t begin, int64_t end) {
+      EXPECT_LE(end - begin, grain);
+      for (int64_t i = begin; i < end; ++i) {
+        visits[i].fetch_add(1);
+      }
+    }, grain);
+
+    for (auto const &v : visits) {
+      EXPECT_EQ(v.load(), 1) << "grain " << grain;
+    }
+  }
+}
+
+TEST(HostThreadPool, weighted_loop_visits_each_item_once) {
+
+  cutlass::HostThreadPool pool(6);
+
+  // All of the cost is at the front, so the initial partition leaves most threads idle
+  std::vector<double> costs(500, 1.0);
+  for (int i = 0; i < 5; ++i) {
+    costs[i] = 1000.0;
+  }
+
+  std::vector<std::atomic<int>> visits(costs.size());
+  for (auto &v : visits) {
+    v = 0;
+  }
+
+  pool.parallel_for_weighted(costs, [&](uint32_t item) {
+    visits[item].fetch_add(1);
+  });
+
+  for (auto const &v : visits) {
+    EXPECT_EQ(v.load(), 1);
+  }
+}
+
+TEST(HostThreadPool, nested_loops_complete) {
+
+  cutlass::HostThreadPool pool(3);
+
+  std::atomic<int64_t> sum{0};
+
+  pool.parallel_for(16, [&](int64_t outer_begin, int64_t outer_end) {
+    for (int64_t outer = outer_begin; outer < outer_end; ++outer) {
+      pool.parallel_for(1000, [&](int64_t begin, int64_t end) {
+        int64_t local = 0;
+        for (int64_t i = begin; i < end; ++i) {
+          local += i;
+        }
+        sum.fetch_add(local);
+      }, 10);
+    }
+  });
+
+  EXPECT_EQ(sum.load(), 16 * (999 * 1000 / 2));
+}
+
+TEST(HostThreadPool, exceptions_are_rethrown) {
+
+  cutlass::HostThreadPool pool(4);
+
+  std::atomic<int> calls{0};
+  EXPECT_THROW(
+    pool.parallel_for(100, [&](int64_t begin, int64_t) {
+      calls.fetch_add(1);
+      if (begin == 42) {
+        throw std::runtime_error("failed");
+      }
+    }),
+    std::runtime_error);
+
+  // The pool remains usable
+  std::atomic<int> count{0};
+  pool.parallel_for(100, [&](int64_t begin, int64_t end) { count.fetch_add(int(end - begin)); });
+  EXPECT_EQ(count.load(), 100);
+}
+
+TEST(HostThreadPool, single_thread_runs_on_caller) {
+
+  std::thread::id caller = std::this_thread::get_id();
+
+  cutlass::HostThreadPool pool(4);
+  int calls = 0;
+  pool.parallel_for(1000, [&](int64_t begin, int64_t end) {
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+    EXPECT_EQ(begin, 0);
+    EXPECT_EQ(end, 1000);
+    ++calls;
+  }, 1, 1);
+  EXPECT_EQ(calls, 1);
+
+  cutlass::HostThreadPool serial(1);
+  serial.parallel_for(1000, [&](int64_t, int64_t) {
+    EXPECT_EQ(std::this_thread::get_id(), caller);
+  });
+}
+
+TEST(HostThreadPool, global_thread_count) {
+
+  int previous = cutlass::host_thread_count();
+
+  cutlass::set_host_thread_count(2);
+  EXPECT_EQ(cutlass::host_thread_count(), 2);
+
+  cutlass::set_host_thread_count(previous);
+  EXPECT_EQ(cutlass::host_thread_count(), previous);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TensorForEachParallel, visits_each_coordinate_once) {
+
+  cutlass::Coord<3> extent = cutlass::make_Coord(7, 13, 31);
+  std::vector<std::atomic<int>> visits(7 * 13 * 31);
+  for (auto &v : visits) {
+    v = 0;
+  }
+
+  cutlass::reference::host::TensorForEachParallel(extent, [&](cutlass::Coord<3> const &coord) {
+    visits[(coord[0] * 13 + coord[1]) * 31 + coord[2]].fetch_add(1);
+  }, 5);
+
+  for (auto const &v : visits) {
+    EXPECT_EQ(v.load(), 1);
+  }
+
+  // Empty extents visit nothing
+  int calls = 0;
+  cutlass::reference::host::TensorForEachParallel(cutlass::make_Coord(4, 0), [&](cutlass::Coord<2> const &) {
+    ++calls;
+  });
+  EXPECT_EQ(calls, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
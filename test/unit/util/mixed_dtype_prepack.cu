@@ -0,0 +1,261 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for mixed input weight pre-packing and the pre-packed weight file
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/mixed_dtype_prepack.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using namespace cute;
+
+// Reordering atoms returned by compute_memory_reordering_atom() for a BF16 MMA with a (1,4)
+// atom layout and (2,4) value shuffle (MN-major), and for an FP8 MMA (K-major)
+using LayoutAtomBF16 = Layout<
+  Shape <Shape <Shape <_8,_2>,_1>, Shape <Shape <_2,_4,_2>,_4>>,
+  Stride<Stride<Stride<_128,_1>,_0>, Stride<Stride<_4,_32,_2>,_8>>>;
+
+using LayoutAtomFP8 = Layout<
+  Shape <Shape <Shape <_8,_2>,_1>, Shape <Shape <_4,_4,_2>,_1>>,
+  Stride<Stride<Stride<_64,_4>,_0>, Stride<Stride<_1,_16,_8>,_0>>>;
+
+template <class T, class LayoutAtom, class Encoding>
+void run_prepack_test(Encoding encoding, int num_threads) {
+
+  auto shape = make_shape(256, 128, 2);
+  auto layout_src = make_layout(shape, make_stride(int64_t(128), _1{}, int64_t(256 * 128)));
+  auto layout_dst = tile_to_shape(LayoutAtom{}, shape);
+
+  size_t bytes = size_t(size(layout_src)) * sizeof_bits_v<T> / 8;
+
+  std::mt19937 rng(2025);
+  std::vector<uint8_t> src(bytes);
+  for (auto &b : src) {
+    b = uint8_t(rng());
+  }
+  std::vector<uint8_t> dst(bytes, 0);
+
+  cutlass::prepack_tensor_host(
+    reinterpret_cast<T const *>(src.data()), layout_src,
+    reinterpret_cast<T *>(dst.data()), layout_dst,
+    encoding, num_threads);
+
+  Tensor S = make_tensor(recast_ptr<T const>(src.data()), layout_src);
+  Tensor D = make_tensor(recast_ptr<T const>(dst.data()), layout_dst);
+
+  for (int l = 0; l < size<2>(shape); ++l) {
+    for (int k = 0; k < size<1>(shape); ++k) {
+      for (int m = 0; m < size<0>(shape); ++m) {
+        T expected = encoding(T(S(m, k, l)));
+        T actual = D(m, k, l);
+        ASSERT_TRUE(actual == expected) << "m=" << m << " k=" << k << " l=" << l;
+      }
+    }
+  }
+}
+
+std::string temp_path(char const *name) {
+  return testing::TempDir() + name;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(MixedDtypePrepack, unified_int4_encoding) {
+
+  for (int value = -8; value < 8; ++value) {
+    cutlass::int4b_t x(value);
+    cutlass::int4b_t y = cutlass::UnifiedInt4Encoding{}(x);
+    if (value >= 1) {
+      // Positive values share the low three bits of their negation
+      EXPECT_EQ(int(y.storage), 8 - value);
+      EXPECT_EQ(y.storage & 0x7, cutlass::int4b_t(-value).storage & 0x7);
+    }
+    else {
+      EXPECT_EQ(y.storage, x.storage) << value;
+    }
+  }
+
+  std::vector<uint8_t> in(1 << 17);
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = uint8_t(i * 37);
+  }
+  std::vector<uint8_t> out(in.size());
+
+  cutlass::unified_encode_int4b_host(
+    reinterpret_cast<cutlass::int4b_t const *>(in.data()),
+    reinterpret_cast<cutlass::int4b_t *>(out.data()), in.size() * 2, 4);
+
+  for (size_t i = 0; i < in.size(); ++i) {
+    uint8_t lo = cutlass::UnifiedInt4Encoding::encode_nibble(in[i] & 0xf);
+    uint8_t hi = cutlass::UnifiedInt4Encoding::encode_nibble(in[i] >> 4);
+    ASSERT_EQ(out[i], uint8_t(lo | (hi << 4))) << i;
+  }
+}
+
+TEST(MixedDtypePrepack, reorder_int4_mn_major) {
+  run_prepack_test<cutlass::int4b_t, LayoutAtomBF16>(cutlass::UnifiedInt4Encoding{}, 8);
+}
+
+TEST(MixedDtypePrepack, reorder_int4_k_major) {
+  run_prepack_test<cutlass::int4b_t, LayoutAtomFP8>(cutlass::UnifiedInt4Encoding{}, 8);
+}
+
+TEST(MixedDtypePrepack, reorder_int8_single_thread) {
+  run_prepack_test<int8_t, LayoutAtomBF16>(cutlass::IdentityEncoding{}, 1);
+}
+
+TEST(MixedDtypePrepack, pack_scale_fp8) {
+
+  std::vector<cutlass::float_e4m3_t> scales(100000);
+  for (size_t i = 0; i < scales.size(); ++i) {
+    scales[i] = cutlass::float_e4m3_t(float(i % 64) / 16.0f - 2.0f);
+  }
+  std::vector<cutlass::Array<cutlass::float_e4m3_t, 8>> packed(scales.size());
+
+  cutlass::pack_scale_fp8_host(scales.data(), packed.data(), scales.size(), 4);
+
+  for (size_t i = 0; i < scales.size(); ++i) {
+    cutlass::packed_scale_t<cutlass::float_e4m3_t> expected(scales[i]);
+    ASSERT_EQ(std::memcmp(&packed[i], &expected, sizeof(expected)), 0) << i;
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(PrepackedWeightFile, create_then_load) {
+
+  std::string path = temp_path("cutlass_prepacked_weights_create.bin");
+  std::remove(path.c_str());
+
+  auto layout_src = make_layout(make_shape(64, 32, 1));
+  auto layout_dst = tile_to_shape(LayoutAtomBF16{}, make_shape(64, 32, 1));
+  std::string key = cutlass::prepack_layout_key<cutlass::int4b_t>(layout_src, layout_dst, "layer0");
+
+  int calls = 0;
+  auto produce = [&](cutlass::PrepackedWeightSections &sections) {
+    ++calls;
+    sections[cutlass::PrepackedWeightFile::kWeights].assign(1024, 0x5a);
+    sections[cutlass::PrepackedWeightFile::kScales].assign(100, 0x11);
+    sections[cutlass::PrepackedWeightFile::kZeros].clear();
+  };
+
+  cutlass::PrepackedWeightFile created;
+  EXPECT_FALSE(created.open_or_create(path, key, produce));
+  EXPECT_FALSE(created.from_cache());
+  EXPECT_EQ(calls, 1);
+  EXPECT_EQ(created.bytes(cutlass::PrepackedWeightFile::kWeights), 1024u);
+  created.close();
+
+  cutlass::PrepackedWeightFile loaded;
+  EXPECT_TRUE(loaded.open_or_create(path, key, produce));
+  EXPECT_TRUE(loaded.from_cache());
+  EXPECT_EQ(calls, 1);
+
+  ASSERT_EQ(loaded.bytes(cutlass::PrepackedWeightFile::kWeights), 1024u);
+  ASSERT_EQ(loaded.bytes(cutlass::PrepackedWeightFile::kScales), 100u);
+  EXPECT_EQ(loaded.bytes(cutlass::PrepackedWeightFile::kZeros), 0u);
+
+  for (int s = 0; s < 2; ++s) {
+    auto section = cutlass::PrepackedWeightFile::Section(s);
+    uint8_t const *data = loaded.data(section);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(data) % cutlass::PrepackedWeightFile::kAlignment, 0u);
+    for (size_t i = 0; i < loaded.bytes(section); ++i) {
+      ASSERT_EQ(data[i], s == 0 ? 0x5a : 0x11);
+    }
+  }
+
+  std::remove(path.c_str());
+}
+
+TEST(PrepackedWeightFile, rebuilds_on_key_mismatch) {
+
+  std::string path = temp_path("cutlass_prepacked_weights_key.bin");
+  std::remove(path.c_str());
+
+  auto layout_src = make_layout(make_shape(64, 32, 1));
+  auto key_a = cutlass::prepack_layout_key<cutlass::int4b_t>(layout_src, tile_to_shape(LayoutAtomBF16{}, make_shape(64, 32, 1)));
+  auto key_b = cutlass::prepack_layout_key<cutlass::int4b_t>(layout_src, tile_to_shape(LayoutAtomFP8{}, make_shape(64, 32, 1)));
+  EXPECT_NE(key_a, key_b);
+
+  auto produce = [](uint8_t value) {
+    return [=](cutlass::PrepackedWeightSections &sections) {
+      sections[cutlass::PrepackedWeightFile::kWeights].assign(16, value);
+    };
+  };
+
+  cutlass::PrepackedWeightFile file;
+  EXPECT_FALSE(file.open_or_create(path, key_a, produce(1)));
+  EXPECT_FALSE(file.open(path, key_b));
+  EXPECT_FALSE(file.open_or_create(path, key_b, produce(2)));
+  EXPECT_EQ(file.data(cutlass::PrepackedWeightFile::kWeights)[0], 2);
+  EXPECT_TRUE(file.open(path, key_b));
+  EXPECT_FALSE(file.open(path, key_a));
+
+  std::remove(path.c_str());
+}
+
+TEST(PrepackedWeightFile, rejects_truncated_file) {
+
+  std::string path = temp_path("cutlass_prepacked_weights_truncated.bin");
+
+  cutlass::PrepackedWeightSections sections;
+  sections[cutlass::PrepackedWeightFile::kWeights].assign(10000, 7);
+  ASSERT_TRUE(cutlass::PrepackedWeightFile::write(path, "key", sections));
+
+  std::vector<char> contents;
+  {
+    std::ifstream in(path, std::ios::binary);
+    contents.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  }
+  {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(contents.data(), std::streamsize(contents.size() / 2));
+  }
+
+  cutlass::PrepackedWeightFile file;
+  EXPECT_FALSE(file.open(path, "key"));
+
+  std::remove(path.c_str());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,199 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Tests for tensor fingerprints computed on the host and on the device
+*/
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/device_memory.h"
+#include "cutlass/util/tensor_fingerprint.h"
+#include "cutlass/util/reference/host/tensor_fingerprint.h"
+#include "cutlass/util/reference/device/tensor_fingerprint.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+std::vector<float> random_block(size_t count, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-4.0f, 4.0f);
+  std::vector<float> block(count);
+  for (auto &x : block) {
+    x = dist(rng);
+  }
+  return block;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TensorFingerprint, quantize) {
+
+  // 1.0 and 1.0 + 2^-10 round to the same 5-bit mantissa; 1.5 does not
+  EXPECT_EQ(cutlass::fingerprint_quantize(1.0, 5, 0), cutlass::fingerprint_quantize(1.0 + 1.0 / 1024, 5, 0));
+  EXPECT_NE(cutlass::fingerprint_quantize(1.0, 5, 0), cutlass::fingerprint_quantize(1.5, 5, 0));
+  EXPECT_NE(cutlass::fingerprint_quantize(1.0, 5, 0), cutlass::fingerprint_quantize(-1.0, 5, 0));
+
+  // Rounding up carries into the exponent
+  EXPECT_EQ(cutlass::fingerprint_quantize(2.0, 4, 0), cutlass::fingerprint_quantize(1.99, 4, 0));
+
+  // Signed zeros and values below the floor are zero; NaNs are alike
+  EXPECT_EQ(cutlass::fingerprint_quantize(0.0, 8, 0), cutlass::fingerprint_quantize(-0.0, 8, 0));
+  EXPECT_EQ(cutlass::fingerprint_quantize(1.0e-3, 8, 1.0 / 256), 0ull);
+  EXPECT_EQ(
+    cutlass::fingerprint_quantize(std::numeric_limits<double>::quiet_NaN(), 8, 0),
+    cutlass::fingerprint_quantize(-std::numeric_limits<double>::quiet_NaN(), 8, 0));
+  EXPECT_NE(
+    cutlass::fingerprint_quantize(std::numeric_limits<double>::infinity(), 8, 0),
+    cutlass::fingerprint_quantize(-std::numeric_limits<double>::infinity(), 8, 0));
+
+  EXPECT_EQ(cutlass::fingerprint_mantissa_bits(0.05), 5);
+  EXPECT_EQ(cutlass::fingerprint_mantissa_bits(0), cutlass::kFingerprintMaxMantissaBits);
+}
+
+TEST(TensorFingerprint, host_digests) {
+
+  auto block = random_block(100003, 1);
+  auto fingerprint = cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 8);
+
+  // Deterministic
+  EXPECT_EQ(fingerprint, cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 8));
+
+  // A one-ulp change alters only the exact digest
+  auto perturbed = block;
+  perturbed[777] = std::nextafter(perturbed[777], 10.0f);
+  auto nearby = cutlass::reference::host::BlockFingerprint(perturbed.data(), perturbed.size(), 8);
+  EXPECT_NE(fingerprint.exact, nearby.exact);
+  EXPECT_EQ(fingerprint.quantized, nearby.quantized);
+
+  // A large change alters both
+  perturbed[777] += 1.0f;
+  auto changed = cutlass::reference::host::BlockFingerprint(perturbed.data(), perturbed.size(), 8);
+  EXPECT_NE(fingerprint.exact, changed.exact);
+  EXPECT_NE(fingerprint.quantized, changed.quantized);
+
+  // Swapping elements changes both digests
+  auto swapped = block;
+  std::swap(swapped[1], swapped[2]);
+  auto reordered = cutlass::reference::host::BlockFingerprint(swapped.data(), swapped.size(), 8);
+  EXPECT_NE(fingerprint.exact, reordered.exact);
+  EXPECT_NE(fingerprint.quantized, reordered.quantized);
+
+  // Truncation changes both digests
+  auto shorter = cutlass::reference::host::BlockFingerprint(block.data(), block.size() - 1, 8);
+  EXPECT_NE(fingerprint.exact, shorter.exact);
+  EXPECT_NE(fingerprint.quantized, shorter.quantized);
+}
+
+TEST(TensorFingerprint, host_digest_independent_of_threads) {
+
+  auto block = random_block(1 << 20, 2);
+
+  int previous = cutlass::host_thread_count();
+
+  cutlass::set_host_thread_count(1);
+  auto serial = cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 10);
+
+  cutlass::set_host_thread_count(4);
+  auto parallel = cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 10);
+
+  cutlass::set_host_thread_count(previous);
+
+  EXPECT_EQ(serial, parallel);
+}
+
+TEST(TensorFingerprint, subbyte_padding_is_ignored) {
+
+  // Five int4b_t elements occupy two and a half bytes; the upper half of the third byte is padding
+  uint8_t storage[3] = {0x21, 0x43, 0x05};
+  uint8_t padded[3] = {0x21, 0x43, 0xf5};
+
+  auto a = cutlass::reference::host::BlockFingerprint(reinterpret_cast<cutlass::int4b_t const *>(storage), 5, 8);
+  auto b = cutlass::reference::host::BlockFingerprint(reinterpret_cast<cutlass::int4b_t const *>(padded), 5, 8);
+  EXPECT_EQ(a, b);
+
+  padded[2] = 0x06;
+  auto c = cutlass::reference::host::BlockFingerprint(reinterpret_cast<cutlass::int4b_t const *>(padded), 5, 8);
+  EXPECT_NE(a.exact, c.exact);
+  EXPECT_NE(a.quantized, c.quantized);
+}
+
+TEST(TensorFingerprint, integers_are_quantized_exactly) {
+
+  std::vector<int32_t> block(1000, 1 << 20);
+  auto fingerprint = cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 1);
+
+  block[10] += 1;
+  auto changed = cutlass::reference::host::BlockFingerprint(block.data(), block.size(), 1);
+  EXPECT_NE(fingerprint.quantized, changed.quantized);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TensorFingerprint, device_matches_host) {
+
+  for (size_t count : {size_t(1), size_t(7), size_t(100003)}) {
+
+    auto values = random_block(count, 3);
+    std::vector<cutlass::half_t> block(count);
+    for (size_t i = 0; i < count; ++i) {
+      block[i] = cutlass::half_t(values[i]);
+    }
+
+    cutlass::DeviceAllocation<cutlass::half_t> device_block(count);
+    device_block.copy_from_host(block.data());
+
+    auto host = cutlass::reference::host::BlockFingerprint(block.data(), count, 6, 1.0 / 256);
+    auto device = cutlass::reference::device::BlockFingerprint(device_block.get(), count, 6, 1.0 / 256);
+
+    EXPECT_EQ(host, device) << "count " << count;
+  }
+
+  // Thirteen int4b_t elements with nonzero padding in the last byte
+  uint8_t packed[7] = {0x9a, 0xbc, 0xde, 0xf0, 0x12, 0x34, 0xf5};
+
+  cutlass::DeviceAllocation<cutlass::int4b_t> device_packed(14);
+  device_packed.copy_from_host(reinterpret_cast<cutlass::int4b_t const *>(packed));
+
+  EXPECT_EQ(
+    cutlass::reference::host::BlockFingerprint(reinterpret_cast<cutlass::int4b_t const *>(packed), 13, 8),
+    cutlass::reference::device::BlockFingerprint(device_packed.get(), 13, 8));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
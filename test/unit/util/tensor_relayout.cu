@@ -0,0 +1,169 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for conversions between tensor layouts
+*/
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/core_io.h"
+#include "cutlass/util/host_tensor.h"
+#include "cutlass/util/reference/host/tensor_foreach.h"
+#include "cutlass/util/reference/host/tensor_relayout.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Fills a tensor with a value unique to each coordinate (modulo the range of the element)
+template <typename Element, typename Layout>
+void fill_sequential(cutlass::HostTensor<Element, Layout> &tensor) {
+  auto extent = tensor.extent();
+  int64_t count = 0;
+  cutlass::reference::host::TensorForEachLambda(extent, [&](typename Layout::TensorCoord const &coord) {
+    tensor.at(coord) = Element(int(count++ % 97) - 48);
+  });
+}
+
+/// Checks that `dst` equals `src` where both are defined and `pad` elsewhere
+template <typename DstElement, typename DstLayout, typename SrcElement, typename SrcLayout>
+void verify(
+  cutlass::HostTensor<DstElement, DstLayout> &dst,
+  cutlass::HostTensor<SrcElement, SrcLayout> &src,
+  DstElement pad) {
+
+  int errors = 0;
+  auto src_extent = src.extent();
+  cutlass::reference::host::TensorForEachLambda(dst.extent(), [&](typename DstLayout::TensorCoord const &coord) {
+    bool inside = true;
+    for (int i = 0; i < DstLayout::kRank; ++i) {
+      inside = inside && coord[i] < src_extent[i];
+    }
+    DstElement expected = inside ? DstElement(src.at(typename SrcLayout::TensorCoord(coord))) : pad;
+    if (!(DstElement(dst.at(coord)) == expected) && errors++ < 10) {
+      ADD_FAILURE() << "mismatch at " << coord;
+    }
+  });
+  EXPECT_EQ(errors, 0);
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TensorRelayout, nchw_to_nhwc) {
+
+  for (cutlass::Tensor4DCoord extent : {cutlass::Tensor4DCoord(1, 1, 1, 1),
+                                        cutlass::Tensor4DCoord(2, 7, 5, 3),
+                                        cutlass::Tensor4DCoord(3, 33, 17, 70),
+                                        cutlass::Tensor4DCoord(4, 64, 64, 64)}) {
+
+    cutlass::HostTensor<float, cutlass::layout::TensorNCHW> src(extent, false);
+    cutlass::HostTensor<float, cutlass::layout::TensorNHWC> dst(extent, false);
+    fill_sequential(src);
+
+    cutlass::reference::host::TensorRelayout(dst.host_view(), src.host_view());
+    verify(dst, src, 0.0f);
+
+    // And back again
+    cutlass::HostTensor<float, cutlass::layout::TensorNCHW> round_trip(extent, false);
+    cutlass::reference::host::TensorRelayout(round_trip.host_view(), dst.host_view());
+    verify(round_trip, src, 0.0f);
+  }
+}
+
+TEST(TensorRelayout, nhwc_to_interleaved_padded) {
+
+  cutlass::Tensor4DCoord src_extent(2, 9, 11, 45);
+  cutlass::Tensor4DCoord dst_extent(2, 9, 11, 64);
+
+  cutlass::HostTensor<int8_t, cutlass::layout::TensorNHWC> src(src_extent, false);
+  cutlass::HostTensor<int8_t, cutlass::layout::TensorNCxHWx<32>> dst(dst_extent, false);
+  fill_sequential(src);
+
+  cutlass::reference::host::TensorRelayout(dst.host_view(), src.host_view(), int8_t(0));
+  verify(dst, src, int8_t(0));
+
+  // Filter layout used by interleaved convolutions
+  cutlass::HostTensor<int8_t, cutlass::layout::TensorCxRSKx<32>> filter(dst_extent, false);
+  cutlass::reference::host::TensorRelayout(filter.host_view(), src.host_view(), int8_t(0));
+  verify(filter, src, int8_t(0));
+}
+
+TEST(TensorRelayout, converting_padded_channels) {
+
+  cutlass::Tensor4DCoord src_extent(3, 20, 20, 6);
+  cutlass::Tensor4DCoord dst_extent(3, 20, 20, 8);
+
+  cutlass::HostTensor<float, cutlass::layout::TensorNHWC> src(src_extent, false);
+  cutlass::HostTensor<cutlass::half_t, cutlass::layout::TensorNHWC> dst(dst_extent, false);
+  fill_sequential(src);
+
+  cutlass::reference::host::TensorRelayout(dst.host_view(), src.host_view(), cutlass::half_t(-1));
+  verify(dst, src, cutlass::half_t(-1));
+}
+
+TEST(TensorRelayout, matrix_interleaved) {
+
+  cutlass::MatrixCoord extent(100, 96);
+
+  cutlass::HostTensor<int32_t, cutlass::layout::RowMajor> src(extent, false);
+  cutlass::HostTensor<int32_t, cutlass::layout::ColumnMajorInterleaved<32>> dst(extent, false);
+  cutlass::HostTensor<int32_t, cutlass::layout::ColumnMajor> transposed(extent, false);
+  fill_sequential(src);
+
+  cutlass::reference::host::TensorRelayout(dst.host_view(), src.host_view());
+  verify(dst, src, 0);
+
+  cutlass::reference::host::TensorRelayout(transposed.host_view(), src.host_view());
+  verify(transposed, src, 0);
+}
+
+TEST(TensorRelayout, subbyte_destination) {
+
+  cutlass::MatrixCoord extent(37, 50);
+
+  cutlass::HostTensor<int8_t, cutlass::layout::RowMajor> src(extent, false);
+  cutlass::HostTensor<cutlass::int4b_t, cutlass::layout::ColumnMajor> dst({40, 50}, false);
+
+  cutlass::reference::host::TensorForEachLambda(extent, [&](cutlass::MatrixCoord const &coord) {
+    src.at(coord) = int8_t((coord.row() + coord.column()) % 16 - 8);
+  });
+
+  cutlass::reference::host::TensorRelayout(
+    dst.host_view(), src.host_view(),
+    [](int8_t x) { return cutlass::int4b_t(x); },
+    cutlass::int4b_t(0));
+
+  verify(dst, src, cutlass::int4b_t(0));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
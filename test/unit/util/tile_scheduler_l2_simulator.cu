@@ -0,0 +1,224 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for the tile scheduler L2 simulator
+*/
+
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/tile_scheduler_l2_simulator.hpp"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+using RasterOrderOptions = cutlass::gemm::kernel::detail::RasterOrderOptions;
+
+cutlass::KernelHardwareInfo make_hw_info(int sm_count) {
+  cutlass::KernelHardwareInfo hw_info;
+  hw_info.sm_count = sm_count;
+  return hw_info;
+}
+
+/// Counts how many times each (m, n, l, k) mainloop iteration is computed
+std::vector<int> k_tile_coverage(
+  cutlass::TileSchedulerL2Simulator const &sim,
+  cutlass::L2SimulationCandidate const &candidate) {
+
+  auto const &problem = sim.problem();
+  int tiles_m = (problem.problem_size.m() + problem.tile_shape.m() - 1) / problem.tile_shape.m();
+  int tiles_n = (problem.problem_size.n() + problem.tile_shape.n() - 1) / problem.tile_shape.n();
+  int tiles_k = sim.k_tiles_per_output_tile();
+
+  std::vector<int> coverage(size_t(tiles_m) * tiles_n * problem.problem_size.batch() * tiles_k, 0);
+  for (auto const &segments : sim.tile_visitation_order(candidate)) {
+    for (auto const &s : segments) {
+      if (s.m >= tiles_m || s.n >= tiles_n) {
+        continue; // padding introduced by swizzle / cluster rounding
+      }
+      for (int k = s.k_begin; k < s.k_begin + s.k_count; ++k) {
+        ++coverage[((size_t(s.l) * tiles_m + s.m) * tiles_n + s.n) * tiles_k + k];
+      }
+    }
+  }
+  return coverage;
+}
+
+} // namespace
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(L2CacheModel, reuse_within_capacity) {
+  cutlass::L2CacheConfig config;
+  config.capacity_bytes = 64 * 1024;
+  config.line_bytes = 128;
+  config.ways = 4;
+
+  cutlass::L2CacheModel l2(config);
+
+  l2.access_range(0, 32 * 1024);
+  l2.access_range(0, 32 * 1024);
+
+  EXPECT_EQ(l2.statistics().misses, 256u);
+  EXPECT_EQ(l2.statistics().hits, 256u);
+  EXPECT_EQ(l2.statistics().dram_read_bytes, 32u * 1024u);
+}
+
+TEST(L2CacheModel, lru_streaming_thrashes) {
+  cutlass::L2CacheConfig config;
+  config.capacity_bytes = 64 * 1024;
+  config.line_bytes = 128;
+  config.ways = 4;
+
+  cutlass::L2CacheModel l2(config);
+
+  // A cyclic sweep over twice the capacity never hits under LRU
+  l2.access_range(0, 128 * 1024);
+  l2.access_range(0, 128 * 1024);
+
+  EXPECT_EQ(l2.statistics().hits, 0u);
+  EXPECT_EQ(l2.statistics().dram_read_bytes, 256u * 1024u);
+}
+
+TEST(L2CacheModel, write_back_on_flush) {
+  cutlass::L2CacheConfig config;
+  config.capacity_bytes = 64 * 1024;
+  config.line_bytes = 128;
+  config.ways = 4;
+
+  cutlass::L2CacheModel l2(config);
+  l2.access_range(0, 4096, true);
+
+  EXPECT_EQ(l2.statistics().dram_read_bytes, 0u);
+  EXPECT_EQ(l2.statistics().dram_write_bytes, 0u);
+
+  l2.flush();
+  EXPECT_EQ(l2.statistics().dram_write_bytes, 4096u);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TileSchedulerL2Simulator, persistent_covers_every_tile_once) {
+
+  for (int cluster_m : {1, 2}) {
+    for (int cluster_n : {1, 2}) {
+      cutlass::L2SimulationProblem problem;
+      problem.problem_size = {1000, 1500, 256, 2};
+      problem.tile_shape = {128, 128, 64};
+      problem.cluster_shape = {cluster_m, cluster_n, 1};
+
+      cutlass::TileSchedulerL2Simulator sim(problem, make_hw_info(132));
+
+      for (auto const &candidate : cutlass::TileSchedulerL2Simulator::default_candidates()) {
+        auto coverage = k_tile_coverage(sim, candidate);
+        for (int count : coverage) {
+          ASSERT_EQ(count, 1) << "cluster " << cluster_m << "x" << cluster_n
+                              << " swizzle " << candidate.max_swizzle_size;
+        }
+      }
+    }
+  }
+}
+
+TEST(TileSchedulerL2Simulator, stream_k_covers_every_k_tile_once) {
+
+  cutlass::L2SimulationProblem problem;
+  problem.problem_size = {1024, 1024, 4096, 1};
+  problem.tile_shape = {128, 128, 64};
+  problem.cluster_shape = {1, 2, 1};
+
+  cutlass::TileSchedulerL2Simulator::StreamKOptions stream_k;
+  stream_k.decomposition_mode = cutlass::gemm::kernel::detail::DecompositionMode::StreamK;
+
+  cutlass::TileSchedulerL2Simulator sim(
+    problem, make_hw_info(132), cutlass::L2CacheConfig(), cutlass::L2SimulationScheduler::StreamK, stream_k);
+
+  for (auto const &candidate : cutlass::TileSchedulerL2Simulator::default_candidates()) {
+    auto coverage = k_tile_coverage(sim, candidate);
+    for (int count : coverage) {
+      ASSERT_EQ(count, 1) << "swizzle " << candidate.max_swizzle_size;
+    }
+  }
+}
+
+TEST(TileSchedulerL2Simulator, compulsory_traffic_with_large_cache) {
+
+  cutlass::L2SimulationProblem problem;
+  problem.problem_size = {512, 512, 512, 1};
+  problem.tile_shape = {128, 128, 64};
+  problem.element_bytes_a = 2;
+  problem.element_bytes_b = 2;
+  problem.element_bytes_d = 2;
+
+  cutlass::L2CacheConfig l2;
+  l2.capacity_bytes = int64_t(64) << 20;
+
+  cutlass::TileSchedulerL2Simulator sim(problem, make_hw_info(132), l2);
+
+  uint64_t compulsory_reads = 2u * 512u * 512u * 2u;
+  uint64_t compulsory_writes = 512u * 512u * 2u;
+
+  for (auto const &result : sim.simulate_all()) {
+    EXPECT_EQ(result.l2.dram_read_bytes, compulsory_reads);
+    EXPECT_EQ(result.l2.dram_write_bytes, compulsory_writes);
+  }
+}
+
+TEST(TileSchedulerL2Simulator, select_minimizes_dram_traffic) {
+
+  // Skinny problem whose operands do not fit in the modeled cache
+  cutlass::L2SimulationProblem problem;
+  problem.problem_size = {8192, 1024, 1024, 1};
+  problem.tile_shape = {128, 128, 64};
+
+  cutlass::L2CacheConfig l2;
+  l2.capacity_bytes = int64_t(2) << 20;
+
+  cutlass::TileSchedulerL2Simulator sim(problem, make_hw_info(132), l2);
+
+  auto results = sim.simulate_all();
+  auto best = sim.select_raster_order_and_swizzle();
+
+  uint64_t best_bytes = ~uint64_t(0);
+  uint64_t selected_bytes = 0;
+  for (auto const &result : results) {
+    best_bytes = std::min(best_bytes, result.dram_bytes());
+    if (result.candidate.raster_order_option == best.raster_order_option &&
+        result.candidate.max_swizzle_size == best.max_swizzle_size) {
+      selected_bytes = result.dram_bytes();
+    }
+  }
+  EXPECT_EQ(selected_bytes, best_bytes);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
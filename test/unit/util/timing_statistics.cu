@@ -0,0 +1,208 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host tests for timing statistics using synthetic sample streams
+*/
+
+#include <random>
+#include <vector>
+
+#include "../common/cutlass_unit_test.h"
+
+#include "cutlass/util/timing_statistics.h"
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TimingStatistics, percentiles) {
+
+  std::vector<double> samples;
+  for (int i = 100; i >= 0; --i) {
+    samples.push_back(double(i));
+  }
+
+  cutlass::TimingStatisticsOptions options;
+  options.outlier_threshold = 0;
+
+  auto stats = cutlass::TimingStatistics::compute(samples, options);
+
+  EXPECT_EQ(stats.samples, 101);
+  EXPECT_EQ(stats.outliers, 0);
+  EXPECT_DOUBLE_EQ(stats.median, 50.0);
+  EXPECT_DOUBLE_EQ(stats.p90, 90.0);
+  EXPECT_DOUBLE_EQ(stats.p99, 99.0);
+  EXPECT_DOUBLE_EQ(stats.mean, 50.0);
+  EXPECT_DOUBLE_EQ(stats.min, 0.0);
+  EXPECT_DOUBLE_EQ(stats.max, 100.0);
+  EXPECT_NEAR(stats.stddev, 29.3002, 1e-4);
+}
+
+TEST(TimingStatistics, interpolated_median) {
+  auto stats = cutlass::TimingStatistics::compute({4.0, 1.0, 3.0, 2.0});
+  EXPECT_DOUBLE_EQ(stats.median, 2.5);
+}
+
+TEST(TimingStatistics, empty) {
+  auto stats = cutlass::TimingStatistics::compute({});
+  EXPECT_EQ(stats.samples, 0);
+  EXPECT_EQ(stats.mean, 0.0);
+}
+
+TEST(TimingStatistics, rejects_outliers) {
+
+  std::mt19937 rng(2025);
+  std::normal_distribution<double> noise(1.0, 0.01);
+
+  std::vector<double> samples;
+  for (int i = 0; i < 200; ++i) {
+    samples.push_back(noise(rng));
+  }
+
+  // Preemption by another process on a shared node
+  samples[17] = 5.0;
+  samples[93] = 3.5;
+  samples[150] = 8.0;
+
+  auto stats = cutlass::TimingStatistics::compute(samples);
+
+  EXPECT_EQ(stats.outliers, 3);
+  EXPECT_LT(stats.max, 1.1);
+  EXPECT_NEAR(stats.mean, 1.0, 0.005);
+  EXPECT_LT(stats.stddev, 0.02);
+
+  cutlass::TimingStatisticsOptions no_rejection;
+  no_rejection.outlier_threshold = 0;
+  auto raw = cutlass::TimingStatistics::compute(samples, no_rejection);
+
+  EXPECT_EQ(raw.outliers, 0);
+  EXPECT_GT(raw.mean, 1.05);
+}
+
+TEST(TimingStatistics, quantized_samples_are_kept) {
+  std::vector<double> samples(50, 2.0);
+  samples.push_back(2.5);
+  auto stats = cutlass::TimingStatistics::compute(samples);
+  EXPECT_EQ(stats.outliers, 0);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(TimingSampler, stops_on_stable_stream) {
+
+  std::mt19937 rng(7);
+  std::normal_distribution<double> noise(1.0, 0.02);
+
+  cutlass::TimingStatisticsOptions options;
+  options.relative_precision = 0.005;
+  options.min_samples = 10;
+
+  cutlass::TimingSampler sampler(options);
+
+  int iterations = 0;
+  while (!sampler.converged() && iterations < 100000) {
+    sampler.add_sample(noise(rng));
+    ++iterations;
+  }
+
+  // 1.96 * 0.02 / sqrt(n) <= 0.005  =>  n ~ 62
+  EXPECT_GT(iterations, 30);
+  EXPECT_LT(iterations, 150);
+  EXPECT_LE(sampler.statistics().relative_half_width(), 0.005);
+}
+
+TEST(TimingSampler, noisier_stream_needs_more_samples) {
+
+  auto samples_to_converge = [](double stddev) {
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(1.0, stddev);
+    cutlass::TimingSampler sampler;
+    while (!sampler.converged()) {
+      sampler.add_sample(noise(rng));
+    }
+    return sampler.count();
+  };
+
+  EXPECT_LT(samples_to_converge(0.01), samples_to_converge(0.05));
+}
+
+TEST(TimingSampler, outliers_do_not_prevent_stopping) {
+
+  std::mt19937 rng(3);
+  std::normal_distribution<double> noise(1.0, 0.01);
+
+  cutlass::TimingStatisticsOptions options;
+  options.max_samples = 10000;
+
+  cutlass::TimingSampler sampler(options);
+
+  for (int i = 0; i < 10000 && !sampler.converged(); ++i) {
+    // Every 20th sample is delayed by a large spike
+    sampler.add_sample(i % 20 == 19 ? 50.0 : noise(rng));
+  }
+
+  EXPECT_LT(sampler.count(), 1000);
+  EXPECT_NEAR(sampler.statistics().median, 1.0, 0.01);
+}
+
+TEST(TimingSampler, respects_min_and_max_samples) {
+
+  cutlass::TimingStatisticsOptions options;
+  options.min_samples = 25;
+  options.max_samples = 40;
+
+  cutlass::TimingSampler constant(options);
+  while (!constant.converged()) {
+    constant.add_sample(1.0);
+  }
+  EXPECT_EQ(constant.count(), 25);
+
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<double> wide(0.0, 100.0);
+
+  cutlass::TimingSampler noisy(options);
+  while (!noisy.converged()) {
+    noisy.add_sample(wide(rng));
+  }
+  EXPECT_EQ(noisy.count(), 40);
+}
+
+TEST(TimingSampler, adaptive_stopping_disabled) {
+
+  cutlass::TimingStatisticsOptions options;
+  options.relative_precision = 0;
+
+  cutlass::TimingSampler sampler(options);
+  for (int i = 0; i < 1000; ++i) {
+    sampler.add_sample(1.0);
+    ASSERT_FALSE(sampler.converged());
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
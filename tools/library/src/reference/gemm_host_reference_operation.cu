@@ -0,0 +1,340 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+  \brief Runtime-dispatched host reference for GEMM
+*/
+
+#include <cstring>
+#include <sstream>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/library/library.h"
+#include "cutlass/library/util.h"
+
+#include "cutlass/util/reference/host/gemm_complex.h"
+
+#include "gemm_host_reference_operation.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Position of a matrix in memory
+struct MatrixView {
+  void *ptr;
+  LayoutTypeID layout;
+  int64_t ld;
+  int64_t batch_offset;
+  int rows;
+  int columns;
+
+  int64_t offset(int row, int column) const {
+    return batch_offset + (layout == LayoutTypeID::kRowMajor ?
+      int64_t(row) * ld + column :
+      int64_t(column) * ld + row);
+  }
+};
+
+cutlass::ComplexTransform to_complex_transform(ComplexTransform transform) {
+  return transform == ComplexTransform::kConjugate ?
+    cutlass::ComplexTransform::kConjugate : cutlass::ComplexTransform::kNone;
+}
+
+/// Converts a matrix into a dense column-major buffer of the compute type
+template <typename Element, typename Target>
+bool load_matrix_typed(MatrixView const &view, Target *dst) {
+
+  if constexpr (detail::GemmHostReferenceConvertible<Target, Element>::value) {
+    Element *base = static_cast<Element *>(view.ptr);
+    for (int column = 0; column < view.columns; ++column) {
+      for (int row = 0; row < view.rows; ++row) {
+        Element element = ReferenceFactory<Element>::get(base, view.offset(row, column));
+        dst[row + int64_t(column) * view.rows] = Target(element);
+      }
+    }
+    return true;
+  }
+  else {
+    return false;
+  }
+}
+
+/// Converts a dense column-major buffer into the elements of a matrix
+template <typename Element, typename Source>
+bool store_matrix_typed(MatrixView const &view, Source const *src, bool clamp) {
+
+  if constexpr (is_complex<Element>::value == is_complex<Source>::value) {
+    Element *base = static_cast<Element *>(view.ptr);
+    for (int column = 0; column < view.columns; ++column) {
+      for (int row = 0; row < view.rows; ++row) {
+        Source value = src[row + int64_t(column) * view.rows];
+        if (clamp) {
+          if constexpr (detail::gemm_host_reference_clamp(NumericTypeMap<Element>::kId)) {
+            ReferenceFactory<Element>::get(base, view.offset(row, column)) =
+              NumericConverterClamp<Element, Source>()(value);
+          }
+          else {
+            return false;
+          }
+        }
+        else {
+          ReferenceFactory<Element>::get(base, view.offset(row, column)) =
+            NumericConverter<Element, Source>()(value);
+        }
+      }
+    }
+    return true;
+  }
+  else {
+    return false;
+  }
+}
+
+/// Calls op(Element()) with the element type identified by `element`
+template <typename Op>
+bool dispatch_element(NumericTypeID element, Op &&op) {
+  switch (element) {
+    case NumericTypeID::kS4: return op(int4b_t());
+    case NumericTypeID::kU4: return op(uint4b_t());
+    case NumericTypeID::kS8: return op(int8_t());
+    case NumericTypeID::kU8: return op(uint8_t());
+    case NumericTypeID::kS32: return op(int32_t());
+    case NumericTypeID::kFE4M3: return op(float_e4m3_t());
+    case NumericTypeID::kFE5M2: return op(float_e5m2_t());
+    case NumericTypeID::kFE2M3: return op(float_e2m3_t());
+    case NumericTypeID::kFE3M2: return op(float_e3m2_t());
+    case NumericTypeID::kFE2M1: return op(float_e2m1_t());
+    case NumericTypeID::kF16: return op(half_t());
+    case NumericTypeID::kBF16: return op(bfloat16_t());
+    case NumericTypeID::kTF32: return op(tfloat32_t());
+    case NumericTypeID::kF32: return op(float());
+    case NumericTypeID::kF64: return op(double());
+    case NumericTypeID::kCF32: return op(complex<float>());
+    case NumericTypeID::kCF64: return op(complex<double>());
+    default: return false;
+  }
+}
+
+template <typename Target>
+bool load_matrix(NumericTypeID element, MatrixView const &view, Target *dst) {
+  return dispatch_element(element, [&](auto e) {
+    return load_matrix_typed<decltype(e), Target>(view, dst);
+  });
+}
+
+template <typename Source>
+bool store_matrix(NumericTypeID element, MatrixView const &view, Source const *src, bool clamp) {
+  return dispatch_element(element, [&](auto e) {
+    return store_matrix_typed<decltype(e), Source>(view, src, clamp);
+  });
+}
+
+/// Computes D = alpha * A B + beta * C for every batch with a single GEMM instance per pair of
+/// compute and accumulator types
+template <typename ElementCompute, typename ElementAccumulator>
+Status run_gemm(
+  GemmDescription const &desc,
+  GemmUniversalConfiguration const &config,
+  GemmUniversalArguments const &args,
+  bool clamp_output) {
+
+  using Layout = layout::ColumnMajor;
+
+  int const M = config.problem_size.m();
+  int const N = config.problem_size.n();
+  int const K = config.problem_size.k();
+  int const batch_count = (config.mode == GemmUniversalMode::kBatched ? config.batch_count : 1);
+
+  std::vector<ElementAccumulator> A(size_t(M) * K);
+  std::vector<ElementAccumulator> B(size_t(K) * N);
+  std::vector<ElementCompute> C(size_t(M) * N);
+  std::vector<ElementCompute> D(size_t(M) * N);
+
+  ElementCompute alpha = *static_cast<ElementCompute const *>(args.alpha);
+  ElementCompute beta = *static_cast<ElementCompute const *>(args.beta);
+
+  for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
+
+    MatrixView view_A{const_cast<void *>(args.A), desc.A.layout, config.lda, batch_idx * args.batch_stride_A, M, K};
+    MatrixView view_B{const_cast<void *>(args.B), desc.B.layout, config.ldb, batch_idx * args.batch_stride_B, K, N};
+    MatrixView view_C{const_cast<void *>(args.C), desc.C.layout, config.ldc, batch_idx * args.batch_stride_C, M, N};
+    MatrixView view_D{args.D, desc.D.layout, config.ldd, batch_idx * args.batch_stride_D, M, N};
+
+    if (!load_matrix(desc.A.element, view_A, A.data()) ||
+        !load_matrix(desc.B.element, view_B, B.data()) ||
+        !load_matrix(desc.C.element, view_C, C.data())) {
+      return Status::kErrorNotSupported;
+    }
+
+    // Operands are already converted, so the product and epilogue match those of the
+    // typed reference; conversion to ElementD is applied when storing.
+    reference::host::GemmComplex<
+      ElementAccumulator, Layout,
+      ElementAccumulator, Layout,
+      ElementCompute, Layout,
+      ElementCompute,
+      ElementAccumulator,
+      ElementCompute,
+      NumericConverter<ElementCompute, ElementCompute>,
+      multiply_add<ElementAccumulator>
+    >(
+      config.problem_size,
+      alpha,
+      {A.data(), Layout(M)},
+      to_complex_transform(desc.transform_A),
+      {B.data(), Layout(K)},
+      to_complex_transform(desc.transform_B),
+      beta,
+      {C.data(), Layout(M)},
+      {D.data(), Layout(M)},
+      ElementAccumulator());
+
+    if (!store_matrix(desc.D.element, view_D, D.data(), clamp_output)) {
+      return Status::kErrorNotSupported;
+    }
+  }
+
+  return Status::kSuccess;
+}
+
+} // namespace
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::string gemm_reference_operation_name(GemmDescription const &description) {
+
+  std::stringstream ss;
+
+  ss << "gemm"
+    << "_reference_" << to_string(description.provider)
+    << "_" << to_string(description.A.element) << to_string(description.A.layout)
+    << "_" << to_string(description.B.element) << to_string(description.B.layout)
+    << "_" << to_string(description.C.element) << to_string(description.C.layout)
+    << "_" << to_string(description.tile_description.math_instruction.element_accumulator);
+
+  return ss.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+GemmHostReferenceOperation::GemmHostReferenceOperation(
+  GemmDescription const &description,
+  bool clamp_output):
+  description_(description), clamp_output_(clamp_output) {
+
+  name_ = gemm_reference_operation_name(description_);
+  description_.name = name_.c_str();
+}
+
+OperationDescription const & GemmHostReferenceOperation::description() const {
+  return description_;
+}
+
+Status GemmHostReferenceOperation::can_implement(
+  void const *configuration,
+  void const *arguments) const {
+
+  return Status::kSuccess;
+}
+
+uint64_t GemmHostReferenceOperation::get_host_workspace_size(
+  void const *configuration) const {
+
+  return sizeof(GemmUniversalConfiguration);
+}
+
+uint64_t GemmHostReferenceOperation::get_device_workspace_size(
+  void const *configuration,
+  void const *arguments) const {
+
+  return 0;
+}
+
+Status GemmHostReferenceOperation::initialize(
+  void const *configuration,
+  void *host_workspace,
+  void *device_workspace,
+  cudaStream_t stream) const {
+
+  std::memcpy(host_workspace, configuration, get_host_workspace_size(configuration));
+
+  return Status::kSuccess;
+}
+
+Status GemmHostReferenceOperation::run(
+  void const *arguments,
+  void *host_workspace,
+  void *device_workspace,
+  cudaStream_t stream) const {
+
+  GemmUniversalConfiguration const &config = *static_cast<GemmUniversalConfiguration const *>(host_workspace);
+  GemmUniversalArguments const &args = *static_cast<GemmUniversalArguments const *>(arguments);
+
+  NumericTypeID compute = description_.element_epilogue;
+  NumericTypeID accumulator = description_.tile_description.math_instruction.element_accumulator;
+
+  if (compute == NumericTypeID::kF32 && accumulator == NumericTypeID::kF32) {
+    return run_gemm<float, float>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kF32 && accumulator == NumericTypeID::kS32) {
+    return run_gemm<float, int32_t>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kS32 && accumulator == NumericTypeID::kS32) {
+    return run_gemm<int32_t, int32_t>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kF16 && accumulator == NumericTypeID::kF16) {
+    return run_gemm<half_t, half_t>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kF64 && accumulator == NumericTypeID::kF64) {
+    return run_gemm<double, double>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kCF32 && accumulator == NumericTypeID::kCF32) {
+    return run_gemm<complex<float>, complex<float>>(description_, config, args, clamp_output_);
+  }
+  if (compute == NumericTypeID::kCF64 && accumulator == NumericTypeID::kCF64) {
+    return run_gemm<complex<double>, complex<double>>(description_, config, args, clamp_output_);
+  }
+
+  return Status::kErrorNotSupported;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,214 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+  \brief Host reference operation for GEMM with operand types selected at runtime
+
+  GemmReferenceOperation instantiates a host GEMM for every combination of element types, layouts,
+  complex transforms and epilogue types in the reference registry. GemmHostReferenceOperation
+  instead reads these from its GemmDescription: operands are converted into dense buffers of the
+  accumulator type through a switch on NumericTypeID, a single GEMM instance per pair of
+  epilogue and accumulator types computes the product, and D is converted back to its element
+  type. The arithmetic is identical to GemmReferenceOperation with Provider::kReferenceHost.
+*/
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+
+#include "cutlass/library/library.h"
+#include "library_internal.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass {
+namespace library {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Element types that GemmHostReferenceOperation can load and store
+constexpr bool gemm_host_reference_element(NumericTypeID element) {
+  switch (element) {
+    case NumericTypeID::kS4:
+    case NumericTypeID::kU4:
+    case NumericTypeID::kS8:
+    case NumericTypeID::kU8:
+    case NumericTypeID::kS32:
+    case NumericTypeID::kFE4M3:
+    case NumericTypeID::kFE5M2:
+    case NumericTypeID::kFE2M3:
+    case NumericTypeID::kFE3M2:
+    case NumericTypeID::kFE2M1:
+    case NumericTypeID::kF16:
+    case NumericTypeID::kBF16:
+    case NumericTypeID::kTF32:
+    case NumericTypeID::kF32:
+    case NumericTypeID::kF64:
+    case NumericTypeID::kCF32:
+    case NumericTypeID::kCF64:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Pairs of epilogue compute and accumulator types with a GEMM instance
+constexpr bool gemm_host_reference_compute(NumericTypeID compute, NumericTypeID accumulator) {
+  return
+    (compute == NumericTypeID::kF32 && accumulator == NumericTypeID::kF32) ||
+    (compute == NumericTypeID::kF32 && accumulator == NumericTypeID::kS32) ||
+    (compute == NumericTypeID::kS32 && accumulator == NumericTypeID::kS32) ||
+    (compute == NumericTypeID::kF16 && accumulator == NumericTypeID::kF16) ||
+    (compute == NumericTypeID::kF64 && accumulator == NumericTypeID::kF64) ||
+    (compute == NumericTypeID::kCF32 && accumulator == NumericTypeID::kCF32) ||
+    (compute == NumericTypeID::kCF64 && accumulator == NumericTypeID::kCF64);
+}
+
+/// Output element types that support a clamping conversion
+constexpr bool gemm_host_reference_clamp(NumericTypeID element) {
+  switch (element) {
+    case NumericTypeID::kS4:
+    case NumericTypeID::kU4:
+    case NumericTypeID::kS8:
+    case NumericTypeID::kU8:
+    case NumericTypeID::kS32:
+    case NumericTypeID::kF16:
+      return true;
+    default:
+      return false;
+  }
+}
+
+/// Element conversions performed by the host reference: real to real and complex to complex
+template <typename Target, typename Element>
+struct GemmHostReferenceConvertible {
+  static bool const value =
+    is_complex<Target>::value == is_complex<Element>::value &&
+    std::is_constructible<Target, Element>::value;
+};
+
+} // namespace detail
+
+/// Indicates whether the host reference for a GEMM instance can be provided by
+/// GemmHostReferenceOperation
+template <
+  typename ElementA,
+  typename ElementB,
+  typename ElementC,
+  typename ElementCompute,
+  typename ElementAccumulator,
+  typename ElementD,
+  typename ConvertOp,
+  typename InnerProductOp
+>
+struct GemmHostReferenceSupport {
+
+  /// Output conversion saturates to the range of ElementD
+  static bool const kClamp = std::is_same<ConvertOp, NumericConverterClamp<ElementD, ElementCompute>>::value;
+
+  static bool const kValue =
+    std::is_same<InnerProductOp, multiply_add<ElementAccumulator>>::value &&
+    (std::is_same<ConvertOp, NumericConverter<ElementD, ElementCompute>>::value ||
+      (kClamp && detail::gemm_host_reference_clamp(NumericTypeMap<ElementD>::kId))) &&
+    detail::gemm_host_reference_compute(NumericTypeMap<ElementCompute>::kId, NumericTypeMap<ElementAccumulator>::kId) &&
+    detail::gemm_host_reference_element(NumericTypeMap<ElementA>::kId) &&
+    detail::gemm_host_reference_element(NumericTypeMap<ElementB>::kId) &&
+    detail::gemm_host_reference_element(NumericTypeMap<ElementC>::kId) &&
+    detail::gemm_host_reference_element(NumericTypeMap<ElementD>::kId) &&
+    detail::GemmHostReferenceConvertible<ElementAccumulator, ElementA>::value &&
+    detail::GemmHostReferenceConvertible<ElementAccumulator, ElementB>::value &&
+    detail::GemmHostReferenceConvertible<ElementCompute, ElementC>::value &&
+    is_complex<ElementCompute>::value == is_complex<ElementD>::value;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Procedural name shared by the GEMM reference operations
+std::string gemm_reference_operation_name(GemmDescription const &description);
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runtime-dispatched host reference for GEMM
+class GemmHostReferenceOperation : public Operation {
+public:
+
+  /// Constructs the operation from a description with provider kReferenceHost. If clamp_output
+  /// is set, D is computed with NumericConverterClamp rather than NumericConverter.
+  GemmHostReferenceOperation(GemmDescription const &description, bool clamp_output = false);
+
+  /// Returns the description of the GEMM operation
+  virtual OperationDescription const & description() const;
+
+  virtual Status can_implement(
+    void const *configuration,
+    void const *arguments) const;
+
+  virtual uint64_t get_host_workspace_size(
+    void const *configuration) const;
+
+  virtual uint64_t get_device_workspace_size(
+    void const *configuration,
+    void const *arguments = nullptr) const;
+
+  virtual Status initialize(
+    void const *configuration,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const;
+
+  virtual Status run(
+    void const *arguments,
+    void *host_workspace,
+    void *device_workspace = nullptr,
+    cudaStream_t stream = nullptr) const;
+
+private:
+
+  /// Storage for the name string
+  std::string name_;
+
+  GemmDescription description_;
+
+  bool clamp_output_;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace library
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,7 @@
 #include "cutlass/library/manifest.h"
 #include "cutlass/library/util.h"
 #include "library_internal.h"
+#include "gemm_host_reference_operation.h"
 
 #include "cutlass/util/reference/host/gemm_complex.h"
 #include "cutlass/util/reference/device/gemm_complex.h"
@@ -55,6 +56,54 @@ namespace library {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Describes a GEMM reference operation
+template <
+  typename ElementA,
+  typename LayoutA,
+  cutlass::ComplexTransform TransformA,
+  typename ElementB,
+  typename LayoutB,
+  cutlass::ComplexTransform TransformB,
+  typename ElementC,
+  typename LayoutC,
+  typename ElementCompute,
+  typename ElementAccumulator,
+  typename ElementD
+>
+GemmDescription make_gemm_reference_description(Provider provider) {
+
+  GemmDescription description;
+
+  // Basic information
+  description.provider = provider;
+  description.kind = OperationKind::kGemm;
+  description.gemm_kind = GemmKind::kUniversal;
+
+  // Tensor description
+  description.A = make_TensorDescription<ElementA, LayoutA>();
+  description.transform_A = ComplexTransformMap<TransformA>::kId;
+  description.B = make_TensorDescription<ElementB, LayoutB>();
+  description.transform_B = ComplexTransformMap<TransformB>::kId;
+  description.C = make_TensorDescription<ElementC, LayoutC>();
+  description.D = make_TensorDescription<ElementD, LayoutC>();
+
+  // Epilogue compute and accumulator type description
+  description.element_epilogue = NumericTypeMap<ElementCompute>::kId;
+
+  description.tile_description.math_instruction.element_accumulator =
+    NumericTypeMap<ElementAccumulator>::kId;
+
+  // Compute capability for gemm reference
+  description.tile_description.minimum_compute_capability =
+    (provider == Provider::kReferenceDevice ? 50 : 0);
+
+  description.tile_description.maximum_compute_capability = 1024;
+
+  return description;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <
   Provider Provider_,
   typename ElementA_,
@@ -105,51 +154,20 @@ public:
 
   /// Constructor
   GemmReferenceOperation() {
-    
-    // Basic information
-    description_.provider = kProvider;
-    description_.kind = OperationKind::kGemm;
-    description_.gemm_kind = GemmKind::kUniversal;
-
-    // Tensor description
-    description_.A = make_TensorDescription<ElementA, LayoutA>();
-    description_.transform_A = ComplexTransformMap<kTransformA>::kId;
-    description_.B = make_TensorDescription<ElementB, LayoutB>();
-    description_.transform_B = ComplexTransformMap<kTransformB>::kId;
-    description_.C = make_TensorDescription<ElementC, LayoutC>();
-    description_.D = make_TensorDescription<ElementD, LayoutC>();
-    
-    // Epilogue compute and accumulator type description
-    description_.element_epilogue = NumericTypeMap<ElementCompute>::kId;
-
-    description_.tile_description.math_instruction.element_accumulator =
-      NumericTypeMap<ElementAccumulator>::kId;
-
-    // Compute capability for gemm reference
-    description_.tile_description.minimum_compute_capability = 
-      (kProvider == Provider::kReferenceDevice ? 50 : 0);
 
-    description_.tile_description.maximum_compute_capability = 1024;
+    description_ = make_gemm_reference_description<
+      ElementA, LayoutA, kTransformA,
+      ElementB, LayoutB, kTransformB,
+      ElementC, LayoutC,
+      ElementCompute,
+      ElementAccumulator,
+      ElementD
+    >(kProvider);
 
     // Procedural name
-    std::stringstream ss;
-
-    ss << "gemm"  
-      << "_reference_" << to_string(description_.provider)
-      << "_" << to_string(description_.A.element) << to_string(description_.A.layout)
-      << "_" << to_string(description_.B.element) << to_string(description_.B.layout)
-      << "_" << to_string(description_.C.element) << to_string(description_.C.layout)
-      << "_" << to_string(description_.tile_description.math_instruction.element_accumulator);
-
-    name_ = ss.str();
+    name_ = gemm_reference_operation_name(description_);
 
     description_.name = name_.c_str();
-
-    // Epilogue compute and accumulator type description
-    description_.element_epilogue = NumericTypeMap<ElementCompute>::kId;
-
-    description_.tile_description.math_instruction.element_accumulator =
-      NumericTypeMap<ElementAccumulator>::kId;
   }
 
   /// Returns the description of the GEMM operation
@@ -202,7 +220,7 @@ public:
     TensorRefC ref_C{static_cast<ElementC *>(const_cast<void *>(args.C)), LayoutC(int(config.ldc))};
     TensorRefD ref_D{static_cast<ElementD *>(args.D), LayoutC(int(config.ldd))};
 
-    if (kProvider == Provider::kReferenceHost) {
+    if constexpr (kProvider == Provider::kReferenceHost) {
 
       cutlass::reference::host::GemmComplex<
         ElementA,
@@ -236,7 +254,7 @@ public:
 
       return Status::kSuccess;
     }
-    else if (kProvider == Provider::kReferenceDevice) {
+    else if constexpr (kProvider == Provider::kReferenceDevice) {
 
       cutlass::reference::device::GemmComplex<
         ElementA,
@@ -294,17 +312,41 @@ template <
 >
 void make_gemm(Manifest &manifest) {
 #if !defined(CUTLASS_PROFILER_DISABLE_REFERENCE)
-  manifest.append(new GemmReferenceOperation<
-    Provider::kReferenceHost,
-    ElementA_, LayoutA_, TransformA,
-    ElementB_, LayoutB_, TransformB,
-    ElementC_, LayoutC_,
+  using HostSupport = GemmHostReferenceSupport<
+    ElementA_, ElementB_, ElementC_,
     ElementCompute_,
     ElementAccumulator_,
     ElementD_,
     ConvertOp_,
     InnerProductOp_
-  >);
+  >;
+
+  // Host references share one runtime-dispatched instance when their types allow it
+  if constexpr (HostSupport::kValue) {
+    manifest.append(new GemmHostReferenceOperation(
+      make_gemm_reference_description<
+        ElementA_, LayoutA_, TransformA,
+        ElementB_, LayoutB_, TransformB,
+        ElementC_, LayoutC_,
+        ElementCompute_,
+        ElementAccumulator_,
+        ElementD_
+      >(Provider::kReferenceHost),
+      HostSupport::kClamp));
+  }
+  else {
+    manifest.append(new GemmReferenceOperation<
+      Provider::kReferenceHost,
+      ElementA_, LayoutA_, TransformA,
+      ElementB_, LayoutB_, TransformB,
+      ElementC_, LayoutC_,
+      ElementCompute_,
+      ElementAccumulator_,
+      ElementD_,
+      ConvertOp_,
+      InnerProductOp_
+    >);
+  }
 
   manifest.append(new GemmReferenceOperation<
     Provider::kReferenceDevice,
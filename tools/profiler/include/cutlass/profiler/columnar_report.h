@@ -0,0 +1,257 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Streaming columnar sink for profiler results
+
+   Results are buffered into row groups of a fixed number of rows, and each full row group is
+   written and flushed immediately, so memory usage is bounded by the row group size regardless
+   of how many results a sweep produces.
+
+   File layout (all integers little-endian):
+
+     File      := Magic Segment*
+     Magic     := "CUTLASSR" u32:version u32:reserved
+     Segment   := Schema RowGroup* [Footer]
+     Schema    := u32:'SCHM' u32:num_tags (String:name String:value)*
+                  u32:num_arguments String:argument_name* u32:num_devices u32:flags
+     RowGroup  := u32:'ROWG' u32:num_rows u64:payload_bytes Payload
+     Payload   := Dict:operation_name Dict:argument* Columns
+     Dict      := u32:num_new_entries String*
+     Columns   := u64:problem_index[num_rows] u8:provider[num_rows] u8:op_kind[num_rows]
+                  u8:disposition[num_rows] u8:status[num_rows] u32:operation_name[num_rows]
+                  (u32:argument[num_rows])* i64:bytes[num_rows] i64:flops[num_rows]
+                  f64:runtime[num_rows] (f64:runtime_device[num_rows])* [Statistics]
+     Statistics := i32:samples[num_rows] i32:outliers[num_rows] (f64:statistic[num_rows])*8
+     Footer    := u32:'END ' u64:total_rows
+     String    := u32:length char[length]
+
+   Flag bit 0 marks segments written with timing statistics, whose row groups carry the
+   Statistics columns (mean, median, p90, p99, min, max, stddev and confidence half-width).
+   Version 1 files have no flags.
+
+   String columns are dictionary-encoded. Dictionaries are scoped to a segment and grow
+   incrementally: each row group carries only the entries first referenced in that group.
+   Appending to an existing file starts a new segment. A file truncated by an interrupted
+   sweep remains readable up to its last complete row group, and appending to it first
+   truncates any incomplete trailing data.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <iosfwd>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "performance_result.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Incrementally built string dictionary
+class ColumnarDictionary {
+public:
+
+  /// Returns the code for `value`, adding it to the dictionary if necessary
+  uint32_t encode(std::string const &value);
+
+  /// Entries added since the last call to take_new_entries()
+  std::vector<std::string> take_new_entries();
+
+  size_t size() const { return entries_.size(); }
+
+private:
+
+  std::unordered_map<std::string, uint32_t> codes_;
+  std::vector<std::string> entries_;
+  size_t emitted_ = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes profiler results to a columnar binary file in row groups
+class ColumnarReportWriter {
+public:
+
+  static constexpr uint32_t kVersion = 2;
+  static constexpr size_t kDefaultRowGroupSize = 4096;
+
+  ColumnarReportWriter(
+    std::string const &path,
+    std::vector<std::pair<std::string, std::string>> const &pivot_tags,
+    std::vector<std::string> const &argument_names,
+    size_t num_devices,
+    bool timing_statistics = false,
+    bool append = false,
+    size_t row_group_size = kDefaultRowGroupSize);
+
+  ~ColumnarReportWriter();
+
+  bool good() const { return good_; }
+
+  /// Buffers a result, writing a row group once enough rows are buffered
+  void append(PerformanceResult const &result);
+
+  /// Writes buffered rows as a (possibly partial) row group
+  void flush();
+
+  /// Flushes buffered rows and writes the segment footer
+  void close();
+
+  size_t rows_written() const { return rows_written_; }
+
+private:
+
+  void write_schema_();
+
+  std::ofstream out_;
+  bool good_;
+  bool closed_;
+
+  std::vector<std::pair<std::string, std::string>> pivot_tags_;
+  std::vector<std::string> argument_names_;
+  size_t num_devices_;
+  bool timing_statistics_;
+  size_t row_group_size_;
+  size_t rows_written_;
+
+  ColumnarDictionary operation_names_;
+  std::vector<ColumnarDictionary> argument_dictionaries_;
+
+  /// Buffered columns of the current row group
+  std::vector<uint64_t> problem_index_;
+  std::vector<uint8_t> provider_;
+  std::vector<uint8_t> op_kind_;
+  std::vector<uint8_t> disposition_;
+  std::vector<uint8_t> status_;
+  std::vector<uint32_t> operation_name_;
+  std::vector<std::vector<uint32_t>> arguments_;
+  std::vector<int64_t> bytes_;
+  std::vector<int64_t> flops_;
+  std::vector<double> runtime_;
+  std::vector<std::vector<double>> runtime_device_;
+  std::vector<int32_t> samples_;
+  std::vector<int32_t> outliers_;
+  std::vector<std::vector<double>> statistics_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Reads a columnar report. Rows are decoded one row group at a time.
+class ColumnarReportReader {
+public:
+
+  /// Schema of one segment of the file
+  struct Schema {
+    std::vector<std::pair<std::string, std::string>> pivot_tags;
+    std::vector<std::string> argument_names;
+    size_t num_devices = 0;
+    bool timing_statistics = false;
+  };
+
+  /// Fully decoded row group
+  struct RowGroup {
+    size_t num_rows = 0;
+    std::vector<uint64_t> problem_index;
+    std::vector<uint8_t> provider;
+    std::vector<uint8_t> op_kind;
+    std::vector<uint8_t> disposition;
+    std::vector<uint8_t> status;
+    std::vector<uint32_t> operation_name;
+    std::vector<std::vector<uint32_t>> arguments;
+    std::vector<int64_t> bytes;
+    std::vector<int64_t> flops;
+    std::vector<double> runtime;
+    std::vector<std::vector<double>> runtime_device;
+    std::vector<int32_t> samples;
+    std::vector<int32_t> outliers;
+    std::vector<std::vector<double>> statistics;
+  };
+
+  explicit ColumnarReportReader(std::string const &path);
+
+  bool good() const { return good_; }
+
+  /// Format version from the file header
+  uint32_t version() const { return version_; }
+
+  /// Offset one past the last complete schema, row group or footer read so far
+  uint64_t valid_bytes() const { return valid_bytes_; }
+
+  /// Advances to the next row group. Returns false at the end of the file.
+  bool next();
+
+  /// Schema of the segment containing the current row group
+  Schema const &schema() const { return schema_; }
+
+  /// True if the current row group is the first of a new segment
+  bool schema_changed() const { return schema_changed_; }
+
+  /// Current row group
+  RowGroup const &row_group() const { return row_group_; }
+
+  /// Decoded string values
+  std::string const &operation_name(size_t row) const;
+  std::string const &argument(size_t row, size_t arg) const;
+
+  /// Reconstructs the result stored in `row` of the current row group
+  PerformanceResult result(size_t row) const;
+
+  /// Prints the file as CSV in the same format written by PerformanceReport
+  static int print_csv(std::string const &path, std::ostream &out);
+
+private:
+
+  bool read_schema_();
+
+  std::ifstream in_;
+  bool good_;
+  bool schema_changed_;
+  uint32_t version_;
+  uint64_t valid_bytes_;
+
+  Schema schema_;
+  RowGroup row_group_;
+
+  std::vector<std::string> operation_names_;
+  std::vector<std::vector<std::string>> argument_values_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
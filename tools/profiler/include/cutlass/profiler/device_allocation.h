@@ -40,6 +40,7 @@
 
 #include "cutlass/library/library.h"
 #include "cutlass/util/distribution.h"
+#include "cutlass/util/tensor_fingerprint.h"
 
 #include "enumerated_types.h"
 
@@ -120,6 +121,14 @@ public:
     double epsilon,
     double nonzero_floor);
 
+  /// Computes the exact and tolerance-aware fingerprints of a block
+  static TensorFingerprint block_fingerprint(
+    library::NumericTypeID numeric_type,
+    void const *ptr,
+    size_t capacity,
+    int mantissa_bits,
+    double nonzero_floor);
+
 public:
   //
   // Methods
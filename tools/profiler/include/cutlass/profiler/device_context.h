@@ -43,6 +43,7 @@
 
 #include "options.h"
 #include "device_allocation.h"
+#include "fingerprint_store.h"
 
 namespace cutlass {
 namespace profiler {
@@ -69,6 +70,9 @@ private:
   /// Non-owning set of named allocations
   AllocationMap allocations_;
 
+  /// Golden output fingerprints used by --fingerprint
+  FingerprintStore fingerprints_;
+
 public:
 
   /// Allocates memory of a given type, capacity (elements), and name
@@ -128,6 +132,10 @@ public:
 
   AllocationMap::iterator begin();
   AllocationMap::iterator end();
+
+  /// Golden output fingerprints
+  FingerprintStore &fingerprints() { return fingerprints_; }
+  FingerprintStore const &fingerprints() const { return fingerprints_; }
 };
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -125,6 +125,23 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str);
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Indicates how output fingerprints are used
+enum class FingerprintMode {
+  kOff,
+  kRecord,
+  kCheck,
+  kInvalid
+};
+
+/// Converts a FingerprintMode enumerant to a string
+char const *to_string(FingerprintMode mode, bool pretty = false);
+
+/// Parses a FingerprintMode enumerant from a string
+template <>
+FingerprintMode from_string<FingerprintMode>(std::string const &str);
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Indicates the type of kernel argument
 // ArgumentType can be both ScalarType or NumericType. Thus, enums kScalar and kNumeric
 // 1) kScalar: e.g. of a Scalar ArgumentType is u32 is a Scalar type.
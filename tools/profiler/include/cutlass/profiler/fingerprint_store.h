@@ -0,0 +1,114 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Golden output fingerprints keyed on operation, problem and initialization seed
+
+   Entries are stored one per line as text so that golden files diff cleanly under version control:
+
+     <exact:hex16> <quantized:hex16> <mantissa_bits> <key>
+
+   The key is the operation name followed by the problem arguments and every initialization option
+   that affects the input data: whether inputs are initialized, the initialization provider, the
+   data distribution and the seed. Lines starting with '#' are ignored.
+*/
+
+#pragma once
+
+#include <iosfwd>
+#include <map>
+#include <string>
+
+#include "cutlass/util/tensor_fingerprint.h"
+
+#include "options.h"
+#include "performance_result.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Golden fingerprint of one profiled problem
+struct FingerprintEntry {
+
+  TensorFingerprint fingerprint;
+
+  /// Mantissa bits used to compute the quantized fingerprint
+  int mantissa_bits = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Maps profiled problems to golden fingerprints
+class FingerprintStore {
+public:
+
+  using EntryMap = std::map<std::string, FingerprintEntry>;
+
+  /// Builds the key identifying the output of `result` for the given initialization options
+  static std::string make_key(PerformanceResult const &result, Options::Initialization const &initialization);
+
+  /// Loads entries from a file, replacing entries with the same key. Returns false if the file
+  /// cannot be opened or contains a malformed line.
+  bool load(std::string const &path);
+
+  /// Reads entries from a stream
+  bool read(std::istream &in);
+
+  /// Writes all entries to a file. Returns false on failure.
+  bool save(std::string const &path) const;
+
+  /// Writes all entries to a stream, sorted by key
+  void write(std::ostream &out) const;
+
+  /// Returns the entry for `key` or nullptr if none exists
+  FingerprintEntry const *lookup(std::string const &key) const;
+
+  /// Records or replaces the entry for `key` if its output passed verification. Outputs that
+  /// failed, were incorrect or were not verified are never recorded as golden. Returns true if
+  /// the entry was recorded.
+  bool record(std::string const &key, FingerprintEntry const &entry, Disposition verification);
+
+  size_t size() const { return entries_.size(); }
+
+  bool empty() const { return entries_.empty(); }
+
+private:
+
+  EntryMap entries_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
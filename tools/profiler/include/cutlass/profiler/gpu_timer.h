@@ -67,6 +67,9 @@ struct GpuTimer {
   /// Records a stop event in the stream and synchronizes on the stream, the flag is for cudaEventRecordWithFlags
   void stop_and_wait(cudaStream_t stream = nullptr, unsigned int flag = cudaEventRecordDefault);
 
+  /// Waits for the most recently recorded stop event to complete
+  void wait() const;
+
   /// Returns the duration in milliseconds
   double duration(int iterations = 1) const;
 };
@@ -201,6 +201,26 @@ public:
     DeviceAllocation &reference,
     int64_t count = 0);
 
+  /// Compares the fingerprint of an output with the golden fingerprint recorded for `result`.
+  /// Returns kNotVerified if no golden fingerprint exists and kIncorrect if both digests differ,
+  /// which callers confirm with a full comparison.
+  static Disposition verify_fingerprint(
+    Options const &options,
+    DeviceContext &device_context,
+    PerformanceResult const &result,
+    DeviceAllocation &output,
+    int64_t count = 0);
+
+  /// Records the fingerprint of an output as golden for --fingerprint=record. Call once the
+  /// verification providers have set `result.disposition`; only kPassed outputs are recorded.
+  /// Returns true if the fingerprint was recorded.
+  static bool record_fingerprint(
+    Options const &options,
+    DeviceContext &device_context,
+    PerformanceResult const &result,
+    DeviceAllocation &output,
+    int64_t count = 0);
+
   static void save_workspace(
     DeviceContext &device_context,
     Options const &options,
@@ -230,6 +250,13 @@ protected:
     library::OperationDescription const &operation_desc,
     ProblemSpace const &problem_space);
 
+  /// Computes the fingerprint of the first `count` elements of an output (all if 0)
+  static TensorFingerprint compute_fingerprint_(
+    Options const &options,
+    DeviceAllocation &output,
+    int64_t count,
+    int mantissa_bits);
+
   /// Method to profile an initialized CUTLASS operation
   virtual Status profile_cutlass_(
     PerformanceResult &result,
@@ -267,6 +294,15 @@ protected:
     std::function<Status(cudaStream_t, int)> const& func,
     cudaStream_t stream = nullptr);
 
+  /// Profiles the GPU kernel launched in `func` on the `stream`, recording the runtime of each
+  /// iteration in `result.runtime_statistics`
+  Status profile_kernel_sampled_(
+    PerformanceResult& result,
+    Options const& options,
+    std::function<Status(cudaStream_t, int)> const& func,
+    cudaStream_t stream,
+    int max_iterations);
+
 private:
   /// finds string matches filter_string in operation_name
   bool find_string_matches_(
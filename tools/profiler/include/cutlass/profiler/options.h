@@ -181,6 +181,20 @@ public:
     /// Indicates when to save the workspace
     SaveWorkspace save_workspace;
 
+    /// Maximum number of host threads used by host reference implementations. Zero uses the
+    /// CUTLASS_HOST_THREADS environment variable, or all hardware threads if it is unset.
+    int host_threads;
+
+    /// If not kOff, outputs are fingerprinted and recorded to or checked against fingerprint_path
+    /// instead of being compared with the verification providers
+    FingerprintMode fingerprint_mode;
+
+    /// File of golden output fingerprints
+    std::string fingerprint_path;
+
+    /// Mantissa bits kept by the quantized digest. Zero derives them from epsilon.
+    int fingerprint_bits;
+
     //
     // Methods
     //
@@ -219,6 +233,17 @@ public:
     /// If true, profiling with cuda graph enabled.
     bool use_cuda_graphs{false};
 
+    /// If true, each iteration is timed individually and summary statistics are reported.
+    /// The reported runtime is then the median of the samples remaining after outlier rejection.
+    bool timing_statistics{false};
+
+    /// Relative confidence interval half-width at which per-iteration sampling stops early.
+    /// Zero disables adaptive stopping.
+    double timing_precision{0};
+
+    /// Modified z-score above which per-iteration samples are rejected as outliers. Zero disables rejection.
+    double outlier_threshold{3.5};
+
     /// If enabled, the CUTLASS profiler searches for the best-performing kernel 
     /// within the subset of kernels matching a kernel filter regex. The best 
     /// performance is determined by screening over a set of predefined M/N/K 
@@ -277,6 +302,18 @@ public:
     /// Path to a file containing junit xml results
     std::string junit_output_path;
 
+    /// If true, results are written to '--output' as CSV
+    bool csv_output;
+
+    /// If true, results are streamed to '--output' in the columnar binary format
+    bool columnar_output;
+
+    /// Number of results buffered per row group of the columnar report
+    int columnar_row_group_size;
+
+    /// Path to a columnar report to print as CSV. The profiler exits after printing.
+    std::string view_path;
+
     /// Sequence of tags to attach to each result
     std::vector<std::pair<std::string, std::string>> pivot_tags;
 
@@ -36,11 +36,13 @@
 
 #include <vector>
 #include <fstream>
+#include <memory>
 
 // CUTLASS Profiler includes
 #include "options.h"
 #include "enumerated_types.h"
 #include "performance_result.h"
+#include "columnar_report.h"
 
 // CUTLASS Library includes
 #include "cutlass/library/library.h"
@@ -71,6 +73,12 @@ private:
   /// Output file containing junit results
   std::ofstream junit_output_file_;
 
+  /// Operation file name containing the columnar report of op_kind
+  std::string op_columnar_file_name_;
+
+  /// Streaming sink for the columnar report
+  std::unique_ptr<ColumnarReportWriter> columnar_writer_;
+
   /// Flag indicating the performance report is valid
   bool good_;
 
@@ -37,6 +37,7 @@
 #include <vector>
 
 #include "cutlass/cutlass.h"
+#include "cutlass/util/timing_statistics.h"
 
 // CUTLASS Profiler includes
 #include "enumerated_types.h"
@@ -89,6 +90,9 @@ struct PerformanceResult {
   /// Average runtime in ms per device
   std::vector<double> runtime_vector;
 
+  /// Statistics of per-iteration runtimes in ms. Empty unless timing statistics are enabled.
+  TimingStatistics runtime_statistics;
+
   //
   // Members
   //
@@ -0,0 +1,780 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Streaming columnar sink for profiler results
+*/
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/columnar_report.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'U', 'T', 'L', 'A', 'S', 'S', 'R'};
+
+constexpr uint32_t make_tag(char a, char b, char c, char d) {
+  return uint32_t(uint8_t(a)) | (uint32_t(uint8_t(b)) << 8) | (uint32_t(uint8_t(c)) << 16) | (uint32_t(uint8_t(d)) << 24);
+}
+
+constexpr uint32_t kSchemaTag = make_tag('S', 'C', 'H', 'M');
+constexpr uint32_t kRowGroupTag = make_tag('R', 'O', 'W', 'G');
+constexpr uint32_t kFooterTag = make_tag('E', 'N', 'D', ' ');
+
+/// Schema flag of segments carrying timing statistics
+constexpr uint32_t kTimingStatisticsFlag = 1;
+
+/// Floating-point timing statistics in the order of their columns
+constexpr double TimingStatistics::*kStatisticsColumns[] = {
+  &TimingStatistics::mean,
+  &TimingStatistics::median,
+  &TimingStatistics::p90,
+  &TimingStatistics::p99,
+  &TimingStatistics::min,
+  &TimingStatistics::max,
+  &TimingStatistics::stddev,
+  &TimingStatistics::confidence_half_width
+};
+
+constexpr size_t kNumStatisticsColumns = sizeof(kStatisticsColumns) / sizeof(kStatisticsColumns[0]);
+
+//
+// Encoding helpers. The format is little-endian, matching all supported hosts.
+//
+
+template <typename T>
+void put(std::string &buffer, T const &value) {
+  buffer.append(reinterpret_cast<char const *>(&value), sizeof(T));
+}
+
+template <typename T>
+void put_column(std::string &buffer, std::vector<T> const &column) {
+  buffer.append(reinterpret_cast<char const *>(column.data()), column.size() * sizeof(T));
+}
+
+void put_string(std::string &buffer, std::string const &str) {
+  put(buffer, uint32_t(str.size()));
+  buffer.append(str);
+}
+
+void put_dictionary(std::string &buffer, std::vector<std::string> const &entries) {
+  put(buffer, uint32_t(entries.size()));
+  for (auto const &entry : entries) {
+    put_string(buffer, entry);
+  }
+}
+
+/// Bounds-checked decoder over a row group payload
+struct Cursor {
+  char const *ptr;
+  char const *end;
+
+  template <typename T>
+  bool get(T &value) {
+    if (size_t(end - ptr) < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(&value, ptr, sizeof(T));
+    ptr += sizeof(T);
+    return true;
+  }
+
+  template <typename T>
+  bool get_column(std::vector<T> &column, size_t count) {
+    if (size_t(end - ptr) < count * sizeof(T)) {
+      return false;
+    }
+    column.resize(count);
+    std::memcpy(column.data(), ptr, count * sizeof(T));
+    ptr += count * sizeof(T);
+    return true;
+  }
+
+  bool get_string(std::string &str) {
+    uint32_t length;
+    if (!get(length) || size_t(end - ptr) < length) {
+      return false;
+    }
+    str.assign(ptr, length);
+    ptr += length;
+    return true;
+  }
+
+  bool get_dictionary(std::vector<std::string> &dictionary) {
+    uint32_t count;
+    if (!get(count)) {
+      return false;
+    }
+    for (uint32_t i = 0; i < count; ++i) {
+      std::string entry;
+      if (!get_string(entry)) {
+        return false;
+      }
+      dictionary.push_back(std::move(entry));
+    }
+    return true;
+  }
+};
+
+template <typename T>
+bool read_value(std::istream &in, T &value) {
+  in.read(reinterpret_cast<char *>(&value), sizeof(T));
+  return bool(in);
+}
+
+bool read_string(std::istream &in, std::string &str) {
+  uint32_t length;
+  if (!read_value(in, length)) {
+    return false;
+  }
+  str.resize(length);
+  in.read(&str[0], length);
+  return bool(in);
+}
+
+/// Validates an existing report before appending to it, truncating incomplete trailing data
+/// left by an interrupted sweep. Returns false if the file cannot be appended to.
+bool prepare_append(std::string const &path) {
+
+  uint64_t valid_bytes = 0;
+  {
+    ColumnarReportReader reader(path);
+    if (!reader.good()) {
+      std::cerr << "Cannot append to '" << path << "': not a columnar profiler report" << std::endl;
+      return false;
+    }
+    // Segments of one file share the version of its header
+    if (reader.version() != ColumnarReportWriter::kVersion) {
+      std::cerr << "Cannot append to '" << path << "': written by a different report version" << std::endl;
+      return false;
+    }
+    while (reader.next()) {
+    }
+    valid_bytes = reader.valid_bytes();
+  }
+
+  std::error_code error;
+  uint64_t file_bytes = std::filesystem::file_size(path, error);
+  if (error) {
+    std::cerr << "Cannot append to '" << path << "': " << error.message() << std::endl;
+    return false;
+  }
+
+  if (valid_bytes < file_bytes) {
+    std::cerr << "Truncating " << (file_bytes - valid_bytes) << " bytes of incomplete data from '"
+      << path << "' before appending" << std::endl;
+    std::filesystem::resize_file(path, valid_bytes, error);
+    if (error) {
+      std::cerr << "Cannot append to '" << path << "': " << error.message() << std::endl;
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+uint32_t ColumnarDictionary::encode(std::string const &value) {
+  auto it = codes_.find(value);
+  if (it != codes_.end()) {
+    return it->second;
+  }
+  uint32_t code = uint32_t(entries_.size());
+  codes_.emplace(value, code);
+  entries_.push_back(value);
+  return code;
+}
+
+std::vector<std::string> ColumnarDictionary::take_new_entries() {
+  std::vector<std::string> new_entries(entries_.begin() + emitted_, entries_.end());
+  emitted_ = entries_.size();
+  return new_entries;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+ColumnarReportWriter::ColumnarReportWriter(
+  std::string const &path,
+  std::vector<std::pair<std::string, std::string>> const &pivot_tags,
+  std::vector<std::string> const &argument_names,
+  size_t num_devices,
+  bool timing_statistics,
+  bool append,
+  size_t row_group_size
+):
+  good_(true),
+  closed_(false),
+  pivot_tags_(pivot_tags),
+  argument_names_(argument_names),
+  num_devices_(num_devices),
+  timing_statistics_(timing_statistics),
+  row_group_size_(row_group_size ? row_group_size : kDefaultRowGroupSize),
+  rows_written_(0),
+  argument_dictionaries_(argument_names.size()),
+  arguments_(argument_names.size()),
+  runtime_device_(num_devices),
+  statistics_(timing_statistics ? kNumStatisticsColumns : 0) {
+
+  bool write_magic = true;
+
+  if (append) {
+    std::error_code error;
+    // A missing or empty file is written from scratch
+    if (std::filesystem::file_size(path, error) && !error) {
+      if (!prepare_append(path)) {
+        good_ = false;
+        return;
+      }
+      write_magic = false;
+    }
+    out_.open(path, std::ios::binary | std::ios::app);
+  }
+  else {
+    out_.open(path, std::ios::binary | std::ios::trunc);
+  }
+
+  if (!out_.good()) {
+    good_ = false;
+    return;
+  }
+
+  if (write_magic) {
+    std::string header(kMagic, sizeof(kMagic));
+    put(header, kVersion);
+    put(header, uint32_t(0));
+    out_.write(header.data(), header.size());
+  }
+
+  write_schema_();
+}
+
+ColumnarReportWriter::~ColumnarReportWriter() {
+  close();
+}
+
+void ColumnarReportWriter::write_schema_() {
+  std::string buffer;
+  put(buffer, kSchemaTag);
+  put(buffer, uint32_t(pivot_tags_.size()));
+  for (auto const &tag : pivot_tags_) {
+    put_string(buffer, tag.first);
+    put_string(buffer, tag.second);
+  }
+  put(buffer, uint32_t(argument_names_.size()));
+  for (auto const &name : argument_names_) {
+    put_string(buffer, name);
+  }
+  put(buffer, uint32_t(num_devices_));
+  put(buffer, timing_statistics_ ? kTimingStatisticsFlag : uint32_t(0));
+  out_.write(buffer.data(), buffer.size());
+  out_.flush();
+  good_ = good_ && out_.good();
+}
+
+void ColumnarReportWriter::append(PerformanceResult const &result) {
+
+  if (!good_ || closed_) {
+    return;
+  }
+
+  problem_index_.push_back(uint64_t(result.problem_index));
+  provider_.push_back(uint8_t(result.provider));
+  op_kind_.push_back(uint8_t(result.op_kind));
+  disposition_.push_back(uint8_t(result.disposition));
+  status_.push_back(uint8_t(result.status));
+  operation_name_.push_back(operation_names_.encode(result.operation_name));
+
+  // Arguments are positional, matching the CSV columns
+  static std::string const kEmpty;
+  for (size_t i = 0; i < argument_names_.size(); ++i) {
+    std::string const &value = i < result.arguments.size() ? result.arguments[i].second : kEmpty;
+    arguments_[i].push_back(argument_dictionaries_[i].encode(value));
+  }
+
+  bytes_.push_back(result.bytes);
+  flops_.push_back(result.flops);
+  runtime_.push_back(result.runtime);
+
+  for (size_t i = 0; i < num_devices_; ++i) {
+    runtime_device_[i].push_back(i < result.runtime_vector.size() ? result.runtime_vector[i] : 0.0);
+  }
+
+  if (timing_statistics_) {
+    TimingStatistics const &stats = result.runtime_statistics;
+    samples_.push_back(stats.samples);
+    outliers_.push_back(stats.outliers);
+    for (size_t i = 0; i < kNumStatisticsColumns; ++i) {
+      statistics_[i].push_back(stats.*kStatisticsColumns[i]);
+    }
+  }
+
+  if (problem_index_.size() >= row_group_size_) {
+    flush();
+  }
+}
+
+void ColumnarReportWriter::flush() {
+
+  if (!good_ || problem_index_.empty()) {
+    return;
+  }
+
+  size_t num_rows = problem_index_.size();
+
+  std::string payload;
+  put_dictionary(payload, operation_names_.take_new_entries());
+  for (auto &dictionary : argument_dictionaries_) {
+    put_dictionary(payload, dictionary.take_new_entries());
+  }
+
+  put_column(payload, problem_index_);
+  put_column(payload, provider_);
+  put_column(payload, op_kind_);
+  put_column(payload, disposition_);
+  put_column(payload, status_);
+  put_column(payload, operation_name_);
+  for (auto const &column : arguments_) {
+    put_column(payload, column);
+  }
+  put_column(payload, bytes_);
+  put_column(payload, flops_);
+  put_column(payload, runtime_);
+  for (auto const &column : runtime_device_) {
+    put_column(payload, column);
+  }
+  if (timing_statistics_) {
+    put_column(payload, samples_);
+    put_column(payload, outliers_);
+    for (auto const &column : statistics_) {
+      put_column(payload, column);
+    }
+  }
+
+  std::string header;
+  put(header, kRowGroupTag);
+  put(header, uint32_t(num_rows));
+  put(header, uint64_t(payload.size()));
+
+  out_.write(header.data(), header.size());
+  out_.write(payload.data(), payload.size());
+  out_.flush();
+  good_ = out_.good();
+
+  rows_written_ += num_rows;
+
+  // Release row storage but keep capacity for the next row group
+  problem_index_.clear();
+  provider_.clear();
+  op_kind_.clear();
+  disposition_.clear();
+  status_.clear();
+  operation_name_.clear();
+  for (auto &column : arguments_) {
+    column.clear();
+  }
+  bytes_.clear();
+  flops_.clear();
+  runtime_.clear();
+  for (auto &column : runtime_device_) {
+    column.clear();
+  }
+  samples_.clear();
+  outliers_.clear();
+  for (auto &column : statistics_) {
+    column.clear();
+  }
+}
+
+void ColumnarReportWriter::close() {
+
+  if (closed_) {
+    return;
+  }
+
+  flush();
+
+  if (good_) {
+    std::string footer;
+    put(footer, kFooterTag);
+    put(footer, uint64_t(rows_written_));
+    out_.write(footer.data(), footer.size());
+  }
+
+  if (out_.is_open()) {
+    out_.close();
+  }
+  closed_ = true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+ColumnarReportReader::ColumnarReportReader(std::string const &path):
+  in_(path, std::ios::binary), good_(false), schema_changed_(false), version_(0), valid_bytes_(0) {
+
+  char magic[sizeof(kMagic)];
+  uint32_t reserved = 0;
+
+  in_.read(magic, sizeof(magic));
+  if (!in_ || std::memcmp(magic, kMagic, sizeof(kMagic))) {
+    return;
+  }
+
+  if (!read_value(in_, version_) || !read_value(in_, reserved) ||
+      version_ > ColumnarReportWriter::kVersion) {
+    return;
+  }
+
+  valid_bytes_ = uint64_t(in_.tellg());
+  good_ = true;
+}
+
+bool ColumnarReportReader::read_schema_() {
+
+  Schema schema;
+  uint32_t count;
+
+  if (!read_value(in_, count)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    std::pair<std::string, std::string> tag;
+    if (!read_string(in_, tag.first) || !read_string(in_, tag.second)) {
+      return false;
+    }
+    schema.pivot_tags.push_back(std::move(tag));
+  }
+
+  if (!read_value(in_, count)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < count; ++i) {
+    std::string name;
+    if (!read_string(in_, name)) {
+      return false;
+    }
+    schema.argument_names.push_back(std::move(name));
+  }
+
+  uint32_t num_devices;
+  if (!read_value(in_, num_devices)) {
+    return false;
+  }
+  schema.num_devices = num_devices;
+
+  if (version_ >= 2) {
+    uint32_t flags;
+    if (!read_value(in_, flags)) {
+      return false;
+    }
+    schema.timing_statistics = (flags & kTimingStatisticsFlag) != 0;
+  }
+
+  schema_ = std::move(schema);
+  operation_names_.clear();
+  argument_values_.assign(schema_.argument_names.size(), {});
+  return true;
+}
+
+bool ColumnarReportReader::next() {
+
+  schema_changed_ = false;
+
+  while (good_) {
+
+    uint32_t tag;
+    if (!read_value(in_, tag)) {
+      return false;
+    }
+
+    if (tag == kSchemaTag) {
+      if (!read_schema_()) {
+        good_ = false;
+        return false;
+      }
+      valid_bytes_ = uint64_t(in_.tellg());
+      schema_changed_ = true;
+      continue;
+    }
+
+    if (tag == kFooterTag) {
+      uint64_t total_rows;
+      if (!read_value(in_, total_rows)) {
+        return false;
+      }
+      valid_bytes_ = uint64_t(in_.tellg());
+      continue;
+    }
+
+    if (tag != kRowGroupTag) {
+      good_ = false;
+      return false;
+    }
+
+    uint32_t num_rows;
+    uint64_t payload_bytes;
+    if (!read_value(in_, num_rows) || !read_value(in_, payload_bytes)) {
+      return false;
+    }
+
+    std::string payload(payload_bytes, '\0');
+    in_.read(&payload[0], std::streamsize(payload_bytes));
+    if (!in_) {
+      // Truncated row group, e.g. from an interrupted sweep
+      return false;
+    }
+
+    Cursor cursor{payload.data(), payload.data() + payload.size()};
+    RowGroup &rg = row_group_;
+    rg.num_rows = num_rows;
+
+    bool ok = cursor.get_dictionary(operation_names_);
+    for (auto &values : argument_values_) {
+      ok = ok && cursor.get_dictionary(values);
+    }
+
+    ok = ok &&
+      cursor.get_column(rg.problem_index, num_rows) &&
+      cursor.get_column(rg.provider, num_rows) &&
+      cursor.get_column(rg.op_kind, num_rows) &&
+      cursor.get_column(rg.disposition, num_rows) &&
+      cursor.get_column(rg.status, num_rows) &&
+      cursor.get_column(rg.operation_name, num_rows);
+
+    rg.arguments.resize(schema_.argument_names.size());
+    for (auto &column : rg.arguments) {
+      ok = ok && cursor.get_column(column, num_rows);
+    }
+
+    ok = ok &&
+      cursor.get_column(rg.bytes, num_rows) &&
+      cursor.get_column(rg.flops, num_rows) &&
+      cursor.get_column(rg.runtime, num_rows);
+
+    rg.runtime_device.resize(schema_.num_devices);
+    for (auto &column : rg.runtime_device) {
+      ok = ok && cursor.get_column(column, num_rows);
+    }
+
+    if (schema_.timing_statistics) {
+      ok = ok &&
+        cursor.get_column(rg.samples, num_rows) &&
+        cursor.get_column(rg.outliers, num_rows);
+      rg.statistics.resize(kNumStatisticsColumns);
+      for (auto &column : rg.statistics) {
+        ok = ok && cursor.get_column(column, num_rows);
+      }
+    }
+    else {
+      rg.samples.clear();
+      rg.outliers.clear();
+      rg.statistics.clear();
+    }
+
+    if (!ok) {
+      good_ = false;
+      return false;
+    }
+    valid_bytes_ = uint64_t(in_.tellg());
+    return true;
+  }
+
+  return false;
+}
+
+std::string const &ColumnarReportReader::operation_name(size_t row) const {
+  return operation_names_.at(row_group_.operation_name.at(row));
+}
+
+std::string const &ColumnarReportReader::argument(size_t row, size_t arg) const {
+  return argument_values_.at(arg).at(row_group_.arguments.at(arg).at(row));
+}
+
+PerformanceResult ColumnarReportReader::result(size_t row) const {
+
+  PerformanceResult result;
+  RowGroup const &rg = row_group_;
+
+  result.problem_index = size_t(rg.problem_index.at(row));
+  result.provider = library::Provider(rg.provider.at(row));
+  result.op_kind = library::OperationKind(rg.op_kind.at(row));
+  result.disposition = Disposition(rg.disposition.at(row));
+  result.status = Status(rg.status.at(row));
+  result.operation_name = operation_name(row);
+
+  for (size_t arg = 0; arg < schema_.argument_names.size(); ++arg) {
+    result.arguments.emplace_back(schema_.argument_names[arg], argument(row, arg));
+  }
+
+  result.bytes = rg.bytes.at(row);
+  result.flops = rg.flops.at(row);
+  result.runtime = rg.runtime.at(row);
+
+  for (auto const &column : rg.runtime_device) {
+    result.runtime_vector.push_back(column.at(row));
+  }
+
+  if (schema_.timing_statistics) {
+    TimingStatistics &stats = result.runtime_statistics;
+    stats.samples = rg.samples.at(row);
+    stats.outliers = rg.outliers.at(row);
+    for (size_t i = 0; i < kNumStatisticsColumns; ++i) {
+      stats.*kStatisticsColumns[i] = rg.statistics.at(i).at(row);
+    }
+  }
+
+  return result;
+}
+
+int ColumnarReportReader::print_csv(std::string const &path, std::ostream &out) {
+
+  ColumnarReportReader reader(path);
+
+  if (!reader.good()) {
+    std::cerr << "Could not read columnar report at path '" << path << "'" << std::endl;
+    return 1;
+  }
+
+  std::string last_header;
+
+  while (reader.next()) {
+
+    Schema const &schema = reader.schema();
+
+    // Header matches PerformanceReport::print_csv_header_(). Appended segments sharing the
+    // same columns continue the previous table, as with '--append' CSV output.
+    if (reader.schema_changed()) {
+      std::ostringstream header;
+      int column_idx = 0;
+      for (auto const &tag : schema.pivot_tags) {
+        header << (column_idx++ ? "," : "") << tag.first;
+      }
+      header << (column_idx ? "," : "") << "Problem,Provider,OperationKind,Operation,Disposition,Status";
+      for (auto const &name : schema.argument_names) {
+        header << "," << name;
+      }
+      header << ",Bytes,Flops,Flops/Byte,Runtime";
+      if (schema.num_devices > 1) {
+        for (size_t i = 0; i < schema.num_devices; ++i) {
+          header << ",Runtime_" << i;
+        }
+      }
+      header << ",GB/s,GFLOPs";
+      if (schema.timing_statistics) {
+        header << ",Samples,Outliers,Runtime_median,Runtime_p90,Runtime_p99,Runtime_stddev";
+      }
+
+      if (header.str() != last_header) {
+        last_header = header.str();
+        out << last_header << "\n";
+      }
+    }
+
+    // Rows match PerformanceReport::print_result_csv_()
+    for (size_t row = 0; row < reader.row_group().num_rows; ++row) {
+      PerformanceResult result = reader.result(row);
+
+      int column_idx = 0;
+      for (auto const &tag : schema.pivot_tags) {
+        out << (column_idx++ ? "," : "") << tag.second;
+      }
+
+      out
+        << (column_idx ? "," : "")
+        << result.problem_index
+        << "," << to_string(result.provider, true)
+        << "," << to_string(result.op_kind)
+        << "," << result.operation_name
+        << "," << to_string(result.disposition)
+        << "," << library::to_string(result.status);
+
+      for (auto const &arg : result.arguments) {
+        out << "," << arg.second;
+      }
+
+      out
+        << "," << result.bytes
+        << "," << result.flops
+        << "," << (result.bytes ? result.flops / result.bytes : 0)
+        << "," << result.runtime;
+
+      if (schema.num_devices > 1) {
+        for (double runtime : result.runtime_vector) {
+          out << "," << runtime;
+        }
+      }
+
+      if (result.good()) {
+        out << "," << result.gbytes_per_sec() << "," << result.gflops_per_sec();
+      }
+      else {
+        out << ",,";
+      }
+
+      if (schema.timing_statistics) {
+        TimingStatistics const &stats = result.runtime_statistics;
+        if (stats.samples) {
+          out
+            << "," << stats.samples
+            << "," << stats.outliers
+            << "," << stats.median
+            << "," << stats.p90
+            << "," << stats.p99
+            << "," << stats.stddev;
+        }
+        else {
+          out << std::string(6, ',');
+        }
+      }
+      out << "\n";
+    }
+  }
+
+  return reader.good() ? 0 : 1;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,7 +35,10 @@
 #include <iostream>
 #include <stdexcept>
 
+#include "cutlass/util/host_thread_pool.h"
+
 // Profiler includes
+#include "cutlass/profiler/columnar_report.h"
 #include "cutlass/profiler/block_scaled_gemm_operation_profiler.h"
 #include "cutlass/profiler/blockwise_gemm_operation_profiler.h"
 #include "cutlass/profiler/conv2d_operation_profiler.h"
@@ -127,6 +130,9 @@ int CutlassProfiler::operator()() {
     options_.device.print_device_info(std::cout);
     return 0;
   }
+  else if (!options_.report.view_path.empty()) {
+    return ColumnarReportReader::print_csv(options_.report.view_path, std::cout);
+  }
 
   if (options_.execution_mode == ExecutionMode::kProfile ||
     options_.execution_mode == ExecutionMode::kDryRun ||
@@ -152,9 +158,27 @@ void CutlassProfiler::enumerate_() {
 /// Profiles all operations
 int CutlassProfiler::profile_() {
 
+  if (options_.verification.host_threads > 0) {
+    cutlass::set_host_thread_count(options_.verification.host_threads);
+  }
+
   // Keep track of all device memory tensor in map
   DeviceContext device_context;
 
+  FingerprintMode fingerprint_mode = options_.verification.fingerprint_mode;
+  std::string const &fingerprint_path = options_.verification.fingerprint_path;
+
+  if (fingerprint_mode == FingerprintMode::kCheck) {
+    if (!device_context.fingerprints().load(fingerprint_path)) {
+      std::cerr << "Failed to read fingerprints from " << fingerprint_path << "\n";
+      return 1;
+    }
+  }
+  else if (fingerprint_mode == FingerprintMode::kRecord) {
+    // Recording adds to an existing file so that sweeps can be recorded incrementally
+    device_context.fingerprints().load(fingerprint_path);
+  }
+
   int result = 0;
   // For all profilers (e.g. gemm/sparse_gemm/conv2d...)
   for (auto & profiler : operation_profilers_) {
@@ -166,11 +190,18 @@ int CutlassProfiler::profile_() {
 
       // If some profile failed, terminate immediately
       if (result) {
-        return result;
+        break;
       }
     }
   }
 
+  if (fingerprint_mode == FingerprintMode::kRecord) {
+    if (!device_context.fingerprints().save(fingerprint_path)) {
+      std::cerr << "Failed to write fingerprints to " << fingerprint_path << "\n";
+      result = result ? result : 1;
+    }
+  }
+
   return result;
 }
 
@@ -39,6 +39,7 @@
 #include "cutlass/layout/tensor.h"
 
 #include "cutlass/util/reference/device/tensor_compare.h"
+#include "cutlass/util/reference/device/tensor_fingerprint.h"
 #include "cutlass/util/reference/device/tensor_fill.h"
 #include "cutlass/util/reference/host/tensor_fill.h"
 #include "cutlass/util/host_tensor.h"
@@ -2090,6 +2091,234 @@ bool DeviceAllocation::block_compare_relatively_equal(
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Computes the exact and tolerance-aware fingerprints of a block
+TensorFingerprint DeviceAllocation::block_fingerprint(
+  library::NumericTypeID numeric_type,
+  void const *ptr,
+  size_t capacity,
+  int mantissa_bits,
+  double nonzero_floor) {
+
+  switch (numeric_type) {
+  case library::NumericTypeID::kFE4M3:
+    return reference::device::BlockFingerprint<float_e4m3_t>(
+      reinterpret_cast<float_e4m3_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFE5M2:
+    return reference::device::BlockFingerprint<float_e5m2_t>(
+      reinterpret_cast<float_e5m2_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFUE4M3:
+    return reference::device::BlockFingerprint<float_ue4m3_t>(
+      reinterpret_cast<float_ue4m3_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFUE8M0:
+    return reference::device::BlockFingerprint<float_ue8m0_t>(
+      reinterpret_cast<float_ue8m0_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFE2M3:
+    return reference::device::BlockFingerprint<float_e2m3_t>(
+      reinterpret_cast<float_e2m3_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFE3M2:
+    return reference::device::BlockFingerprint<float_e3m2_t>(
+      reinterpret_cast<float_e3m2_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kFE2M1:
+    return reference::device::BlockFingerprint<float_e2m1_t>(
+      reinterpret_cast<float_e2m1_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kF16:
+    return reference::device::BlockFingerprint<half_t>(
+      reinterpret_cast<half_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kBF16:
+    return reference::device::BlockFingerprint<bfloat16_t>(
+      reinterpret_cast<bfloat16_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kTF32:
+    return reference::device::BlockFingerprint<tfloat32_t>(
+      reinterpret_cast<tfloat32_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kF32:
+    return reference::device::BlockFingerprint<float>(
+      reinterpret_cast<float const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kF64:
+    return reference::device::BlockFingerprint<double>(
+      reinterpret_cast<double const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS2:
+    return reference::device::BlockFingerprint<int2b_t>(
+      reinterpret_cast<int2b_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS4:
+    return reference::device::BlockFingerprint<int4b_t>(
+      reinterpret_cast<int4b_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS8:
+    return reference::device::BlockFingerprint<int8_t>(
+      reinterpret_cast<int8_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS16:
+    return reference::device::BlockFingerprint<int16_t>(
+      reinterpret_cast<int16_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS32:
+    return reference::device::BlockFingerprint<int32_t>(
+      reinterpret_cast<int32_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kS64:
+    return reference::device::BlockFingerprint<int64_t>(
+      reinterpret_cast<int64_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kB1:
+    return reference::device::BlockFingerprint<uint1b_t>(
+      reinterpret_cast<uint1b_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU2:
+    return reference::device::BlockFingerprint<uint2b_t>(
+      reinterpret_cast<uint2b_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU4:
+    return reference::device::BlockFingerprint<uint4b_t>(
+      reinterpret_cast<uint4b_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU8:
+    return reference::device::BlockFingerprint<uint8_t>(
+      reinterpret_cast<uint8_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU16:
+    return reference::device::BlockFingerprint<uint16_t>(
+      reinterpret_cast<uint16_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU32:
+    return reference::device::BlockFingerprint<uint32_t>(
+      reinterpret_cast<uint32_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kU64:
+    return reference::device::BlockFingerprint<uint64_t>(
+      reinterpret_cast<uint64_t const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kCF16:
+    return reference::device::BlockFingerprint<complex<half_t>>(
+      reinterpret_cast<complex<half_t> const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kCBF16:
+    return reference::device::BlockFingerprint<complex<bfloat16_t>>(
+      reinterpret_cast<complex<bfloat16_t> const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kCTF32:
+    return reference::device::BlockFingerprint<complex<tfloat32_t>>(
+      reinterpret_cast<complex<tfloat32_t> const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kCF32:
+    return reference::device::BlockFingerprint<complex<float>>(
+      reinterpret_cast<complex<float> const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  case library::NumericTypeID::kCF64:
+    return reference::device::BlockFingerprint<complex<double>>(
+      reinterpret_cast<complex<double> const *>(ptr),
+      capacity,
+      mantissa_bits,
+      nonzero_floor);
+
+  default:
+    {
+      throw std::runtime_error(std::string("Unsupported numeric type: ") + to_string(numeric_type));
+    }
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 /// Permits copying dynamic vectors into static-length vectors
 template <typename TensorCoord, int Rank>
 struct vector_to_coord {
@@ -221,6 +221,50 @@ SaveWorkspace from_string<SaveWorkspace>(std::string const &str) {
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
+static struct {
+  char const *text;
+  char const *pretty;
+  FingerprintMode enumerant;
+}
+FingerprintMode_enumerants[] = {
+  {"off", "Off", FingerprintMode::kOff},
+  {"record", "Record", FingerprintMode::kRecord},
+  {"check", "Check", FingerprintMode::kCheck}
+};
+
+/// Converts a FingerprintMode enumerant to a string
+char const *to_string(FingerprintMode mode, bool pretty) {
+
+  for (auto const & possible : FingerprintMode_enumerants) {
+    if (mode == possible.enumerant) {
+      if (pretty) {
+        return possible.pretty;
+      }
+      else {
+        return possible.text;
+      }
+    }
+  }
+
+  return pretty ? "Invalid" : "invalid";
+}
+
+/// Parses a FingerprintMode enumerant from a string
+template <>
+FingerprintMode from_string<FingerprintMode>(std::string const &str) {
+
+  for (auto const & possible : FingerprintMode_enumerants) {
+    if ((str.compare(possible.text) == 0) ||
+        (str.compare(possible.pretty) == 0)) {
+      return possible.enumerant;
+    }
+  }
+
+  return FingerprintMode::kInvalid;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 static struct {
   char const *text;
   char const *pretty;
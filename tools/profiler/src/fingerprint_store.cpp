@@ -0,0 +1,201 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/* \file
+   \brief Golden output fingerprints keyed on operation, problem and initialization seed
+*/
+
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include "cutlass/library/util.h"
+
+#include "cutlass/profiler/fingerprint_store.h"
+
+namespace cutlass {
+namespace profiler {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/// Writes a distribution without spaces. Unless fixed by --dist, the distribution is chosen from
+/// the element types, which the operation name already identifies.
+void write_distribution(std::ostream &out, Options::Initialization const &initialization) {
+
+  if (!initialization.fix_data_distribution) {
+    out << "default";
+    return;
+  }
+
+  Distribution const &dist = initialization.data_distribution;
+
+  switch (dist.kind) {
+  case Distribution::Uniform:
+    out << "uniform,min:" << dist.uniform.min << ",max:" << dist.uniform.max
+        << ",pnan:" << dist.uniform.pnan;
+    break;
+  case Distribution::Gaussian:
+    out << "gaussian,mean:" << dist.gaussian.mean << ",stddev:" << dist.gaussian.stddev
+        << ",pnzA:" << dist.gaussian.pnzA << ",pnzB:" << dist.gaussian.pnzB
+        << ",pnzC:" << dist.gaussian.pnzC;
+    break;
+  case Distribution::Identity:
+    out << "identity";
+    break;
+  case Distribution::Sequential:
+    out << "sequential,start:" << dist.sequential.start << ",delta:" << dist.sequential.delta;
+    break;
+  case Distribution::AllZeros:
+    out << "all_zeros";
+    break;
+  case Distribution::AllOnes:
+    out << "all_ones";
+    break;
+  default:
+    out << "invalid";
+    break;
+  }
+
+  out << ",int_scale:" << dist.int_scale;
+}
+
+} // namespace
+
+std::string FingerprintStore::make_key(
+  PerformanceResult const &result,
+  Options::Initialization const &initialization) {
+
+  std::stringstream ss;
+
+  ss << result.operation_name;
+
+  for (auto const &arg : result.arguments) {
+    ss << " " << arg.first << "=" << arg.second;
+  }
+
+  ss << " initialization=" << (initialization.enabled ? library::to_string(initialization.provider) : "none");
+
+  ss << " dist=";
+  write_distribution(ss, initialization);
+
+  ss << " seed=" << initialization.seed;
+
+  return ss.str();
+}
+
+bool FingerprintStore::load(std::string const &path) {
+
+  std::ifstream in(path);
+
+  if (!in.is_open()) {
+    return false;
+  }
+
+  return read(in);
+}
+
+bool FingerprintStore::read(std::istream &in) {
+
+  std::string line;
+
+  while (std::getline(in, line)) {
+
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    std::stringstream ss(line);
+    FingerprintEntry entry;
+
+    ss >> std::hex >> entry.fingerprint.exact >> entry.fingerprint.quantized >> std::dec >> entry.mantissa_bits;
+
+    std::string key;
+    std::getline(ss >> std::ws, key);
+
+    if (ss.fail() || key.empty()) {
+      return false;
+    }
+
+    entries_[key] = entry;
+  }
+
+  return true;
+}
+
+bool FingerprintStore::save(std::string const &path) const {
+
+  std::ofstream out(path);
+
+  if (!out.is_open()) {
+    return false;
+  }
+
+  write(out);
+
+  return out.good();
+}
+
+void FingerprintStore::write(std::ostream &out) const {
+
+  char digests[40];
+
+  for (auto const &entry : entries_) {
+    std::snprintf(digests, sizeof(digests), "%016llx %016llx",
+      static_cast<unsigned long long>(entry.second.fingerprint.exact),
+      static_cast<unsigned long long>(entry.second.fingerprint.quantized));
+
+    out << digests << " " << entry.second.mantissa_bits << " " << entry.first << "\n";
+  }
+}
+
+FingerprintEntry const *FingerprintStore::lookup(std::string const &key) const {
+  auto it = entries_.find(key);
+  return it == entries_.end() ? nullptr : &it->second;
+}
+
+bool FingerprintStore::record(std::string const &key, FingerprintEntry const &entry, Disposition verification) {
+
+  if (verification != Disposition::kPassed) {
+    return false;
+  }
+
+  entries_[key] = entry;
+  return true;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace profiler
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
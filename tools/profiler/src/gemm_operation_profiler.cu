@@ -1183,6 +1183,27 @@ bool GemmOperationProfiler::verify_cutlass(
   // CUTLASS op ran the but not yet verified against any verification provider
   results_.back().disposition = Disposition::kNotVerified;
 
+  //
+  // Compare with golden fingerprints instead of running verification providers
+  //
+
+  if (options.verification.fingerprint_mode == FingerprintMode::kCheck) {
+
+    Disposition fingerprint_disposition = Disposition::kPassed;
+
+    for (size_t i = 0; i < gemm_workspace_.size() && fingerprint_disposition == Disposition::kPassed; ++i) {
+      cudaSetDevice(options.device.device_id(i));
+      fingerprint_disposition = verify_fingerprint(
+        options, device_context, results_.back(), *gemm_workspace_[i].Computed);
+    }
+
+    // Outputs without a matching fingerprint fall back to the verification providers
+    if (fingerprint_disposition == Disposition::kPassed || !options.verification.enabled) {
+      results_.back().disposition = fingerprint_disposition;
+      return true;
+    }
+  }
+
   //
   // Run verification providers
   //
@@ -1264,6 +1285,13 @@ bool GemmOperationProfiler::verify_cutlass(
     }
   }
 
+  // Record golden fingerprints only for outputs the verification providers confirmed. Outputs that
+  // failed verification returned above.
+  if (options.verification.fingerprint_mode == FingerprintMode::kRecord) {
+    cudaSetDevice(options.device.device_id(0));
+    record_fingerprint(options, device_context, results_.back(), *gemm_workspace_[0].Computed);
+  }
+
   // if verification.required is set, then return success iff at least one ref-check was run
   if (options.verification.required) {
     bool did_any_verification_run = false;
@@ -103,6 +103,14 @@ void GpuTimer::stop_and_wait(cudaStream_t stream, const unsigned int flag) {
   }
 }
 
+/// Waits for the most recently recorded stop event to complete
+void GpuTimer::wait() const {
+  cudaError_t result = cudaEventSynchronize(events[1]);
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to synchronize with stop event.");
+  }
+}
+
 /// Returns the duration in milliseconds
 double GpuTimer::duration(int iterations) const {
 
@@ -667,6 +667,76 @@ Disposition OperationProfiler::compare_tensors(
   return passed ? Disposition::kPassed : Disposition::kIncorrect;
 }
 
+/// Compares the fingerprint of an output with its golden fingerprint
+Disposition OperationProfiler::verify_fingerprint(
+  Options const &options,
+  DeviceContext &device_context,
+  PerformanceResult const &result,
+  DeviceAllocation &output,
+  int64_t count) {
+
+  FingerprintEntry const *golden = device_context.fingerprints().lookup(
+    FingerprintStore::make_key(result, options.initialization));
+
+  if (!golden) {
+    return Disposition::kNotVerified;
+  }
+
+  // The quantized digest must be computed with the precision it was recorded at
+  TensorFingerprint fingerprint = compute_fingerprint_(options, output, count, golden->mantissa_bits);
+
+  // Either digest matching is sufficient: the exact digest covers bit-identical outputs and the
+  // quantized digest tolerates differences below the recorded precision. An element rounding
+  // across a quantization boundary also changes the quantized digest, so a mismatch of both only
+  // means the output must be confirmed with a full comparison.
+  bool passed = fingerprint.exact == golden->fingerprint.exact ||
+    fingerprint.quantized == golden->fingerprint.quantized;
+
+  return passed ? Disposition::kPassed : Disposition::kIncorrect;
+}
+
+/// Records the fingerprint of an output if it passed verification
+bool OperationProfiler::record_fingerprint(
+  Options const &options,
+  DeviceContext &device_context,
+  PerformanceResult const &result,
+  DeviceAllocation &output,
+  int64_t count) {
+
+  if (result.disposition != Disposition::kPassed) {
+    return false;
+  }
+
+  FingerprintEntry entry;
+  entry.mantissa_bits = options.verification.fingerprint_bits > 0 ?
+    options.verification.fingerprint_bits :
+    fingerprint_mantissa_bits(options.verification.epsilon);
+
+  entry.fingerprint = compute_fingerprint_(options, output, count, entry.mantissa_bits);
+
+  return device_context.fingerprints().record(
+    FingerprintStore::make_key(result, options.initialization), entry, result.disposition);
+}
+
+/// Computes the exact and quantized digests of an output
+TensorFingerprint OperationProfiler::compute_fingerprint_(
+  Options const &options,
+  DeviceAllocation &output,
+  int64_t count,
+  int mantissa_bits) {
+
+  if (count == 0) {
+    count = output.capacity();
+  }
+
+  return DeviceAllocation::block_fingerprint(
+    output.type(),
+    output.data(),
+    count,
+    mantissa_bits,
+    options.verification.nonzero_floor);
+}
+
 /// Saves the workspace
 void OperationProfiler::save_workspace(
   DeviceContext &device_context,
@@ -932,6 +1002,10 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
     }
   }
 
+  if (options.profiling.timing_statistics && iterations > 0) {
+    return profile_kernel_sampled_(result, options, func, stream, iterations);
+  }
+
   timer.start(stream);
 
   int iteration = 0;
@@ -952,6 +1026,66 @@ Status OperationProfiler::profile_kernel_no_cuda_graphs_(
   return status;
 }
 
+/// Times each iteration individually, stopping early once the confidence interval is tight enough
+Status OperationProfiler::profile_kernel_sampled_(
+  PerformanceResult& result,
+  Options const& options,
+  std::function<Status(cudaStream_t, int)> const& func,
+  cudaStream_t stream,
+  int max_iterations) {
+
+  if (max_iterations <= 0) {
+    result.status = Status::kErrorInvalidProblem;
+    return result.status;
+  }
+
+  TimingStatisticsOptions statistics_options;
+  statistics_options.outlier_threshold = options.profiling.outlier_threshold;
+  statistics_options.relative_precision = options.profiling.timing_precision;
+  statistics_options.min_samples = std::min(options.profiling.min_iterations, max_iterations);
+  statistics_options.max_samples = max_iterations;
+
+  TimingSampler sampler(statistics_options);
+
+  // Events are synchronized once per batch so that the host does not stall the stream between
+  // consecutive iterations
+  constexpr int kBatchIterations = 32;
+  std::vector<GpuTimer> timers(std::min(kBatchIterations, max_iterations));
+
+  Status status = Status::kSuccess;
+
+  int iteration = 0;
+  while (!sampler.converged()) {
+
+    int batch = std::min(int(timers.size()), max_iterations - iteration);
+
+    for (int i = 0; i < batch; ++i) {
+      timers[i].start(stream);
+      status = func(stream, iteration + options.profiling.warmup_iterations);
+      timers[i].stop(stream);
+
+      if (status != Status::kSuccess) {
+        result.status = status;
+        return status;
+      }
+      ++iteration;
+    }
+
+    // Stop events complete in stream order, so the last one covers the whole batch
+    timers[batch - 1].wait();
+
+    for (int i = 0; i < batch; ++i) {
+      sampler.add_sample(timers[i].duration());
+    }
+  }
+
+  result.runtime_statistics = sampler.statistics();
+  result.runtime = result.runtime_statistics.median;
+  result.status  = status;
+
+  return status;
+}
+
 /// Method to profile a CUTLASS Operation
 Status OperationProfiler::profile_cutlass_(
   PerformanceResult &result,
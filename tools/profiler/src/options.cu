@@ -497,6 +497,14 @@ Options::Profiling::Profiling(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("profiling-duration", duration, 10);
   cmdline.get_cmd_line_argument("min-iterations", min_iterations, 10);
   cmdline.get_cmd_line_argument("use-cuda-graphs", use_cuda_graphs, false);
+  cmdline.get_cmd_line_argument("timing-statistics", timing_statistics, false);
+  cmdline.get_cmd_line_argument("timing-precision", timing_precision, 0.0);
+  cmdline.get_cmd_line_argument("outlier-threshold", outlier_threshold, 3.5);
+
+  // Adaptive stopping requires per-iteration samples
+  if (timing_precision > 0) {
+    timing_statistics = true;
+  }
   cmdline.get_cmd_line_argument("enable-kernel-performance-search", enable_kernel_performance_search, false);
   cmdline.get_cmd_line_argument("enable-best-kernel-for-fixed-shape", enable_best_kernel_for_fixed_shape, false);
 
@@ -550,6 +558,20 @@ void Options::Profiling::print_usage(std::ostream &out) const {
     << "  --profiling-enabled=<bool>                   "
     << "    If true, profiling is actually conducted.\n\n"
 
+    << "  --timing-statistics=<bool>                   "
+    << "    If true, each profiling iteration is timed individually. Median, p90, p99, and standard" << end_of_line
+    << "      deviation are reported, and Runtime is the median after outlier rejection. Not supported" << end_of_line
+    << "      with --use-cuda-graphs.\n\n"
+
+    << "  --timing-precision=<float>                   "
+    << "    Stops profiling a kernel once the confidence interval on its mean runtime is within this" << end_of_line
+    << "      fraction of the mean (e.g. 0.01), bounded above by the iteration count. Implies" << end_of_line
+    << "      --timing-statistics=true. If zero (default), all iterations are run.\n\n"
+
+    << "  --outlier-threshold=<float>                  "
+    << "    Per-iteration samples with a modified z-score above this value are rejected as" << end_of_line
+    << "      outliers. If zero, no samples are rejected. (default: 3.5)\n\n"
+
     << "  --enable-best-kernel-for-fixed-shape=<bool>   "
     << "    If true, iterate through common cluster sizes, raster orders, and swizzle sizes for each kernel.\n\n"
 
@@ -562,6 +584,9 @@ void Options::Profiling::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "profiling_iterations: " << iterations << "\n"
     << indent_str(indent) << "sleep_duration: " << sleep_duration << "\n"
     << indent_str(indent) << "profiling_enabled: " << enabled << "\n"
+    << indent_str(indent) << "timing_statistics: " << timing_statistics << "\n"
+    << indent_str(indent) << "timing_precision: " << timing_precision << "\n"
+    << indent_str(indent) << "outlier_threshold: " << outlier_threshold << "\n"
     << indent_str(indent) << "providers: [";
 
   int j = 0;
@@ -604,6 +629,28 @@ Options::Verification::Verification(cutlass::CommandLine const &cmdline) {
 
   cmdline.get_cmd_line_argument("nonzero-floor", nonzero_floor, 1.0 / 256.0);
 
+  cmdline.get_cmd_line_argument("host-threads", host_threads, 0);
+
+  if (cmdline.check_cmd_line_flag("fingerprint")) {
+    std::string value;
+    cmdline.get_cmd_line_argument("fingerprint", value);
+    fingerprint_mode = from_string<FingerprintMode>(value);
+    if (fingerprint_mode == FingerprintMode::kInvalid) {
+      throw std::runtime_error("Invalid fingerprint mode: " + value);
+    }
+  }
+  else {
+    fingerprint_mode = FingerprintMode::kOff;
+  }
+
+  // Only outputs confirmed by a verification provider are recorded as golden
+  if (fingerprint_mode == FingerprintMode::kRecord && !enabled) {
+    throw std::runtime_error("--fingerprint=record requires --verification-enabled=true");
+  }
+
+  cmdline.get_cmd_line_argument("fingerprint-file", fingerprint_path, std::string("fingerprints.txt"));
+  cmdline.get_cmd_line_argument("fingerprint-bits", fingerprint_bits, 0);
+
   if (cmdline.check_cmd_line_flag("save-workspace")) {
     std::string value;
     cmdline.get_cmd_line_argument("save-workspace", value);
@@ -658,7 +705,26 @@ void Options::Verification::print_usage(std::ostream &out) const {
     << "  --verification-providers=<providers>         "
     << "    List of providers used to verify result. (default: '*')" << end_of_line
     << "      Gemm verification-providers {cublas*}" << end_of_line
-    << "      Conv2d verification-providers {cudnn*, device*, host}"
+    << "      Conv2d verification-providers {cudnn*, device*, host}\n\n"
+
+    << "  --host-threads=<int>                         "
+    << "    Maximum number of host threads used by host reference implementations." << end_of_line
+    << "      Zero (default) uses the CUTLASS_HOST_THREADS environment variable or all" << end_of_line
+    << "      hardware threads. Lower values leave cores free for threads launching GPU work.\n\n"
+
+    << "  --fingerprint=<string>                       "
+    << "    Verifies outputs against golden fingerprints before verification providers." << end_of_line
+    << "       --fingerprint=off     compare with verification providers (default)" << end_of_line
+    << "       --fingerprint=record  record fingerprints of verified outputs to the fingerprint file" << end_of_line
+    << "       --fingerprint=check   compare output fingerprints with the fingerprint file\n\n"
+
+    << "  --fingerprint-file=<path>                    "
+    << "    File of golden fingerprints keyed on operation, problem and seed." << end_of_line
+    << "      (default: fingerprints.txt)\n\n"
+
+    << "  --fingerprint-bits=<int>                     "
+    << "    Mantissa bits kept by the tolerance-aware digest of floating-point outputs." << end_of_line
+    << "      Zero (default) derives them from --epsilon."
     << "\n\n";
 }
 
@@ -668,6 +734,9 @@ void Options::Verification::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "verification_enabled: " << enabled << "\n"
     << indent_str(indent) << "epsilon: " << epsilon << "\n"
     << indent_str(indent) << "save_workspace: " << to_string(save_workspace) << "\n"
+    << indent_str(indent) << "host_threads: " << host_threads << "\n"
+    << indent_str(indent) << "fingerprint: " << to_string(fingerprint_mode) << "\n"
+    << indent_str(indent) << "fingerprint_file: " << fingerprint_path << "\n"
     << indent_str(indent) << "verification_providers: [";
 
   int j = 0;
@@ -702,6 +771,30 @@ Options::Report::Report(cutlass::CommandLine const &cmdline) {
   cmdline.get_cmd_line_argument("output", output_path);
   cmdline.get_cmd_line_argument("junit-output", junit_output_path);
 
+  csv_output = true;
+  columnar_output = false;
+
+  if (cmdline.check_cmd_line_flag("report-format")) {
+    std::vector<std::string> formats;
+    cmdline.get_cmd_line_arguments("report-format", formats);
+
+    csv_output = false;
+    for (auto const &format : formats) {
+      if (format == "csv") {
+        csv_output = true;
+      }
+      else if (format == "columnar") {
+        columnar_output = true;
+      }
+      else {
+        throw std::runtime_error("Unsupported report format: " + format);
+      }
+    }
+  }
+
+  cmdline.get_cmd_line_argument("report-row-group", columnar_row_group_size, 4096);
+  cmdline.get_cmd_line_argument("report-view", view_path);
+
   if (cmdline.check_cmd_line_flag("tags")) {
     cmdline.get_cmd_line_argument_pairs("tags", pivot_tags);
   }
@@ -731,6 +824,16 @@ void Options::Report::print_usage(std::ostream &out) const {
     << "  --junit-output=<path>                        "
     << "    Path to junit output file for result reporting. Operation kind and '.junit.xml' is appended.\n\n"
 
+    << "  --report-format=<csv,columnar>               "
+    << "    Formats written to '--output'. 'csv' appends '.csv'; 'columnar' streams a dictionary-encoded" << end_of_line
+    << "      binary file with '.cprof' appended, using memory bounded by '--report-row-group'. (default: csv)\n\n"
+
+    << "  --report-row-group=<int>                     "
+    << "    Number of results buffered before a row group of the columnar report is flushed. (default: 4096)\n\n"
+
+    << "  --report-view=<path>                         "
+    << "    Prints a columnar report as CSV to stdout and exits.\n\n"
+
     << "  --print-kernel-before-running=<bool>                "
     << "    Prints the name of the kernel being profiled before running the kernel." << end_of_line
     << "      This is useful for determining which kernel is causing a run of the profiler to hang\n\n"
@@ -756,6 +859,10 @@ void Options::Report::print_options(std::ostream &out, int indent) const {
     << indent_str(indent) << "append: " << append << "\n"
     << indent_str(indent) << "output: " << output_path << "\n"
     << indent_str(indent) << "junit-output: " << junit_output_path << "\n"
+    << indent_str(indent) << "report-format: "
+      << (csv_output ? "csv" : "") << (csv_output && columnar_output ? "," : "")
+      << (columnar_output ? "columnar" : "") << "\n"
+    << indent_str(indent) << "report-row-group: " << columnar_row_group_size << "\n"
     << indent_str(indent) << "print-kernel-before-running: " << print_kernel_before_running << "\n"
     << indent_str(indent) << "report-not-run: " << report_not_run << "\n"
     << indent_str(indent) << "tags:\n";
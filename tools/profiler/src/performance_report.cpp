@@ -78,6 +78,7 @@ PerformanceReport::PerformanceReport(
   std::string base_path = options_.report.output_path;
   base_path = base_path.substr(0, base_path.rfind(".csv"));
   op_file_name_ = base_path + "." + to_string(op_kind_) + ".csv";
+  op_columnar_file_name_ = base_path + "." + to_string(op_kind_) + ".cprof";
 
   base_path = options_.report.junit_output_path;
   base_path = base_path.substr(0, base_path.rfind(".xml"));
@@ -87,7 +88,7 @@ PerformanceReport::PerformanceReport(
   //
   // Open output file for operation of PerformanceReport::op_kind
   //
-  if (!options_.report.output_path.empty()) {
+  if (!options_.report.output_path.empty() && options_.report.csv_output) {
 
     bool print_header = true;
 
@@ -119,6 +120,30 @@ PerformanceReport::PerformanceReport(
     }
   }
 
+  //
+  // Open columnar output file. Rows are streamed in row groups so that memory does not grow
+  // with the number of results.
+  //
+  if (!options_.report.output_path.empty() && options_.report.columnar_output) {
+
+    columnar_writer_.reset(new ColumnarReportWriter(
+      op_columnar_file_name_,
+      options_.report.pivot_tags,
+      argument_names_,
+      options_.device.devices.size(),
+      options_.profiling.timing_statistics,
+      options_.report.append,
+      size_t(options_.report.columnar_row_group_size)));
+
+    if (!columnar_writer_->good()) {
+
+      std::cerr << "Could not open columnar output file at path '"
+         << op_columnar_file_name_ << "'" << std::endl;
+
+      good_ = false;
+    }
+  }
+
   if (!options_.report.junit_output_path.empty()) {
 
     junit_output_file_.open(op_junit_file_name_);
@@ -152,10 +177,14 @@ void PerformanceReport::append_result(PerformanceResult result) {
     print_junit_result_(junit_output_file_, result);
   }
 
+  if (columnar_writer_) {
+    columnar_writer_->append(result);
+  }
+
   if (output_file_.is_open()) {
     print_result_csv_(output_file_, result) << std::endl;
   }
-  else {
+  else if (!columnar_writer_) {
     concatenated_results_.push_back(result);
   }
 }
@@ -234,6 +263,14 @@ PerformanceReport::~PerformanceReport() {
     output_file_.close();
   }
 
+  if (columnar_writer_) {
+    columnar_writer_->close();
+    if (options_.report.verbose) {
+      std::cout << "\nWrote " << columnar_writer_->rows_written() << " results to '"
+        << op_columnar_file_name_ << "'" << std::endl;
+    }
+  }
+
   if (junit_output_file_.is_open()) {
     print_junit_footer_(junit_output_file_);
     junit_output_file_.close();
@@ -326,6 +363,16 @@ std::ostream & PerformanceReport::print_result_pretty_(
       << "          Memory: " << result.gbytes_per_sec() << " GiB/s\n"
       << "\n            Math: " << result.gflops_per_sec() << " GFLOP/s\n";
 
+    TimingStatistics const &stats = result.runtime_statistics;
+    if (stats.samples) {
+      out
+        << "\n      Iterations: " << stats.samples << "  (" << stats.outliers << " outliers rejected)\n"
+        << "  Runtime median: " << stats.median << "  ms\n"
+        << "     Runtime p90: " << stats.p90 << "  ms\n"
+        << "     Runtime p99: " << stats.p99 << "  ms\n"
+        << "  Runtime stddev: " << stats.stddev << "  ms  (95% CI of mean: +/-"
+        << 100.0 * stats.relative_half_width() << "%)\n";
+    }
   }
 
   return out;
@@ -367,6 +414,17 @@ std::ostream & PerformanceReport::print_csv_header_(
     << ",GFLOPs"
     ;
 
+  if (options_.profiling.timing_statistics) {
+    out
+      << ",Samples"
+      << ",Outliers"
+      << ",Runtime_median"
+      << ",Runtime_p90"
+      << ",Runtime_p99"
+      << ",Runtime_stddev"
+      ;
+  }
+
   return out;
 }
 
@@ -425,6 +483,23 @@ std::ostream & PerformanceReport::print_result_csv_(
     );
   }
 
+  if (options_.profiling.timing_statistics) {
+    TimingStatistics const &stats = result.runtime_statistics;
+    if (stats.samples) {
+      out
+        << "," << stats.samples
+        << "," << stats.outliers
+        << "," << stats.median
+        << "," << stats.p90
+        << "," << stats.p99
+        << "," << stats.stddev
+        ;
+    }
+    else {
+      out << std::string(6, ',');
+    }
+  }
+
   return out;
 }
 
@@ -0,0 +1,692 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Host-side analyzer of how convolution layers map onto implicit GEMM CTA tiles.
+
+  For each layer, operator (fprop, dgrad, wgrad) and iterator algorithm (analytic, optimized,
+  fixed_channels, few_channels) the analyzer reproduces the grid and mainloop trip counts the
+  CUTLASS 2.x implicit GEMM kernels would launch, using the same helpers as the kernels
+  (implicit_gemm_problem_size, implicit_gemm_k_iterations and the strided dgrad filter
+  decomposition). It then reports how many of the issued MMA lanes compute a term of the
+  convolution and how many are predicated off or multiply zeros:
+
+    - tile_efficiency: output elements of the implicit GEMM over the CTA tiles covering them
+    - k_efficiency:    reduction extent over the reduction extent iterated by each CTA
+    - mma_efficiency:  convolution MACs over issued MACs; the remainder is padding halo,
+                       strided dgrad holes, channel padding and tile quantization combined
+    - wave_efficiency: CTAs over the CTA slots of the waves needed to run them
+
+  Layers whose channel counts do not meet the vector access width of analytic and optimized
+  kernels are additionally evaluated with C and K padded to the next multiple, so the cost of
+  padding can be compared against the fixed and few channel iterators.
+
+  Typical use:
+
+    std::ifstream layers_file("resnet50.txt");
+    auto layers = cutlass::parse_conv_layers(layers_file);
+
+    cutlass::ConvImplicitGemmAnalyzerConfig config;
+    config.tile = {128, 128, 32};
+    config.sm_count = 132;
+
+    cutlass::ConvImplicitGemmAnalyzer analyzer(config);
+    auto analyses = analyzer.analyze(layers);
+    cutlass::print_conv_analysis_csv(std::cout, analyses);
+
+  Grouped and depthwise convolutions are not modeled.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm_coord.h"
+#include "cutlass/conv/convolution.h"
+#include "cutlass/conv/conv2d_problem_size.h"
+#include "cutlass/conv/conv3d_problem_size.h"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Shape of one convolution layer. Spatial extents are stored in (d, h, w) order; 2-D layers
+/// have unit depth.
+struct ConvLayerShape {
+
+  std::string name;
+  int spatial_dims = 2;
+
+  int N = 1;
+  int C = 1;
+  int K = 1;
+  int groups = 1;
+
+  std::array<int, 3> input{1, 1, 1};     ///< D, H, W
+  std::array<int, 3> filter{1, 1, 1};    ///< T, R, S
+  std::array<int, 3> output{1, 1, 1};    ///< Z, P, Q
+  std::array<int, 3> padding{0, 0, 0};
+  std::array<int, 3> stride{1, 1, 1};
+  std::array<int, 3> dilation{1, 1, 1};
+
+  ConvLayerShape() = default;
+
+  ConvLayerShape(conv::Conv2dProblemSize const &problem, std::string name_ = ""):
+    name(name_), spatial_dims(2),
+    N(problem.N), C(problem.C), K(problem.K), groups(problem.groups),
+    input{1, problem.H, problem.W},
+    filter{1, problem.R, problem.S},
+    output{1, problem.P, problem.Q},
+    padding{0, problem.pad_h, problem.pad_w},
+    stride{1, problem.stride_h, problem.stride_w},
+    dilation{1, problem.dilation_h, problem.dilation_w} { }
+
+  ConvLayerShape(conv::Conv3dProblemSize const &problem, std::string name_ = ""):
+    name(name_), spatial_dims(3),
+    N(problem.N), C(problem.C), K(problem.K), groups(problem.groups),
+    input{problem.D, problem.H, problem.W},
+    filter{problem.T, problem.R, problem.S},
+    output{problem.Z, problem.P, problem.Q},
+    padding{problem.pad_d, problem.pad_h, problem.pad_w},
+    stride{problem.stride_d, problem.stride_h, problem.stride_w},
+    dilation{problem.dilation_d, problem.dilation_h, problem.dilation_w} { }
+
+  /// Computes the output extents from the input, filter, padding, stride and dilation
+  void compute_output() {
+    for (int i = 0; i < 3; ++i) {
+      output[i] = (input[i] + 2 * padding[i] - dilation[i] * (filter[i] - 1) - 1) / stride[i] + 1;
+    }
+  }
+
+  conv::Conv2dProblemSize conv2d(int split_k_slices = 1) const {
+    return conv::Conv2dProblemSize(
+      N, input[1], input[2], C, K, filter[1], filter[2], output[1], output[2],
+      padding[1], padding[2], stride[1], stride[2], dilation[1], dilation[2],
+      conv::Mode::kCrossCorrelation, split_k_slices, groups);
+  }
+
+  conv::Conv3dProblemSize conv3d(int split_k_slices = 1) const {
+    return conv::Conv3dProblemSize(
+      N, input[0], input[1], input[2], C, K, filter[0], filter[1], filter[2],
+      output[0], output[1], output[2],
+      padding[0], padding[1], padding[2], stride[0], stride[1], stride[2],
+      dilation[0], dilation[1], dilation[2],
+      conv::Mode::kCrossCorrelation, split_k_slices, groups);
+  }
+
+  /// Multiply-accumulates of the convolution, excluding taps that fall into the padding
+  int64_t useful_macs() const {
+    int64_t taps = 1;
+    for (int i = 0; i < 3; ++i) {
+      int64_t valid = 0;
+      for (int o = 0; o < output[i]; ++o) {
+        for (int f = 0; f < filter[i]; ++f) {
+          int x = o * stride[i] - padding[i] + f * dilation[i];
+          valid += (x >= 0 && x < input[i]);
+        }
+      }
+      taps *= valid;
+    }
+    return int64_t(N) * K * (C / groups) * taps;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Parses one layer per line as whitespace-separated key=value pairs, using the names of the
+/// profiler's convolution arguments: n, h, w, c, k, r, s, pad_h, pad_w, stride_h, stride_w,
+/// dilation_h, dilation_w, and d, t, pad_d, stride_d, dilation_d for 3-D layers. Output extents
+/// (p, q, z) are computed unless given. A leading token without '=' names the layer. Empty
+/// lines and lines starting with '#' are skipped.
+///
+///   conv1   n=32 h=224 w=224 c=3 k=64 r=7 s=7 pad_h=3 pad_w=3 stride_h=2 stride_w=2
+///   res2a   n=32 h=56 w=56 c=64 k=64 r=3 s=3 pad_h=1 pad_w=1
+inline std::vector<ConvLayerShape> parse_conv_layers(std::istream &in) {
+
+  std::vector<ConvLayerShape> layers;
+  std::string line;
+  int line_number = 0;
+
+  while (std::getline(in, line)) {
+    ++line_number;
+
+    std::istringstream tokens(line);
+    std::string token;
+    if (!(tokens >> token) || token[0] == '#') {
+      continue;
+    }
+
+    ConvLayerShape layer;
+    std::array<int, 3> given_output{0, 0, 0};
+
+    do {
+      size_t eq = token.find('=');
+      if (eq == std::string::npos) {
+        if (!layer.name.empty()) {
+          throw std::invalid_argument(
+            "line " + std::to_string(line_number) + ": unexpected token '" + token + "'");
+        }
+        layer.name = token;
+        continue;
+      }
+
+      std::string key = token.substr(0, eq);
+      int value = 0;
+      try {
+        value = std::stoi(token.substr(eq + 1));
+      }
+      catch (std::exception const &) {
+        throw std::invalid_argument(
+          "line " + std::to_string(line_number) + ": invalid value in '" + token + "'");
+      }
+
+      if      (key == "n") { layer.N = value; }
+      else if (key == "c") { layer.C = value; }
+      else if (key == "k") { layer.K = value; }
+      else if (key == "g" || key == "groups") { layer.groups = value; }
+      else if (key == "d") { layer.input[0] = value; layer.spatial_dims = 3; }
+      else if (key == "h") { layer.input[1] = value; }
+      else if (key == "w") { layer.input[2] = value; }
+      else if (key == "t") { layer.filter[0] = value; layer.spatial_dims = 3; }
+      else if (key == "r") { layer.filter[1] = value; }
+      else if (key == "s") { layer.filter[2] = value; }
+      else if (key == "z") { given_output[0] = value; }
+      else if (key == "p") { given_output[1] = value; }
+      else if (key == "q") { given_output[2] = value; }
+      else if (key == "pad_d") { layer.padding[0] = value; }
+      else if (key == "pad_h") { layer.padding[1] = value; }
+      else if (key == "pad_w") { layer.padding[2] = value; }
+      else if (key == "stride_d") { layer.stride[0] = value; }
+      else if (key == "stride_h") { layer.stride[1] = value; }
+      else if (key == "stride_w") { layer.stride[2] = value; }
+      else if (key == "dilation_d") { layer.dilation[0] = value; }
+      else if (key == "dilation_h") { layer.dilation[1] = value; }
+      else if (key == "dilation_w") { layer.dilation[2] = value; }
+      else {
+        throw std::invalid_argument(
+          "line " + std::to_string(line_number) + ": unknown key '" + key + "'");
+      }
+    } while (tokens >> token);
+
+    layer.compute_output();
+    for (int i = 0; i < 3; ++i) {
+      if (given_output[i] > 0) {
+        layer.output[i] = given_output[i];
+      }
+    }
+
+    if (layer.name.empty()) {
+      layer.name = "layer" + std::to_string(layers.size());
+    }
+
+    layers.push_back(layer);
+  }
+
+  return layers;
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Kernel configuration against which layers are analyzed
+struct ConvImplicitGemmAnalyzerConfig {
+
+  /// CTA tile (M, N, K) of the implicit GEMM
+  gemm::GemmCoord tile{128, 128, 32};
+
+  /// Elements per vector access of analytic and optimized kernels (8 for 128-bit fp16 accesses).
+  /// Fixed and few channel kernels use the widest power-of-two access, up to this width, that
+  /// divides C.
+  int alignment = 8;
+
+  /// CTA slots per wave are sm_count * ctas_per_sm
+  int sm_count = 108;
+  int ctas_per_sm = 1;
+
+  int split_k_slices = 1;
+
+  /// Also analyze analytic and optimized kernels with C and K padded to a multiple of alignment
+  bool pad_channels = true;
+};
+
+/// Result of mapping one layer, operator and iterator algorithm onto the configured kernel
+struct ConvImplicitGemmAnalysis {
+
+  std::string layer;
+  conv::Operator conv_operator = conv::Operator::kFprop;
+  conv::IteratorAlgorithm algorithm = conv::IteratorAlgorithm::kAnalytic;
+
+  /// Channel counts the kernel runs with. These exceed the layer's when channels are padded.
+  int C = 0;
+  int K = 0;
+  bool padded_channels = false;
+
+  /// Whether a kernel with this iterator algorithm can run the layer, and why not otherwise
+  bool supported = false;
+  std::string reason;
+
+  /// Implicit GEMM extent
+  gemm::GemmCoord gemm_extent;
+
+  /// Launched grid, including split-K slices, and the longest mainloop of any CTA
+  gemm::GemmCoord grid;
+  int64_t ctas = 0;
+  int k_iterations = 0;
+
+  int64_t useful_macs = 0;
+  int64_t issued_macs = 0;
+
+  double tile_efficiency = 0;
+  double k_efficiency = 0;
+  double mma_efficiency = 0;
+
+  double waves = 0;
+  double wave_efficiency = 0;
+
+  /// Mainloop iterations on the critical path, summing the longest CTA of each wave. Comparable
+  /// across candidates sharing a CTA tile.
+  int64_t mainloop_iterations = 0;
+
+  /// Set on the candidate with the fewest mainloop iterations for its layer and operator
+  bool best = false;
+
+  /// Fraction of issued MMA lanes that are predicated off or multiply padding
+  double predicated_fraction() const {
+    return 1.0 - mma_efficiency;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline char const *conv_analyzer_operator_name(conv::Operator op) {
+  switch (op) {
+    case conv::Operator::kFprop: return "fprop";
+    case conv::Operator::kDgrad: return "dgrad";
+    case conv::Operator::kWgrad: return "wgrad";
+    case conv::Operator::kDeconv: return "deconv";
+    default: break;
+  }
+  return "unknown";
+}
+
+inline char const *conv_analyzer_algorithm_name(conv::IteratorAlgorithm algorithm) {
+  switch (algorithm) {
+    case conv::IteratorAlgorithm::kAnalytic: return "analytic";
+    case conv::IteratorAlgorithm::kOptimized: return "optimized";
+    case conv::IteratorAlgorithm::kFixedChannels: return "fixed_channels";
+    case conv::IteratorAlgorithm::kFewChannels: return "few_channels";
+    case conv::IteratorAlgorithm::kFixedStrideDilation: return "fixed_stride_dilation";
+    default: break;
+  }
+  return "unknown";
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Maps convolution layers onto implicit GEMM CTA tiles
+class ConvImplicitGemmAnalyzer {
+public:
+
+  explicit ConvImplicitGemmAnalyzer(
+    ConvImplicitGemmAnalyzerConfig const &config = ConvImplicitGemmAnalyzerConfig()):
+    config_(config) {
+
+    if (config_.tile.m() <= 0 || config_.tile.n() <= 0 || config_.tile.k() <= 0 ||
+        config_.alignment <= 0 || config_.sm_count <= 0 || config_.ctas_per_sm <= 0 ||
+        config_.split_k_slices <= 0) {
+      throw std::invalid_argument("ConvImplicitGemmAnalyzer: configuration must be positive");
+    }
+  }
+
+  ConvImplicitGemmAnalyzerConfig const &config() const {
+    return config_;
+  }
+
+  /// Analyzes every layer for fprop, dgrad and wgrad
+  std::vector<ConvImplicitGemmAnalysis> analyze(std::vector<ConvLayerShape> const &layers) const {
+    std::vector<ConvImplicitGemmAnalysis> results;
+    for (auto const &layer : layers) {
+      for (auto op : {conv::Operator::kFprop, conv::Operator::kDgrad, conv::Operator::kWgrad}) {
+        auto candidates = analyze(layer, op);
+        results.insert(results.end(), candidates.begin(), candidates.end());
+      }
+    }
+    return results;
+  }
+
+  /// Analyzes one layer and operator under each iterator algorithm, and with padded channels
+  /// where the layer's channels are not aligned. The best supported candidate is marked.
+  std::vector<ConvImplicitGemmAnalysis> analyze(ConvLayerShape const &layer, conv::Operator op) const {
+
+    std::vector<ConvImplicitGemmAnalysis> candidates;
+
+    int padded_C = round_up(layer.C, config_.alignment);
+    int padded_K = round_up(layer.K, config_.alignment);
+    bool aligned = (padded_C == layer.C && padded_K == layer.K);
+
+    for (auto algorithm : {
+        conv::IteratorAlgorithm::kAnalytic,
+        conv::IteratorAlgorithm::kOptimized,
+        conv::IteratorAlgorithm::kFixedChannels,
+        conv::IteratorAlgorithm::kFewChannels}) {
+
+      candidates.push_back(analyze(layer, op, algorithm, layer.C, layer.K));
+
+      bool channel_aligned_algorithm =
+        algorithm == conv::IteratorAlgorithm::kAnalytic ||
+        algorithm == conv::IteratorAlgorithm::kOptimized;
+
+      if (config_.pad_channels && !aligned && channel_aligned_algorithm) {
+        candidates.push_back(analyze(layer, op, algorithm, padded_C, padded_K));
+      }
+    }
+
+    ConvImplicitGemmAnalysis *best = nullptr;
+    for (auto &candidate : candidates) {
+      if (!candidate.supported) {
+        continue;
+      }
+      if (!best ||
+          candidate.mainloop_iterations < best->mainloop_iterations ||
+          (candidate.mainloop_iterations == best->mainloop_iterations &&
+           candidate.issued_macs < best->issued_macs)) {
+        best = &candidate;
+      }
+    }
+    if (best) {
+      best->best = true;
+    }
+
+    return candidates;
+  }
+
+  /// Analyzes one layer, operator and iterator algorithm, running the kernel with C and K channels
+  ConvImplicitGemmAnalysis analyze(
+    ConvLayerShape const &layer,
+    conv::Operator op,
+    conv::IteratorAlgorithm algorithm,
+    int C,
+    int K) const {
+
+    ConvImplicitGemmAnalysis result;
+    result.layer = layer.name;
+    result.conv_operator = op;
+    result.algorithm = algorithm;
+    result.C = C;
+    result.K = K;
+    result.padded_channels = (C != layer.C || K != layer.K);
+
+    ConvLayerShape shape = layer;
+    shape.C = C;
+    shape.K = K;
+
+    result.reason = unsupported_reason(shape, op, algorithm);
+    result.supported = result.reason.empty();
+    if (!result.supported) {
+      return result;
+    }
+
+    result.useful_macs = layer.useful_macs();
+
+    int tile_m = config_.tile.m();
+    int tile_n = config_.tile.n();
+    int tile_k = config_.tile.k();
+    int slots = config_.sm_count * config_.ctas_per_sm;
+
+    if (shape.spatial_dims == 2) {
+      auto problem = shape.conv2d(config_.split_k_slices);
+      result.gemm_extent = conv::implicit_gemm_problem_size(op, problem);
+      result.k_iterations = conv::implicit_gemm_k_iterations(op, tile_k, problem, algorithm);
+
+      if (op == conv::Operator::kDgrad && (problem.stride_h > 1 || problem.stride_w > 1)) {
+        analyze_strided_dgrad_(result, problem, slots);
+        return result;
+      }
+    }
+    else {
+      auto problem = shape.conv3d(config_.split_k_slices);
+      result.gemm_extent = conv::implicit_gemm_problem_size(op, problem);
+      result.k_iterations = conv::implicit_gemm_k_iterations(op, tile_k, problem, algorithm);
+    }
+
+    auto extent = result.gemm_extent;
+    result.grid = gemm::GemmCoord(
+      ceil_div(extent.m(), tile_m), ceil_div(extent.n(), tile_n), config_.split_k_slices);
+    result.ctas = int64_t(result.grid.m()) * result.grid.n() * result.grid.k();
+
+    int64_t iterated_k = int64_t(result.k_iterations) * tile_k * config_.split_k_slices;
+    result.issued_macs = result.ctas * tile_m * tile_n * tile_k * result.k_iterations;
+    result.tile_efficiency = double(extent.m()) * extent.n() /
+      (double(result.grid.m()) * tile_m * double(result.grid.n()) * tile_n);
+    result.k_efficiency = double(extent.k()) / double(iterated_k);
+
+    result.mainloop_iterations = ceil_div(result.ctas, slots) * result.k_iterations;
+
+    finish_(result, slots);
+    return result;
+  }
+
+  /// Returns an empty string if the iterator algorithm supports the layer
+  std::string unsupported_reason(
+    ConvLayerShape const &layer,
+    conv::Operator op,
+    conv::IteratorAlgorithm algorithm) const {
+
+    if (layer.groups != 1) {
+      return "grouped convolution is not modeled";
+    }
+
+    bool unit_stride = (layer.stride[0] == 1 && layer.stride[1] == 1 && layer.stride[2] == 1);
+
+    switch (algorithm) {
+      case conv::IteratorAlgorithm::kAnalytic:
+      case conv::IteratorAlgorithm::kOptimized:
+        if (layer.C % config_.alignment || layer.K % config_.alignment) {
+          return "C and K must be multiples of " + std::to_string(config_.alignment);
+        }
+        if (algorithm == conv::IteratorAlgorithm::kOptimized) {
+          if (layer.filter[1] > 32 || layer.filter[2] > 32) {
+            return "optimized iterators require R <= 32 and S <= 32";
+          }
+          if (layer.spatial_dims == 3 && op == conv::Operator::kDgrad && !unit_stride) {
+            return "optimized 3-D dgrad requires unit stride";
+          }
+        }
+        return "";
+
+      case conv::IteratorAlgorithm::kFixedChannels:
+      case conv::IteratorAlgorithm::kFewChannels: {
+        if (op != conv::Operator::kFprop || layer.spatial_dims != 2) {
+          return "only 2-D fprop is supported";
+        }
+        if (config_.split_k_slices != 1) {
+          return "split-K is not modeled";
+        }
+        int access = channel_access_size(layer.C);
+        if (algorithm == conv::IteratorAlgorithm::kFixedChannels) {
+          if (layer.C != access) {
+            return "C must be a power of two no larger than " + std::to_string(config_.alignment);
+          }
+          if (config_.tile.k() % layer.C) {
+            return "tile K must be a multiple of C";
+          }
+        }
+        return "";
+      }
+
+      default:
+        break;
+    }
+    return "not modeled";
+  }
+
+  /// Widest power-of-two vector access, no larger than the configured alignment, dividing C
+  int channel_access_size(int C) const {
+    int access = 1;
+    while (access * 2 <= config_.alignment && C % (access * 2) == 0) {
+      access *= 2;
+    }
+    return access;
+  }
+
+private:
+
+  /// Strided dgrad launches one group of M tiles per starting filter position (r, s) modulo the
+  /// stride. Each group only accumulates the filter taps congruent to its starting position, so
+  /// mainloop trip counts differ between groups.
+  void analyze_strided_dgrad_(
+    ConvImplicitGemmAnalysis &result,
+    conv::Conv2dProblemSize const &problem,
+    int slots) const {
+
+    int tile_m = config_.tile.m();
+    int tile_n = config_.tile.n();
+    int tile_k = config_.tile.k();
+
+    int tile_m_per_filter = conv::strided_dgrad_tile_m_per_filter(problem, tile_m);
+    int filter_groups = problem.stride_h * problem.stride_w;
+    int k_iterations_per_tap = result.k_iterations / (problem.R * problem.S);
+
+    std::vector<int> group_k_iterations(filter_groups);
+    for (int group = 0; group < filter_groups; ++group) {
+      int start_r = group / problem.stride_w;
+      int start_s = group % problem.stride_w;
+      group_k_iterations[group] = (start_r < problem.R && start_s < problem.S) ?
+        k_iterations_per_tap * problem.num_gemm_k_filter_positions(start_r, start_s) : 0;
+    }
+
+    result.grid = gemm::GemmCoord(
+      tile_m_per_filter * filter_groups, ceil_div(result.gemm_extent.n(), tile_n), config_.split_k_slices);
+    result.ctas = int64_t(result.grid.m()) * result.grid.n() * result.grid.k();
+    result.k_iterations = *std::max_element(group_k_iterations.begin(), group_k_iterations.end());
+
+    int64_t group_iterations = 0;
+    for (int k_iterations : group_k_iterations) {
+      group_iterations += k_iterations;
+    }
+    int64_t cta_iterations = group_iterations * tile_m_per_filter * result.grid.n() * result.grid.k();
+    result.issued_macs = cta_iterations * tile_m * tile_n * tile_k;
+
+    // Dx rows computed per filter group cover every output row exactly once across groups
+    result.tile_efficiency = double(result.gemm_extent.m()) * result.gemm_extent.n() /
+      (double(result.grid.m()) * tile_m * double(result.grid.n()) * tile_n);
+
+    int64_t taps = int64_t(problem.R) * problem.S;
+    result.k_efficiency = double(taps * problem.K) /
+      (double(group_iterations) * tile_k * config_.split_k_slices);
+
+    // CTAs are launched with M fastest; each wave lasts as long as its longest CTA
+    int64_t mainloop_iterations = 0;
+    for (int64_t first = 0; first < result.ctas; first += slots) {
+      int64_t last = std::min(result.ctas, first + slots);
+      int longest = 0;
+      for (int64_t cta = first; cta < last; ++cta) {
+        int group = int((cta % result.grid.m()) / tile_m_per_filter);
+        longest = std::max(longest, group_k_iterations[group]);
+        if (longest == result.k_iterations) {
+          break;
+        }
+      }
+      mainloop_iterations += longest;
+    }
+    result.mainloop_iterations = mainloop_iterations;
+
+    finish_(result, slots);
+  }
+
+  void finish_(ConvImplicitGemmAnalysis &result, int slots) const {
+    result.mma_efficiency = result.issued_macs > 0 ?
+      double(result.useful_macs) / double(result.issued_macs) : 0;
+    result.waves = double(result.ctas) / double(slots);
+    int64_t full_waves = ceil_div(result.ctas, slots);
+    result.wave_efficiency = full_waves > 0 ?
+      double(result.ctas) / (double(full_waves) * slots) : 0;
+  }
+
+  static int round_up(int value, int multiple) {
+    return (value + multiple - 1) / multiple * multiple;
+  }
+
+  static int64_t ceil_div(int64_t value, int64_t divisor) {
+    return (value + divisor - 1) / divisor;
+  }
+
+  ConvImplicitGemmAnalyzerConfig config_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes one CSV row per analysis
+inline void print_conv_analysis_csv(
+  std::ostream &out,
+  std::vector<ConvImplicitGemmAnalysis> const &analyses) {
+
+  out << "layer,operator,algorithm,C,K,padded_channels,supported,gemm_m,gemm_n,gemm_k,"
+      << "grid_m,grid_n,split_k,k_iterations,useful_macs,issued_macs,tile_efficiency,k_efficiency,"
+      << "mma_efficiency,predicated_fraction,waves,wave_efficiency,mainloop_iterations,best,reason\n";
+
+  for (auto const &a : analyses) {
+    out << a.layer << ","
+        << conv_analyzer_operator_name(a.conv_operator) << ","
+        << conv_analyzer_algorithm_name(a.algorithm) << ","
+        << a.C << "," << a.K << ","
+        << (a.padded_channels ? "true" : "false") << ","
+        << (a.supported ? "true" : "false") << ",";
+
+    if (a.supported) {
+      out << a.gemm_extent.m() << "," << a.gemm_extent.n() << "," << a.gemm_extent.k() << ","
+          << a.grid.m() << "," << a.grid.n() << "," << a.grid.k() << ","
+          << a.k_iterations << "," << a.useful_macs << "," << a.issued_macs << ","
+          << a.tile_efficiency << "," << a.k_efficiency << ","
+          << a.mma_efficiency << "," << a.predicated_fraction() << ","
+          << a.waves << "," << a.wave_efficiency << ","
+          << a.mainloop_iterations << ",";
+    }
+    else {
+      out << ",,,,,,,,,,,,,,,,";
+    }
+
+    out << (a.best ? "true" : "false") << "," << a.reason << "\n";
+  }
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
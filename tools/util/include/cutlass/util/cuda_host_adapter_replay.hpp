@@ -0,0 +1,826 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Recording and replaying implementations of CudaHostAdapter.
+
+  Device-wide operators built with CUTLASS_ENABLE_CUDA_HOST_ADAPTER route occupancy queries,
+  launches, tensor map encoding and workspace fills through a CudaHostAdapter. The adapters here
+  make the host side of that traffic observable and reproducible:
+
+    - RecordingCudaHostAdapter forwards every call to another adapter and records it with its
+      arguments, result and host duration.
+
+    - ReplayCudaHostAdapter answers every call from a CudaHostAdapterDeviceProfile without touching
+      a GPU. Launches and fills are validated against the profile and then discarded, and tensor
+      maps are fabricated.
+
+  A profile captured from a recording on a GPU machine can be saved and replayed on a CPU-only
+  machine, so the host cost of can_implement(), get_workspace_size(), initialize() and run() can be
+  benchmarked and regression-tested anywhere:
+
+    cutlass::CudaHostAdapterDeviceProfile profile = cutlass::CudaHostAdapterDeviceProfile::load_file("h100.profile");
+    cutlass::ReplayCudaHostAdapter replay(profile, kernel_handles, 1);
+    cutlass::RecordingCudaHostAdapter recorder(&replay);
+
+    gemm_op.initialize(args, workspace, stream, &recorder);
+    gemm_op.run(stream, &recorder);
+    recorder.write_csv(std::cout);
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <map>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/cuda_host_adapter.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Device properties answering the queries of a ReplayCudaHostAdapter. Defaults describe an H100 SXM.
+struct CudaHostAdapterDeviceProfile {
+
+  std::string name = "H100";
+
+  int32_t sm_count = 132;
+  int32_t max_threads_per_sm = 2048;
+  int32_t max_threads_per_block = 1024;
+  int32_t max_blocks_per_sm = 32;
+
+  /// Shared memory capacity in bytes
+  int32_t shared_memory_per_sm = 233472;
+  int32_t shared_memory_per_block = 232448;
+
+  /// Shared memory reserved by the system for each resident block
+  int32_t reserved_shared_memory_per_block = 1024;
+
+  /// Largest cluster size, in blocks, that launches accept
+  int32_t max_cluster_size = 16;
+
+  /// Occupancy answers, keyed by (kernel index, thread count, shared memory bytes), that take
+  /// precedence over the occupancy model
+  std::map<std::array<int32_t, 3>, int32_t> occupancy;
+
+  /// Maximum number of resident blocks per SM
+  int32_t query_occupancy(int32_t kernel_index, int32_t thread_count, int32_t smem_size) const {
+
+    auto it = occupancy.find({kernel_index, thread_count, smem_size});
+    if (it != occupancy.end()) {
+      return it->second;
+    }
+
+    if (thread_count <= 0 || thread_count > max_threads_per_block ||
+        smem_size < 0 || smem_size > shared_memory_per_block) {
+      return 0;
+    }
+
+    // Threads are allocated to blocks in whole warps
+    int32_t warp_threads = (thread_count + 31) / 32 * 32;
+    int32_t blocks = std::min(max_blocks_per_sm, max_threads_per_sm / warp_threads);
+    return std::min(blocks, shared_memory_per_sm / (smem_size + reserved_shared_memory_per_block));
+  }
+
+  /// Writes the profile in the text format read by load()
+  void save(std::ostream &out) const {
+    out << "# CUTLASS CudaHostAdapter device profile\n"
+        << "name = " << name << "\n"
+        << "sm_count = " << sm_count << "\n"
+        << "max_threads_per_sm = " << max_threads_per_sm << "\n"
+        << "max_threads_per_block = " << max_threads_per_block << "\n"
+        << "max_blocks_per_sm = " << max_blocks_per_sm << "\n"
+        << "shared_memory_per_sm = " << shared_memory_per_sm << "\n"
+        << "shared_memory_per_block = " << shared_memory_per_block << "\n"
+        << "reserved_shared_memory_per_block = " << reserved_shared_memory_per_block << "\n"
+        << "max_cluster_size = " << max_cluster_size << "\n";
+    for (auto const &entry : occupancy) {
+      out << "occupancy = " << entry.first[0] << " " << entry.first[1] << " " << entry.first[2]
+          << " " << entry.second << "\n";
+    }
+  }
+
+  /// Reads `key = value` lines. Blank lines and lines starting with '#' are ignored, and keys
+  /// missing from the input keep their default values.
+  static CudaHostAdapterDeviceProfile load(std::istream &in) {
+
+    CudaHostAdapterDeviceProfile profile;
+    std::map<std::string, int32_t *> fields = {
+      {"sm_count", &profile.sm_count},
+      {"max_threads_per_sm", &profile.max_threads_per_sm},
+      {"max_threads_per_block", &profile.max_threads_per_block},
+      {"max_blocks_per_sm", &profile.max_blocks_per_sm},
+      {"shared_memory_per_sm", &profile.shared_memory_per_sm},
+      {"shared_memory_per_block", &profile.shared_memory_per_block},
+      {"reserved_shared_memory_per_block", &profile.reserved_shared_memory_per_block},
+      {"max_cluster_size", &profile.max_cluster_size}
+    };
+
+    std::string line;
+    int line_number = 0;
+    while (std::getline(in, line)) {
+      ++line_number;
+
+      size_t first = line.find_first_not_of(" \t\r");
+      if (first == std::string::npos || line[first] == '#') {
+        continue;
+      }
+
+      size_t separator = line.find('=');
+      if (separator == std::string::npos) {
+        throw std::runtime_error("Device profile line " + std::to_string(line_number) + ": expected 'key = value'");
+      }
+
+      std::string key = trim(line.substr(0, separator));
+      std::string value = trim(line.substr(separator + 1));
+      std::istringstream value_stream(value);
+
+      if (key == "name") {
+        profile.name = value;
+      }
+      else if (key == "occupancy") {
+        std::array<int32_t, 3> occupancy_key;
+        int32_t blocks;
+        if (!(value_stream >> occupancy_key[0] >> occupancy_key[1] >> occupancy_key[2] >> blocks)) {
+          throw std::runtime_error("Device profile line " + std::to_string(line_number) +
+            ": expected 'occupancy = <kernel index> <threads> <smem bytes> <blocks>'");
+        }
+        profile.occupancy[occupancy_key] = blocks;
+      }
+      else {
+        auto field = fields.find(key);
+        if (field == fields.end()) {
+          throw std::runtime_error("Device profile line " + std::to_string(line_number) + ": unknown key '" + key + "'");
+        }
+        if (!(value_stream >> *field->second)) {
+          throw std::runtime_error("Device profile line " + std::to_string(line_number) + ": invalid value for '" + key + "'");
+        }
+      }
+    }
+
+    return profile;
+  }
+
+  static CudaHostAdapterDeviceProfile load_file(std::string const &path) {
+    std::ifstream in(path);
+    if (!in) {
+      throw std::runtime_error("Failed to open device profile " + path);
+    }
+    return load(in);
+  }
+
+  void save_file(std::string const &path) const {
+    std::ofstream out(path);
+    if (!out) {
+      throw std::runtime_error("Failed to create device profile " + path);
+    }
+    save(out);
+  }
+
+private:
+
+  static std::string trim(std::string const &str) {
+    size_t first = str.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+      return std::string();
+    }
+    size_t last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Answers CudaHostAdapter calls from a device profile without a GPU
+class ReplayCudaHostAdapter : public CudaHostAdapter {
+public:
+
+  explicit ReplayCudaHostAdapter(
+    CudaHostAdapterDeviceProfile const &profile = CudaHostAdapterDeviceProfile(),
+    void **kernel_handles_ = nullptr,
+    int32_t kernel_count_ = 0):
+    CudaHostAdapter(kernel_handles_, kernel_count_), profile_(profile) { }
+
+  CudaHostAdapterDeviceProfile const &profile() const {
+    return profile_;
+  }
+
+  Status query_occupancy(
+    int32_t *device_sms,
+    int32_t *sm_occupancy,
+    int32_t kernel_index,
+    int32_t thread_count,
+    int32_t smem_size) const override {
+
+    if (device_sms) {
+      *device_sms = profile_.sm_count;
+    }
+    if (sm_occupancy) {
+      *sm_occupancy = profile_.query_occupancy(kernel_index, thread_count, smem_size);
+    }
+    return Status::kSuccess;
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    return validate_launch(grid_dims, dim3(1, 1, 1), block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    return validate_launch(grid_dims, cluster_dims, block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const fallback_cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    Status status = validate_launch(grid_dims, cluster_dims, block_dims, smem_size, kernel_params, kernel_index);
+    if (status != Status::kSuccess) {
+      return status;
+    }
+    return validate_launch(grid_dims, fallback_cluster_dims, block_dims, smem_size, kernel_params, kernel_index);
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  CUresult tensorMapEncodeIm2col(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t*,
+    const cuuint64_t*,
+    const int*,
+    const int*,
+    cuuint32_t,
+    cuuint32_t,
+    const cuuint32_t*,
+    CUtensorMapInterleave,
+    CUtensorMapSwizzle,
+    CUtensorMapL2promotion,
+    CUtensorMapFloatOOBfill) const override {
+
+    if (tensorRank < 3) {
+      return CUDA_ERROR_INVALID_VALUE;
+    }
+    return fabricate_tensor_map(tensorMap, tensorRank, globalAddress);
+  }
+
+  CUresult tensorMapEncodeTiled(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t*,
+    const cuuint64_t*,
+    const cuuint32_t*,
+    const cuuint32_t*,
+    CUtensorMapInterleave,
+    CUtensorMapSwizzle,
+    CUtensorMapL2promotion,
+    CUtensorMapFloatOOBfill) const override {
+
+    return fabricate_tensor_map(tensorMap, tensorRank, globalAddress);
+  }
+
+  CUresult tensorMapReplaceAddress(CUtensorMap* tensorMap, void* globalAddress) const override {
+    if (!tensorMap || reinterpret_cast<uintptr_t>(globalAddress) % 16) {
+      return CUDA_ERROR_INVALID_VALUE;
+    }
+    uint64_t address = reinterpret_cast<uintptr_t>(globalAddress);
+    std::memcpy(tensorMap, &address, sizeof(address));
+    return CUDA_SUCCESS;
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+protected:
+
+  /// Fills are discarded, since the destination is not backed by device memory
+  Status memsetDeviceImpl(
+    void* destination,
+    void const* fill_value,
+    size_t fill_size,
+    size_t count,
+    cudaStream_t) const override {
+
+    if ((count && !destination) || !fill_value || fill_size == 0) {
+      return Status::kErrorInvalidProblem;
+    }
+    return Status::kSuccess;
+  }
+
+private:
+
+  Status validate_launch(
+    dim3 grid_dims,
+    dim3 cluster_dims,
+    dim3 block_dims,
+    size_t smem_size,
+    void **kernel_params,
+    int32_t kernel_index) const {
+
+    uint64_t block_threads = uint64_t(block_dims.x) * block_dims.y * block_dims.z;
+    uint64_t cluster_size = uint64_t(cluster_dims.x) * cluster_dims.y * cluster_dims.z;
+
+    bool valid =
+      kernel_params != nullptr &&
+      kernel_index >= 0 && (empty() || kernel_index < kernel_count) &&
+      grid_dims.x && grid_dims.y && grid_dims.z &&
+      block_threads > 0 && block_threads <= uint64_t(profile_.max_threads_per_block) &&
+      smem_size <= size_t(profile_.shared_memory_per_block) &&
+      cluster_size > 0 && cluster_size <= uint64_t(profile_.max_cluster_size) &&
+      grid_dims.x % cluster_dims.x == 0 &&
+      grid_dims.y % cluster_dims.y == 0 &&
+      grid_dims.z % cluster_dims.z == 0;
+
+    return valid ? Status::kSuccess : Status::kErrorInternal;
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  /// The fabricated descriptor holds the global address in its first word
+  CUresult fabricate_tensor_map(CUtensorMap* tensorMap, cuuint32_t tensorRank, void* globalAddress) const {
+    if (!tensorMap || tensorRank == 0 || tensorRank > 5) {
+      return CUDA_ERROR_INVALID_VALUE;
+    }
+    std::memset(tensorMap, 0, sizeof(CUtensorMap));
+    return tensorMapReplaceAddress(tensorMap, globalAddress);
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  CudaHostAdapterDeviceProfile profile_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Entry points of CudaHostAdapter
+enum class CudaHostAdapterCallKind {
+  kQueryOccupancy,
+  kLaunch,
+  kLaunchCluster,
+  kLaunchPreferredCluster,
+  kTensorMapEncodeIm2col,
+  kTensorMapEncodeTiled,
+  kTensorMapReplaceAddress,
+  kMemset
+};
+
+inline char const *to_string(CudaHostAdapterCallKind kind) {
+  switch (kind) {
+    case CudaHostAdapterCallKind::kQueryOccupancy: return "query_occupancy";
+    case CudaHostAdapterCallKind::kLaunch: return "launch";
+    case CudaHostAdapterCallKind::kLaunchCluster: return "launch_cluster";
+    case CudaHostAdapterCallKind::kLaunchPreferredCluster: return "launch_preferred_cluster";
+    case CudaHostAdapterCallKind::kTensorMapEncodeIm2col: return "tensor_map_encode_im2col";
+    case CudaHostAdapterCallKind::kTensorMapEncodeTiled: return "tensor_map_encode_tiled";
+    case CudaHostAdapterCallKind::kTensorMapReplaceAddress: return "tensor_map_replace_address";
+    case CudaHostAdapterCallKind::kMemset: return "memset";
+  }
+  return "unknown";
+}
+
+/// A call recorded by RecordingCudaHostAdapter. Fields not taken by a call keep their defaults.
+struct CudaHostAdapterCall {
+
+  CudaHostAdapterCallKind kind = CudaHostAdapterCallKind::kLaunch;
+
+  /// Status for adapter calls, CUresult for tensor map calls
+  int32_t result = 0;
+
+  /// Host time spent in the adapter being recorded, in microseconds
+  double duration_us = 0;
+
+  int32_t kernel_index = -1;
+
+  // Occupancy queries
+  int32_t thread_count = 0;
+  int32_t device_sms = 0;
+  int32_t sm_occupancy = 0;
+
+  // Launches
+  dim3 grid_dims = dim3(0, 0, 0);
+  dim3 cluster_dims = dim3(1, 1, 1);
+  dim3 fallback_cluster_dims = dim3(1, 1, 1);
+  dim3 block_dims = dim3(0, 0, 0);
+  size_t smem_size = 0;
+  cudaStream_t stream = nullptr;
+
+  // Tensor maps and fills
+  void *address = nullptr;
+  uint32_t tensor_rank = 0;
+  int32_t data_type = 0;
+  int32_t swizzle = 0;
+  std::vector<uint64_t> global_dims;
+  std::vector<uint64_t> global_strides;
+  std::vector<uint32_t> box_dims;
+  size_t fill_size = 0;
+  size_t fill_count = 0;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Forwards every call to another adapter and records it. Thread-safe.
+class RecordingCudaHostAdapter : public CudaHostAdapter {
+public:
+
+  /// Kernel handles and launch attributes are taken from `target`, which must outlive the recorder
+  explicit RecordingCudaHostAdapter(CudaHostAdapter const *target):
+    CudaHostAdapter(*target), target_(target) { }
+
+  /// Calls recorded so far, in call order
+  std::vector<CudaHostAdapterCall> calls() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return calls_;
+  }
+
+  size_t count(CudaHostAdapterCallKind kind) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return size_t(std::count_if(calls_.begin(), calls_.end(),
+      [kind](CudaHostAdapterCall const &call) { return call.kind == kind; }));
+  }
+
+  /// Total host time spent in the target adapter, in microseconds
+  double total_duration_us() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    double total = 0;
+    for (auto const &call : calls_) {
+      total += call.duration_us;
+    }
+    return total;
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    calls_.clear();
+  }
+
+  /// Device profile reproducing the recorded occupancy queries
+  CudaHostAdapterDeviceProfile profile(
+    CudaHostAdapterDeviceProfile const &base = CudaHostAdapterDeviceProfile()) const {
+
+    CudaHostAdapterDeviceProfile profile = base;
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const &call : calls_) {
+      if (call.kind == CudaHostAdapterCallKind::kQueryOccupancy && call.result == int32_t(Status::kSuccess)) {
+        profile.sm_count = call.device_sms;
+        profile.occupancy[{call.kernel_index, call.thread_count, int32_t(call.smem_size)}] = call.sm_occupancy;
+      }
+    }
+    return profile;
+  }
+
+  /// Writes one line per recorded call
+  void write_csv(std::ostream &out) const {
+    out << "call,result,duration_us,kernel_index,grid,cluster,fallback_cluster,block,smem_size,"
+           "thread_count,sm_occupancy,tensor_rank,global_dims,fill_count\n";
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const &call : calls_) {
+      out << to_string(call.kind) << ","
+          << call.result << ","
+          << call.duration_us << ","
+          << call.kernel_index << ","
+          << format_dims(call.grid_dims) << ","
+          << format_dims(call.cluster_dims) << ","
+          << format_dims(call.fallback_cluster_dims) << ","
+          << format_dims(call.block_dims) << ","
+          << call.smem_size << ","
+          << call.thread_count << ","
+          << call.sm_occupancy << ","
+          << call.tensor_rank << ",";
+      for (size_t i = 0; i < call.global_dims.size(); ++i) {
+        out << (i ? "x" : "") << call.global_dims[i];
+      }
+      out << "," << call.fill_count << "\n";
+    }
+  }
+
+  Status query_occupancy(
+    int32_t *device_sms,
+    int32_t *sm_occupancy,
+    int32_t kernel_index,
+    int32_t thread_count,
+    int32_t smem_size) const override {
+
+    CudaHostAdapterCall call;
+    call.kind = CudaHostAdapterCallKind::kQueryOccupancy;
+    call.kernel_index = kernel_index;
+    call.thread_count = thread_count;
+    call.smem_size = size_t(smem_size);
+
+    Status status = timed(call, [&]() {
+      return target_->query_occupancy(device_sms, sm_occupancy, kernel_index, thread_count, smem_size);
+    });
+    call.device_sms = device_sms ? *device_sms : 0;
+    call.sm_occupancy = sm_occupancy ? *sm_occupancy : 0;
+    record(call, status);
+    return status;
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    CudaHostAdapterCall call = launch_call(CudaHostAdapterCallKind::kLaunch, grid_dims, block_dims,
+      smem_size, cuda_stream, kernel_index);
+    Status status = timed(call, [&]() {
+      return target_->launch(grid_dims, block_dims, smem_size, cuda_stream, kernel_params, kernel_index);
+    });
+    record(call, status);
+    return status;
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    CudaHostAdapterCall call = launch_call(CudaHostAdapterCallKind::kLaunchCluster, grid_dims, block_dims,
+      smem_size, cuda_stream, kernel_index);
+    call.cluster_dims = cluster_dims;
+    Status status = timed(call, [&]() {
+      return target_->launch(grid_dims, cluster_dims, block_dims, smem_size, cuda_stream, kernel_params,
+        kernel_index);
+    });
+    record(call, status);
+    return status;
+  }
+
+  Status launch(
+    dim3 const grid_dims,
+    dim3 const cluster_dims,
+    dim3 const fallback_cluster_dims,
+    dim3 const block_dims,
+    size_t const smem_size,
+    cudaStream_t cuda_stream,
+    void** kernel_params,
+    int32_t kernel_index) const override {
+
+    CudaHostAdapterCall call = launch_call(CudaHostAdapterCallKind::kLaunchPreferredCluster, grid_dims,
+      block_dims, smem_size, cuda_stream, kernel_index);
+    call.cluster_dims = cluster_dims;
+    call.fallback_cluster_dims = fallback_cluster_dims;
+    Status status = timed(call, [&]() {
+      return target_->launch(grid_dims, cluster_dims, fallback_cluster_dims, block_dims, smem_size,
+        cuda_stream, kernel_params, kernel_index);
+    });
+    record(call, status);
+    return status;
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  CUresult tensorMapEncodeIm2col(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const int* pixelBoxLowerCorner,
+    const int* pixelBoxUpperCorner,
+    cuuint32_t channelsPerPixel,
+    cuuint32_t pixelsPerColumn,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) const override {
+
+    CudaHostAdapterCall call = tensor_map_call(CudaHostAdapterCallKind::kTensorMapEncodeIm2col,
+      tensorDataType, tensorRank, globalAddress, globalDim, globalStrides, swizzle);
+    CUresult result = timed(call, [&]() {
+      return target_->tensorMapEncodeIm2col(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, pixelBoxLowerCorner, pixelBoxUpperCorner, channelsPerPixel, pixelsPerColumn,
+        elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    });
+    record(call, result);
+    return result;
+  }
+
+  CUresult tensorMapEncodeTiled(
+    CUtensorMap* tensorMap,
+    CUtensorMapDataType tensorDataType,
+    cuuint32_t tensorRank,
+    void* globalAddress,
+    const cuuint64_t* globalDim,
+    const cuuint64_t* globalStrides,
+    const cuuint32_t* boxDim,
+    const cuuint32_t* elementStrides,
+    CUtensorMapInterleave interleave,
+    CUtensorMapSwizzle swizzle,
+    CUtensorMapL2promotion l2Promotion,
+    CUtensorMapFloatOOBfill oobFill) const override {
+
+    CudaHostAdapterCall call = tensor_map_call(CudaHostAdapterCallKind::kTensorMapEncodeTiled,
+      tensorDataType, tensorRank, globalAddress, globalDim, globalStrides, swizzle);
+    if (boxDim && tensorRank <= 5) {
+      call.box_dims.assign(boxDim, boxDim + tensorRank);
+    }
+    CUresult result = timed(call, [&]() {
+      return target_->tensorMapEncodeTiled(tensorMap, tensorDataType, tensorRank, globalAddress, globalDim,
+        globalStrides, boxDim, elementStrides, interleave, swizzle, l2Promotion, oobFill);
+    });
+    record(call, result);
+    return result;
+  }
+
+  CUresult tensorMapReplaceAddress(CUtensorMap* tensorMap, void* globalAddress) const override {
+    CudaHostAdapterCall call;
+    call.kind = CudaHostAdapterCallKind::kTensorMapReplaceAddress;
+    call.address = globalAddress;
+    CUresult result = timed(call, [&]() {
+      return target_->tensorMapReplaceAddress(tensorMap, globalAddress);
+    });
+    record(call, result);
+    return result;
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+protected:
+
+  Status memsetDeviceImpl(
+    void* destination,
+    void const* fill_value,
+    size_t fill_size,
+    size_t count,
+    cudaStream_t stream) const override {
+
+    CudaHostAdapterCall call;
+    call.kind = CudaHostAdapterCallKind::kMemset;
+    call.address = destination;
+    call.fill_size = fill_size;
+    call.fill_count = count;
+    call.stream = stream;
+
+    // memsetDeviceImpl() is protected in the target, so dispatch through the public entry point
+    Status status = timed(call, [&]() {
+      switch (fill_size) {
+        case 1: return target_->memsetDevice(destination, load<uint8_t>(fill_value), count, stream);
+        case 2: return target_->memsetDevice(destination, load<uint16_t>(fill_value), count, stream);
+        case 4: return target_->memsetDevice(destination, load<uint32_t>(fill_value), count, stream);
+        case 8: return target_->memsetDevice(destination, load<uint64_t>(fill_value), count, stream);
+        default: return Status::kErrorNotSupported;
+      }
+    });
+    record(call, status);
+    return status;
+  }
+
+private:
+
+  template <class T>
+  static T load(void const *ptr) {
+    T value;
+    std::memcpy(&value, ptr, sizeof(T));
+    return value;
+  }
+
+  static std::string format_dims(dim3 dims) {
+    return std::to_string(dims.x) + "x" + std::to_string(dims.y) + "x" + std::to_string(dims.z);
+  }
+
+  static CudaHostAdapterCall launch_call(
+    CudaHostAdapterCallKind kind,
+    dim3 grid_dims,
+    dim3 block_dims,
+    size_t smem_size,
+    cudaStream_t stream,
+    int32_t kernel_index) {
+
+    CudaHostAdapterCall call;
+    call.kind = kind;
+    call.grid_dims = grid_dims;
+    call.block_dims = block_dims;
+    call.smem_size = smem_size;
+    call.stream = stream;
+    call.kernel_index = kernel_index;
+    return call;
+  }
+
+#if defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  static CudaHostAdapterCall tensor_map_call(
+    CudaHostAdapterCallKind kind,
+    CUtensorMapDataType data_type,
+    cuuint32_t rank,
+    void *address,
+    const cuuint64_t *global_dims,
+    const cuuint64_t *global_strides,
+    CUtensorMapSwizzle swizzle) {
+
+    CudaHostAdapterCall call;
+    call.kind = kind;
+    call.data_type = int32_t(data_type);
+    call.tensor_rank = rank;
+    call.address = address;
+    call.swizzle = int32_t(swizzle);
+    if (rank <= 5) {
+      if (global_dims) {
+        call.global_dims.assign(global_dims, global_dims + rank);
+      }
+      if (global_strides && rank > 1) {
+        call.global_strides.assign(global_strides, global_strides + rank - 1);
+      }
+    }
+    return call;
+  }
+
+#endif // defined(CUDA_HOST_ADAPTER_TENSORMAP_ENABLED)
+
+  template <class Func>
+  static auto timed(CudaHostAdapterCall &call, Func &&func) -> decltype(func()) {
+    auto start = std::chrono::steady_clock::now();
+    auto result = func();
+    std::chrono::duration<double, std::micro> elapsed = std::chrono::steady_clock::now() - start;
+    call.duration_us = elapsed.count();
+    return result;
+  }
+
+  template <class Result>
+  void record(CudaHostAdapterCall &call, Result result) const {
+    call.result = int32_t(result);
+    std::lock_guard<std::mutex> lock(mutex_);
+    calls_.push_back(std::move(call));
+  }
+
+  CudaHostAdapter const *target_;
+  mutable std::mutex mutex_;
+  mutable std::vector<CudaHostAdapterCall> calls_;
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,207 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+
+/*! \file
+    \brief Saves and restores the contents of the DevicePropertiesCache.
+
+    A snapshot taken after warming up a process lets later processes on the same machine start
+    without issuing device attribute or occupancy queries. Snapshots identify kernels by the hash
+    of their type name and are only meaningful for the binary, device and driver they were taken
+    with.
+
+    The file holds one entry per line:
+
+      attribute = <device> <attribute name> <value>
+      kernel = <query name> <device> <kernel id> <threads> <smem bytes> <cluster x> <cluster y> <cluster z> <flags> <value>
+*/
+
+#pragma once
+
+#include <fstream>
+#include <iomanip>
+#include <istream>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "cutlass/device_properties_cache.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Writes cached device attributes and kernel occupancy. Dynamic shared memory limits are
+/// process state rather than device properties and are not saved.
+inline void save_device_properties_snapshot(
+  std::ostream &out,
+  DevicePropertiesCache const &cache = DevicePropertiesCache::instance()) {
+
+  out << "# CUTLASS device properties snapshot\n";
+
+  cache.for_each_attribute([&](int device, DeviceAttribute attribute, int value) {
+    out << "attribute = " << device << " " << to_string(attribute) << " " << value << "\n";
+  });
+
+  cache.for_each_kernel_query([&](KernelQueryKey const &key, int value) {
+    if (key.query == KernelQuery::kDynamicSharedMemoryLimit) {
+      return;
+    }
+    out << "kernel = " << to_string(key.query) << " " << key.device << " "
+        << std::hex << std::setw(16) << std::setfill('0') << key.kernel << std::dec << std::setfill(' ') << " "
+        << key.threads << " " << key.smem_size << " "
+        << key.cluster_x << " " << key.cluster_y << " " << key.cluster_z << " "
+        << key.flags << " " << value << "\n";
+  });
+}
+
+/// Inserts the entries of a snapshot into the cache. Entries already cached are kept. Returns the
+/// number of entries read.
+inline size_t load_device_properties_snapshot(
+  std::istream &in,
+  DevicePropertiesCache &cache = DevicePropertiesCache::instance()) {
+
+  auto trim = [](std::string const &str) {
+    size_t first = str.find_first_not_of(" \t\r");
+    if (first == std::string::npos) {
+      return std::string();
+    }
+    size_t last = str.find_last_not_of(" \t\r");
+    return str.substr(first, last - first + 1);
+  };
+
+  auto error = [](int line_number, std::string const &message) {
+    return std::runtime_error("Device properties snapshot line " + std::to_string(line_number) + ": " + message);
+  };
+
+  size_t entries = 0;
+  std::string line;
+  int line_number = 0;
+  while (std::getline(in, line)) {
+    ++line_number;
+
+    size_t first = line.find_first_not_of(" \t\r");
+    if (first == std::string::npos || line[first] == '#') {
+      continue;
+    }
+
+    size_t separator = line.find('=');
+    if (separator == std::string::npos) {
+      throw error(line_number, "expected 'key = value'");
+    }
+
+    std::string key = trim(line.substr(0, separator));
+    std::istringstream value_stream(line.substr(separator + 1));
+
+    if (key == "attribute") {
+      int device;
+      std::string name;
+      int value;
+      if (!(value_stream >> device >> name >> value)) {
+        throw error(line_number, "expected 'attribute = <device> <attribute name> <value>'");
+      }
+
+      DeviceAttribute attribute = DeviceAttribute::kInvalid;
+      for (int i = 0; i < DevicePropertiesCache::kAttributeCount; ++i) {
+        if (name == to_string(DeviceAttribute(i))) {
+          attribute = DeviceAttribute(i);
+        }
+      }
+      if (attribute == DeviceAttribute::kInvalid) {
+        throw error(line_number, "unknown attribute '" + name + "'");
+      }
+
+      int cached;
+      if (!cache.find_attribute(cached, device, attribute)) {
+        cache.set_attribute(device, attribute, value);
+      }
+    }
+    else if (key == "kernel") {
+      std::string name;
+      KernelQueryKey query_key;
+      int value;
+      if (!(value_stream >> name >> query_key.device >> std::hex >> query_key.kernel >> std::dec
+                         >> query_key.threads >> query_key.smem_size
+                         >> query_key.cluster_x >> query_key.cluster_y >> query_key.cluster_z
+                         >> query_key.flags >> value)) {
+        throw error(line_number, "expected 'kernel = <query name> <device> <kernel id> <threads> "
+          "<smem bytes> <cluster x> <cluster y> <cluster z> <flags> <value>'");
+      }
+
+      if (name == to_string(KernelQuery::kMaxActiveBlocks)) {
+        query_key.query = KernelQuery::kMaxActiveBlocks;
+      }
+      else if (name == to_string(KernelQuery::kMaxActiveClusters)) {
+        query_key.query = KernelQuery::kMaxActiveClusters;
+      }
+      else {
+        throw error(line_number, "unknown kernel query '" + name + "'");
+      }
+
+      cache.insert(query_key, value);
+    }
+    else {
+      throw error(line_number, "unknown key '" + key + "'");
+    }
+
+    ++entries;
+  }
+
+  return entries;
+}
+
+inline void save_device_properties_snapshot_file(
+  std::string const &path,
+  DevicePropertiesCache const &cache = DevicePropertiesCache::instance()) {
+
+  std::ofstream out(path);
+  if (!out) {
+    throw std::runtime_error("Failed to create device properties snapshot " + path);
+  }
+  save_device_properties_snapshot(out, cache);
+}
+
+inline size_t load_device_properties_snapshot_file(
+  std::string const &path,
+  DevicePropertiesCache &cache = DevicePropertiesCache::instance()) {
+
+  std::ifstream in(path);
+  if (!in) {
+    throw std::runtime_error("Failed to open device properties snapshot " + path);
+  }
+  return load_device_properties_snapshot(in, cache);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,356 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Host-side tile assignment and load planner for the SM90 grouped GEMM tile scheduler.
+
+  PersistentTileSchedulerSm90Group linearizes the output tiles of all groups, group after group,
+  and persistent CTA `c` of a grid of `G` CTAs visits linear tiles c, c + G, c + 2G, ... The
+  scheduler has no knowledge of how many K iterations each tile needs, so when groups differ in K
+  or in size (for example the per-expert GEMMs of a mixture-of-experts layer under skewed routing)
+  the work received by each CTA can differ substantially.
+
+  The planner replays the scheduler's grid sizing, rasterization and tile index math on the host
+  for a set of group problem sizes and predicts the load of every persistent CTA, so that the
+  effect of a routing distribution on a grouped kernel can be evaluated without a GPU:
+
+    cutlass::GroupedGemmPlanner planner(tile_shape, cluster_shape, hw_info);
+    auto problems = cutlass::GroupedGemmPlanner::moe_problem_sizes(tokens_per_expert, n, k);
+    auto plan = planner.plan(problems);
+    std::cout << plan;                          // makespan, imbalance and padding efficiency
+
+  Loads are predicted in units of mainloop K-tile iterations. Each persistent CTA is assumed to
+  occupy one SM, so the load of a CTA is the predicted busy time of its SM.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <ostream>
+#include <stdexcept>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/fast_math.h"
+#include "cutlass/gemm_coord.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/gemm/group_array_problem_shape.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+
+#include "cute/layout.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Cost of a single output tile, in units of one mainloop K-tile iteration
+struct GroupedGemmTileCostModel {
+
+  /// Cost of one mainloop iteration over a K tile
+  double k_tile_cost = 1.0;
+
+  /// Fixed cost of each output tile: scheduling, prologue and epilogue
+  double tile_overhead = 2.0;
+
+  double operator()(int k_tiles) const {
+    return tile_overhead + k_tile_cost * double(k_tiles);
+  }
+};
+
+/// Output tile visited by the group scheduler
+struct GroupedGemmPlannedTile {
+  int32_t group = 0;
+  int32_t m = 0;                  ///< tile coordinate within the group along M
+  int32_t n = 0;                  ///< tile coordinate within the group along N
+  int32_t cta = 0;                ///< persistent CTA that computes the tile
+  bool padding = false;           ///< tile lies entirely outside the problem (cluster rounding)
+};
+
+/// Scheduling of one group
+struct GroupedGemmPlannedGroup {
+  gemm::GemmCoord problem_size;
+  int tiles_m = 0;                ///< output tiles along M, rounded up to the cluster shape
+  int tiles_n = 0;                ///< output tiles along N, rounded up to the cluster shape
+  int k_tiles = 0;
+  uint64_t start_linear_idx = 0;  ///< linear index of the group's first tile
+
+  uint64_t tiles() const {
+    return uint64_t(tiles_m) * uint64_t(tiles_n);
+  }
+};
+
+/// Predicted tile assignment and per-CTA load of a grouped GEMM
+struct GroupedGemmPlan {
+
+  using RasterOrder = gemm::kernel::detail::RasterOrder;
+
+  RasterOrder raster_order = RasterOrder::AlongN;
+  int log_swizzle_size = 0;
+
+  /// Number of persistent CTAs launched
+  int grid_size = 0;
+
+  std::vector<GroupedGemmPlannedGroup> groups;
+
+  /// Tiles in linear scheduling order. Only populated when requested from the planner.
+  std::vector<GroupedGemmPlannedTile> tiles;
+
+  /// Predicted load and tile count of each persistent CTA
+  std::vector<double> cta_load;
+  std::vector<int64_t> cta_tiles;
+
+  /// Multiply-accumulates of the problems, and those issued including tile padding
+  double useful_macs = 0;
+  double issued_macs = 0;
+
+  uint64_t total_tiles() const {
+    return groups.empty() ? 0 : groups.back().start_linear_idx + groups.back().tiles();
+  }
+
+  double total_load() const {
+    return std::accumulate(cta_load.begin(), cta_load.end(), 0.0);
+  }
+
+  /// Predicted duration of the kernel: the load of the busiest CTA
+  double makespan() const {
+    return cta_load.empty() ? 0.0 : *std::max_element(cta_load.begin(), cta_load.end());
+  }
+
+  double mean_load() const {
+    return cta_load.empty() ? 0.0 : total_load() / double(cta_load.size());
+  }
+
+  /// Ratio of the makespan to the mean CTA load. 1 is a perfectly balanced schedule.
+  double imbalance() const {
+    double mean = mean_load();
+    return mean > 0 ? makespan() / mean : 1.0;
+  }
+
+  /// Fraction of issued MMA work that contributes to the output
+  double padding_efficiency() const {
+    return issued_macs > 0 ? useful_macs / issued_macs : 1.0;
+  }
+};
+
+inline std::ostream &operator<<(std::ostream &out, GroupedGemmPlan const &plan) {
+  return out
+    << "groups: " << plan.groups.size()
+    << ", tiles: " << plan.total_tiles()
+    << ", grid: " << plan.grid_size
+    << ", raster: " << (plan.raster_order == GroupedGemmPlan::RasterOrder::AlongN ? "N" : "M")
+    << ", makespan: " << plan.makespan()
+    << ", mean load: " << plan.mean_load()
+    << ", imbalance: " << plan.imbalance()
+    << ", padding efficiency: " << plan.padding_efficiency();
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Replays the SM90 grouped GEMM tile scheduler on the host
+class GroupedGemmPlanner {
+public:
+
+  using RasterOrder = gemm::kernel::detail::RasterOrder;
+  using RasterOrderOptions = gemm::kernel::detail::RasterOrderOptions;
+  using ProblemShape = gemm::GroupProblemShape<cute::Shape<int, int, int>>;
+  using Params = gemm::kernel::detail::PersistentTileSchedulerSm90GroupParams<ProblemShape>;
+
+private:
+
+  gemm::GemmCoord tile_shape_;
+  gemm::GemmCoord cluster_shape_;
+  KernelHardwareInfo hw_info_;
+  int max_swizzle_size_;
+  RasterOrderOptions raster_order_option_;
+  GroupedGemmTileCostModel cost_model_;
+
+public:
+
+  GroupedGemmPlanner(
+    gemm::GemmCoord tile_shape,
+    gemm::GemmCoord cluster_shape,
+    KernelHardwareInfo const &hw_info,
+    int max_swizzle_size = 1,
+    RasterOrderOptions raster_order_option = RasterOrderOptions::Heuristic,
+    GroupedGemmTileCostModel const &cost_model = GroupedGemmTileCostModel()
+  ):
+    tile_shape_(tile_shape), cluster_shape_(cluster_shape), hw_info_(hw_info),
+    max_swizzle_size_(max_swizzle_size), raster_order_option_(raster_order_option), cost_model_(cost_model) {
+
+    if (hw_info_.sm_count <= 0) {
+      throw std::invalid_argument("GroupedGemmPlanner: KernelHardwareInfo::sm_count must be set");
+    }
+    if (tile_shape_.m() <= 0 || tile_shape_.n() <= 0 || tile_shape_.k() <= 0 ||
+        cluster_shape_.m() <= 0 || cluster_shape_.n() <= 0) {
+      throw std::invalid_argument("GroupedGemmPlanner: tile and cluster shapes must be positive");
+    }
+  }
+
+  /// Problem sizes of the per-expert GEMMs of a mixture-of-experts layer. Each expert multiplies
+  /// its routed tokens (tokens x k) by its weights (k x n). With `tokens_along_n`, tokens map to
+  /// the N mode instead, as in kernels that swap the A and B operands.
+  static std::vector<gemm::GemmCoord> moe_problem_sizes(
+    std::vector<int> const &tokens_per_expert,
+    int n,
+    int k,
+    bool tokens_along_n = false) {
+
+    std::vector<gemm::GemmCoord> problems;
+    problems.reserve(tokens_per_expert.size());
+    for (int tokens : tokens_per_expert) {
+      if (tokens < 0) {
+        throw std::invalid_argument("GroupedGemmPlanner: token counts must be non-negative");
+      }
+      problems.push_back(tokens_along_n ? gemm::GemmCoord(n, tokens, k) : gemm::GemmCoord(tokens, n, k));
+    }
+    return problems;
+  }
+
+  /// Computes the tile assignment and predicted per-CTA load. Recording every tile costs memory
+  /// proportional to the number of tiles and is only needed to inspect the assignment itself.
+  GroupedGemmPlan plan(std::vector<gemm::GemmCoord> const &problem_sizes, bool record_tiles = false) const {
+
+    GroupedGemmPlan plan;
+
+    // Mirrors PersistentTileSchedulerSm90Group::get_tiled_cta_shape_mnl(): tiles of all groups are
+    // linearized along M with a single tile along N.
+    uint32_t total_ctas = 0;
+    for (gemm::GemmCoord const &problem : problem_sizes) {
+      int ctas_m = ceil_div(problem.m(), tile_shape_.m());
+      int ctas_n = ceil_div(problem.n(), tile_shape_.n());
+      total_ctas += uint32_t(round_up(ctas_m, cluster_shape_.m()) * round_up(ctas_n, cluster_shape_.n()));
+    }
+
+    dim3 problem_blocks = Params::get_tiled_cta_shape_mnl(cluster_shape_, total_ctas, 1);
+
+    plan.log_swizzle_size = Params::get_log_swizzle_size(problem_blocks.x, problem_blocks.y, max_swizzle_size_);
+    int swizzle = 1 << plan.log_swizzle_size;
+
+    plan.raster_order = Params::get_rasterization_order(
+      round_up(problem_blocks.x, swizzle * cluster_shape_.m()),
+      round_up(problem_blocks.y, swizzle * cluster_shape_.n()),
+      raster_order_option_);
+
+    dim3 grid = Params::get_grid_shape(
+      problem_blocks, cluster_shape_, hw_info_, max_swizzle_size_, raster_order_option_);
+
+    plan.grid_size = std::max(1, int(grid.x * grid.y * grid.z));
+    plan.cta_load.assign(plan.grid_size, 0.0);
+    plan.cta_tiles.assign(plan.grid_size, 0);
+
+    // Mirrors the per-group tile counts of PersistentTileSchedulerSm90Group::get_work_idx_m_and_n()
+    uint64_t start = 0;
+    for (gemm::GemmCoord const &problem : problem_sizes) {
+      GroupedGemmPlannedGroup group;
+      group.problem_size = problem;
+      group.tiles_m = round_up(ceil_div(problem.m(), tile_shape_.m()), swizzle * cluster_shape_.m());
+      group.tiles_n = round_up(ceil_div(problem.n(), tile_shape_.n()), swizzle * cluster_shape_.n());
+      group.k_tiles = ceil_div(problem.k(), tile_shape_.k());
+      group.start_linear_idx = start;
+      start += group.tiles();
+      plan.groups.push_back(group);
+
+      plan.useful_macs += double(problem.m()) * double(problem.n()) * double(problem.k());
+      plan.issued_macs += double(group.tiles()) * double(tile_shape_.m()) * double(tile_shape_.n()) *
+                          double(group.k_tiles) * double(tile_shape_.k());
+    }
+
+    if (record_tiles) {
+      plan.tiles.reserve(size_t(start));
+    }
+
+    for (int32_t g = 0; g < int32_t(plan.groups.size()); ++g) {
+      GroupedGemmPlannedGroup const &group = plan.groups[g];
+      double cost = cost_model_(group.k_tiles);
+
+      for (uint64_t linear_idx = group.start_linear_idx;
+           linear_idx < group.start_linear_idx + group.tiles(); ++linear_idx) {
+
+        int cta = int(linear_idx % uint64_t(plan.grid_size));
+        plan.cta_load[cta] += cost;
+        plan.cta_tiles[cta] += 1;
+
+        if (record_tiles) {
+          GroupedGemmPlannedTile tile = tile_coord(plan, g, linear_idx);
+          tile.cta = cta;
+          plan.tiles.push_back(tile);
+        }
+      }
+    }
+
+    return plan;
+  }
+
+  /// Coordinate of the tile with the given linear index within group `group_idx`. Mirrors the
+  /// swizzle and cluster index math of PersistentTileSchedulerSm90Group::get_work_idx_m_and_n().
+  GroupedGemmPlannedTile tile_coord(GroupedGemmPlan const &plan, int32_t group_idx, uint64_t linear_idx) const {
+
+    GroupedGemmPlannedGroup const &group = plan.groups.at(group_idx);
+
+    bool along_n = plan.raster_order == RasterOrder::AlongN;
+    uint64_t cluster_minor = uint64_t(along_n ? cluster_shape_.m() : cluster_shape_.n());
+    uint64_t cluster_major = uint64_t(along_n ? cluster_shape_.n() : cluster_shape_.m());
+    uint64_t blocks_along_raster_order = uint64_t(along_n ? group.tiles_n : group.tiles_m);
+
+    uint64_t blk_per_grid_dim = (linear_idx - group.start_linear_idx) / cluster_minor;
+    uint64_t cluster_id = blk_per_grid_dim / cluster_major;
+    uint64_t cluster_major_offset = blk_per_grid_dim % cluster_major;
+
+    // The launched grid places one cluster along the minor mode, so the device reads this offset
+    // from blockIdx, which equals the linear index modulo the cluster extent.
+    uint64_t cluster_minor_offset = linear_idx % cluster_minor;
+
+    uint64_t offset = cluster_id & ((uint64_t(1) << plan.log_swizzle_size) - 1);
+    uint64_t extra = cluster_id >> plan.log_swizzle_size;
+    uint64_t group_cluster_blk_major = blocks_along_raster_order / cluster_major;
+
+    uint64_t cluster_idx_minor = (extra / group_cluster_blk_major) * (uint64_t(1) << plan.log_swizzle_size) + offset;
+    uint64_t cluster_idx_major = extra % group_cluster_blk_major;
+
+    int32_t minor_work_idx = int32_t(cluster_idx_minor * cluster_minor + cluster_minor_offset);
+    int32_t major_work_idx = int32_t(cluster_idx_major * cluster_major + cluster_major_offset);
+
+    GroupedGemmPlannedTile tile;
+    tile.group = group_idx;
+    tile.m = along_n ? minor_work_idx : major_work_idx;
+    tile.n = along_n ? major_work_idx : minor_work_idx;
+    tile.padding = int64_t(tile.m) * tile_shape_.m() >= group.problem_size.m() ||
+                   int64_t(tile.n) * tile_shape_.n() >= group.problem_size.n();
+    return tile;
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,363 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+  \brief Allocation policies for host-side tensor storage.
+
+  HostAllocator is a standard allocator whose behavior is selected by a set of HostAllocation
+  flags. It is intended as the HostAllocator_ argument of HostTensor for very large host tensors,
+  where zero-filling and first-touch page faults on a single thread dominate setup time:
+
+    using Allocator = cutlass::HostAllocator<float,
+      cutlass::HostAllocation::kUninitialized |
+      cutlass::HostAllocation::kTransparentHugePages |
+      cutlass::HostAllocation::kParallelFirstTouch>;
+
+    cutlass::HostTensor<float, cutlass::layout::RowMajor, Allocator> tensor({M, N});
+
+  Huge pages and parallel first-touch rely on mmap() and madvise() and are ignored on platforms
+  without them. Allocations smaller than kMappedAllocationThreshold always use operator new.
+*/
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "cutlass/cutlass.h"
+#include "cutlass/util/host_thread_pool.h"
+
+namespace cutlass {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Flags selecting the behavior of HostAllocator
+struct HostAllocation {
+
+  /// std::allocator behavior: elements are value-initialized by the container
+  static constexpr unsigned kDefault = 0;
+
+  /// Elements are default-initialized, so trivially constructible elements are left uninitialized
+  /// instead of being zero-filled on resize.
+  static constexpr unsigned kUninitialized = 1u << 0;
+
+  /// Requests transparent huge pages for mapped allocations with madvise(MADV_HUGEPAGE)
+  static constexpr unsigned kTransparentHugePages = 1u << 1;
+
+  /// Maps allocations from the hugetlbfs pool (MAP_HUGETLB), falling back to transparent huge
+  /// pages if no huge pages are reserved
+  static constexpr unsigned kExplicitHugePages = 1u << 2;
+
+  /// Pages of new allocations are touched by the threads of the shared host thread pool, so that a
+  /// first-touch NUMA policy spreads them across the nodes of the threads that later process them.
+  static constexpr unsigned kParallelFirstTouch = 1u << 3;
+
+  /// Freed allocations are cached and reused by later allocations of a similar size instead of
+  /// being returned to the system. See HostAllocationArena.
+  static constexpr unsigned kArena = 1u << 4;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Raw memory source shared by all HostAllocator instances with the same flags
+template <unsigned kFlags>
+struct HostMemorySource {
+
+  /// Allocations at least this large are mapped directly when huge pages or first-touch are requested
+  static constexpr size_t kMappedAllocationThreshold = size_t(2) << 20;
+
+  /// Alignment and rounding granularity of mapped allocations
+  static constexpr size_t kHugePageBytes = size_t(2) << 20;
+
+  static constexpr bool kMapped =
+    (kFlags & (HostAllocation::kTransparentHugePages |
+               HostAllocation::kExplicitHugePages |
+               HostAllocation::kParallelFirstTouch)) != 0;
+
+  static bool is_mapped(size_t bytes) {
+#if defined(__linux__)
+    return kMapped && bytes >= kMappedAllocationThreshold;
+#else
+    return false;
+#endif
+  }
+
+  /// Number of bytes actually reserved for a request of `bytes`
+  static size_t allocation_size(size_t bytes) {
+    if (is_mapped(bytes)) {
+      return (bytes + kHugePageBytes - 1) / kHugePageBytes * kHugePageBytes;
+    }
+    return bytes;
+  }
+
+  /// Allocates `bytes` aligned to `alignment`. Mapped allocations are aligned to pages.
+  static void *allocate(size_t bytes, size_t alignment) {
+
+    if (!is_mapped(bytes)) {
+      return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+#if defined(__linux__)
+    size_t size = allocation_size(bytes);
+    void *ptr = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    if (kFlags & HostAllocation::kExplicitHugePages) {
+      ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    }
+#endif
+
+    if (ptr == MAP_FAILED) {
+      ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (ptr == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+#if defined(MADV_HUGEPAGE)
+      if (kFlags & (HostAllocation::kTransparentHugePages | HostAllocation::kExplicitHugePages)) {
+        madvise(ptr, size, MADV_HUGEPAGE);
+      }
+#endif
+    }
+
+    if (kFlags & HostAllocation::kParallelFirstTouch) {
+      first_touch(static_cast<char *>(ptr), size);
+    }
+
+    return ptr;
+#else
+    return ::operator new(bytes, std::align_val_t(alignment));
+#endif
+  }
+
+  static void deallocate(void *ptr, size_t bytes, size_t alignment) {
+    if (!is_mapped(bytes)) {
+      ::operator delete(ptr, std::align_val_t(alignment));
+      return;
+    }
+#if defined(__linux__)
+    munmap(ptr, allocation_size(bytes));
+#endif
+  }
+
+  /// Writes one byte of every page, splitting the range across the shared host thread pool.
+  /// Anonymous mappings are zero until first written, so the contents are unchanged.
+  static void first_touch(char *ptr, size_t bytes) {
+
+    size_t const page = (kFlags & (HostAllocation::kTransparentHugePages | HostAllocation::kExplicitHugePages)) ?
+      kHugePageBytes : size_t(4096);
+
+    int64_t pages = int64_t((bytes + page - 1) / page);
+    HostThreadPool &pool = host_thread_pool();
+    int64_t grain = std::max<int64_t>(1, pages / pool.num_threads());
+
+    pool.parallel_for(pages, [=](int64_t begin, int64_t end) {
+      for (int64_t p = begin; p < end; ++p) {
+        reinterpret_cast<char volatile *>(ptr)[p * page] = 0;
+      }
+    }, grain);
+  }
+};
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Process-wide cache of freed host allocations, shared by all HostAllocator instances with the
+/// same flags. A cached block is reused for a request of up to its size and at least half its size
+/// whose alignment it satisfies.
+template <unsigned kFlags>
+class HostAllocationArena {
+public:
+
+  using Source = detail::HostMemorySource<kFlags>;
+
+  /// The arena is never destroyed, so that containers with static storage duration may return
+  /// their memory to it during program exit
+  static HostAllocationArena &instance() {
+    static HostAllocationArena *arena = new HostAllocationArena();
+    return *arena;
+  }
+
+  void *allocate(size_t bytes, size_t alignment) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = free_.lower_bound(bytes); it != free_.end() && it->first / 2 <= bytes; ++it) {
+        if (it->second.alignment >= alignment) {
+          void *ptr = it->second.ptr;
+          live_[ptr] = Block{it->first, it->second.alignment};
+          cached_bytes_ -= it->first;
+          free_.erase(it);
+          return ptr;
+        }
+      }
+    }
+
+    size_t size = Source::allocation_size(bytes);
+    void *ptr = Source::allocate(size, alignment);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    live_[ptr] = Block{size, alignment};
+    return ptr;
+  }
+
+  void deallocate(void *ptr) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = live_.find(ptr);
+    if (it == live_.end()) {
+      return;
+    }
+    free_.emplace(it->second.size, FreeBlock{ptr, it->second.alignment});
+    cached_bytes_ += it->second.size;
+    live_.erase(it);
+  }
+
+  /// Returns all cached blocks to the system
+  void release() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto const &block : free_) {
+      Source::deallocate(block.second.ptr, block.first, block.second.alignment);
+    }
+    free_.clear();
+    cached_bytes_ = 0;
+  }
+
+  /// Bytes held in freed blocks awaiting reuse
+  size_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+private:
+
+  struct Block {
+    size_t size;
+    size_t alignment;
+  };
+
+  struct FreeBlock {
+    void *ptr;
+    size_t alignment;
+  };
+
+  HostAllocationArena() = default;
+
+  mutable std::mutex mutex_;
+  std::multimap<size_t, FreeBlock> free_;
+  std::unordered_map<void *, Block> live_;
+  size_t cached_bytes_ = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Standard allocator with selectable host allocation policy
+template <typename T, unsigned kFlags_ = HostAllocation::kDefault>
+class HostAllocator {
+public:
+
+  using value_type = T;
+
+  static constexpr unsigned kFlags = kFlags_;
+
+  template <typename U>
+  struct rebind {
+    using other = HostAllocator<U, kFlags>;
+  };
+
+  HostAllocator() noexcept = default;
+
+  template <typename U>
+  HostAllocator(HostAllocator<U, kFlags> const &) noexcept { }
+
+  T *allocate(size_t count) {
+    if (count > size_t(-1) / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    size_t bytes = count * sizeof(T);
+    if (kFlags & HostAllocation::kArena) {
+      return static_cast<T *>(HostAllocationArena<kFlags>::instance().allocate(bytes, alignof(T)));
+    }
+    return static_cast<T *>(detail::HostMemorySource<kFlags>::allocate(bytes, alignof(T)));
+  }
+
+  void deallocate(T *ptr, size_t count) noexcept {
+    if (kFlags & HostAllocation::kArena) {
+      HostAllocationArena<kFlags>::instance().deallocate(ptr);
+    }
+    else {
+      detail::HostMemorySource<kFlags>::deallocate(ptr, count * sizeof(T), alignof(T));
+    }
+  }
+
+  /// Default-initializes instead of value-initializing when kUninitialized is set
+  template <typename U>
+  void construct(U *ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    if constexpr ((kFlags & HostAllocation::kUninitialized) != 0) {
+      ::new (static_cast<void *>(ptr)) U;
+    }
+    else {
+      ::new (static_cast<void *>(ptr)) U();
+    }
+  }
+
+  template <typename U, typename... Args>
+  void construct(U *ptr, Args &&... args) {
+    ::new (static_cast<void *>(ptr)) U(std::forward<Args>(args)...);
+  }
+
+  template <typename U>
+  bool operator==(HostAllocator<U, kFlags> const &) const noexcept {
+    return true;
+  }
+
+  template <typename U>
+  bool operator!=(HostAllocator<U, kFlags> const &) const noexcept {
+    return false;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,893 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+  \brief Executes CUDA threadblocks of CUTLASS kernels on the host.
+
+  Each emulated CUDA thread runs as a fiber (POSIX ucontext) or as an OS thread. Threads of a block
+  share an emulated shared memory buffer and synchronize through __syncthreads(), __syncwarp() and
+  the __shfl*_sync() family. Blocks of the grid are distributed across the shared host thread pool
+  (cutlass/util/host_thread_pool.h).
+
+  Kernels written with CUTLASS_HOST_DEVICE / CUTLASS_DEVICE building blocks, such as CUTLASS 2.x
+  SIMT GEMMs composed from DefaultGemm with OpClassSimt, can then be tested on machines without a
+  GPU and profiled with host tools:
+
+    #include "cutlass/util/host_emulation.h"     // must precede all other CUTLASS headers
+    #include "cutlass/gemm/kernel/default_gemm.h"
+
+    using GemmKernel = typename cutlass::gemm::kernel::DefaultGemm<...,
+      cutlass::arch::OpClassSimt, cutlass::arch::Sm50, ...>::GemmKernel;
+
+    typename GemmKernel::Params params(problem_size, grid_tiled_shape, ref_A, ref_B, ref_C, ref_D,
+                                       {alpha, beta});
+
+    cutlass::emulation::launch_kernel<GemmKernel>(
+      threadblock_swizzle.get_grid_shape(grid_tiled_shape), dim3(GemmKernel::kThreadCount, 1, 1),
+      params);
+
+  Pointers in Params refer to host memory. The translation unit must be compiled by a host
+  compiler, since CUTLASS_DEVICE functions are only callable from the host when __CUDACC__ is not
+  defined, and must not include device-level adapters that launch kernels with <<<...>>>.
+  Defining CUTLASS_HOST_EMULATION selects plain C++ implementations of the global memory
+  accesses and warp intrinsics that otherwise rely on inline PTX. CUTLASS headers reach this
+  runtime only through the functions declared in cutlass/host_emulation_hooks.h.
+
+  threadIdx, blockIdx, blockDim and gridDim are thread-local variables holding the coordinates of
+  the emulated thread scheduled on the calling host thread, so device_launch_parameters.h must not
+  be included.
+
+  Warp intrinsics synchronize all live threads of the warp and ignore their mask argument. Paths
+  guarded by __CUDA_ARCH__, such as tensor core MMAs and cp.async, are not emulated.
+*/
+
+#if defined(__CUDACC__)
+#error "cutlass/util/host_emulation.h must be compiled by a host compiler"
+#endif
+
+#if defined(CUTLASS_HOST_DEVICE)
+#error "cutlass/util/host_emulation.h must be included before other CUTLASS headers"
+#endif
+
+#define CUTLASS_HOST_EMULATION 1
+
+#include <cuda_runtime.h>
+#include <cuda_fp16.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <climits>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__linux__)
+#include <ucontext.h>
+#define CUTLASS_HOST_EMULATION_FIBERS 1
+#endif
+
+#include "cutlass/host_emulation_hooks.h"
+#include "cutlass/util/host_thread_pool.h"
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CUDA built-in variables
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline thread_local uint3 threadIdx = {0, 0, 0};
+inline thread_local uint3 blockIdx = {0, 0, 0};
+inline thread_local dim3 blockDim;
+inline thread_local dim3 gridDim;
+
+namespace cutlass {
+namespace emulation {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// How the threads of a block are executed
+enum class Backend {
+  /// All threads of a block run as fibers on one worker thread, switching at barriers. This is
+  /// deterministic and keeps each block on a single OS thread for host profilers.
+  kFibers,
+  /// Each thread of a block runs on its own OS thread
+  kThreads
+};
+
+struct LaunchOptions {
+
+#if defined(CUTLASS_HOST_EMULATION_FIBERS)
+  Backend backend = Backend::kFibers;
+#else
+  Backend backend = Backend::kThreads;
+#endif
+
+  /// Number of blocks executed concurrently, at most the number of threads of the shared host
+  /// thread pool. A value <= 0 uses all threads of the pool.
+  int num_workers = 0;
+
+  /// Stack size of each fiber
+  size_t fiber_stack_bytes = size_t(256) << 10;
+
+  /// Byte written to every byte of shared memory before each block runs, or a negative value to
+  /// leave it unchanged from the previous block. The default fills floating-point data with NaN so
+  /// that reads of uninitialized shared memory surface in the results.
+  int shared_memory_fill = 0xff;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+class BlockState;
+
+/// Per-thread view of the built-in variables
+struct ThreadContext {
+  uint3 thread_idx;
+  uint3 block_idx;
+  dim3 block_dim;
+  dim3 grid_dim;
+  int linear_idx;
+  BlockState *block;
+};
+
+inline ThreadContext *&current_context() {
+  static thread_local ThreadContext *context = nullptr;
+  return context;
+}
+
+inline ThreadContext &current() {
+  ThreadContext *context = current_context();
+  if (!context) {
+    throw std::logic_error("CUDA built-in variable or intrinsic used outside of an emulated kernel");
+  }
+  return *context;
+}
+
+/// Schedules the emulated thread `context` on the calling host thread, or none if null
+inline void bind(ThreadContext *context) {
+  current_context() = context;
+  if (context) {
+    ::threadIdx = context->thread_idx;
+    ::blockIdx = context->block_idx;
+    ::blockDim = context->block_dim;
+    ::gridDim = context->grid_dim;
+  }
+}
+
+/// Synchronization state of one block
+class BlockState {
+public:
+
+  static constexpr int kWarpSize = 32;
+
+  /// Bytes exchanged per thread by a warp shuffle
+  static constexpr size_t kExchangeBytes = 16;
+
+  explicit BlockState(int thread_count):
+    thread_count_(thread_count),
+    exchange_(size_t(thread_count)) { }
+
+  virtual ~BlockState() { }
+
+  /// Runs body() on every thread of the block and returns once all have exited
+  virtual void run(ThreadContext const &prototype, std::function<void()> const &body) = 0;
+
+  virtual void sync_block(ThreadContext &context) = 0;
+
+  virtual void sync_warp(ThreadContext &context) = 0;
+
+  unsigned char *exchange_slot(int linear_idx) {
+    return exchange_[size_t(linear_idx)].data();
+  }
+
+  /// Called by a thread after it returns from the kernel
+  void clear_exchange_slot(int linear_idx) {
+    exchange_[size_t(linear_idx)].fill(0);
+  }
+
+  int thread_count() const {
+    return thread_count_;
+  }
+
+  int warp_count() const {
+    return (thread_count_ + kWarpSize - 1) / kWarpSize;
+  }
+
+protected:
+
+  /// Creates the contexts of all threads from a prototype holding block_idx and the dimensions
+  std::vector<ThreadContext> make_contexts_(ThreadContext const &prototype) {
+    std::vector<ThreadContext> contexts(size_t(thread_count_), prototype);
+    for (auto &slot : exchange_) {
+      slot.fill(0);
+    }
+    for (int i = 0; i < thread_count_; ++i) {
+      ThreadContext &context = contexts[size_t(i)];
+      context.linear_idx = i;
+      context.thread_idx.x = unsigned(i) % prototype.block_dim.x;
+      context.thread_idx.y = unsigned(i) / prototype.block_dim.x % prototype.block_dim.y;
+      context.thread_idx.z = unsigned(i) / (prototype.block_dim.x * prototype.block_dim.y);
+      context.block = this;
+    }
+    return contexts;
+  }
+
+  int thread_count_;
+  std::vector<std::array<unsigned char, kExchangeBytes>> exchange_;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Runs each thread of a block on its own OS thread. Threads of a block wait for each other at
+/// barriers, so they cannot share the bounded host thread pool. The calling thread runs thread 0
+/// and a team of thread_count - 1 OS threads, created once and reused by every block run on this
+/// state, runs the others.
+class ThreadedBlock : public BlockState {
+public:
+
+  explicit ThreadedBlock(int thread_count):
+    BlockState(thread_count),
+    block_barrier_{thread_count, 0, 0},
+    warp_barriers_(size_t(warp_count())) {
+
+    team_.reserve(size_t(thread_count - 1));
+    for (int i = 1; i < thread_count; ++i) {
+      team_.emplace_back([this, i] {
+        uint64_t seen = 0;
+        while (true) {
+          {
+            std::unique_lock<std::mutex> lock(team_mutex_);
+            team_wake_.wait(lock, [&] { return stop_ || launch_ != seen; });
+            if (stop_) {
+              return;
+            }
+            seen = launch_;
+          }
+          run_thread_(size_t(i));
+          std::lock_guard<std::mutex> lock(team_mutex_);
+          if (--running_ == 0) {
+            team_done_.notify_all();
+          }
+        }
+      });
+    }
+  }
+
+  ~ThreadedBlock() {
+    {
+      std::lock_guard<std::mutex> lock(team_mutex_);
+      stop_ = true;
+    }
+    team_wake_.notify_all();
+    for (auto &thread : team_) {
+      thread.join();
+    }
+  }
+
+  void run(ThreadContext const &prototype, std::function<void()> const &body) override {
+
+    contexts_ = make_contexts_(prototype);
+    errors_.assign(contexts_.size(), nullptr);
+    body_ = &body;
+
+    block_barrier_ = Barrier{thread_count(), 0, 0};
+    for (int w = 0; w < warp_count(); ++w) {
+      warp_barriers_[size_t(w)] = Barrier{std::min(kWarpSize, thread_count() - w * kWarpSize), 0, 0};
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(team_mutex_);
+      running_ = team_.size();
+      ++launch_;
+    }
+    team_wake_.notify_all();
+
+    run_thread_(0);
+
+    {
+      std::unique_lock<std::mutex> lock(team_mutex_);
+      team_done_.wait(lock, [&] { return running_ == 0; });
+    }
+
+    for (auto &error : errors_) {
+      if (error) {
+        std::rethrow_exception(error);
+      }
+    }
+  }
+
+  void sync_block(ThreadContext &) override {
+    arrive_and_wait_(block_barrier_);
+  }
+
+  void sync_warp(ThreadContext &context) override {
+    arrive_and_wait_(warp_barriers_[size_t(context.linear_idx / kWarpSize)]);
+  }
+
+private:
+
+  struct Barrier {
+    int live;
+    int arrived;
+    uint64_t generation;
+  };
+
+  void arrive_and_wait_(Barrier &barrier) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    uint64_t generation = barrier.generation;
+    if (++barrier.arrived == barrier.live) {
+      release_(barrier);
+      return;
+    }
+    released_.wait(lock, [&] { return barrier.generation != generation; });
+  }
+
+  void release_(Barrier &barrier) {
+    barrier.arrived = 0;
+    ++barrier.generation;
+    released_.notify_all();
+  }
+
+  /// Exited threads no longer participate in barriers
+  void exit_(ThreadContext const &context) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    clear_exchange_slot(context.linear_idx);
+    for (Barrier *barrier : {&block_barrier_, &warp_barriers_[size_t(context.linear_idx / kWarpSize)]}) {
+      --barrier->live;
+      if (barrier->arrived > 0 && barrier->arrived == barrier->live) {
+        release_(*barrier);
+      }
+    }
+  }
+
+  /// Runs emulated thread `i` of the current block on the calling thread
+  void run_thread_(size_t i) {
+    bind(&contexts_[i]);
+    try {
+      (*body_)();
+    }
+    catch (...) {
+      errors_[i] = std::current_exception();
+    }
+    exit_(contexts_[i]);
+    bind(nullptr);
+  }
+
+  std::mutex mutex_;
+  std::condition_variable released_;
+  Barrier block_barrier_;
+  std::vector<Barrier> warp_barriers_;
+
+  std::vector<ThreadContext> contexts_;
+  std::vector<std::exception_ptr> errors_;
+  std::function<void()> const *body_ = nullptr;
+
+  std::mutex team_mutex_;
+  std::condition_variable team_wake_;
+  std::condition_variable team_done_;
+  std::vector<std::thread> team_;
+  uint64_t launch_ = 0;
+  size_t running_ = 0;
+  bool stop_ = false;
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if defined(CUTLASS_HOST_EMULATION_FIBERS)
+
+/// Runs all threads of a block as fibers on the calling thread. Each pass of the scheduler resumes
+/// every runnable fiber until it reaches a barrier or exits, then releases satisfied barriers.
+class FiberBlock : public BlockState {
+public:
+
+  FiberBlock(int thread_count, size_t stack_bytes):
+    BlockState(thread_count),
+    stack_bytes_(stack_bytes),
+    fibers_(size_t(thread_count)) { }
+
+  void run(ThreadContext const &prototype, std::function<void()> const &body) override {
+
+    std::vector<ThreadContext> contexts = make_contexts_(prototype);
+    body_ = &body;
+
+    for (size_t i = 0; i < fibers_.size(); ++i) {
+      Fiber &fiber = fibers_[i];
+      if (!fiber.stack) {
+        fiber.stack.reset(new char[stack_bytes_]);
+      }
+      fiber.state = State::kRunnable;
+      fiber.error = nullptr;
+      fiber.context_ptr = &contexts[i];
+      getcontext(&fiber.context);
+      fiber.context.uc_stack.ss_sp = fiber.stack.get();
+      fiber.context.uc_stack.ss_size = stack_bytes_;
+      fiber.context.uc_link = &scheduler_;
+      makecontext(&fiber.context, &FiberBlock::entry_, 0);
+    }
+
+    FiberBlock *previous = active_();
+    active_() = this;
+
+    size_t live = fibers_.size();
+    while (live > 0) {
+
+      for (size_t i = 0; i < fibers_.size(); ++i) {
+        if (fibers_[i].state != State::kRunnable) {
+          continue;
+        }
+        running_ = i;
+        bind(fibers_[i].context_ptr);
+        swapcontext(&scheduler_, &fibers_[i].context);
+        bind(nullptr);
+        if (fibers_[i].state == State::kFinished) {
+          --live;
+        }
+      }
+
+      if (live > 0 && !release_barriers_()) {
+        active_() = previous;
+        throw std::runtime_error("Emulated block deadlocked: threads wait at barriers that cannot be satisfied");
+      }
+    }
+
+    active_() = previous;
+
+    for (Fiber &fiber : fibers_) {
+      if (fiber.error) {
+        std::rethrow_exception(fiber.error);
+      }
+    }
+  }
+
+  void sync_block(ThreadContext &context) override {
+    yield_(context, State::kBlockBarrier);
+  }
+
+  void sync_warp(ThreadContext &context) override {
+    yield_(context, State::kWarpBarrier);
+  }
+
+private:
+
+  enum class State {
+    kRunnable,
+    kBlockBarrier,
+    kWarpBarrier,
+    kFinished
+  };
+
+  struct Fiber {
+    ucontext_t context;
+    std::unique_ptr<char[]> stack;
+    State state = State::kFinished;
+    ThreadContext *context_ptr = nullptr;
+    std::exception_ptr error;
+  };
+
+  static FiberBlock *&active_() {
+    static thread_local FiberBlock *block = nullptr;
+    return block;
+  }
+
+  static void entry_() {
+    FiberBlock *self = active_();
+    Fiber &fiber = self->fibers_[self->running_];
+    try {
+      (*self->body_)();
+    }
+    catch (...) {
+      fiber.error = std::current_exception();
+    }
+    self->clear_exchange_slot(int(self->running_));
+    fiber.state = State::kFinished;
+    // Returning resumes uc_link, the scheduler
+  }
+
+  void yield_(ThreadContext &context, State state) {
+    Fiber &fiber = fibers_[size_t(context.linear_idx)];
+    fiber.state = state;
+    swapcontext(&fiber.context, &scheduler_);
+    bind(&context);
+  }
+
+  /// Makes fibers at satisfied barriers runnable. Returns false if none could be released.
+  bool release_barriers_() {
+
+    bool released = false;
+
+    for (int w = 0; w < warp_count(); ++w) {
+      size_t begin = size_t(w) * kWarpSize;
+      size_t end = std::min(fibers_.size(), begin + kWarpSize);
+      bool waiting = false;
+      bool satisfied = true;
+      for (size_t i = begin; i < end; ++i) {
+        waiting |= fibers_[i].state == State::kWarpBarrier;
+        satisfied &= fibers_[i].state == State::kWarpBarrier || fibers_[i].state == State::kFinished;
+      }
+      if (waiting && satisfied) {
+        for (size_t i = begin; i < end; ++i) {
+          if (fibers_[i].state == State::kWarpBarrier) {
+            fibers_[i].state = State::kRunnable;
+          }
+        }
+        released = true;
+      }
+    }
+
+    if (released) {
+      return true;
+    }
+
+    bool waiting = false;
+    bool satisfied = true;
+    for (Fiber const &fiber : fibers_) {
+      waiting |= fiber.state == State::kBlockBarrier;
+      satisfied &= fiber.state == State::kBlockBarrier || fiber.state == State::kFinished;
+    }
+    if (waiting && satisfied) {
+      for (Fiber &fiber : fibers_) {
+        if (fiber.state == State::kBlockBarrier) {
+          fiber.state = State::kRunnable;
+        }
+      }
+      return true;
+    }
+
+    return false;
+  }
+
+  size_t stack_bytes_;
+  std::vector<Fiber> fibers_;
+  ucontext_t scheduler_;
+  size_t running_ = 0;
+  std::function<void()> const *body_ = nullptr;
+};
+
+#endif
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Source lane of a shuffle, or the calling lane if the source is outside its segment
+inline int shuffle_source(int lane, int source, int width) {
+  int segment = lane & ~(width - 1);
+  return (source >= segment && source < segment + width) ? source : lane;
+}
+
+template <typename T>
+T shuffle(T const &value, int source_lane) {
+
+  static_assert(std::is_trivially_copyable<T>::value && sizeof(T) <= BlockState::kExchangeBytes,
+                "Unsupported type for emulated warp shuffle");
+
+  ThreadContext &context = current();
+  BlockState &block = *context.block;
+
+  int warp_base = context.linear_idx / BlockState::kWarpSize * BlockState::kWarpSize;
+  int source = std::min(warp_base + source_lane, block.thread_count() - 1);
+
+  std::memcpy(block.exchange_slot(context.linear_idx), &value, sizeof(T));
+  block.sync_warp(context);
+
+  T result;
+  std::memcpy(&result, block.exchange_slot(source), sizeof(T));
+  block.sync_warp(context);
+
+  return result;
+}
+
+/// Number of threads of the block with a nonzero predicate. Threads that have exited count as zero.
+inline int reduce_block(int predicate) {
+
+  ThreadContext &context = current();
+  BlockState &block = *context.block;
+
+  int value = predicate ? 1 : 0;
+  std::memcpy(block.exchange_slot(context.linear_idx), &value, sizeof(int));
+  block.sync_block(context);
+
+  int count = 0;
+  for (int i = 0; i < block.thread_count(); ++i) {
+    int other;
+    std::memcpy(&other, block.exchange_slot(i), sizeof(int));
+    count += other;
+  }
+  block.sync_block(context);
+
+  return count;
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Definitions of cutlass/host_emulation_hooks.h
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline bool in_kernel() {
+  return detail::current_context() != nullptr;
+}
+
+inline uint3 thread_idx() {
+  return detail::current().thread_idx;
+}
+
+inline uint3 block_idx() {
+  return detail::current().block_idx;
+}
+
+inline int lane_idx() {
+  return detail::current().linear_idx % detail::BlockState::kWarpSize;
+}
+
+inline int warp_broadcast(int value, int source_lane) {
+  return detail::shuffle(value, source_lane);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Executes func(void *shared_memory) on every thread of every block of the grid
+template <typename Func>
+void launch(dim3 grid, dim3 block, size_t shared_memory_bytes, Func &&func,
+            LaunchOptions const &options = LaunchOptions()) {
+
+  size_t block_count = size_t(grid.x) * grid.y * grid.z;
+  int thread_count = int(block.x * block.y * block.z);
+  if (block_count == 0 || thread_count == 0) {
+    return;
+  }
+
+  HostThreadPool &pool = host_thread_pool();
+  size_t workers = options.num_workers > 0 ?
+    std::min(size_t(options.num_workers), size_t(pool.num_threads())) : size_t(pool.num_threads());
+  workers = std::min(workers, block_count);
+
+  std::atomic<size_t> next_block{0};
+  std::mutex error_mutex;
+  std::exception_ptr error;
+
+  auto worker = [&]() {
+
+    // A worker that starts after all blocks were claimed sets up no block state
+    size_t b = next_block++;
+    if (b >= block_count) {
+      return;
+    }
+
+    // Shared memory is allocated with the alignment of dynamic shared memory on the device
+    size_t shared_bytes = std::max<size_t>(shared_memory_bytes, 1);
+    std::unique_ptr<uint64_t[]> storage(new uint64_t[(shared_bytes + 127) / 8 + 16]);
+    void *shared_memory = reinterpret_cast<void *>(
+      (reinterpret_cast<uintptr_t>(storage.get()) + 127) / 128 * 128);
+
+    std::unique_ptr<detail::BlockState> state;
+#if defined(CUTLASS_HOST_EMULATION_FIBERS)
+    if (options.backend == Backend::kFibers) {
+      state.reset(new detail::FiberBlock(thread_count, options.fiber_stack_bytes));
+    }
+#endif
+    if (!state) {
+      state.reset(new detail::ThreadedBlock(thread_count));
+    }
+
+    std::function<void()> body = [&]() {
+      func(shared_memory);
+    };
+
+    for (; b < block_count; b = next_block++) {
+
+      {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (error) {
+          return;
+        }
+      }
+
+      detail::ThreadContext prototype;
+      prototype.block_idx.x = unsigned(b % grid.x);
+      prototype.block_idx.y = unsigned(b / grid.x % grid.y);
+      prototype.block_idx.z = unsigned(b / (size_t(grid.x) * grid.y));
+      prototype.block_dim = block;
+      prototype.grid_dim = grid;
+
+      if (options.shared_memory_fill >= 0) {
+        std::memset(shared_memory, options.shared_memory_fill, shared_memory_bytes);
+      }
+
+      try {
+        state->run(prototype, body);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(error_mutex);
+        if (!error) {
+          error = std::current_exception();
+        }
+        return;
+      }
+    }
+  };
+
+  // Each worker claims blocks until none are left
+  pool.parallel_for(int64_t(workers), [&](int64_t begin, int64_t end) {
+    for (int64_t w = begin; w < end; ++w) {
+      worker();
+    }
+  }, 1, int(workers));
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
+
+/// Executes a kernel with the interface of cutlass::Kernel<Operator>: each thread constructs an
+/// Operator and calls operator()(params, shared_storage).
+template <typename Operator>
+void launch_kernel(dim3 grid, dim3 block, typename Operator::Params const &params,
+                   LaunchOptions const &options = LaunchOptions()) {
+
+  using SharedStorage = typename Operator::SharedStorage;
+
+  launch(grid, block, sizeof(SharedStorage), [&](void *shared_memory) {
+    Operator op;
+    op(params, *reinterpret_cast<SharedStorage *>(shared_memory));
+  }, options);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace emulation
+} // namespace cutlass
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// CUDA intrinsics
+//
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// CUDA declares these overloads for device code
+using std::min;
+using std::max;
+
+inline void __syncthreads() {
+  auto &context = ::cutlass::emulation::detail::current();
+  context.block->sync_block(context);
+}
+
+inline int __syncthreads_count(int predicate) {
+  return ::cutlass::emulation::detail::reduce_block(predicate);
+}
+
+inline int __syncthreads_and(int predicate) {
+  return ::cutlass::emulation::detail::reduce_block(predicate) ==
+    ::cutlass::emulation::detail::current().block->thread_count();
+}
+
+inline int __syncthreads_or(int predicate) {
+  return ::cutlass::emulation::detail::reduce_block(predicate) > 0;
+}
+
+inline void __syncwarp(unsigned = 0xffffffff) {
+  auto &context = ::cutlass::emulation::detail::current();
+  context.block->sync_warp(context);
+}
+
+inline void __threadfence_block() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+inline void __threadfence() {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+}
+
+template <typename T>
+T __shfl_sync(unsigned, T var, int src_lane, int width = 32) {
+  int lane = ::cutlass::emulation::detail::current().linear_idx % 32;
+  int source = (lane & ~(width - 1)) + (src_lane & (width - 1));
+  return ::cutlass::emulation::detail::shuffle(var, source);
+}
+
+template <typename T>
+T __shfl_xor_sync(unsigned, T var, int lane_mask, int width = 32) {
+  int lane = ::cutlass::emulation::detail::current().linear_idx % 32;
+  return ::cutlass::emulation::detail::shuffle(
+    var, ::cutlass::emulation::detail::shuffle_source(lane, lane ^ lane_mask, width));
+}
+
+template <typename T>
+T __shfl_up_sync(unsigned, T var, unsigned delta, int width = 32) {
+  int lane = ::cutlass::emulation::detail::current().linear_idx % 32;
+  return ::cutlass::emulation::detail::shuffle(
+    var, ::cutlass::emulation::detail::shuffle_source(lane, lane - int(delta), width));
+}
+
+template <typename T>
+T __shfl_down_sync(unsigned, T var, unsigned delta, int width = 32) {
+  int lane = ::cutlass::emulation::detail::current().linear_idx % 32;
+  return ::cutlass::emulation::detail::shuffle(
+    var, ::cutlass::emulation::detail::shuffle_source(lane, lane + int(delta), width));
+}
+
+// Integer and half-precision intrinsics used by CUTLASS headers outside of __CUDA_ARCH__ guards.
+// The half2 functions are templates so that host overloads provided by cuda_fp16.h take precedence.
+
+inline int __dp4a(int srcA, int srcB, int c) {
+  for (int i = 0; i < 4; ++i) {
+    c += int(int8_t(srcA >> (8 * i))) * int(int8_t(srcB >> (8 * i)));
+  }
+  return c;
+}
+
+inline unsigned __dp4a(unsigned srcA, unsigned srcB, unsigned c) {
+  for (int i = 0; i < 4; ++i) {
+    c += unsigned(uint8_t(srcA >> (8 * i))) * unsigned(uint8_t(srcB >> (8 * i)));
+  }
+  return c;
+}
+
+inline unsigned __byte_perm(unsigned x, unsigned y, unsigned s) {
+  uint64_t bytes = (uint64_t(y) << 32) | x;
+  unsigned result = 0;
+  for (int i = 0; i < 4; ++i) {
+    unsigned selector = (s >> (4 * i)) & 7;
+    result |= unsigned((bytes >> (8 * selector)) & 0xff) << (8 * i);
+  }
+  return result;
+}
+
+template <typename Half2>
+Half2 __hfma2(Half2 a, Half2 b, Half2 c) {
+  Half2 result;
+  result.x = __float2half_rn(__half2float(a.x) * __half2float(b.x) + __half2float(c.x));
+  result.y = __float2half_rn(__half2float(a.y) * __half2float(b.y) + __half2float(c.y));
+  return result;
+}
+
+template <typename Half2>
+Half2 __hsub2(Half2 a, Half2 b) {
+  Half2 result;
+  result.x = __float2half_rn(__half2float(a.x) - __half2float(b.x));
+  result.y = __float2half_rn(__half2float(a.y) - __half2float(b.y));
+  return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
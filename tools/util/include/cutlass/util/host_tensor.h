@@ -39,9 +39,14 @@
 
   Call {host, device}_{data, ref, view}() for accessing host or device memory.
 
+  Host memory is obtained from the HostAllocator_ argument. The default std::allocator zero-fills
+  host memory on every allocation; see cutlass/util/host_allocator.h for policies that skip the
+  fill, use huge pages, place pages with parallel first-touch or recycle freed buffers.
+
   See cutlass/tensor_ref.h and cutlass/tensor_view.h for more details.
 */
 
+#include <memory>
 #include <vector>
 
 #include "cutlass/cutlass.h"
@@ -60,7 +65,9 @@ template <
   /// Data type of element stored within tensor (concept: NumericType)
   typename Element_,
   /// Defines a mapping from logical coordinate to linear memory (concept: Layout)
-  typename Layout_
+  typename Layout_,
+  /// Allocator of host memory, rebound to the storage unit of Element_ (concept: Allocator)
+  typename HostAllocator_ = std::allocator<Element_>
 >
 class HostTensor {
 public:
@@ -104,6 +111,9 @@ public:
   /// Constant reference to element in tensor
   using ConstReference = typename ConstTensorRef::Reference;
 
+  /// Allocator of host memory
+  using HostAllocator = HostAllocator_;
+
 private:
   using StorageUnit = typename platform::conditional_t<std::is_same_v<Element, bool>, uint8_t,            // Avoid the std::vector<bool> specialization
                                   typename platform::conditional_t<sizeof_bits<Element>::value % 8 == 0,  // Handle subbyte types
@@ -124,8 +134,10 @@ private:
   /// Layout object
   Layout layout_;
 
+  using HostStorageAllocator = typename std::allocator_traits<HostAllocator>::template rebind_alloc<StorageUnit>;
+
   /// Host-side memory allocation
-  std::vector<StorageUnit> host_;
+  std::vector<StorageUnit, HostStorageAllocator> host_;
 
   /// Device-side memory
   device_memory::allocation<StorageUnit> device_;
@@ -185,6 +197,12 @@ public:
     host_.clear();
 
     size_t count_container = count_to_container_storage_unit_count(count);
+
+    // Release the old allocation before growing so that both are never held at once
+    if (count_container > host_.capacity()) {
+      decltype(host_)().swap(host_);
+    }
+
 #if (CUTLASS_DEBUG_TRACE_LEVEL > 1)
     CUTLASS_TRACE_HOST("cutlass::HostTensor::reserve: host_.resize(" << count_container << ")");
 #endif    
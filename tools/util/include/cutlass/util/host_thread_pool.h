@@ -0,0 +1,444 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Work-stealing thread pool shared by the host reference implementations.
+
+    A parallel loop is split into chunks, and the chunks are partitioned into one contiguous range
+    per participating thread. Each thread pops chunks from the front of its own range. A thread
+    whose range is empty steals the back half of the largest remaining range, so imbalanced loops
+    finish without a central queue.
+
+    The thread that starts a loop always participates in it. Pool workers join loops while they
+    are idle. A loop started from inside another loop's body is therefore always completed by at
+    least its caller, and nested parallelism cannot deadlock. A nested loop uses only the workers
+    that are idle at that time.
+
+    The process-wide pool returned by host_thread_pool() uses the number of threads given by the
+    CUTLASS_HOST_THREADS environment variable, or all hardware threads if it is unset. Use
+    set_host_thread_count() to cap it, for example to keep host threads off cores that launch GPU
+    work.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Contiguous range of work items owned by one worker. The owner pops items from the front and
+/// thieves split off the back half. Both ends are packed into one word so that each update is a
+/// single compare-and-swap.
+class StealableRange {
+public:
+
+  void reset(uint32_t begin, uint32_t end) {
+    range_.store(pack(begin, end), std::memory_order_release);
+  }
+
+  uint32_t size() const {
+    uint64_t range = range_.load(std::memory_order_relaxed);
+    return end_of(range) - begin_of(range);
+  }
+
+  bool pop_front(uint32_t &item) {
+    uint64_t range = range_.load(std::memory_order_acquire);
+    while (begin_of(range) < end_of(range)) {
+      if (range_.compare_exchange_weak(range, pack(begin_of(range) + 1, end_of(range)),
+                                       std::memory_order_acq_rel, std::memory_order_acquire)) {
+        item = begin_of(range);
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool steal_back_half(uint32_t &begin, uint32_t &end) {
+    uint64_t range = range_.load(std::memory_order_acquire);
+    while (begin_of(range) < end_of(range)) {
+      uint32_t split = end_of(range) - (end_of(range) - begin_of(range) + 1) / 2;
+      if (range_.compare_exchange_weak(range, pack(begin_of(range), split),
+                                       std::memory_order_acq_rel, std::memory_order_acquire)) {
+        begin = split;
+        end = end_of(range);
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+
+  static uint64_t pack(uint32_t begin, uint32_t end) {
+    return (uint64_t(end) << 32) | uint64_t(begin);
+  }
+  static uint32_t begin_of(uint64_t range) { return uint32_t(range); }
+  static uint32_t end_of(uint64_t range) { return uint32_t(range >> 32); }
+
+  std::atomic<uint64_t> range_{0};
+};
+
+/// One parallel loop in flight. Participants hold shared ownership, since a worker may still be
+/// scanning the ranges after the last item has completed.
+struct HostParallelJob {
+
+  HostParallelJob(int slots_, uint32_t items_, void (*invoke_)(void *, uint32_t), void *body_):
+    slots(slots_), next_slot(1), ranges(new StealableRange[slots_]),
+    pending(items_), failed(false), invoke(invoke_), body(body_) { }
+
+  /// Number of participants, including the caller in slot 0
+  int slots;
+
+  /// Next slot to be claimed by a worker. Guarded by the pool's mutex.
+  int next_slot;
+
+  std::unique_ptr<StealableRange[]> ranges;
+
+  /// Items not yet completed
+  std::atomic<uint32_t> pending;
+
+  std::atomic<bool> failed;
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable done;
+
+  void (*invoke)(void *, uint32_t);
+  void *body;
+
+  /// Runs one item, recording the first exception. Items after a failure are skipped.
+  void execute(uint32_t item) {
+    if (!failed.load(std::memory_order_relaxed)) {
+      try {
+        invoke(body, item);
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!failed.exchange(true)) {
+          error = std::current_exception();
+        }
+      }
+    }
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::lock_guard<std::mutex> lock(mutex);
+      done.notify_all();
+    }
+  }
+
+  /// Runs items from `slot`, then steals from the other slots until none have work left
+  void participate(int slot) {
+    uint32_t item;
+    for (;;) {
+      while (ranges[slot].pop_front(item)) {
+        execute(item);
+      }
+
+      // Steal from the slot with the most remaining items
+      bool stolen = false;
+      while (!stolen) {
+        int victim = -1;
+        uint32_t victim_size = 0;
+        for (int s = 1; s < slots; ++s) {
+          int candidate = (slot + s) % slots;
+          uint32_t size = ranges[candidate].size();
+          if (size > victim_size) {
+            victim = candidate;
+            victim_size = size;
+          }
+        }
+        if (victim < 0) {
+          return;
+        }
+        uint32_t steal_begin, steal_end;
+        if (ranges[victim].steal_back_half(steal_begin, steal_end)) {
+          ranges[slot].reset(steal_begin, steal_end);
+          stolen = true;
+        }
+      }
+    }
+  }
+
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this]() { return pending.load(std::memory_order_acquire) == 0; });
+  }
+};
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Pool of host threads executing parallel loops with work stealing
+class HostThreadPool {
+public:
+
+  /// Creates a pool whose loops run on up to `num_threads` threads, including the thread that
+  /// starts the loop. A `num_threads` of 0 uses all hardware threads.
+  explicit HostThreadPool(int num_threads = 0): stop_(false) {
+    if (num_threads <= 0) {
+      num_threads = std::max(1, int(std::thread::hardware_concurrency()));
+    }
+    num_threads_ = num_threads;
+    workers_.reserve(num_threads - 1);
+    for (int t = 1; t < num_threads; ++t) {
+      workers_.emplace_back([this]() { worker_loop(); });
+    }
+  }
+
+  HostThreadPool(HostThreadPool const &) = delete;
+  HostThreadPool &operator=(HostThreadPool const &) = delete;
+
+  ~HostThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  /// Maximum number of threads participating in one loop
+  int num_threads() const {
+    return num_threads_;
+  }
+
+  /// Calls func(begin, end) on disjoint chunks covering [0, count). Every chunk except possibly
+  /// the last holds `grain` items. At most `max_threads` threads participate; 0 means all threads
+  /// of the pool. The first exception thrown by `func` is rethrown after all chunks have finished.
+  template <typename Func>
+  void parallel_for(int64_t count, Func &&func, int64_t grain = 1, int max_threads = 0) {
+
+    if (count <= 0) {
+      return;
+    }
+
+    grain = std::max<int64_t>(grain, 1);
+    grain = std::max<int64_t>(grain, (count + int64_t(UINT32_MAX) - 1) / int64_t(UINT32_MAX));
+    uint32_t chunks = uint32_t((count + grain - 1) / grain);
+
+    auto body = [&](uint32_t chunk) {
+      int64_t begin = int64_t(chunk) * grain;
+      func(begin, std::min(count, begin + grain));
+    };
+
+    int slots = participants(chunks, max_threads);
+    if (slots == 1) {
+      func(int64_t(0), count);
+      return;
+    }
+
+    auto job = make_job(slots, chunks, body);
+    for (int s = 0; s < slots; ++s) {
+      job->ranges[s].reset(uint32_t(uint64_t(chunks) * s / slots), uint32_t(uint64_t(chunks) * (s + 1) / slots));
+    }
+    run(job);
+  }
+
+  /// Calls func(item) for items [0, costs.size()). Items are initially partitioned into contiguous
+  /// ranges of similar total cost, so that stealing only corrects for misestimated costs.
+  template <typename Func>
+  void parallel_for_weighted(std::vector<double> const &costs, Func &&func, int max_threads = 0) {
+
+    if (costs.empty()) {
+      return;
+    }
+
+    uint32_t items = uint32_t(std::min<size_t>(costs.size(), UINT32_MAX));
+    auto body = [&](uint32_t item) { func(item); };
+
+    int slots = participants(items, max_threads);
+    if (slots == 1) {
+      for (uint32_t item = 0; item < items; ++item) {
+        func(item);
+      }
+      return;
+    }
+
+    double total_cost = 0;
+    for (uint32_t item = 0; item < items; ++item) {
+      total_cost += costs[item];
+    }
+
+    auto job = make_job(slots, items, body);
+
+    uint32_t begin = 0;
+    double prefix_cost = 0;
+    for (int s = 0; s < slots; ++s) {
+      double target = total_cost * double(s + 1) / double(slots);
+      uint32_t end = begin;
+      while (end < items && (s + 1 == slots || prefix_cost + costs[end] <= target || end == begin)) {
+        prefix_cost += costs[end];
+        ++end;
+      }
+      job->ranges[s].reset(begin, end);
+      begin = end;
+    }
+    run(job);
+  }
+
+private:
+
+  int participants(uint32_t items, int max_threads) const {
+    int slots = max_threads > 0 ? std::min(max_threads, num_threads_) : num_threads_;
+    return int(std::min<uint32_t>(uint32_t(slots), items));
+  }
+
+  template <typename Body>
+  static std::shared_ptr<detail::HostParallelJob> make_job(int slots, uint32_t items, Body &body) {
+    auto invoke = [](void *body, uint32_t item) {
+      (*static_cast<Body *>(body))(item);
+    };
+    return std::make_shared<detail::HostParallelJob>(slots, items, invoke, static_cast<void *>(&body));
+  }
+
+  /// Publishes the job to idle workers, participates as slot 0, and waits for all items
+  void run(std::shared_ptr<detail::HostParallelJob> const &job) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.push_back(job);
+    }
+    wake_.notify_all();
+
+    job->participate(0);
+    job->wait();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      jobs_.erase(std::remove(jobs_.begin(), jobs_.end(), job), jobs_.end());
+    }
+
+    if (job->error) {
+      std::rethrow_exception(job->error);
+    }
+  }
+
+  void worker_loop() {
+    for (;;) {
+      std::shared_ptr<detail::HostParallelJob> job;
+      int slot = 0;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this]() { return stop_ || !jobs_.empty(); });
+        if (stop_) {
+          return;
+        }
+
+        // The most recent job is joined first, so nested loops finish before their parents
+        // hand out more work
+        job = jobs_.back();
+        slot = job->next_slot++;
+        if (job->next_slot == job->slots) {
+          jobs_.pop_back();
+        }
+      }
+      job->participate(slot);
+    }
+  }
+
+  int num_threads_;
+  bool stop_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+
+  /// Jobs with unclaimed slots
+  std::vector<std::shared_ptr<detail::HostParallelJob>> jobs_;
+  std::vector<std::thread> workers_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+inline std::mutex &host_thread_pool_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+inline std::unique_ptr<HostThreadPool> &host_thread_pool_instance() {
+  static std::unique_ptr<HostThreadPool> pool;
+  return pool;
+}
+
+/// Thread count requested through CUTLASS_HOST_THREADS, or 0 if unset or invalid
+inline int host_thread_count_from_environment() {
+  char const *value = std::getenv("CUTLASS_HOST_THREADS");
+  if (!value) {
+    return 0;
+  }
+  int count = std::atoi(value);
+  return count > 0 ? count : 0;
+}
+
+} // namespace detail
+
+/// Process-wide pool used by the host reference implementations
+inline HostThreadPool &host_thread_pool() {
+  std::lock_guard<std::mutex> lock(detail::host_thread_pool_mutex());
+  auto &pool = detail::host_thread_pool_instance();
+  if (!pool) {
+    pool.reset(new HostThreadPool(detail::host_thread_count_from_environment()));
+  }
+  return *pool;
+}
+
+/// Replaces the process-wide pool with one of `num_threads` threads (0 for all hardware threads).
+/// Must not be called while a loop is running on the pool.
+inline void set_host_thread_count(int num_threads) {
+  std::lock_guard<std::mutex> lock(detail::host_thread_pool_mutex());
+  auto &pool = detail::host_thread_pool_instance();
+  pool.reset();
+  pool.reset(new HostThreadPool(num_threads));
+}
+
+/// Number of threads of the process-wide pool
+inline int host_thread_count() {
+  return host_thread_pool().num_threads();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,643 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+  \brief Host-side weight pre-packing for mixed input data type GEMMs.
+
+  Quantized weights are encoded and reordered into the layout consumed by the mixed input
+  mainloops in a single pass over each tensor, split across host threads. The packed weights,
+  scales and zeros can be written to a PrepackedWeightFile keyed by the source and reordered
+  layouts, so that later runs map the file instead of repeating the transforms:
+
+    auto key = cutlass::prepack_layout_key<cutlass::int4b_t>(layout_B, layout_B_reordered, "layer0");
+
+    cutlass::PrepackedWeightFile file;
+    file.open_or_create(path, key, [&](cutlass::PrepackedWeightSections &sections) {
+      sections[cutlass::PrepackedWeightFile::kWeights].resize(weight_bytes);
+      cutlass::prepack_tensor_host(
+        weights, layout_B,
+        reinterpret_cast<cutlass::int4b_t *>(sections[cutlass::PrepackedWeightFile::kWeights].data()),
+        layout_B_reordered, cutlass::UnifiedInt4Encoding{});
+      ...
+    });
+
+    cutlass::device_memory::copy_to_device(
+      block_B.get(), file.data<cutlass::int4b_t>(cutlass::PrepackedWeightFile::kWeights), ...);
+
+  On POSIX systems the file is mapped read-only, so loading costs no more than the page faults
+  of the copy that consumes it. Sections start on page boundaries and may be pinned in place
+  with cudaHostRegister(). Files are written in host byte order and are meant as a local cache;
+  a file whose version, key or size does not match is rebuilt.
+*/
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CUTLASS_PREPACK_MMAP 1
+#endif
+
+#include "cute/tensor.hpp"
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/numeric_types.h"
+#include "cutlass/util/host_thread_pool.h"
+
+namespace cutlass {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+class packed_scale_t {
+public:
+  static_assert(cute::is_same_v<T, cute::int8_t> ||
+                cute::is_same_v<T, cute::uint8_t> ||
+                cute::is_same_v<T, cutlass::float_e4m3_t> ||
+                cute::is_same_v<T, cutlass::float_e5m2_t>,
+                "only 8 bit arithmetic types are supported.");
+  CUTLASS_HOST_DEVICE
+  explicit packed_scale_t(T val) {
+    if constexpr (!cute::is_unsigned_v<T>) {
+      // Only pack negative values. The positive values are generated in flight in the mainloop.
+      storage[0] = pack4(T(float(val) * -8.f), T(float(val) * -7.f), T(float(val) * -6.f), T(float(val) * -5.f));
+      storage[1] = pack4(T(float(val) * -4.f), T(float(val) * -3.f), T(float(val) * -2.f), -val);
+    }
+    else {
+      storage[0] = pack4(T(float(val) * 8.f), T(float(val) * 7.f), T(float(val) * 6.f), T(float(val) * 5.f));
+      storage[1] = pack4(T(float(val) * 4.f), T(float(val) * 3.f), T(float(val) * 2.f), val);
+    }
+  }
+  CUTLASS_HOST_DEVICE
+  packed_scale_t() = default;
+  CUTLASS_HOST_DEVICE
+  explicit operator float() const {
+    return float(get());
+  }
+  CUTLASS_HOST_DEVICE
+  bool operator==(packed_scale_t const& rhs) const {
+    return storage[0] == rhs.storage[0] && storage[1] == rhs.storage[1];
+  }
+  CUTLASS_HOST_DEVICE
+  bool operator!=(packed_scale_t const& rhs) const {
+    return !(*this == rhs);
+  }
+  CUTLASS_HOST_DEVICE
+  friend packed_scale_t operator+(packed_scale_t const& lhs, packed_scale_t const& rhs) {
+    return packed_scale_t(lhs.get() + rhs.get());
+  }
+  CUTLASS_HOST_DEVICE
+  friend packed_scale_t operator-(packed_scale_t const& lhs, packed_scale_t const& rhs) {
+    return packed_scale_t(lhs.get() - rhs.get());
+  }
+  CUTLASS_HOST_DEVICE
+  friend packed_scale_t operator*(packed_scale_t const& lhs, packed_scale_t const& rhs) {
+    return packed_scale_t(lhs.get() * rhs.get());
+  }
+  CUTLASS_HOST_DEVICE
+  friend packed_scale_t operator/(packed_scale_t const& lhs, packed_scale_t const& rhs) {
+    return packed_scale_t(lhs.get() / rhs.get());
+  }
+
+private:
+  using Storage = uint32_t;
+  using Stage = uint8_t;
+
+  Storage storage[2] {};
+
+  CUTLASS_HOST_DEVICE
+  static Storage pack4(T c1, T c2, T c3, T c4) {
+    Storage result = 0;
+    result |= (static_cast<Storage>(reinterpret_cast<Stage const&>(c4)) << 24);
+    result |= (static_cast<Storage>(reinterpret_cast<Stage const&>(c3)) << 16);
+    result |= (static_cast<Storage>(reinterpret_cast<Stage const&>(c2)) << 8);
+    result |= static_cast<Storage>(reinterpret_cast<Stage const&>(c1));
+    return result;
+  }
+  CUTLASS_HOST_DEVICE
+  T get() const {
+    auto stage = static_cast<Stage>(storage[0] >> 8);
+    #if defined(__CUDA_ARCH__)
+    return reinterpret_cast<T const&>(stage);
+    #else
+    T tmp;
+    std::memcpy(&tmp, &stage, sizeof(Stage));
+    return tmp;
+    #endif
+  }
+  CUTLASS_HOST_DEVICE
+  T get(int idx) const {
+    Stage stage;
+    if (idx < 4) stage = static_cast<Stage>(storage[0] >> (8 * idx));
+    else         stage = static_cast<Stage>(storage[1] >> (8 * idx - 32));
+    #if defined(__CUDA_ARCH__)
+    return reinterpret_cast<T const&>(stage);
+    #else
+    T tmp;
+    std::memcpy(&tmp, &stage, sizeof(Stage));
+    return tmp;
+    #endif
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Leaves values unchanged
+struct IdentityEncoding {
+  template <class T>
+  T operator()(T const &value) const {
+    return value;
+  }
+};
+
+/// In the mainloop, PRMT selects 1 byte from only 8 bytes so the sign bit is handled in an extra PRMT.
+/// This encoding unifies positive and negative INT4 values except for the sign bit: 1 becomes 0b0111,
+/// which is the same encoding as -1 (0b1111).
+struct UnifiedInt4Encoding {
+
+  static uint8_t encode_nibble(uint8_t nibble) {
+    return (nibble >= 1 && nibble <= 7) ? uint8_t(8 - nibble) : nibble;
+  }
+
+  /// Encodes both nibbles of a storage byte
+  static uint8_t encode_byte(uint8_t byte) {
+    return uint8_t(encode_nibble(byte & 0x0f) | (encode_nibble(byte >> 4) << 4));
+  }
+
+  cutlass::int4b_t operator()(cutlass::int4b_t value) const {
+    value.storage = encode_nibble(value.storage & 0x0f);
+    return value;
+  }
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Work below this many elements is processed on the calling thread
+static constexpr size_t kPrepackParallelThreshold = size_t(1) << 16;
+
+/// Calls func(begin, end) on contiguous ranges of [0, count) on up to num_threads threads of the
+/// shared host thread pool, or on all of them if num_threads <= 0
+template <class Func>
+void prepack_parallel_for(size_t count, size_t elements, int num_threads, Func func) {
+
+  if (elements < kPrepackParallelThreshold || count <= 1) {
+    func(size_t(0), count);
+    return;
+  }
+
+  HostThreadPool &pool = host_thread_pool();
+  int threads = num_threads > 0 ? std::min(num_threads, pool.num_threads()) : pool.num_threads();
+
+  // Several ranges per thread let idle threads steal from slow ones
+  int64_t grain = std::max<int64_t>(1, int64_t(count) / (4 * int64_t(threads)));
+
+  pool.parallel_for(int64_t(count), [&](int64_t begin, int64_t end) {
+    func(size_t(begin), size_t(end));
+  }, grain, threads);
+}
+
+/// 64-bit FNV-1a
+inline uint64_t prepack_hash(char const *data, size_t bytes) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < bytes; ++i) {
+    hash = (hash ^ uint8_t(data[i])) * 0x100000001b3ull;
+  }
+  return hash;
+}
+
+} // namespace detail
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Encodes and reorders a host tensor of shape [MN, K, L] in a single pass. This is the host
+/// counterpart of reorder_tensor() fused with an element-wise encoding such as UnifiedInt4Encoding.
+///
+/// Work is split over the (MN or K) x L columns that do not contain the stride-1 mode of the
+/// destination, so that a thread owns every byte it writes when T is narrower than a byte.
+template <class T, class LayoutSrc, class LayoutDst, class Encoding = IdentityEncoding>
+void prepack_tensor_host(
+  T const *src,
+  LayoutSrc const &layout_src,
+  T *dst,
+  LayoutDst const &layout_dst,
+  Encoding encoding = {},
+  int num_threads = 0) {
+
+  using namespace cute;
+
+  auto has_major_mode = [](auto s) {
+    return any_of(flatten(s), [](auto a){ return is_constant<1, decltype(a)>{}; });
+  };
+  static_assert(has_major_mode(stride<0>(LayoutDst{})) ^ has_major_mode(stride<1>(LayoutDst{})),
+                "Could not find stride-1 mode in destination layout");
+  constexpr bool kMajorMN = has_major_mode(stride<0>(LayoutDst{}));
+
+  Tensor S = make_tensor(recast_ptr<T const>(src), layout_src);
+  Tensor D = make_tensor(recast_ptr<T>(dst), layout_dst);
+
+  int64_t const extent_mn = int64_t(size<0>(layout_dst));
+  int64_t const extent_k = int64_t(size<1>(layout_dst));
+  int64_t const batches = int64_t(size<2>(layout_dst));
+
+  int64_t const inner = kMajorMN ? extent_mn : extent_k;
+  int64_t const outer = kMajorMN ? extent_k : extent_mn;
+
+  detail::prepack_parallel_for(size_t(outer * batches), size_t(size(layout_dst)), num_threads,
+    [&](size_t begin, size_t end) {
+      for (size_t column = begin; column < end; ++column) {
+        int64_t o = int64_t(column) % outer;
+        int64_t l = int64_t(column) / outer;
+        for (int64_t i = 0; i < inner; ++i) {
+          int64_t mn = kMajorMN ? i : o;
+          int64_t k = kMajorMN ? o : i;
+          D(mn, k, l) = encoding(T(S(mn, k, l)));
+        }
+      }
+    });
+}
+
+/// Applies UnifiedInt4Encoding to a packed buffer of `count` INT4 elements
+inline void unified_encode_int4b_host(
+  cutlass::int4b_t const *block_in,
+  cutlass::int4b_t *block_out,
+  size_t count,
+  int num_threads = 0) {
+
+  uint8_t const *in = reinterpret_cast<uint8_t const *>(block_in);
+  uint8_t *out = reinterpret_cast<uint8_t *>(block_out);
+  size_t bytes = (count + 1) / 2;
+
+  detail::prepack_parallel_for(bytes, count, num_threads, [=](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      out[i] = UnifiedInt4Encoding::encode_byte(in[i]);
+    }
+  });
+}
+
+/// Expands each 8-bit scale into the eight multiples consumed by the INT4 x FP8 mainloop
+template <class ElementScale>
+void pack_scale_fp8_host(
+  ElementScale const *block_in,
+  cutlass::Array<ElementScale, 8> *block_out,
+  size_t count,
+  int num_threads = 0) {
+
+  detail::prepack_parallel_for(count, count, num_threads, [=](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      cutlass::packed_scale_t<ElementScale> tmp(block_in[i]);
+      std::memcpy(&block_out[i], &tmp, sizeof(tmp));
+    }
+  });
+}
+
+/// Cache key identifying a reordering of T from layout_src to layout_dst. The tag should name the
+/// source data (e.g. checkpoint and tensor name), since the layouts alone do not.
+template <class T, class LayoutSrc, class LayoutDst>
+std::string prepack_layout_key(
+  LayoutSrc const &layout_src,
+  LayoutDst const &layout_dst,
+  std::string const &tag = std::string()) {
+
+  std::ostringstream key;
+  key << "bits=" << cute::sizeof_bits_v<T> << ";src=" << layout_src << ";dst=" << layout_dst << ";tag=" << tag;
+  return key.str();
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Contents of each section of a PrepackedWeightFile
+using PrepackedWeightSections = std::array<std::vector<uint8_t>, 3>;
+
+/// Read-only view of pre-packed weights, scales and zeros stored in a file.
+///
+/// File layout (host byte order):
+///
+///   Header    := char:magic[8]="CUTLASSW" u32:version u32:key_bytes u64:key_hash
+///                u64:section_offset[3] u64:section_bytes[3]
+///   Key       := char[key_bytes]
+///   Section*  := padding to a multiple of kAlignment, u8[section_bytes]
+class PrepackedWeightFile {
+public:
+
+  enum Section {
+    kWeights,
+    kScales,
+    kZeros,
+    kSectionCount
+  };
+
+  static constexpr uint32_t kVersion = 1;
+
+  /// Alignment of each section relative to the start of the file
+  static constexpr size_t kAlignment = 4096;
+
+  PrepackedWeightFile() = default;
+
+  PrepackedWeightFile(PrepackedWeightFile const &) = delete;
+  PrepackedWeightFile &operator=(PrepackedWeightFile const &) = delete;
+
+  PrepackedWeightFile(PrepackedWeightFile &&other) noexcept {
+    *this = std::move(other);
+  }
+
+  PrepackedWeightFile &operator=(PrepackedWeightFile &&other) noexcept {
+    if (this != &other) {
+      close();
+      base_ = other.base_;
+      size_ = other.size_;
+      mapped_ = other.mapped_;
+      from_cache_ = other.from_cache_;
+      buffer_ = std::move(other.buffer_);
+      sections_ = std::move(other.sections_);
+      header_ = other.header_;
+      other.base_ = nullptr;
+      other.size_ = 0;
+      other.mapped_ = false;
+    }
+    return *this;
+  }
+
+  ~PrepackedWeightFile() {
+    close();
+  }
+
+  /// Opens an existing file. Returns false if it is missing or does not match `key`.
+  bool open(std::string const &path, std::string const &key) {
+
+    close();
+
+#if defined(CUTLASS_PREPACK_MMAP)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      return false;
+    }
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+      ::close(fd);
+      return false;
+    }
+    size_t size = size_t(info.st_size);
+    void *ptr = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+      return false;
+    }
+    base_ = static_cast<uint8_t const *>(ptr);
+    size_ = size;
+    mapped_ = true;
+#else
+    std::ifstream in(path, std::ios::binary | std::ios::ate);
+    if (!in) {
+      return false;
+    }
+    buffer_.resize(size_t(in.tellg()));
+    in.seekg(0);
+    if (!in.read(reinterpret_cast<char *>(buffer_.data()), std::streamsize(buffer_.size()))) {
+      buffer_.clear();
+      return false;
+    }
+    base_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+
+    if (!validate_(key)) {
+      close();
+      return false;
+    }
+
+    from_cache_ = true;
+    return true;
+  }
+
+  /// Writes sections to `path`, replacing any existing file atomically
+  static bool write(std::string const &path, std::string const &key, PrepackedWeightSections const &sections) {
+
+    Header header;
+    std::memcpy(header.magic, kMagic, sizeof(header.magic));
+    header.version = kVersion;
+    header.key_bytes = uint32_t(key.size());
+    header.key_hash = detail::prepack_hash(key.data(), key.size());
+
+    uint64_t offset = sizeof(Header) + key.size();
+    for (int s = 0; s < kSectionCount; ++s) {
+      offset = align_(offset);
+      header.section_offset[s] = offset;
+      header.section_bytes[s] = sections[s].size();
+      offset += sections[s].size();
+    }
+
+    std::string temp_path = path + ".tmp" + temp_suffix_();
+    {
+      std::ofstream out(temp_path, std::ios::binary | std::ios::trunc);
+      if (!out) {
+        return false;
+      }
+      out.write(reinterpret_cast<char const *>(&header), sizeof(header));
+      out.write(key.data(), std::streamsize(key.size()));
+
+      uint64_t position = sizeof(Header) + key.size();
+      std::vector<char> padding(kAlignment, 0);
+      for (int s = 0; s < kSectionCount; ++s) {
+        out.write(padding.data(), std::streamsize(header.section_offset[s] - position));
+        out.write(reinterpret_cast<char const *>(sections[s].data()), std::streamsize(sections[s].size()));
+        position = header.section_offset[s] + sections[s].size();
+      }
+      if (!out) {
+        out.close();
+        std::remove(temp_path.c_str());
+        return false;
+      }
+    }
+
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+      std::remove(temp_path.c_str());
+      return false;
+    }
+    return true;
+  }
+
+  /// Opens `path` if it matches `key`. Otherwise calls produce(PrepackedWeightSections &) to build
+  /// the sections, writes them to `path` and opens the result. If the file cannot be written, the
+  /// produced sections are kept in memory. Returns true if the file was loaded from the cache.
+  template <class Producer>
+  bool open_or_create(std::string const &path, std::string const &key, Producer &&produce) {
+
+    if (open(path, key)) {
+      return true;
+    }
+
+    PrepackedWeightSections sections;
+    produce(sections);
+
+    if (write(path, key, sections) && open(path, key)) {
+      from_cache_ = false;
+      return false;
+    }
+
+    close();
+    sections_ = std::move(sections);
+    return false;
+  }
+
+  /// Unmaps the file
+  void close() {
+#if defined(CUTLASS_PREPACK_MMAP)
+    if (mapped_) {
+      munmap(const_cast<uint8_t *>(base_), size_);
+    }
+#endif
+    base_ = nullptr;
+    size_ = 0;
+    mapped_ = false;
+    from_cache_ = false;
+    buffer_.clear();
+    for (auto &section : sections_) {
+      section.clear();
+    }
+  }
+
+  /// True if the contents were loaded from an existing file
+  bool from_cache() const {
+    return from_cache_;
+  }
+
+  /// True if the file is memory mapped
+  bool mapped() const {
+    return mapped_;
+  }
+
+  uint8_t const *data(Section section) const {
+    if (base_) {
+      return base_ + header_.section_offset[section];
+    }
+    return sections_[section].data();
+  }
+
+  template <class T>
+  T const *data(Section section) const {
+    return reinterpret_cast<T const *>(data(section));
+  }
+
+  size_t bytes(Section section) const {
+    if (base_) {
+      return size_t(header_.section_bytes[section]);
+    }
+    return sections_[section].size();
+  }
+
+private:
+
+  static constexpr char kMagic[8] = {'C', 'U', 'T', 'L', 'A', 'S', 'S', 'W'};
+
+  struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t key_bytes;
+    uint64_t key_hash;
+    uint64_t section_offset[kSectionCount];
+    uint64_t section_bytes[kSectionCount];
+  };
+
+  static_assert(sizeof(Header) == 72, "Unexpected padding in PrepackedWeightFile header");
+
+  static uint64_t align_(uint64_t offset) {
+    return (offset + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  static std::string temp_suffix_() {
+    std::ostringstream suffix;
+#if defined(CUTLASS_PREPACK_MMAP)
+    suffix << "." << getpid();
+#endif
+    suffix << "." << std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return suffix.str();
+  }
+
+  bool validate_(std::string const &key) {
+
+    if (size_ < sizeof(Header)) {
+      return false;
+    }
+
+    // Copied so that the header is aligned regardless of how the file was read
+    std::memcpy(&header_, base_, sizeof(Header));
+    Header const &header = header_;
+
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 ||
+        header.version != kVersion ||
+        header.key_bytes != key.size() ||
+        header.key_hash != detail::prepack_hash(key.data(), key.size()) ||
+        size_ < sizeof(Header) + key.size() ||
+        std::memcmp(base_ + sizeof(Header), key.data(), key.size()) != 0) {
+      return false;
+    }
+
+    for (int s = 0; s < kSectionCount; ++s) {
+      if (header.section_offset[s] > size_ || header.section_bytes[s] > size_ - header.section_offset[s]) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint8_t const *base_ = nullptr;
+  size_t size_ = 0;
+  bool mapped_ = false;
+  bool from_cache_ = false;
+  std::vector<uint8_t> buffer_;
+  PrepackedWeightSections sections_;
+  Header header_ = {};
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+#undef CUTLASS_PREPACK_MMAP
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
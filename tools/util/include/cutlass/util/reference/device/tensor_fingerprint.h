@@ -0,0 +1,178 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Computes fingerprints of blocks of elements in device memory.
+
+    The digests are defined in cutlass/util/tensor_fingerprint.h and match those computed on the
+    host by reference/host/tensor_fingerprint.h. Only the two 64-bit digests are copied to the
+    host.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_size.h"
+#include "cutlass/subbyte_reference.h"
+#include "cutlass/util/tensor_fingerprint.h"
+
+namespace cutlass {
+namespace reference {
+namespace device {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace kernel {
+
+/// Accumulates the digest of the raw bits of a block into `digest`. Templated on the element
+/// type so the definition may live in a header without duplicate symbols at link time.
+template <typename Element>
+__global__ void BlockFingerprintExact(
+  unsigned long long *digest,
+  uint8_t const *bytes,
+  uint64_t num_bits) {
+
+  uint64_t words = (num_bits + 63) / 64;
+  uint64_t full_words = num_bits / 64;
+  bool aligned = (reinterpret_cast<uintptr_t>(bytes) % sizeof(uint64_t)) == 0;
+
+  uint64_t sum = 0;
+  for (uint64_t w = threadIdx.x + uint64_t(blockDim.x) * blockIdx.x; w < words; w += uint64_t(gridDim.x) * blockDim.x) {
+    uint64_t value = (aligned && w < full_words) ?
+      reinterpret_cast<uint64_t const *>(bytes)[w] :
+      fingerprint_load_word(bytes, w, num_bits);
+    sum += fingerprint_term(w, value);
+  }
+
+  atomicAdd(digest, static_cast<unsigned long long>(sum));
+}
+
+/// Accumulates the digest of the quantized elements of a block into `digest`
+template <typename Element>
+__global__ void BlockFingerprintQuantized(
+  unsigned long long *digest,
+  Element const *ptr,
+  size_t capacity,
+  int mantissa_bits,
+  double nonzero_floor) {
+
+  uint64_t sum = 0;
+  for (size_t idx = threadIdx.x + size_t(blockDim.x) * blockIdx.x; idx < capacity; idx += size_t(gridDim.x) * blockDim.x) {
+    Element value = cutlass::ReferenceFactory<Element>::get(ptr, idx);
+    sum += fingerprint_term(uint64_t(idx), FingerprintValue<Element>::quantize(value, mantissa_bits, nonzero_floor));
+  }
+
+  atomicAdd(digest, static_cast<unsigned long long>(sum));
+}
+
+} // namespace kernel
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes the exact and quantized digests of a block of elements in device memory. Elements are
+/// rounded to `mantissa_bits` bits, and elements smaller in magnitude than `nonzero_floor` count
+/// as zero.
+template <typename Element>
+TensorFingerprint BlockFingerprint(
+  Element const *ptr,
+  size_t capacity,
+  int mantissa_bits,
+  double nonzero_floor = 0,
+  int grid_size = 0,
+  int block_size = 0,
+  cudaStream_t stream = nullptr) {
+
+  unsigned long long *device_digests = nullptr;
+
+  if (cudaMalloc((void **)&device_digests, 2 * sizeof(unsigned long long)) != cudaSuccess) {
+    throw std::runtime_error("Failed to allocate device digests.");
+  }
+
+  if (cudaMemsetAsync(device_digests, 0, 2 * sizeof(unsigned long long), stream) != cudaSuccess) {
+    cudaFree(device_digests);
+    throw std::runtime_error("Failed to clear device digests.");
+  }
+
+  if (!grid_size || !block_size) {
+
+    // if grid_size or block_size are zero, query occupancy using the CUDA Occupancy API
+    cudaError_t result = cudaOccupancyMaxPotentialBlockSize(
+      &grid_size,
+      &block_size,
+      reinterpret_cast<void const *>(kernel::BlockFingerprintQuantized<Element>));
+
+    if (result != cudaSuccess) {
+      cudaFree(device_digests);
+      throw std::runtime_error("Failed to query occupancy.");
+    }
+    // Limit block size. This has the effect of increasing the number of items processed by a
+    // single thread and reduces the number of atomic updates.
+    block_size = (block_size < 128 ? block_size : 128);
+  }
+
+  dim3 grid(grid_size, 1, 1);
+  dim3 block(block_size, 1, 1);
+
+  uint64_t num_bits = uint64_t(capacity) * uint64_t(sizeof_bits<Element>::value);
+
+  kernel::BlockFingerprintExact<Element><<< grid, block, 0, stream >>>(
+    device_digests, reinterpret_cast<uint8_t const *>(ptr), num_bits);
+
+  kernel::BlockFingerprintQuantized<Element><<< grid, block, 0, stream >>>(
+    device_digests + 1, ptr, capacity, mantissa_bits, nonzero_floor);
+
+  unsigned long long digests[2] = {0, 0};
+
+  cudaError_t result = cudaMemcpyAsync(digests, device_digests, sizeof(digests), cudaMemcpyDeviceToHost, stream);
+  if (result == cudaSuccess) {
+    result = cudaStreamSynchronize(stream);
+  }
+
+  cudaFree(device_digests);
+
+  if (result != cudaSuccess) {
+    throw std::runtime_error("Failed to copy digests from device.");
+  }
+
+  // The initial terms depend only on the block size and are added on the host
+  TensorFingerprint fingerprint;
+  fingerprint.exact = uint64_t(digests[0]) + fingerprint_mix(num_bits);
+  fingerprint.quantized = uint64_t(digests[1]) + fingerprint_mix(uint64_t(capacity));
+  return fingerprint;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // device
+} // reference
+} // cutlass
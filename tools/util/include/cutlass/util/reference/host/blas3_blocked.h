@@ -0,0 +1,228 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Blocked, multithreaded engine shared by the BLAS3 host references.
+
+    The output is tiled into kBlas3Block x kBlas3Block tiles. For each block row, the left operand
+    is packed once into a K-major panel; for each referenced tile of the row, the right operand is
+    packed and multiplied with a register-blocked micro-kernel. Callers describe the structure of
+    the operation through three functions:
+
+      tiles(row_block)                    -> [first, last) column blocks written in this block row
+      k_range(row_block, col_block)       -> [begin, end) of the reduction that is not structurally zero
+      epilogue(tile_row, tile_col, accum) -> writes the tile whose first element is (tile_row, tile_col)
+
+    so triangular outputs and triangular operands are never computed. Block rows are partitioned
+    across threads into contiguous ranges of equal work, which keeps triangular problems balanced.
+    Within each output element, products are accumulated in increasing order of k.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "cutlass/util/host_thread_pool.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Edge length of the square output tiles
+static int const kBlas3Block = 16;
+
+/// Problems with fewer multiply-adds than this are computed on the calling thread
+static double const kBlas3ParallelThreshold = double(1 << 22);
+
+/// accum += a_panel * b_panel over `k_count` K-major packed columns of kBlock elements
+template <typename ComputeType, typename InnerProductOp, int kBlock>
+inline void blas3_micro_kernel(
+  int k_count,
+  ComputeType const *a_panel,
+  ComputeType const *b_panel,
+  ComputeType (&accum)[kBlock][kBlock],
+  InnerProductOp &inner_product_op) {
+
+  for (int k = 0; k < k_count; ++k) {
+    ComputeType const *a = a_panel + k * kBlock;
+    ComputeType const *b = b_panel + k * kBlock;
+    for (int j = 0; j < kBlock; ++j) {
+      for (int i = 0; i < kBlock; ++i) {
+        accum[i][j] = inner_product_op(a[i], b[j], accum[i][j]);
+      }
+    }
+  }
+}
+
+/// Calls func(row_block) for every block row, splitting them across the host thread pool into
+/// contiguous ranges of similar total weight
+template <typename Func>
+void blas3_parallel_for_row_blocks(std::vector<double> const &weights, Func &&func) {
+
+  int const row_blocks = int(weights.size());
+
+  double total = 0;
+  for (double w : weights) {
+    total += w;
+  }
+
+  if (total * kBlas3Block * kBlas3Block < kBlas3ParallelThreshold) {
+    for (int rb = 0; rb < row_blocks; ++rb) {
+      func(rb);
+    }
+    return;
+  }
+
+  cutlass::host_thread_pool().parallel_for_weighted(weights, [&](uint32_t rb) {
+    func(int(rb));
+  });
+}
+
+/// Computes the tiles of an M x N product selected by `tiles` and `k_range` and hands each
+/// accumulated tile to `epilogue`. Elements of the operands are obtained from load_a(row, k) and
+/// load_b(k, col), which are only called for rows < M and columns < N.
+template <
+  typename ComputeType,
+  typename InnerProductOp,
+  typename LoadA,
+  typename LoadB,
+  typename Tiles,
+  typename KRange,
+  typename Epilogue
+>
+void blas3_blocked_product(
+  int M,
+  int N,
+  LoadA load_a,
+  LoadB load_b,
+  Tiles tiles,
+  KRange k_range,
+  Epilogue epilogue,
+  ComputeType initial_accum) {
+
+  int const kBlock = kBlas3Block;
+  int const row_blocks = (M + kBlock - 1) / kBlock;
+
+  std::vector<double> weights(row_blocks, 0);
+  for (int rb = 0; rb < row_blocks; ++rb) {
+    std::pair<int, int> cols = tiles(rb);
+    for (int cb = cols.first; cb < cols.second; ++cb) {
+      std::pair<int, int> k = k_range(rb, cb);
+      weights[rb] += 1 + std::max(0, k.second - k.first);
+    }
+  }
+
+  blas3_parallel_for_row_blocks(weights, [&](int rb) {
+
+    std::pair<int, int> cols = tiles(rb);
+    if (cols.first >= cols.second) {
+      return;
+    }
+
+    // Reduction range covering every tile of the block row
+    int k_begin = k_range(rb, cols.first).first;
+    int k_end = k_range(rb, cols.first).second;
+    for (int cb = cols.first + 1; cb < cols.second; ++cb) {
+      std::pair<int, int> k = k_range(rb, cb);
+      if (k.first < k.second) {
+        k_begin = std::min(k_begin, k.first);
+        k_end = std::max(k_end, k.second);
+      }
+    }
+    k_end = std::max(k_begin, k_end);
+
+    int const row = rb * kBlock;
+    int const rows = std::min(kBlock, M - row);
+
+    std::vector<ComputeType> a_panel(size_t(k_end - k_begin) * kBlock, ComputeType());
+    for (int k = k_begin; k < k_end; ++k) {
+      for (int i = 0; i < rows; ++i) {
+        a_panel[size_t(k - k_begin) * kBlock + i] = load_a(row + i, k);
+      }
+    }
+
+    std::vector<ComputeType> b_panel(size_t(k_end - k_begin) * kBlock, ComputeType());
+    InnerProductOp inner_product_op;
+
+    for (int cb = cols.first; cb < cols.second; ++cb) {
+
+      int const col = cb * kBlock;
+      int const columns = std::min(kBlock, N - col);
+
+      std::pair<int, int> k = k_range(rb, cb);
+      int const k_count = std::max(0, k.second - k.first);
+
+      for (int kk = 0; kk < k_count; ++kk) {
+        ComputeType *b = &b_panel[size_t(kk) * kBlock];
+        for (int j = 0; j < columns; ++j) {
+          b[j] = load_b(k.first + kk, col + j);
+        }
+        for (int j = columns; j < kBlock; ++j) {
+          b[j] = ComputeType();
+        }
+      }
+
+      ComputeType accum[kBlas3Block][kBlas3Block];
+      for (int j = 0; j < kBlock; ++j) {
+        for (int i = 0; i < kBlock; ++i) {
+          accum[i][j] = initial_accum;
+        }
+      }
+
+      if (k_count > 0) {
+        blas3_micro_kernel<ComputeType, InnerProductOp, kBlas3Block>(
+          k_count, &a_panel[size_t(k.first - k_begin) * kBlock], b_panel.data(), accum, inner_product_op);
+      }
+
+      epilogue(row, col, accum);
+    }
+  });
+}
+
+/// Column blocks of a block row that intersect the stored triangle of a square output
+inline std::pair<int, int> blas3_triangle_tiles(bool lower, int row_block, int col_blocks) {
+  return lower ?
+    std::make_pair(0, std::min(row_block + 1, col_blocks)) :
+    std::make_pair(row_block, col_blocks);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
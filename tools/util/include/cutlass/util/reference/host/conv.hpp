@@ -41,6 +41,8 @@
 
 #include "cute/tensor.hpp"
 
+#include "cutlass/util/host_thread_pool.h"
+
 #include <cuda_runtime.h>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -200,6 +202,27 @@ struct ConvReferenceImpl {
   }
 
 private:
+  // Outputs narrower than a byte may share bytes with the outputs of another thread
+  static constexpr bool kParallelOutput = cute::sizeof_bits_v<ElementOut> >= 8;
+
+  // Calls func(i, j) for the indices of two collapsed outer loops on the shared host thread pool
+  template <class Func>
+  void parallel_for_outer(int32_t extent_i, int32_t extent_j, Func &&func) {
+    cutlass::host_thread_pool().parallel_for(int64_t(extent_i) * extent_j, [&](int64_t begin, int64_t end) {
+      for (int64_t idx = begin; idx < end; ++idx) {
+        func(int32_t(idx / extent_j), int32_t(idx % extent_j));
+      }
+    }, 1, kParallelOutput ? 0 : 1);
+  }
+
+  // Calls func(i, j, k) for the indices of three collapsed outer loops on the shared host thread pool
+  template <class Func>
+  void parallel_for_outer(int32_t extent_i, int32_t extent_j, int32_t extent_k, Func &&func) {
+    parallel_for_outer(extent_i, extent_j * extent_k, [&](int32_t i, int32_t jk) {
+      func(i, jk / extent_k, jk % extent_k);
+    });
+  }
+
   // Specialization for 1D fprop kernel
   void fprop_reference(cute::Int<1> spatial_dims) {
     int32_t G = size<3>(tensor_d_);
@@ -209,44 +232,39 @@ private:
     int32_t S = size<1>(tensor_b_);
     int32_t C = size<0>(tensor_b_);
 
-#if defined(_OPENMP)
-  #pragma omp parallel for collapse(2)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t q = 0; q < Q; ++q) {
-          for (int32_t k = 0; k < K; ++k) {
-            auto accumulator = ElementAcc(0);
-            for (int32_t s = 0; s < S; ++s) {
-              for (int32_t c = 0; c < C; ++c) {
-                int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                if (detail::is_activation_in_bounds(tensor_a_, n, w, c, g)) {
-                  auto a = tensor_a_(c, w, n, g);
-                  auto b = tensor_b_(c, s, k, g);
-                  accumulator += ElementAcc(a * b);
-                }
+    parallel_for_outer(G, N, [&](int32_t g, int32_t n) {
+      for (int32_t q = 0; q < Q; ++q) {
+        for (int32_t k = 0; k < K; ++k) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t s = 0; s < S; ++s) {
+            for (int32_t c = 0; c < C; ++c) {
+              int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+              if (detail::is_activation_in_bounds(tensor_a_, n, w, c, g)) {
+                auto a = tensor_a_(c, w, n, g);
+                auto b = tensor_b_(c, s, k, g);
+                accumulator += ElementAcc(a * b);
               }
             }
-            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-              epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
-            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-              epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
-            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-            if (not EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(k, q, n, g));
-            }
-            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-              output += bias_converter(epi_fusion_params_.tensor_bias[k]);
-            }
-            output = epi_activation(output);
-            if (EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(k, q, n, g));
-            }
-            tensor_d_(k, q, n, g) = output_converter(output);
           }
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+            epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+            epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(k, q, n, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[k]);
+          }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(k, q, n, g));
+          }
+          tensor_d_(k, q, n, g) = output_converter(output);
         }
       }
-    }
+    });
 
   }
 
@@ -261,49 +279,42 @@ private:
     int32_t S = size<1>(tensor_b_);
     int32_t C = size<0>(tensor_b_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t p = 0; p < P; ++p) {
-          for (int32_t q = 0; q < Q; ++q) {
-            for (int32_t k = 0; k < K; ++k) {
-              auto accumulator = ElementAcc(0);
-              for (int32_t r = 0; r < R; ++r) {
-                for (int32_t s = 0; s < S; ++s) {
-                  for (int32_t c = 0; c < C; ++c) {
-                    int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                    int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
-                    if (detail::is_activation_in_bounds(tensor_a_, n, h, w, c, g)) {
-                      auto a = tensor_a_(c, w, h, n, g);
-                      auto b = tensor_b_(c, s, r, k, g);
-                      accumulator += ElementAcc(a * b);
-                    }
-                  }
+    parallel_for_outer(G, N, P, [&](int32_t g, int32_t n, int32_t p) {
+      for (int32_t q = 0; q < Q; ++q) {
+        for (int32_t k = 0; k < K; ++k) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t r = 0; r < R; ++r) {
+            for (int32_t s = 0; s < S; ++s) {
+              for (int32_t c = 0; c < C; ++c) {
+                int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+                int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
+                if (detail::is_activation_in_bounds(tensor_a_, n, h, w, c, g)) {
+                  auto a = tensor_a_(c, w, h, n, g);
+                  auto b = tensor_b_(c, s, r, k, g);
+                  accumulator += ElementAcc(a * b);
                 }
               }
-              ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-                epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
-              ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-                epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
-              ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-              if (not EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, n, g));
-              }
-              if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                output += bias_converter(epi_fusion_params_.tensor_bias[k]);
-              }
-              output = epi_activation(output);
-              if (EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, n, g));
-              }
-              tensor_d_(k, q, p, n, g) = output_converter(output);
             }
           }
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+            epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+            epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, n, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[k]);
+          }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, n, g));
+          }
+          tensor_d_(k, q, p, n, g) = output_converter(output);
         }
       }
-    }
+    });
 
   }
 
@@ -320,54 +331,47 @@ private:
     int32_t S = size<1>(tensor_b_);
     int32_t C = size<0>(tensor_b_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t z = 0; z < Z; ++z) {
-          for (int32_t p = 0; p < P; ++p) {
-            for (int32_t q = 0; q < Q; ++q) {
-              for (int32_t k = 0; k < K; ++k) {
-                auto accumulator = ElementAcc(0);
-                for (int32_t t = 0; t < T; ++t) {
-                  for (int32_t r = 0; r < R; ++r) {
-                    for (int32_t s = 0; s < S; ++s) {
-                      for (int32_t c = 0; c < C; ++c) {
-                        int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                        int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
-                        int32_t d =  z * cute::get<2>(tstride_) - cute::get<2>(padding_) + t * cute::get<2>(dilation_);
-                        if (detail::is_activation_in_bounds(tensor_a_, n, d, h, w, c, g)) {
-                          auto a = tensor_a_(c, w, h, d, n, g);
-                          auto b = tensor_b_(c, s, r, t, k, g);
-                          accumulator += ElementAcc(a * b);
-                        }
-                      }
+    parallel_for_outer(G, N, Z, [&](int32_t g, int32_t n, int32_t z) {
+      for (int32_t p = 0; p < P; ++p) {
+        for (int32_t q = 0; q < Q; ++q) {
+          for (int32_t k = 0; k < K; ++k) {
+            auto accumulator = ElementAcc(0);
+            for (int32_t t = 0; t < T; ++t) {
+              for (int32_t r = 0; r < R; ++r) {
+                for (int32_t s = 0; s < S; ++s) {
+                  for (int32_t c = 0; c < C; ++c) {
+                    int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+                    int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
+                    int32_t d =  z * cute::get<2>(tstride_) - cute::get<2>(padding_) + t * cute::get<2>(dilation_);
+                    if (detail::is_activation_in_bounds(tensor_a_, n, d, h, w, c, g)) {
+                      auto a = tensor_a_(c, w, h, d, n, g);
+                      auto b = tensor_b_(c, s, r, t, k, g);
+                      accumulator += ElementAcc(a * b);
                     }
                   }
                 }
-                ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-                  epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
-                ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-                  epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
-                ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-                if (not EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, z, n, g));
-                }
-                if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                  output += bias_converter(epi_fusion_params_.tensor_bias[k]);
-                }
-                output = epi_activation(output);
-                if (EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, z, n, g));
-                }
-                tensor_d_(k, q, p, z, n, g) = output_converter(output);
               }
             }
+            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+              epi_fusion_params_.tensor_alpha[k] : epi_fusion_params_.alpha;
+            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+              epi_fusion_params_.tensor_beta[k] : epi_fusion_params_.beta;
+            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+            if (not EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, z, n, g));
+            }
+            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+              output += bias_converter(epi_fusion_params_.tensor_bias[k]);
+            }
+            output = epi_activation(output);
+            if (EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(k, q, p, z, n, g));
+            }
+            tensor_d_(k, q, p, z, n, g) = output_converter(output);
           }
         }
       }
-    }
+    });
 
   }
 
@@ -380,49 +384,44 @@ private:
     int32_t K = size<2>(tensor_b_);
     int32_t S = size<1>(tensor_b_);
 
-#if defined(_OPENMP)
-   #pragma omp parallel for collapse(2)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t w = 0; w < W; ++w) {
-          for (int32_t c = 0; c < C; ++c) {
-            auto accumulator = ElementAcc(0);
-            for (int32_t k = 0; k < K; ++k) {
-              for (int32_t s = 0; s < S; ++s) {
-                int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
+    parallel_for_outer(G, N, [&](int32_t g, int32_t n) {
+      for (int32_t w = 0; w < W; ++w) {
+        for (int32_t c = 0; c < C; ++c) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t k = 0; k < K; ++k) {
+            for (int32_t s = 0; s < S; ++s) {
+              int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
 
-                if (q % cute::get<0>(tstride_) == 0) {
-                  q /= cute::get<0>(tstride_);
-                } else {
-                  continue;
-                }
+              if (q % cute::get<0>(tstride_) == 0) {
+                q /= cute::get<0>(tstride_);
+              } else {
+                continue;
+              }
 
-                if (detail::is_activation_in_bounds(tensor_a_, n, q, k, g)) {
-                  accumulator += ElementAcc(tensor_a_(k, q, n, g) * tensor_b_(c, s, k, g));
-                }
+              if (detail::is_activation_in_bounds(tensor_a_, n, q, k, g)) {
+                accumulator += ElementAcc(tensor_a_(k, q, n, g) * tensor_b_(c, s, k, g));
               }
             }
-            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
-              ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
-              ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
-            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-            if (not EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(c, w, n, g));
-            }
-            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-              output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-            }
-            output = epi_activation(output);
-            if (EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(c, w, n, g));
-            }
-            tensor_d_(c, w, n, g) = output_converter(output);
           }
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
+            ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
+            ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, w, n, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[c]);
+          }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, w, n, g));
+          }
+          tensor_d_(c, w, n, g) = output_converter(output);
         }
       }
-    }
+    });
 
   }
 
@@ -437,61 +436,54 @@ private:
     int32_t R = size<2>(tensor_b_);
     int32_t S = size<1>(tensor_b_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t h = 0; h < H; ++h) {
-          for (int32_t w = 0; w < W; ++w) {
-            for (int32_t c = 0; c < C; ++c) {
-              auto accumulator = ElementAcc(0);
-              for (int32_t k = 0; k < K; ++k) {
-                for (int32_t r = 0; r < R; ++r) {
-                  for (int32_t s = 0; s < S; ++s) {
-                    int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
-                    int32_t p = h + cute::get<1>(padding_) - r * cute::get<1>(dilation_);
+    parallel_for_outer(G, N, H, [&](int32_t g, int32_t n, int32_t h) {
+      for (int32_t w = 0; w < W; ++w) {
+        for (int32_t c = 0; c < C; ++c) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t k = 0; k < K; ++k) {
+            for (int32_t r = 0; r < R; ++r) {
+              for (int32_t s = 0; s < S; ++s) {
+                int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
+                int32_t p = h + cute::get<1>(padding_) - r * cute::get<1>(dilation_);
 
-                    if (q % cute::get<0>(tstride_) == 0) {
-                      q /= cute::get<0>(tstride_);
-                    } else {
-                      continue;
-                    }
+                if (q % cute::get<0>(tstride_) == 0) {
+                  q /= cute::get<0>(tstride_);
+                } else {
+                  continue;
+                }
 
-                    if (p % cute::get<1>(tstride_) == 0) {
-                      p /= cute::get<1>(tstride_);
-                    } else {
-                      continue;
-                    }
+                if (p % cute::get<1>(tstride_) == 0) {
+                  p /= cute::get<1>(tstride_);
+                } else {
+                  continue;
+                }
 
-                    if (detail::is_activation_in_bounds(tensor_a_, n, p, q, k, g)) {
-                      accumulator += ElementAcc(tensor_a_(k, q, p, n, g) * tensor_b_(c, s, r, k, g));
-                    }
-                  }
+                if (detail::is_activation_in_bounds(tensor_a_, n, p, q, k, g)) {
+                  accumulator += ElementAcc(tensor_a_(k, q, p, n, g) * tensor_b_(c, s, r, k, g));
                 }
               }
-              ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
-                ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-              ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
-                ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
-              ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-              if (not EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, n, g));
-              }
-              if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-              }
-              output = epi_activation(output);
-              if (EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, n, g));
-              }
-
-              tensor_d_(c, w, h, n, g) = output_converter(output);
             }
           }
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
+            ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
+            ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, n, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[c]);
+          }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, n, g));
+          }
+
+          tensor_d_(c, w, h, n, g) = output_converter(output);
         }
       }
-    }
+    });
 
   }
 
@@ -508,71 +500,64 @@ private:
     int32_t R = size<2>(tensor_b_);
     int32_t S = size<1>(tensor_b_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t n = 0; n < N; ++n) {
-        for (int32_t d = 0; d < D; ++d) {
-          for (int32_t h = 0; h < H; ++h) {
-            for (int32_t w = 0; w < W; ++w) {
-              for (int32_t c = 0; c < C; ++c) {
-                auto accumulator = ElementAcc(0);
-                for (int32_t k = 0; k < K; ++k) {
-                  for (int32_t t = 0; t < T; ++t) {
-                    for (int32_t r = 0; r < R; ++r) {
-                      for (int32_t s = 0; s < S; ++s) {
-                        int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
-                        int32_t p = h + cute::get<1>(padding_) - r * cute::get<1>(dilation_);
-                        int32_t z = d + cute::get<2>(padding_) - t * cute::get<2>(dilation_);
-
-                        if (q % cute::get<0>(tstride_) == 0) {
-                          q /= cute::get<0>(tstride_);
-                        } else {
-                          continue;
-                        }
-
-                        if (p % cute::get<1>(tstride_) == 0) {
-                          p /= cute::get<1>(tstride_);
-                        } else {
-                          continue;
-                        }
-
-                        if (z % cute::get<2>(tstride_) == 0) {
-                          z /= cute::get<2>(tstride_);
-                        } else {
-                          continue;
-                        }
-
-                        if (detail::is_activation_in_bounds(tensor_a_, n, z, p, q, k, g)) {
-                          accumulator += ElementAcc(tensor_a_(k, q, p, z, n, g) * tensor_b_(c, s, r, t, k, g));
-                        }
-                      }
+    parallel_for_outer(G, N, D, [&](int32_t g, int32_t n, int32_t d) {
+      for (int32_t h = 0; h < H; ++h) {
+        for (int32_t w = 0; w < W; ++w) {
+          for (int32_t c = 0; c < C; ++c) {
+            auto accumulator = ElementAcc(0);
+            for (int32_t k = 0; k < K; ++k) {
+              for (int32_t t = 0; t < T; ++t) {
+                for (int32_t r = 0; r < R; ++r) {
+                  for (int32_t s = 0; s < S; ++s) {
+                    int32_t q = w + cute::get<0>(padding_) - s * cute::get<0>(dilation_);
+                    int32_t p = h + cute::get<1>(padding_) - r * cute::get<1>(dilation_);
+                    int32_t z = d + cute::get<2>(padding_) - t * cute::get<2>(dilation_);
+
+                    if (q % cute::get<0>(tstride_) == 0) {
+                      q /= cute::get<0>(tstride_);
+                    } else {
+                      continue;
+                    }
+
+                    if (p % cute::get<1>(tstride_) == 0) {
+                      p /= cute::get<1>(tstride_);
+                    } else {
+                      continue;
+                    }
+
+                    if (z % cute::get<2>(tstride_) == 0) {
+                      z /= cute::get<2>(tstride_);
+                    } else {
+                      continue;
+                    }
+
+                    if (detail::is_activation_in_bounds(tensor_a_, n, z, p, q, k, g)) {
+                      accumulator += ElementAcc(tensor_a_(k, q, p, z, n, g) * tensor_b_(c, s, r, t, k, g));
                     }
                   }
                 }
-                ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
-                  ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-                ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
-                  ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
-                ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-                if (not EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, d, n, g));
-                }
-                if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                  output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-                }
-                output = epi_activation(output);
-                if (EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, d, n, g));
-                }
-                tensor_d_(c, w, h, d, n, g) = output_converter(output);
               }
             }
+            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data())
+              ? epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data())
+              ? epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+            if (not EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, d, n, g));
+            }
+            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+              output += bias_converter(epi_fusion_params_.tensor_bias[c]);
+            }
+            output = epi_activation(output);
+            if (EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(c, w, h, d, n, g));
+            }
+            tensor_d_(c, w, h, d, n, g) = output_converter(output);
           }
         }
       }
-    }
+    });
 
   }
 
@@ -588,50 +573,45 @@ private:
     int32_t S = size<1>(tensor_d_);
     int32_t C = size<0>(tensor_d_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(2)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t k = 0; k < K; ++k) {
-        for (int32_t s = 0; s < S; ++s) {
-          for (int32_t c = 0; c < C; ++c) {
-            auto accumulator = ElementAcc(0);
-            for (int32_t n = 0; n < N; ++n) {
-              for (int32_t q = 0; q < Q; ++q) {
-                int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                bool is_in_bounds =
-                    detail::is_activation_in_bounds(tensor_b_, n, w, c, g);
-                if (is_in_bounds) {
-                  auto act =
-                      tensor_b_(c, w, n, g);
-                  auto xformed_act =
-                      tensor_a_(k, q, n, g);
-                  accumulator += ElementAcc(act * xformed_act);
-                }
+    parallel_for_outer(G, K, [&](int32_t g, int32_t k) {
+      for (int32_t s = 0; s < S; ++s) {
+        for (int32_t c = 0; c < C; ++c) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t n = 0; n < N; ++n) {
+            for (int32_t q = 0; q < Q; ++q) {
+              int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+              bool is_in_bounds =
+                  detail::is_activation_in_bounds(tensor_b_, n, w, c, g);
+              if (is_in_bounds) {
+                auto act =
+                    tensor_b_(c, w, n, g);
+                auto xformed_act =
+                    tensor_a_(k, q, n, g);
+                accumulator += ElementAcc(act * xformed_act);
               }
             }
+          }
 
-            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-              epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-              epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+            epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+            epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
 
-            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-            if (not EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(c, s, k, g));
-            }
-            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-              output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-            }
-            output = epi_activation(output);
-            if (EpilogueFusionParams::ResidualAdd) {
-              output += scale_converter(beta) * residual_converter(tensor_c_(c, s, k, g));
-            }
-            tensor_d_(c, s, k, g) = output_converter(output);
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, s, k, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[c]);
           }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, s, k, g));
+          }
+          tensor_d_(c, s, k, g) = output_converter(output);
         }
       }
-    }
+    });
   }
 
   // Specialization for 2D wgrad kernel
@@ -649,55 +629,48 @@ private:
     int32_t S = size<1>(tensor_d_);
     int32_t C = size<0>(tensor_d_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0; g < G; ++g) {
-      for (int32_t k = 0; k < K; ++k) {
-        for (int32_t r = 0; r < R; ++r) {
-          for (int32_t s = 0; s < S; ++s) {
-            for (int32_t c = 0; c < C; ++c) {
-              auto accumulator = ElementAcc(0);
-              for (int32_t n = 0; n < N; ++n) {
-                for (int32_t p = 0; p < P; ++p) {
-                  for (int32_t q = 0; q < Q; ++q) {
-                    int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                    int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
-                    bool is_in_bounds =
-                        detail::is_activation_in_bounds(tensor_b_, n, h, w, c, g);
-                    if (is_in_bounds) {
-                      auto act =
-                          tensor_b_(c, w, h, n, g);
-                      auto xformed_act =
-                          tensor_a_(k, q, p, n, g);
-                      accumulator += ElementAcc(act * xformed_act);
-                    }
-                  }
+    parallel_for_outer(G, K, R, [&](int32_t g, int32_t k, int32_t r) {
+      for (int32_t s = 0; s < S; ++s) {
+        for (int32_t c = 0; c < C; ++c) {
+          auto accumulator = ElementAcc(0);
+          for (int32_t n = 0; n < N; ++n) {
+            for (int32_t p = 0; p < P; ++p) {
+              for (int32_t q = 0; q < Q; ++q) {
+                int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+                int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
+                bool is_in_bounds =
+                    detail::is_activation_in_bounds(tensor_b_, n, h, w, c, g);
+                if (is_in_bounds) {
+                  auto act =
+                      tensor_b_(c, w, h, n, g);
+                  auto xformed_act =
+                      tensor_a_(k, q, p, n, g);
+                  accumulator += ElementAcc(act * xformed_act);
                 }
               }
+            }
+          }
 
-              ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-                epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-              ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-                epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+          ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+            epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+          ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+            epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
 
-              ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-              if (not EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, k, g));
-              }
-              if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-              }
-              output = epi_activation(output);
-              if (EpilogueFusionParams::ResidualAdd) {
-                output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, k, g));
-              }
-              tensor_d_(c, s, r, k, g) = output_converter(output);
-            }
+          ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+          if (not EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, k, g));
+          }
+          if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+            output += bias_converter(epi_fusion_params_.tensor_bias[c]);
           }
+          output = epi_activation(output);
+          if (EpilogueFusionParams::ResidualAdd) {
+            output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, k, g));
+          }
+          tensor_d_(c, s, r, k, g) = output_converter(output);
         }
       }
-    }
+    });
   }
 
   // Specialization for 3D wgrad kernel
@@ -718,60 +691,53 @@ private:
     int32_t S = size<1>(tensor_d_);
     int32_t C = size<0>(tensor_d_);
 
-#if defined(_OPENMP)
-    #pragma omp parallel for collapse(3)
-#endif
-    for (int32_t g = 0 ; g < G; ++g) {
-      for (int32_t k = 0; k < K; ++k) {
-        for (int32_t t = 0; t < T; ++t) {
-          for (int32_t r = 0; r < R; ++r) {
-            for (int32_t s = 0; s < S; ++s) {
-              for (int32_t c = 0; c < C; ++c) {
-                auto accumulator = ElementAcc(0);
-                for (int32_t n = 0; n < N; ++n) {
-                  for (int32_t z = 0; z < Z; ++z) {
-                    for (int32_t p = 0; p < P; ++p) {
-                      for (int32_t q = 0; q < Q; ++q) {
-                        int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
-                        int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
-                        int32_t d =  z * cute::get<2>(tstride_) - cute::get<2>(padding_) + t * cute::get<2>(dilation_);
-                        bool is_in_bounds =
-                            detail::is_activation_in_bounds(tensor_b_, n, d, h, w, c, g);
-                        if (is_in_bounds) {
-                          auto act =
-                              tensor_b_(c, w, h, d, n, g);
-                          auto xformed_act =
-                              tensor_a_(k, q, p, z, n, g);
-                          accumulator += ElementAcc(act * xformed_act);
-                        }
-                      }
+    parallel_for_outer(G, K, T, [&](int32_t g, int32_t k, int32_t t) {
+      for (int32_t r = 0; r < R; ++r) {
+        for (int32_t s = 0; s < S; ++s) {
+          for (int32_t c = 0; c < C; ++c) {
+            auto accumulator = ElementAcc(0);
+            for (int32_t n = 0; n < N; ++n) {
+              for (int32_t z = 0; z < Z; ++z) {
+                for (int32_t p = 0; p < P; ++p) {
+                  for (int32_t q = 0; q < Q; ++q) {
+                    int32_t w =  q * cute::get<0>(tstride_) - cute::get<0>(padding_) + s * cute::get<0>(dilation_);
+                    int32_t h =  p * cute::get<1>(tstride_) - cute::get<1>(padding_) + r * cute::get<1>(dilation_);
+                    int32_t d =  z * cute::get<2>(tstride_) - cute::get<2>(padding_) + t * cute::get<2>(dilation_);
+                    bool is_in_bounds =
+                        detail::is_activation_in_bounds(tensor_b_, n, d, h, w, c, g);
+                    if (is_in_bounds) {
+                      auto act =
+                          tensor_b_(c, w, h, d, n, g);
+                      auto xformed_act =
+                          tensor_a_(k, q, p, z, n, g);
+                      accumulator += ElementAcc(act * xformed_act);
                     }
                   }
                 }
+              }
+            }
 
-                ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
-                  epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
-                ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
-                  epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
+            ElementScalar alpha = raw_pointer_cast(epi_fusion_params_.tensor_alpha.data()) ?
+              epi_fusion_params_.tensor_alpha[c] : epi_fusion_params_.alpha;
+            ElementScalar beta = raw_pointer_cast(epi_fusion_params_.tensor_beta.data()) ?
+              epi_fusion_params_.tensor_beta[c] : epi_fusion_params_.beta;
 
-                ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
-                if (not EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, t, k, g));
-                }
-                if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
-                  output += bias_converter(epi_fusion_params_.tensor_bias[c]);
-                }
-                output = epi_activation(output);
-                if (EpilogueFusionParams::ResidualAdd) {
-                  output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, t, k, g));
-                }
-                tensor_d_(c, s, r, t, k, g) = output_converter(output);
-              }
+            ElementCompute output = scale_converter(alpha) * acc_converter(accumulator);
+            if (not EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, t, k, g));
+            }
+            if (raw_pointer_cast(epi_fusion_params_.tensor_bias.data())) {
+              output += bias_converter(epi_fusion_params_.tensor_bias[c]);
             }
+            output = epi_activation(output);
+            if (EpilogueFusionParams::ResidualAdd) {
+              output += scale_converter(beta) * residual_converter(tensor_c_(c, s, r, t, k, g));
+            }
+            tensor_d_(c, s, r, t, k, g) = output_converter(output);
           }
         }
       }
-    }
+    });
   }
 };
 
@@ -0,0 +1,664 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Host implementations of the epilogue thread functors over long contiguous spans.
+
+    The functors in cutlass/epilogue/thread operate on one Array fragment at a time, and heavy
+    activations evaluate std::exp, std::tanh or erff per element. The classes here apply the
+    same operations to whole spans. The linear part reuses the functors' own conversions and
+    arithmetic on each element and is bit-identical to the fragment path. Heavy float
+    activations (Sigmoid, SiLu, Tanh, GELU, GELU_taylor) are evaluated with branch-free
+    polynomial approximations that compilers vectorize for the target instruction set.
+
+    Vectorized activations agree with the scalar functors to within
+
+      |vector - scalar| <= kEpilogueSpanRelativeTolerance * |scalar| + kEpilogueSpanAbsoluteTolerance
+
+    All other activations, and all activations computed in types other than float, call the
+    scalar functor on each element and match it exactly.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/array.h"
+#include "cutlass/functional.h"
+#include "cutlass/numeric_conversion.h"
+#include "cutlass/epilogue/thread/activation.h"
+#include "cutlass/epilogue/thread/linear_combination.h"
+#include "cutlass/epilogue/thread/linear_combination_generic.h"
+#include "cutlass/epilogue/thread/linear_combination_bias_elementwise.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Bound on the relative difference between vectorized and scalar activations
+static double const kEpilogueSpanRelativeTolerance = 1.0e-6;
+
+/// Bound on the absolute difference between vectorized and scalar activations, covering results
+/// that are small because of cancellation (e.g. GELU of large negative arguments)
+static double const kEpilogueSpanAbsoluteTolerance = 1.0e-6;
+
+namespace detail {
+
+/// Elements converted to the compute type at a time
+static int const kEpilogueSpanBlock = 256;
+
+/// e^x for float with a Cody-Waite range reduction and a degree-6 polynomial
+inline float epilogue_span_exp(float x) {
+  float const kMax = 88.72283935546875f;
+  float const kMin = -104.0f;
+  float const kLog2e = 1.44269504088896341f;
+  float const kLn2Hi = 0.693359375f;
+  float const kLn2Lo = -2.12194440e-4f;
+  float const kRound = 12582912.0f;  // 1.5 * 2^23
+
+  float c = std::min(std::max(x, kMin), kMax);
+
+  // n = round(c / ln 2)
+  float n = (c * kLog2e + kRound) - kRound;
+  float r = c - n * kLn2Hi;
+  r = r - n * kLn2Lo;
+
+  float p = 1.9875691500e-4f;
+  p = p * r + 1.3981999507e-3f;
+  p = p * r + 8.3334519073e-3f;
+  p = p * r + 4.1665795894e-2f;
+  p = p * r + 1.6666665459e-1f;
+  p = p * r + 5.0000001201e-1f;
+  p = p * r * r + r + 1.0f;
+
+  // Scale by 2^n in two steps so that both factors are normal across the whole range,
+  // including results that are denormal
+  int32_t e = int32_t(n);
+  int32_t e_lo = e >> 1;
+  int32_t bits_lo = (e_lo + 127) << 23;
+  int32_t bits_hi = (e - e_lo + 127) << 23;
+  float scale_lo;
+  float scale_hi;
+  std::memcpy(&scale_lo, &bits_lo, sizeof(float));
+  std::memcpy(&scale_hi, &bits_hi, sizeof(float));
+  float y = p * scale_lo * scale_hi;
+
+  y = (x > kMax) ? std::numeric_limits<float>::infinity() : y;
+  y = (x < kMin) ? 0.0f : y;
+  return (x != x) ? x : y;
+}
+
+/// tanh(x) for float: an odd polynomial near zero, 1 - 2 / (e^2|x| + 1) elsewhere
+inline float epilogue_span_tanh(float x) {
+  float a = std::abs(x);
+
+  float z = x * x;
+  float p = -5.70498872745e-3f;
+  p = p * z + 2.06390887954e-2f;
+  p = p * z - 5.37397155531e-2f;
+  p = p * z + 1.33314422036e-1f;
+  p = p * z - 3.33332819422e-1f;
+  float small = p * z * x + x;
+
+  float e = epilogue_span_exp(2.0f * a);
+  float large = std::copysign(1.0f - 2.0f / (e + 1.0f), x);
+
+  return (a < 0.625f) ? small : large;
+}
+
+/// 1 + erf(x) for float, computed as erfc(-x) for negative arguments to avoid cancellation
+inline float epilogue_span_one_plus_erf(float x) {
+  float a = std::abs(x);
+
+  // Maclaurin series, accurate to float precision for |x| < 0.5
+  float z = x * x;
+  float s = -1.0f / 1320.0f;
+  s = s * z + 1.0f / 216.0f;
+  s = s * z - 1.0f / 42.0f;
+  s = s * z + 1.0f / 10.0f;
+  s = s * z - 1.0f / 3.0f;
+  s = s * z + 1.0f;
+  float small = 1.0f + 1.12837916709551257f * x * s;
+
+  // Abramowitz and Stegun 7.1.26: erfc(a) = t * P(t) * e^(-a^2), absolute error < 1.5e-7
+  float t = 1.0f / (1.0f + 0.3275911f * a);
+  float q = 1.061405429f;
+  q = q * t - 1.453152027f;
+  q = q * t + 1.421413741f;
+  q = q * t - 0.284496736f;
+  q = q * t + 0.254829592f;
+  float erfc = q * t * epilogue_span_exp(-a * a);
+  float large = (x < 0.0f) ? erfc : 2.0f - erfc;
+
+  return (a < 0.5f) ? small : large;
+}
+
+inline float epilogue_span_sigmoid(float x) {
+  return 1.0f / (1.0f + epilogue_span_exp(-x));
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Applies an activation functor in place to `count` contiguous elements.
+///
+/// The primary template calls the scalar functor on each element; specializations below
+/// vectorize heavy float activations.
+template <typename Activation>
+struct ActivationSpan {
+
+  static bool const kVectorized = false;
+
+  template <typename T>
+  void operator()(T *data, int64_t count) const {
+    Activation op;
+    for (int64_t i = 0; i < count; ++i) {
+      data[i] = op(data[i]);
+    }
+  }
+
+  template <typename T, typename Arguments>
+  void operator()(T *data, int64_t count, Arguments const &args) const {
+    Activation op;
+    for (int64_t i = 0; i < count; ++i) {
+      data[i] = op(data[i], args);
+    }
+  }
+};
+
+template <>
+struct ActivationSpan<epilogue::thread::Sigmoid<float>> {
+
+  static bool const kVectorized = true;
+
+  void operator()(float *data, int64_t count) const {
+    for (int64_t i = 0; i < count; ++i) {
+      data[i] = detail::epilogue_span_sigmoid(data[i]);
+    }
+  }
+};
+
+template <>
+struct ActivationSpan<epilogue::thread::SiLu<float>> {
+
+  static bool const kVectorized = true;
+
+  void operator()(float *data, int64_t count) const {
+    for (int64_t i = 0; i < count; ++i) {
+      float x = data[i];
+      data[i] = x * detail::epilogue_span_sigmoid(x);
+    }
+  }
+};
+
+template <>
+struct ActivationSpan<epilogue::thread::Tanh<float>> {
+
+  static bool const kVectorized = true;
+
+  void operator()(float *data, int64_t count) const {
+    for (int64_t i = 0; i < count; ++i) {
+      data[i] = detail::epilogue_span_tanh(data[i]);
+    }
+  }
+};
+
+template <>
+struct ActivationSpan<epilogue::thread::GELU<float>> {
+
+  static bool const kVectorized = true;
+
+  void operator()(float *data, int64_t count) const {
+    for (int64_t i = 0; i < count; ++i) {
+      float x = data[i];
+      data[i] = 0.5f * x * detail::epilogue_span_one_plus_erf(x * 0.70710678118654752f);
+    }
+  }
+};
+
+template <>
+struct ActivationSpan<epilogue::thread::GELU_taylor<float>> {
+
+  static bool const kVectorized = true;
+
+  void operator()(float *data, int64_t count) const {
+    // Same sequence of operations as GELU_taylor<float>, with tanh vectorized
+    float const k0 = float(0.7978845608028654);
+    float const k1 = float(k0 * float(0.044715));
+    for (int64_t i = 0; i < count; ++i) {
+      float z = data[i];
+      float v1 = k1 * z * z + k0;
+      float v3 = detail::epilogue_span_tanh(z * v1);
+      data[i] = 0.5f * (z * v3 + z);
+    }
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// compute[i] = alpha * accum[i] + beta * source[i] with the operation order of LinearCombination
+/// and LinearCombinationGeneric. A null source computes alpha * accum[i].
+template <
+  typename ElementCompute,
+  typename ElementAccumulator,
+  typename ElementSource,
+  epilogue::thread::ScaleType::Kind Scale,
+  FloatRoundStyle Round
+>
+void epilogue_span_linear_combination(
+  ElementCompute *compute,
+  ElementAccumulator const *accum,
+  ElementSource const *source,
+  int count,
+  ElementCompute alpha,
+  ElementCompute beta) {
+
+  using ScaleType = epilogue::thread::ScaleType;
+
+  NumericConverter<ElementCompute, ElementAccumulator, Round> accumulator_converter;
+  NumericConverter<ElementCompute, ElementSource, Round> source_converter;
+  multiplies<ElementCompute> mul;
+  multiply_add<ElementCompute> mul_add;
+
+  if (Scale == ScaleType::Nothing) {
+    for (int i = 0; i < count; ++i) {
+      compute[i] = accumulator_converter(accum[i]);
+    }
+  }
+  else if (!source) {
+    for (int i = 0; i < count; ++i) {
+      compute[i] = mul(alpha, accumulator_converter(accum[i]));
+    }
+  }
+  else if (Scale == ScaleType::NoBetaScaling) {
+    for (int i = 0; i < count; ++i) {
+      compute[i] = mul_add(alpha, accumulator_converter(accum[i]), source_converter(source[i]));
+    }
+  }
+  else {
+    for (int i = 0; i < count; ++i) {
+      ElementCompute x = mul(beta, source_converter(source[i]));
+      compute[i] = mul_add(alpha, accumulator_converter(accum[i]), x);
+    }
+  }
+}
+
+template <typename ElementOutput, typename ElementCompute, FloatRoundStyle Round>
+void epilogue_span_store(ElementOutput *output, ElementCompute const *compute, int count) {
+  NumericConverter<ElementOutput, ElementCompute, Round> destination_converter;
+  for (int i = 0; i < count; ++i) {
+    output[i] = destination_converter(compute[i]);
+  }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Applies an epilogue output operator to contiguous spans of accumulators and source elements.
+///
+/// The primary template calls the fragment operator on consecutive fragments, zero-padding the
+/// last one. Specializations for LinearCombination and LinearCombinationGeneric (including
+/// LinearCombinationGELU, LinearCombinationSilu and LinearCombinationSigmoid) process the span
+/// in blocks and vectorize the activation.
+template <typename OutputOp>
+class EpilogueSpan {
+public:
+
+  using ElementOutput = typename OutputOp::FragmentOutput::Element;
+  using ElementAccumulator = typename OutputOp::FragmentAccumulator::Element;
+  using ElementSource = typename OutputOp::FragmentSource::Element;
+
+  static int const kCount = OutputOp::kCount;
+  static bool const kVectorized = false;
+
+  explicit EpilogueSpan(typename OutputOp::Params const &params): op_(params) { }
+
+  bool is_source_needed() const {
+    return op_.is_source_needed();
+  }
+
+  /// D = op(accum, source). The source is only read if a non-null pointer is given and the
+  /// operator needs it, following the convention of the device epilogues.
+  void operator()(
+    ElementOutput *D,
+    ElementAccumulator const *accum,
+    ElementSource const *source,
+    int64_t count) const {
+
+    bool use_source = source && op_.is_source_needed();
+
+    for (int64_t offset = 0; offset < count; offset += kCount) {
+      int n = int(std::min<int64_t>(kCount, count - offset));
+
+      typename OutputOp::FragmentAccumulator frag_accum;
+      typename OutputOp::FragmentSource frag_source;
+      frag_accum.clear();
+      frag_source.clear();
+
+      for (int i = 0; i < n; ++i) {
+        frag_accum[i] = accum[offset + i];
+        if (use_source) {
+          frag_source[i] = source[offset + i];
+        }
+      }
+
+      typename OutputOp::FragmentOutput frag_D = use_source ? op_(frag_accum, frag_source) : op_(frag_accum);
+
+      for (int i = 0; i < n; ++i) {
+        D[offset + i] = frag_D[i];
+      }
+    }
+  }
+
+  void operator()(ElementOutput *D, ElementAccumulator const *accum, int64_t count) const {
+    this->operator()(D, accum, nullptr, count);
+  }
+
+private:
+
+  OutputOp op_;
+};
+
+/// D = alpha * accumulator + beta * source
+template <
+  typename ElementOutput_,
+  int Count,
+  typename ElementAccumulator_,
+  typename ElementCompute_,
+  epilogue::thread::ScaleType::Kind Scale,
+  FloatRoundStyle Round,
+  typename ElementSource_
+>
+class EpilogueSpan<epilogue::thread::LinearCombination<
+  ElementOutput_, Count, ElementAccumulator_, ElementCompute_, Scale, Round, ElementSource_>> {
+public:
+
+  using OutputOp = epilogue::thread::LinearCombination<
+    ElementOutput_, Count, ElementAccumulator_, ElementCompute_, Scale, Round, ElementSource_>;
+
+  using ElementOutput = ElementOutput_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using ElementSource = ElementSource_;
+
+  static int const kCount = Count;
+  static bool const kVectorized = true;
+
+  explicit EpilogueSpan(typename OutputOp::Params const &params, int group_idx = 0) {
+    if (params.alpha_ptr_array != nullptr && params.alpha_ptr_array[group_idx] != nullptr) {
+      alpha_ = *(params.alpha_ptr_array[group_idx]);
+    }
+    else {
+      alpha_ = params.alpha_ptr ? *params.alpha_ptr : params.alpha;
+    }
+    if (params.beta_ptr_array != nullptr && params.beta_ptr_array[group_idx] != nullptr) {
+      beta_ = *(params.beta_ptr_array[group_idx]);
+    }
+    else {
+      beta_ = params.beta_ptr ? *params.beta_ptr : params.beta;
+    }
+  }
+
+  bool is_source_needed() const {
+    if (Scale == epilogue::thread::ScaleType::NoBetaScaling) return true;
+    if (Scale == epilogue::thread::ScaleType::OnlyAlphaScaling) return false;
+    if (Scale == epilogue::thread::ScaleType::Nothing) return false;
+    return beta_ != ElementCompute(0);
+  }
+
+  void operator()(
+    ElementOutput *D,
+    ElementAccumulator const *accum,
+    ElementSource const *source,
+    int64_t count) const {
+
+    ElementSource const *used_source = is_source_needed() ? source : nullptr;
+    ElementCompute compute[detail::kEpilogueSpanBlock];
+
+    for (int64_t offset = 0; offset < count; offset += detail::kEpilogueSpanBlock) {
+      int n = int(std::min<int64_t>(detail::kEpilogueSpanBlock, count - offset));
+
+      detail::epilogue_span_linear_combination<ElementCompute, ElementAccumulator, ElementSource, Scale, Round>(
+        compute, accum + offset, used_source ? used_source + offset : nullptr, n, alpha_, beta_);
+
+      detail::epilogue_span_store<ElementOutput, ElementCompute, Round>(D + offset, compute, n);
+    }
+  }
+
+  void operator()(ElementOutput *D, ElementAccumulator const *accum, int64_t count) const {
+    this->operator()(D, accum, nullptr, count);
+  }
+
+private:
+
+  ElementCompute alpha_;
+  ElementCompute beta_;
+};
+
+/// D = activation(alpha * accumulator + beta * source)
+template <
+  template <typename T> class ActivationFunctor,
+  typename ElementOutput_,
+  int Count,
+  typename ElementAccumulator_,
+  typename ElementCompute_,
+  epilogue::thread::ScaleType::Kind Scale,
+  FloatRoundStyle Round,
+  bool IsHeavy
+>
+class EpilogueSpan<epilogue::thread::LinearCombinationGeneric<
+  ActivationFunctor, ElementOutput_, Count, ElementAccumulator_, ElementCompute_, Scale, Round, IsHeavy>> {
+public:
+
+  using OutputOp = epilogue::thread::LinearCombinationGeneric<
+    ActivationFunctor, ElementOutput_, Count, ElementAccumulator_, ElementCompute_, Scale, Round, IsHeavy>;
+
+  using ElementOutput = ElementOutput_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using ElementSource = ElementOutput_;
+  using Activation = ActivationFunctor<ElementCompute>;
+
+  static int const kCount = Count;
+  static bool const kVectorized = ActivationSpan<Activation>::kVectorized;
+
+  explicit EpilogueSpan(typename OutputOp::Params const &params): params_(params) {
+    params_.alpha = params.alpha_ptr ? *params.alpha_ptr : params.alpha;
+    params_.beta = params.beta_ptr ? *params.beta_ptr : params.beta;
+  }
+
+  bool is_source_needed() const {
+    if (Scale == epilogue::thread::ScaleType::NoBetaScaling) return true;
+    if (Scale == epilogue::thread::ScaleType::OnlyAlphaScaling) return false;
+    if (Scale == epilogue::thread::ScaleType::Nothing) return false;
+    return params_.beta != ElementCompute(0);
+  }
+
+  void operator()(
+    ElementOutput *D,
+    ElementAccumulator const *accum,
+    ElementSource const *source,
+    int64_t count) const {
+
+    ElementSource const *used_source = is_source_needed() ? source : nullptr;
+    ElementCompute compute[detail::kEpilogueSpanBlock];
+    ActivationSpan<Activation> activation;
+
+    for (int64_t offset = 0; offset < count; offset += detail::kEpilogueSpanBlock) {
+      int n = int(std::min<int64_t>(detail::kEpilogueSpanBlock, count - offset));
+
+      detail::epilogue_span_linear_combination<ElementCompute, ElementAccumulator, ElementSource, Scale, Round>(
+        compute, accum + offset, used_source ? used_source + offset : nullptr, n, params_.alpha, params_.beta);
+
+      if constexpr (epilogue::thread::GenericActivationTraits<Activation>::IsArgumentsNeeded) {
+        activation(compute, n, params_);
+      }
+      else {
+        activation(compute, n);
+      }
+
+      detail::epilogue_span_store<ElementOutput, ElementCompute, Round>(D + offset, compute, n);
+    }
+  }
+
+  void operator()(ElementOutput *D, ElementAccumulator const *accum, int64_t count) const {
+    this->operator()(D, accum, nullptr, count);
+  }
+
+private:
+
+  typename OutputOp::Params params_;
+};
+
+/// Z = elementwise(binary(alpha * accumulator + beta * source, bias)), T = binary(...)
+template <
+  typename ElementC_,
+  typename ElementAccumulator_,
+  typename ElementCompute_,
+  typename ElementZ_,
+  typename ElementT_,
+  int ElementsPerAccess,
+  typename ElementwiseOp_,
+  typename BinaryOp_,
+  bool StoreT_,
+  typename ElementVector_
+>
+class EpilogueSpan<epilogue::thread::LinearCombinationBiasElementwise<
+  ElementC_, ElementAccumulator_, ElementCompute_, ElementZ_, ElementT_, ElementsPerAccess,
+  ElementwiseOp_, BinaryOp_, StoreT_, ElementVector_>> {
+public:
+
+  using OutputOp = epilogue::thread::LinearCombinationBiasElementwise<
+    ElementC_, ElementAccumulator_, ElementCompute_, ElementZ_, ElementT_, ElementsPerAccess,
+    ElementwiseOp_, BinaryOp_, StoreT_, ElementVector_>;
+
+  using ElementC = ElementC_;
+  using ElementAccumulator = ElementAccumulator_;
+  using ElementCompute = ElementCompute_;
+  using ElementZ = ElementZ_;
+  using ElementT = ElementT_;
+  using ElementVector = ElementVector_;
+  using ElementwiseOp = ElementwiseOp_;
+  using BinaryOp = BinaryOp_;
+
+  static int const kCount = ElementsPerAccess;
+  static bool const kStoreT = StoreT_;
+  static bool const kVectorized = ActivationSpan<ElementwiseOp>::kVectorized;
+
+  explicit EpilogueSpan(typename OutputOp::Params const &params): elementwise_(params.elementwise) {
+    alpha_ = params.alpha_ptr ? *params.alpha_ptr : params.alpha;
+    beta_ = params.beta_ptr ? *params.beta_ptr : params.beta;
+  }
+
+  bool is_source_needed() const {
+    return beta_ != ElementCompute(0);
+  }
+
+  /// Computes `count` elements of Z and, if kStoreT, of T. Bias element i is read from
+  /// bias[i * bias_stride]; a stride of zero broadcasts a single value along the span.
+  void operator()(
+    ElementZ *Z,
+    ElementT *T,
+    ElementAccumulator const *accum,
+    ElementC const *source,
+    ElementVector const *bias,
+    int64_t count,
+    int64_t bias_stride = 1) const {
+
+    bool use_source = source && is_source_needed();
+
+    NumericConverter<ElementCompute, ElementAccumulator> accumulator_converter;
+    NumericConverter<ElementCompute, ElementC> source_converter;
+    NumericConverter<ElementCompute, ElementVector> bias_converter;
+    NumericConverter<ElementZ, ElementCompute> convert_z;
+    NumericConverter<ElementT, ElementCompute> convert_t;
+    BinaryOp binary_op;
+    ActivationSpan<ElementwiseOp> elementwise_op;
+
+    ElementCompute compute[detail::kEpilogueSpanBlock];
+
+    for (int64_t offset = 0; offset < count; offset += detail::kEpilogueSpanBlock) {
+      int n = int(std::min<int64_t>(detail::kEpilogueSpanBlock, count - offset));
+
+      for (int i = 0; i < n; ++i) {
+        ElementCompute v = bias_converter(bias[(offset + i) * bias_stride]);
+        ElementCompute ab = accumulator_converter(accum[offset + i]);
+        compute[i] = use_source ?
+          binary_op(alpha_ * ab + beta_ * source_converter(source[offset + i]), v) :
+          binary_op(alpha_ * ab, v);
+      }
+
+      if constexpr (kStoreT) {
+        for (int i = 0; i < n; ++i) {
+          T[offset + i] = convert_t(compute[i]);
+        }
+      }
+
+      if constexpr (std::is_same_v<ElementwiseArguments, epilogue::thread::detail::EmptyArguments>) {
+        elementwise_op(compute, n);
+      }
+      else {
+        elementwise_op(compute, n, elementwise_);
+      }
+
+      for (int i = 0; i < n; ++i) {
+        Z[offset + i] = convert_z(compute[i]);
+      }
+    }
+  }
+
+private:
+
+  using ElementwiseArguments = typename OutputOp::ElementwiseArguments;
+
+  ElementCompute alpha_;
+  ElementCompute beta_;
+  ElementwiseArguments elementwise_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
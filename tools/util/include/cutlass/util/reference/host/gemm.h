@@ -43,6 +43,7 @@
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
+#include "cutlass/util/host_thread_pool.h"
 
 namespace cutlass {
 namespace reference {
@@ -79,6 +80,9 @@ Out cast_if_scalar(In in) {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Products with fewer multiply-adds than this are computed on the calling thread
+static double const kGemmParallelThreshold = double(1 << 20);
+
 /// Computes a general matrix product among matrices (tensors of rank=2) pointed to by TensorRef
 /// objects.
 template <
@@ -118,11 +122,23 @@ void compute_gemm(
   int const Mblock = 16;
   int const Nblock = 16;
 
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
+  int const row_blocks = (M + Mblock - 1) / Mblock;
+  int const col_blocks = (N + Nblock - 1) / Nblock;
+
+  // Output tiles are computed concurrently unless elements narrower than a byte could be shared
+  // by neighboring tiles
+  bool const parallel = sizeof_bits<ElementC>::value >= 8 &&
+    double(M) * double(N) * double(K) >= kGemmParallelThreshold;
+
+  auto compute_tiles = [&](int64_t begin, int64_t end) {
+
+    ConvertOp convert_op;
+    InnerProductOp inner_product_op;
 
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
+    for (int64_t tile = begin; tile < end; ++tile) {
+
+      int const row_block = int(tile / col_blocks) * Mblock;
+      int const col_block = int(tile % col_blocks) * Nblock;
 
       ComputeType accum[Mblock][Nblock];
 
@@ -166,6 +182,15 @@ void compute_gemm(
         }
       }
     }
+  };
+
+  int64_t const tiles = int64_t(row_blocks) * col_blocks;
+
+  if (parallel) {
+    cutlass::host_thread_pool().parallel_for(tiles, compute_tiles);
+  }
+  else {
+    compute_tiles(0, tiles);
   }
 }
 
@@ -45,6 +45,9 @@
 
 #include "cutlass/gemm/gemm.h"
 
+#include "cutlass/util/reference/host/blas3_blocked.h"
+#include "cutlass/util/reference/host/gemm_complex_blocked.h"
+
 namespace cutlass {
 namespace reference {
 namespace host {
@@ -58,6 +61,11 @@ namespace host {
 /// accumulator type, so a function argument 'initial_accum' is exposed. Passing
 /// AccumulatorType(0) as the last function argument can be easier than naming all template
 /// arguments explicitly.
+///
+/// By default, each output accumulates one InnerProductOp per term in increasing order of k.
+/// Complex-valued products using the default InnerProductOp may instead be computed from real
+/// products on split real and imaginary planes by passing ComplexGemmAlgorithm::k4M or k3M (see
+/// gemm_complex_blocked.h). These are faster but round differently.
 template <
   typename ElementA,
   typename LayoutA,
@@ -86,84 +94,86 @@ void GemmComplex(
   int64_t batch_stride_A = 0,
   int64_t batch_stride_B = 0,
   int64_t batch_stride_C = 0,
-  int64_t batch_stride_D = 0) {
+  int64_t batch_stride_D = 0,
+  ComplexGemmAlgorithm algorithm = ComplexGemmAlgorithm::kElementwise) {
 
   static_assert(
     LayoutA::kRank == 2 &&
     LayoutB::kRank == 2 &&
     LayoutC::kRank == 2, "Tensors must be of rank 2");
 
-  // Note: batch is ignored.
   int const M = problem_size.m();
   int const N = problem_size.n();
   int const K = problem_size.k();
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
-    // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-        ComputeType accum[Mblock][Nblock];
-
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
+    auto store = [&](int row, int col, ComputeType const &accum) {
+      if (row < M && col < N) {
+        ConvertOp convert_op;
+        MatrixCoord coord = MatrixCoord(row, col);
+        tensor_d.at(coord) = convert_op(
+          alpha * ScalarType(accum) +
+          beta * ScalarType(tensor_c.at(coord)));
+      }
+    };
+
+    auto epilogue = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+      for (int j = 0; j < detail::kBlas3Block; j++) {
+        for (int i = 0; i < detail::kBlas3Block; i++) {
+          store(tile_row + i, tile_col + j, accum[i][j]);
         }
-
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N) {
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementB b = tensor_b.at(MatrixCoord(k_block, col));
-
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_kj = ComputeType(b);
-
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
-
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_kj = conj(b_kj);
-                }
-
-                accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
-              }
-            }
-          }
+      }
+    };
+
+    bool split_planes = false;
+
+    if constexpr (is_complex<ComputeType>::value &&
+                  platform::is_same<InnerProductOp, multiply_add<ComputeType>>::value) {
+
+      split_planes = (algorithm != ComplexGemmAlgorithm::kElementwise);
+
+      if (split_planes) {
+        // Complex multiply-add is computed from real products on split planes
+        detail::complex_blocked_product(
+          M, N, K,
+          [&](int row, int k) { return ComputeType(tensor_a.at(MatrixCoord(row, k))); },
+          transform_a,
+          [&](int k, int col) { return ComputeType(tensor_b.at(MatrixCoord(k, col))); },
+          transform_b,
+          epilogue,
+          initial_accum,
+          algorithm);
+      }
+    }
+
+    if (!split_planes) {
+
+      auto load_a = [&](int row, int k) {
+        ComputeType a_ik = ComputeType(tensor_a.at(MatrixCoord(row, k)));
+        if (transform_a == ComplexTransform::kConjugate) {
+          a_ik = conj(a_ik);
         }
+        return a_ik;
+      };
 
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            MatrixCoord coord = MatrixCoord(row, col);
-
-            if (row < M && col < N) {
-
-              tensor_d.at(coord) = convert_op(
-                alpha * ScalarType(accum[i][j]) + 
-                beta * ScalarType(tensor_c.at(coord)));
-            }
-          }
+      auto load_b = [&](int k, int col) {
+        ComputeType b_kj = ComputeType(tensor_b.at(MatrixCoord(k, col)));
+        if (transform_b == ComplexTransform::kConjugate) {
+          b_kj = conj(b_kj);
         }
-
-      } // for (col_block)
-    } // for (row_block)
+        return b_kj;
+      };
+
+      int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
+
+      detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+        M, N, load_a, load_b,
+        [&](int) { return std::make_pair(0, col_blocks); },
+        [&](int, int) { return std::make_pair(0, K); },
+        epilogue,
+        initial_accum);
+    }
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_b.add_pointer_offset(batch_stride_B);
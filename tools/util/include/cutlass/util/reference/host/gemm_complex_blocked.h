@@ -0,0 +1,205 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Blocked, multithreaded engine for complex-valued GEMM host references.
+
+    Complex operands are split into real and imaginary planes while being packed into K-major
+    panels, and the complex product is formed from real GEMMs on those planes:
+
+      4M:  Cr = Ar Br - Ai Bi                       Ci = Ar Bi + Ai Br
+      3M:  P1 = Ar Br,  P2 = Ai Bi,  P3 = (Ar + Ai)(Br + Bi)
+           Cr = P1 - P2                             Ci = P3 - P1 - P2
+
+    Conjugation is applied by negating the imaginary plane when packing. The 3M (Gauss)
+    formulation trades one real GEMM for additional rounding in the imaginary part. Each real
+    GEMM runs on the micro-kernel and thread partitioning of the BLAS3 host references.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#include "cutlass/complex.h"
+#include "cutlass/functional.h"
+
+#include "cutlass/util/reference/host/blas3_blocked.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Formulation of the complex product of the host GEMM references
+enum class ComplexGemmAlgorithm {
+  kElementwise,   ///< one complex multiply-add per term in increasing order of k
+  k4M,            ///< four real products
+  k3M             ///< three real products (Gauss), with a less accurate imaginary part
+};
+
+namespace detail {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Computes the M x N complex product of K-deep operands obtained from load_a(row, k) and
+/// load_b(k, col) and hands each accumulated tile to epilogue(row, col, accum).
+template <
+  typename Real,
+  typename LoadA,
+  typename LoadB,
+  typename Epilogue
+>
+void complex_blocked_product(
+  int M,
+  int N,
+  int K,
+  LoadA load_a,
+  ComplexTransform transform_a,
+  LoadB load_b,
+  ComplexTransform transform_b,
+  Epilogue epilogue,
+  complex<Real> initial_accum,
+  ComplexGemmAlgorithm algorithm) {
+
+  int const kBlock = kBlas3Block;
+  int const row_blocks = (M + kBlock - 1) / kBlock;
+  int const col_blocks = (N + kBlock - 1) / kBlock;
+  int const products = (algorithm == ComplexGemmAlgorithm::k3M ? 3 : 4);
+
+  Real const sign_a = (transform_a == ComplexTransform::kConjugate ? Real(-1) : Real(1));
+  Real const sign_b = (transform_b == ComplexTransform::kConjugate ? Real(-1) : Real(1));
+
+  using Tile = Real[kBlas3Block][kBlas3Block];
+  using Panel = std::vector<Real>;
+
+  std::vector<double> weights(row_blocks, double(col_blocks) * (1 + double(K) * products / 4));
+
+  blas3_parallel_for_row_blocks(weights, [&](int rb) {
+
+    multiply_add<Real> inner_product_op;
+
+    int const row = rb * kBlock;
+    int const rows = std::min(kBlock, M - row);
+    size_t const panel_size = size_t(K) * kBlock;
+
+    // Planes of A: real, imaginary, and either the negated imaginary (4M) or the sum (3M)
+    Panel a_real(panel_size, Real()), a_imag(panel_size, Real()), a_extra(panel_size, Real());
+    for (int k = 0; k < K; ++k) {
+      for (int i = 0; i < rows; ++i) {
+        complex<Real> a = load_a(row + i, k);
+        Real re = a.real();
+        Real im = sign_a * a.imag();
+        size_t idx = size_t(k) * kBlock + i;
+        a_real[idx] = re;
+        a_imag[idx] = im;
+        a_extra[idx] = (algorithm == ComplexGemmAlgorithm::k3M ? re + im : -im);
+      }
+    }
+
+    // Planes of B: real, imaginary, and the sum (3M only)
+    Panel b_real(panel_size, Real()), b_imag(panel_size, Real()), b_sum(panel_size, Real());
+
+    for (int cb = 0; cb < col_blocks; ++cb) {
+
+      int const col = cb * kBlock;
+      int const columns = std::min(kBlock, N - col);
+
+      for (int k = 0; k < K; ++k) {
+        for (int j = 0; j < columns; ++j) {
+          complex<Real> b = load_b(k, col + j);
+          Real re = b.real();
+          Real im = sign_b * b.imag();
+          size_t idx = size_t(k) * kBlock + j;
+          b_real[idx] = re;
+          b_imag[idx] = im;
+          b_sum[idx] = re + im;
+        }
+        for (int j = columns; j < kBlock; ++j) {
+          size_t idx = size_t(k) * kBlock + j;
+          b_real[idx] = b_imag[idx] = b_sum[idx] = Real();
+        }
+      }
+
+      complex<Real> accum[kBlas3Block][kBlas3Block];
+
+      if (algorithm == ComplexGemmAlgorithm::k3M) {
+
+        Tile p1 = {}, p2 = {}, p3 = {};
+
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_real.data(), b_real.data(), p1, inner_product_op);
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_imag.data(), b_imag.data(), p2, inner_product_op);
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_extra.data(), b_sum.data(), p3, inner_product_op);
+
+        for (int j = 0; j < kBlock; ++j) {
+          for (int i = 0; i < kBlock; ++i) {
+            accum[i][j] = complex<Real>(
+              initial_accum.real() + (p1[i][j] - p2[i][j]),
+              initial_accum.imag() + (p3[i][j] - p1[i][j] - p2[i][j]));
+          }
+        }
+      }
+      else {
+
+        Tile acc_real, acc_imag;
+        for (int j = 0; j < kBlock; ++j) {
+          for (int i = 0; i < kBlock; ++i) {
+            acc_real[i][j] = initial_accum.real();
+            acc_imag[i][j] = initial_accum.imag();
+          }
+        }
+
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_real.data(), b_real.data(), acc_real, inner_product_op);
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_extra.data(), b_imag.data(), acc_real, inner_product_op);
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_real.data(), b_imag.data(), acc_imag, inner_product_op);
+        blas3_micro_kernel<Real, multiply_add<Real>, kBlas3Block>(K, a_imag.data(), b_real.data(), acc_imag, inner_product_op);
+
+        for (int j = 0; j < kBlock; ++j) {
+          for (int i = 0; i < kBlock; ++i) {
+            accum[i][j] = complex<Real>(acc_real[i][j], acc_imag[i][j]);
+          }
+        }
+      }
+
+      epilogue(row, col, accum);
+    }
+  });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace detail
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,9 @@
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
 
+#include "cutlass/util/reference/host/blas3_blocked.h"
+#include "cutlass/util/reference/host/gemm_complex_blocked.h"
+
 namespace cutlass {
 namespace reference {
 namespace host {
@@ -57,6 +60,11 @@ namespace host {
 /// accumulator type, so a function argument 'initial_accum' is exposed. Passing
 /// AccumulatorType(0) as the last function argument can be easier than naming all template
 /// arguments explicitly.
+///
+/// By default, each output accumulates one InnerProductOp per term in increasing order of k. With
+/// the default InnerProductOp, ComplexGemmAlgorithm::k4M or k3M instead compute the product from
+/// real products on the real and imaginary planes (see gemm_complex_blocked.h). These are faster
+/// but round differently.
 template <
   typename ElementA,
   typename LayoutA,
@@ -79,7 +87,8 @@ void GemmPlanarComplex(
   complex<ScalarType> beta,
   TensorRefPlanarComplex<ElementC, LayoutC> tensor_c,
   TensorRefPlanarComplex<ElementC, LayoutC> tensor_d,
-  complex<ComputeType> initial_accum) {
+  complex<ComputeType> initial_accum,
+  ComplexGemmAlgorithm algorithm = ComplexGemmAlgorithm::kElementwise) {
 
   static_assert(
     LayoutA::kRank == 2 &&
@@ -95,91 +104,84 @@ void GemmPlanarComplex(
   int const N = problem_size.n();
   int const K = problem_size.k();
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
+  auto load_a = [&](int row, int k) {
+    ComplexA a_ik = tensor_a.at(MatrixCoord(row, k));
+    return complex<ComputeType>{ComputeType(a_ik.real()), ComputeType(a_ik.imag())};
+  };
 
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
+  auto load_b = [&](int k, int col) {
+    ComplexB b_kj = tensor_b.at(MatrixCoord(k, col));
+    return complex<ComputeType>{ComputeType(b_kj.real()), ComputeType(b_kj.imag())};
+  };
 
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
+  auto epilogue = [&](int tile_row, int tile_col, complex<ComputeType> const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
 
-      complex<ComputeType> accum[Mblock][Nblock];
+    ConvertOp convert_op;
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
+    for (int j = 0; j < detail::kBlas3Block; j++) {
+      for (int i = 0; i < detail::kBlas3Block; i++) {
+        int row = tile_row + i;
+        int col = tile_col + j;
 
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
+        MatrixCoord coord = MatrixCoord(row, col);
 
-            if (row < M && col < N) {
+        if (row < M && col < N) {
 
-              ComplexA a_ik = tensor_a.at(MatrixCoord(row, k_block));
-              ComplexB b_kj = tensor_b.at(MatrixCoord(k_block, col));
+          complex<ScalarType> acc{
+            ScalarType(accum[i][j].real()),
+            ScalarType(accum[i][j].imag())
+          };
 
-              complex<ComputeType> a = complex<ComputeType>{
-                ComputeType(a_ik.real()),
-                ComputeType(a_ik.imag())
-              };
+          ComplexC d_ij = tensor_c.at(coord);
 
-              complex<ComputeType> b = complex<ComputeType>{
-                ComputeType(b_kj.real()),
-                ComputeType(b_kj.imag())
-              };
+          complex<ScalarType> src{
+            ScalarType(d_ij.real()),
+            ScalarType(d_ij.imag())
+          };
 
-              if (transform_a == ComplexTransform::kConjugate) {
-                a = conj(a);
-              }
+          complex<ScalarType> result = alpha * acc + beta * src;
 
-              if (transform_b == ComplexTransform::kConjugate) {
-                b = conj(b);
-              }
+          d_ij.real() = convert_op(result.real());
+          d_ij.imag() = convert_op(result.imag());
 
-              accum[i][j] = inner_product_op(a, b,  accum[i][j]);
-            }
-          }
+          tensor_d.at(coord) = d_ij;
         }
       }
+    }
+  };
 
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
-
-          MatrixCoord coord = MatrixCoord(row, col);
-
-          if (row < M && col < N) {
-
-            complex<ScalarType> acc{
-              ScalarType(accum[i][j].real()),
-              ScalarType(accum[i][j].imag())
-            };
-
-            ComplexC d_ij = tensor_c.at(coord);
-
-            complex<ScalarType> src{
-              ScalarType(d_ij.real()),
-              ScalarType(d_ij.imag())
-            };
+  bool split_planes = false;
 
-            complex<ScalarType> result = alpha * acc + beta * src;
+  if constexpr (platform::is_same<InnerProductOp, multiply_add<complex<ComputeType>>>::value) {
 
-            d_ij.real() = convert_op(result.real());
-            d_ij.imag() = convert_op(result.imag());
+    split_planes = (algorithm != ComplexGemmAlgorithm::kElementwise);
 
-            tensor_d.at(coord) = d_ij;
-          }
-        }
-      }
+    if (split_planes) {
+      // Real and imaginary planes are packed separately and multiplied with real products
+      detail::complex_blocked_product(
+        M, N, K, load_a, transform_a, load_b, transform_b, epilogue, initial_accum, algorithm);
     }
   }
+
+  if (!split_planes) {
+
+    int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
+
+    detail::blas3_blocked_product<complex<ComputeType>, InnerProductOp>(
+      M, N,
+      [&](int row, int k) {
+        complex<ComputeType> a = load_a(row, k);
+        return transform_a == ComplexTransform::kConjugate ? conj(a) : a;
+      },
+      [&](int k, int col) {
+        complex<ComputeType> b = load_b(k, col);
+        return transform_b == ComplexTransform::kConjugate ? conj(b) : b;
+      },
+      [&](int) { return std::make_pair(0, col_blocks); },
+      [&](int, int) { return std::make_pair(0, K); },
+      epilogue,
+      initial_accum);
+  }
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
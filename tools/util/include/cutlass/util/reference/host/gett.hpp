@@ -35,6 +35,8 @@
 #pragma once
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
+#include <mutex>
+
 #include "cutlass/gemm/gemm.h"
 #include "cutlass/complex.h"
 #include "cutlass/numeric_conversion.h"
@@ -44,10 +46,24 @@
 #include "cute/tensor.hpp"
 #include "cute/pointer.hpp"
 
+#include "cutlass/util/host_thread_pool.h"
+
 /////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace cutlass::reference::host {
 
+namespace detail {
+
+/// Serializes the amax updates of epilogue blocks computed concurrently
+inline std::mutex &gett_abs_max_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+} // namespace detail
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
 template<class T, class = void>
 struct ElementTraits {
   using type = T;
@@ -496,18 +512,25 @@ void Gett(
   static int constexpr kBlockM = 64;
   static int constexpr kBlockN = 64;
 
-#if defined(_OPENMP)
-  #pragma omp parallel for collapse(3)
-#endif
-  for (int64_t l = 0; l < cute::size<2>(mainloop_params.A.layout()); ++l) {
-    for (int64_t m = 0; m < cute::size<0>(mainloop_params.A.layout()); m += kBlockM) {
-      for (int64_t n = 0; n < cute::size<0>(mainloop_params.B.layout()); n += kBlockN) {
-        typename MainloopParams::ElementAccumulator acc[kBlockM][kBlockN];
-        gett_mainloop(mainloop_params, m, n, l, acc);
-        gett_epilogue(epilogue_params, m, n, l, acc);
-      }
+  // Blocks of outputs narrower than a byte may share bytes with their neighbors
+  constexpr bool kParallel =
+    cute::sizeof_bits_v<typename EpilogueParams::TensorD::value_type> >= 8 &&
+    cute::sizeof_bits_v<typename EpilogueParams::TensorAux::value_type> >= 8;
+
+  int64_t blocks_m = (cute::size<0>(mainloop_params.A.layout()) + kBlockM - 1) / kBlockM;
+  int64_t blocks_n = (cute::size<0>(mainloop_params.B.layout()) + kBlockN - 1) / kBlockN;
+  int64_t blocks = cute::size<2>(mainloop_params.A.layout()) * blocks_m * blocks_n;
+
+  cutlass::host_thread_pool().parallel_for(blocks, [&](int64_t begin, int64_t end) {
+    for (int64_t block = begin; block < end; ++block) {
+      int64_t n = (block % blocks_n) * kBlockN;
+      int64_t m = (block / blocks_n % blocks_m) * kBlockM;
+      int64_t l = block / blocks_n / blocks_m;
+      typename MainloopParams::ElementAccumulator acc[kBlockM][kBlockN];
+      gett_mainloop(mainloop_params, m, n, l, acc);
+      gett_epilogue(epilogue_params, m, n, l, acc);
     }
-  }
+  }, 1, kParallel ? 0 : 1);
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////
@@ -799,22 +822,20 @@ void gett_epilogue(
     }
   }
 
-#if defined(_OPENMP)
-  #pragma omp critical(Abs_Max_Data_Update)
-#endif
-  {
-    if constexpr (IsScalingAndAmaxOutputNeeded) {
-      if (epilogue_params.abs_max_D) {
-        *epilogue_params.abs_max_D = maximum_with_nan_propogation<ElementAccumulator>{}(
-          *epilogue_params.abs_max_D, abs_max_output_converter(local_abs_max_output));
-      }
+  // Blocks are computed concurrently by Gett(), so only the amax updates take a lock
+  if constexpr (IsScalingAndAmaxOutputNeeded) {
+    if (epilogue_params.abs_max_D) {
+      std::lock_guard<std::mutex> lock(detail::gett_abs_max_mutex());
+      *epilogue_params.abs_max_D = maximum_with_nan_propogation<ElementAccumulator>{}(
+        *epilogue_params.abs_max_D, abs_max_output_converter(local_abs_max_output));
     }
+  }
 
-    if constexpr (IsScalingAndAmaxAuxOutputNeeded) {
-      if (epilogue_params.abs_max_Aux) {
-        *epilogue_params.abs_max_Aux = maximum_with_nan_propogation<ElementAccumulator>{}(
-            *epilogue_params.abs_max_Aux, abs_max_output_converter(local_abs_max_aux_output));
-      }
+  if constexpr (IsScalingAndAmaxAuxOutputNeeded) {
+    if (epilogue_params.abs_max_Aux) {
+      std::lock_guard<std::mutex> lock(detail::gett_abs_max_mutex());
+      *epilogue_params.abs_max_Aux = maximum_with_nan_propogation<ElementAccumulator>{}(
+          *epilogue_params.abs_max_Aux, abs_max_output_converter(local_abs_max_aux_output));
     }
   }
 }
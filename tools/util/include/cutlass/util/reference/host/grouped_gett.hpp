@@ -0,0 +1,119 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Multithreaded reference implementation of grouped GEMMs in host-side code.
+
+    Each group is computed with the GETT mainloop and epilogue of gett.hpp. The output blocks of
+    all groups are ordered group after group and distributed over the threads of the host thread
+    pool in ranges of roughly equal cost. A thread that runs out of work steals the back half of
+    another thread's range, so a few large groups among many tiny ones (as under skewed
+    mixture-of-experts routing) do not serialize on a single thread.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include "cutlass/util/host_thread_pool.h"
+#include "cutlass/util/reference/host/gett.hpp"
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace cutlass::reference::host {
+
+/// Grouped GETT reference kernel. Group `g` computes epilogue_params[g] applied to the product of
+/// mainloop_params[g]. A `num_threads` of 0 uses all threads of the host thread pool. Outputs
+/// narrower than a byte are computed on a single thread.
+template <
+  class MainloopParams,
+  class EpilogueParams
+>
+void GroupedGett(
+    std::vector<MainloopParams> const& mainloop_params,
+    std::vector<EpilogueParams> const& epilogue_params,
+    int num_threads = 0)
+{
+  static int constexpr kBlockM = 64;
+  static int constexpr kBlockN = 64;
+
+  // Blocks of outputs narrower than a byte may share bytes with their neighbors
+  constexpr bool kParallel =
+    cute::sizeof_bits_v<typename EpilogueParams::TensorD::value_type> >= 8 &&
+    cute::sizeof_bits_v<typename EpilogueParams::TensorAux::value_type> >= 8;
+
+  if (mainloop_params.size() != epilogue_params.size()) {
+    throw std::invalid_argument("GroupedGett: mainloop and epilogue parameters differ in group count");
+  }
+
+  struct Block {
+    int32_t group;
+    int64_t m;
+    int64_t n;
+    int64_t l;
+  };
+
+  std::vector<Block> blocks;
+  std::vector<double> costs;
+
+  for (int32_t g = 0; g < int32_t(mainloop_params.size()); ++g) {
+    auto const& A = mainloop_params[g].A;
+    auto const& B = mainloop_params[g].B;
+    int64_t K = cute::size<1>(A.layout());
+    for (int64_t l = 0; l < cute::size<2>(A.layout()); ++l) {
+      for (int64_t m = 0; m < cute::size<0>(A.layout()); m += kBlockM) {
+        for (int64_t n = 0; n < cute::size<0>(B.layout()); n += kBlockN) {
+          blocks.push_back({g, m, n, l});
+          // Epilogue work is counted as one K iteration
+          costs.push_back(double(K + 1));
+        }
+      }
+    }
+  }
+
+  if (blocks.size() > size_t(UINT32_MAX)) {
+    throw std::invalid_argument("GroupedGett: too many output blocks");
+  }
+
+  cutlass::host_thread_pool().parallel_for_weighted(costs, [&](uint32_t item) {
+    Block const& block = blocks[item];
+    typename MainloopParams::ElementAccumulator acc[kBlockM][kBlockN];
+    gett_mainloop(mainloop_params[block.group], block.m, block.n, block.l, acc);
+    gett_epilogue(epilogue_params[block.group], block.m, block.n, block.l, acc);
+  }, kParallel ? num_threads : 1);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // cutlass::reference::host
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
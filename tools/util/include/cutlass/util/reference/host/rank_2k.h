@@ -44,6 +44,7 @@
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/blas3_blocked.h"
 
 namespace cutlass {
 namespace reference {
@@ -87,83 +88,57 @@ void compute_rank2k(
     FillModeC == FillMode::kUpper, 
     "Fill Mode can either be Lower or Upper.");
 
-  using CompareOp = typename platform::conditional<(FillModeC == FillMode::kLower), 
-                                                    std::greater_equal<int>, 
-                                                    std::less_equal<int>>::type;
-
   // Note: batch is ignored.
   // Note: M is same as N for Rank 2k update
   int const N = problem_size.n();
   int const K = problem_size.k();
-
-  // Blocking necessary to speedup reference implementation
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-  CompareOp compare_op;
-
-  for (int row_block = 0; row_block < N; row_block += Nblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-      ComputeType accum[Nblock][Nblock];
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Nblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
-
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Nblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < N && col < N && compare_op(row, col)) 
-            {
-
-              // A x B^T
-              ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-              ElementB b_t = tensor_b.at(MatrixCoord(col, k_block));
-
-              ComputeType compute_a(cast_if_scalar<ComputeType>(a));
-              ComputeType compute_b_t(cast_if_scalar<ComputeType>(b_t));
-
-              accum[i][j] = inner_product_op(compute_a, compute_b_t, accum[i][j]);
-
-              // B x A^T
-              ElementB b = tensor_b.at(MatrixCoord(row, k_block));
-              ElementA a_t = tensor_a.at(MatrixCoord(col, k_block));
-
-              ComputeType compute_b(cast_if_scalar<ComputeType>(b));
-              ComputeType compute_a_t(cast_if_scalar<ComputeType>(a_t));
-
-              accum[i][j] = inner_product_op(compute_b, compute_a_t, accum[i][j]);
-            }
-          }
-        }
-      }
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Nblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
-
-          MatrixCoord coord = MatrixCoord(row, col);
-
-          if (row < N && col < N && 
-              ( (FillModeC == FillMode::kLower && row >= col) || 
-                (FillModeC == FillMode::kUpper && row <= col) )
-          ) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]) +
-              beta * ScalarType(tensor_c.at(coord)));
-          }
+  int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
+
+  // Products A x B^T and B x A^T are interleaved along a reduction of length 2K:
+  // step 2k multiplies A(row, k) B(col, k) and step 2k + 1 multiplies B(row, k) A(col, k).
+  auto load_a = [&](int row, int k) {
+    return (k % 2) ?
+      ComputeType(cast_if_scalar<ComputeType>(tensor_b.at(MatrixCoord(row, k / 2)))) :
+      ComputeType(cast_if_scalar<ComputeType>(tensor_a.at(MatrixCoord(row, k / 2))));
+  };
+
+  auto load_b = [&](int k, int col) {
+    return (k % 2) ?
+      ComputeType(cast_if_scalar<ComputeType>(tensor_a.at(MatrixCoord(col, k / 2)))) :
+      ComputeType(cast_if_scalar<ComputeType>(tensor_b.at(MatrixCoord(col, k / 2))));
+  };
+
+  auto tiles = [&](int row_block) {
+    return detail::blas3_triangle_tiles(FillModeC == FillMode::kLower, row_block, col_blocks);
+  };
+
+  auto k_range = [&](int, int) {
+    return std::make_pair(0, 2 * K);
+  };
+
+  auto epilogue = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+    ConvertOp convert_op;
+    for (int j = 0; j < detail::kBlas3Block; j++) {
+      for (int i = 0; i < detail::kBlas3Block; i++) {
+        int row = tile_row + i;
+        int col = tile_col + j;
+
+        MatrixCoord coord = MatrixCoord(row, col);
+
+        if (row < N && col < N && 
+            ( (FillModeC == FillMode::kLower && row >= col) || 
+              (FillModeC == FillMode::kUpper && row <= col) )
+        ) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]) +
+            beta * ScalarType(tensor_c.at(coord)));
         }
       }
     }
-  }
+  };
+
+  detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+    N, N, load_a, load_b, tiles, k_range, epilogue, initial_accum);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
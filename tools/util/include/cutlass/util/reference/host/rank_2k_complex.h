@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/util/reference/host/blas3_blocked.h"
 #include <cassert>
 
 namespace cutlass {
@@ -100,144 +101,105 @@ void Rank2KComplex(
   // Rank2K update operates on A=NxK, B=NxK, and C=NxN
   assert(M==N);
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
+  int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
 
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
-    // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-        ComputeType accum[Mblock][Nblock];
-
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
-        }
-
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N &&
-                 ( (fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col) )               
-                ) {
-                
-                // A x B^T (Symmetric) or A x B^H (Hermitian)
-                // complex conjugation on operandB (b_t) is function of blas3 computation
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementB b_t = (blas_mode == BlasMode::kHermitian) ? 
-                              conj(tensor_b.at(MatrixCoord(col, k_block))) : 
-                              tensor_b.at(MatrixCoord(col, k_block));
-
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_jk = ComputeType(b_t);
-
-                // complex conjugation is a function of operand layouts
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
-                // complex conjugation is a function of operand layouts
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_jk = conj(b_jk);
-                }
-
-                accum[i][j] = inner_product_op(a_ik, b_jk,  accum[i][j]);
-              }
-            }
-          }
-        }
-
-        /* HER2K need two epilogues to handle complex alpha value */
-        if ( blas_mode == BlasMode::kHermitian ) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              MatrixCoord coord = MatrixCoord(row, col);
-
-              if (row < M && col < N && 
-                  ((fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col))
-                ) {
-
-                ScalarType c = tensor_c.at(coord);
-                // The imaginary parts of the diagonal elements of 
-                // a complex data type are assumed and set to zero
-                if (blas_mode == BlasMode::kHermitian) {
-                  c = (row == col) ? real(c) : c;
-                }
-
-                tensor_d.at(coord) = convert_op(alpha * 
-                  ScalarType(accum[i][j]) + 
-                  beta * c);
-              }
-            }
-          }
-          
-          /* Zeoring out accum for second HERK */
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              accum[i][j] = initial_accum;
+    // A x B^T (Symmetric) or A x B^H (Hermitian)
+    auto load_a_1 = [&](int row, int k) {
+      ComputeType a_ik = ComputeType(tensor_a.at(MatrixCoord(row, k)));
+      // complex conjugation is a function of operand layouts
+      if (transform_a == ComplexTransform::kConjugate) {
+        a_ik = conj(a_ik);
+      }
+      return a_ik;
+    };
+
+    auto load_b_1 = [&](int k, int col) {
+      // complex conjugation on operandB (b_t) is function of blas3 computation
+      ElementB b_t = (blas_mode == BlasMode::kHermitian) ? 
+                    conj(tensor_b.at(MatrixCoord(col, k))) : 
+                    tensor_b.at(MatrixCoord(col, k));
+      ComputeType b_jk = ComputeType(b_t);
+      // complex conjugation is a function of operand layouts
+      if (transform_b == ComplexTransform::kConjugate) {
+        b_jk = conj(b_jk);
+      }
+      return b_jk;
+    };
+
+    // B x A^T (Symmetric) or B x A^H (Hermitian)
+    auto load_a_2 = [&](int row, int k) {
+      ComputeType b_ik = ComputeType(tensor_b.at(MatrixCoord(row, k)));
+      // complex conjugation here is a function of operand layouts
+      if (transform_b == ComplexTransform::kConjugate) {
+        b_ik = conj(b_ik);
+      }
+      return b_ik;
+    };
+
+    auto load_b_2 = [&](int k, int col) {
+      // complex conjugation on operandB (a_t) is function of blas3 computation
+      ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
+                      conj(tensor_a.at(MatrixCoord(col, k))):
+                      tensor_a.at(MatrixCoord(col, k));
+      ComputeType a_jk = ComputeType(a_t);
+      // complex conjugation here is a function of operand layouts
+      if (transform_a == ComplexTransform::kConjugate) {
+        a_jk = conj(a_jk);
+      }
+      return a_jk;
+    };
+
+    auto tiles = [&](int row_block) {
+      return detail::blas3_triangle_tiles(fill_mode_c == FillMode::kLower, row_block, col_blocks);
+    };
+
+    ScalarType alpha_hermitian = (blas_mode == BlasMode::kHermitian) ? 
+                                  conj(alpha) : alpha;
+    ScalarType beta_hermitian = (blas_mode == BlasMode::kHermitian) ? 
+                                  1 : beta;
+
+    auto epilogue_2 = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+      ConvertOp convert_op;
+      for (int j = 0; j < detail::kBlas3Block; j++) {
+        for (int i = 0; i < detail::kBlas3Block; i++) {
+          int row = tile_row + i;
+          int col = tile_col + j;
+
+          MatrixCoord coord = MatrixCoord(row, col);
+
+          if (row < M && col < N && 
+              ((fill_mode_c == FillMode::kLower && row >= col) || 
+               (fill_mode_c == FillMode::kUpper && row <= col))
+            ) {
+
+            ScalarType d = (blas_mode == BlasMode::kHermitian) ? 
+                           tensor_d.at(coord) : tensor_c.at(coord);
+
+            ScalarType tmp_d = convert_op(
+              alpha_hermitian * ScalarType(accum[i][j]) + 
+              beta_hermitian * d);
+
+            if (blas_mode == BlasMode::kHermitian && row == col ) {
+              tensor_d.at(coord) = real(tmp_d);
+            } else {
+              tensor_d.at(coord) = tmp_d;
             }
           }
         }
+      }
+    };
 
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N &&
-                 ( (fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col) )               
-                ) {
-
-                // B x A^T (Symmetric) or B x A^H (Hermitian)
-                // complex conjugation on operandB (a_t) is function of blas3 computation
-                ElementB b = tensor_b.at(MatrixCoord(row, k_block));
-                ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
-                                conj(tensor_a.at(MatrixCoord(col, k_block))):
-                                tensor_a.at(MatrixCoord(col, k_block));
-
-                ComputeType b_ik = ComputeType(b);
-                ComputeType a_jk = ComputeType(a_t);
-                
-                // complex conjugation here is a function of operand layouts
-                if (transform_b == ComplexTransform::kConjugate) {
-                  b_ik = conj(b_ik);
-                }
-                // complex conjugation here is a function of operand layouts
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_jk = conj(a_jk);
-                }
-
-                accum[i][j] = inner_product_op(b_ik, a_jk, accum[i][j]);
-              }
-            }
-          }
-        }
+    /* HER2K need two epilogues to handle complex alpha value */
+    if ( blas_mode == BlasMode::kHermitian ) {
 
-        ScalarType alpha_hermitian = (blas_mode == BlasMode::kHermitian) ? 
-                                      conj(alpha) : alpha;
-        ScalarType beta_hermitian = (blas_mode == BlasMode::kHermitian) ? 
-                                      1 : beta;
-        
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
+      auto epilogue_1 = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+        ConvertOp convert_op;
+        for (int j = 0; j < detail::kBlas3Block; j++) {
+          for (int i = 0; i < detail::kBlas3Block; i++) {
+            int row = tile_row + i;
+            int col = tile_col + j;
 
             MatrixCoord coord = MatrixCoord(row, col);
 
@@ -246,24 +208,48 @@ void Rank2KComplex(
                  (fill_mode_c == FillMode::kUpper && row <= col))
               ) {
 
-              ScalarType d = (blas_mode == BlasMode::kHermitian) ? 
-                             tensor_d.at(coord) : tensor_c.at(coord);
-
-              ScalarType tmp_d = convert_op(
-                alpha_hermitian * ScalarType(accum[i][j]) + 
-                beta_hermitian * d);
+              ScalarType c = tensor_c.at(coord);
+              // The imaginary parts of the diagonal elements of 
+              // a complex data type are assumed and set to zero
+              c = (row == col) ? real(c) : c;
 
-              if (blas_mode == BlasMode::kHermitian && row == col ) {
-                tensor_d.at(coord) = real(tmp_d);
-              } else {
-                tensor_d.at(coord) = tmp_d;
-              }
+              tensor_d.at(coord) = convert_op(alpha * 
+                ScalarType(accum[i][j]) + 
+                beta * c);
             }
           }
         }
+      };
+
+      auto k_range = [&](int, int) {
+        return std::make_pair(0, K);
+      };
+
+      detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+        M, N, load_a_1, load_b_1, tiles, k_range, epilogue_1, initial_accum);
+
+      detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+        M, N, load_a_2, load_b_2, tiles, k_range, epilogue_2, initial_accum);
+    }
+    else {
+
+      // Both products accumulate into one sum: steps [0, K) compute A x B^T and
+      // steps [K, 2K) compute B x A^T.
+      auto load_a = [&](int row, int k) {
+        return k < K ? load_a_1(row, k) : load_a_2(row, k - K);
+      };
+
+      auto load_b = [&](int k, int col) {
+        return k < K ? load_b_1(k, col) : load_b_2(k - K, col);
+      };
+
+      auto k_range = [&](int, int) {
+        return std::make_pair(0, 2 * K);
+      };
 
-      } // for (col_block)
-    } // for (row_block)
+      detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+        M, N, load_a, load_b, tiles, k_range, epilogue_2, initial_accum);
+    }
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_b.add_pointer_offset(batch_stride_B);
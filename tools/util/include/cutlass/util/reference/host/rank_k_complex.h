@@ -41,6 +41,7 @@
 #include "cutlass/numeric_conversion.h"
 #include "cutlass/tensor_view.h"
 #include "cutlass/gemm/gemm.h"
+#include "cutlass/util/reference/host/blas3_blocked.h"
 #include <cassert>
 
 namespace cutlass {
@@ -94,98 +95,78 @@ void Rank2KComplex(
   // Rank2K update operates on A=NxK, B=NxK, and C=NxN
   assert(M==N);
 
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
+  int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
 
   for (int batch_idx = 0; batch_idx < batch_count; ++batch_idx) {
 
-    // Compute matrix product using blocks
-    for (int row_block = 0; row_block < M; row_block += Mblock) {
-      for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-        ComputeType accum[Mblock][Nblock];
-
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            accum[i][j] = initial_accum;
-          }
-        }
-
-        for (int k_block = 0; k_block < K; ++k_block) {
-          for (int j = 0; j < Nblock; j++) {
-            for (int i = 0; i < Mblock; i++) {
-              int row = row_block + i;
-              int col = col_block + j;
-
-              if (row < M && col < N &&
-                 ( (fill_mode_c == FillMode::kLower && row >= col) || 
-                  (fill_mode_c == FillMode::kUpper && row <= col) )               
-                ) {
-                
-                // A x A^T (Symmetric) or A x A^H (Hermitian)
-                // complex conjugation on operandB (a_t) (function of blas3 computation)
-                ElementA a = tensor_a.at(MatrixCoord(row, k_block));
-                ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
-                              conj(tensor_a.at(MatrixCoord(col, k_block))) : 
-                              tensor_a.at(MatrixCoord(col, k_block));
-
-                ComputeType a_ik = ComputeType(a);
-                ComputeType b_jk = ComputeType(a_t);
-
-                // complex conjugation (function of input layouts)
-                if (transform_a == ComplexTransform::kConjugate) {
-                  a_ik = conj(a_ik);
-                }
-                // complex conjugation (function of input layouts)
-                if (transform_a == ComplexTransform::kConjugate) {
-                  b_jk = conj(b_jk);
-                }
-
-                accum[i][j] = inner_product_op(a_ik, b_jk,  accum[i][j]);
-
-              }
+    // A x A^T (Symmetric) or A x A^H (Hermitian)
+    auto load_a = [&](int row, int k) {
+      ComputeType a_ik = ComputeType(tensor_a.at(MatrixCoord(row, k)));
+      // complex conjugation (function of input layouts)
+      if (transform_a == ComplexTransform::kConjugate) {
+        a_ik = conj(a_ik);
+      }
+      return a_ik;
+    };
+
+    auto load_b = [&](int k, int col) {
+      // complex conjugation on operandB (a_t) (function of blas3 computation)
+      ElementA a_t = (blas_mode == BlasMode::kHermitian) ? 
+                    conj(tensor_a.at(MatrixCoord(col, k))) : 
+                    tensor_a.at(MatrixCoord(col, k));
+      ComputeType b_jk = ComputeType(a_t);
+      // complex conjugation (function of input layouts)
+      if (transform_a == ComplexTransform::kConjugate) {
+        b_jk = conj(b_jk);
+      }
+      return b_jk;
+    };
+
+    auto tiles = [&](int row_block) {
+      return detail::blas3_triangle_tiles(fill_mode_c == FillMode::kLower, row_block, col_blocks);
+    };
+
+    auto k_range = [&](int, int) {
+      return std::make_pair(0, K);
+    };
+
+    auto epilogue = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+      ConvertOp convert_op;
+      for (int j = 0; j < detail::kBlas3Block; j++) {
+        for (int i = 0; i < detail::kBlas3Block; i++) {
+          int row = tile_row + i;
+          int col = tile_col + j;
+
+          MatrixCoord coord = MatrixCoord(row, col);
+
+          if (row < M && col < N && 
+              ((fill_mode_c == FillMode::kLower && row >= col) || 
+               (fill_mode_c == FillMode::kUpper && row <= col))
+            ) {
+
+            ScalarType c = tensor_c.at(coord);
+            // The imaginary parts of the diagonal elements of 
+            // a complex data type are assumed and set to zero
+            if (blas_mode == BlasMode::kHermitian) {
+              c = (row == col) ? real(c) : c;
             }
-          }
-        }
 
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            MatrixCoord coord = MatrixCoord(row, col);
-
-            if (row < M && col < N && 
-                ((fill_mode_c == FillMode::kLower && row >= col) || 
-                 (fill_mode_c == FillMode::kUpper && row <= col))
-              ) {
-
-              ScalarType c = tensor_c.at(coord);
-              // The imaginary parts of the diagonal elements of 
-              // a complex data type are assumed and set to zero
-              if (blas_mode == BlasMode::kHermitian) {
-                c = (row == col) ? real(c) : c;
-              }
-
-              ScalarType tmp_d = convert_op(
-                alpha * ScalarType(accum[i][j]) + 
-                beta * c);
-
-              if (blas_mode == BlasMode::kHermitian && row == col ) {
-                tensor_d.at(coord) = real(tmp_d);
-              } else {
-                tensor_d.at(coord) = tmp_d;
-              }
+            ScalarType tmp_d = convert_op(
+              alpha * ScalarType(accum[i][j]) + 
+              beta * c);
+
+            if (blas_mode == BlasMode::kHermitian && row == col ) {
+              tensor_d.at(coord) = real(tmp_d);
+            } else {
+              tensor_d.at(coord) = tmp_d;
             }
           }
         }
+      }
+    };
 
-      } // for (col_block)
-    } // for (row_block)
+    detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+      M, N, load_a, load_b, tiles, k_range, epilogue, initial_accum);
 
     tensor_a.add_pointer_offset(batch_stride_A);
     tensor_c.add_pointer_offset(batch_stride_C);
@@ -45,6 +45,7 @@
 #include "cutlass/arch/mma.h"
 #include "cutlass/util/host_tensor.h"
 #include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/blas3_blocked.h"
 
 namespace cutlass {
 namespace reference {
@@ -100,90 +101,55 @@ void compute_symm(
   int const N = problem_size.n();
   // Assuming correct k-dimension value is passed
   int const K = problem_size.k();
-
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-  CompareOp_w_diag compare_op_1;
-  CompareOp_wo_diag compare_op_2;
-
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-      ComputeType accum[Mblock][Nblock];
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
-
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < M && col < N) {
-              ElementA a_1 = ElementA();
-              ElementB b_1 = ElementB();
-              ElementA a_2 = ElementA();
-              ElementB b_2 = ElementB();
-
-              // A x B or B x A (with diagonal)
-              if (SideModeA == SideMode::kLeft) {
-                a_1 = (compare_op_1(row, k_block)) ? 
-                      (tensor_a.at(MatrixCoord(row, k_block))) : ElementA();
-                b_1 = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a_1 = tensor_b.at(MatrixCoord(row, k_block));
-                b_1 = (compare_op_1(k_block, col)) ? 
-                      tensor_a.at(MatrixCoord(k_block, col)) : ElementA();
-              }
-
-              ComputeType compute_a_1(cast_if_scalar<ComputeType>(a_1));
-              ComputeType compute_b_1(cast_if_scalar<ComputeType>(b_1));
-
-              accum[i][j] = inner_product_op(compute_a_1, compute_b_1, accum[i][j]);
-
-              // A^T x B or B x A^T (without diagonal)
-              if (SideModeA == SideMode::kLeft) {
-                a_2 = (compare_op_2(k_block, row)) ? 
-                      (tensor_a.at(MatrixCoord(k_block, row))) : ElementA();
-                b_2 = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a_2 = tensor_b.at(MatrixCoord(row, k_block));
-                b_2 = (compare_op_2(col, k_block)) ? 
-                      tensor_a.at(MatrixCoord(col, k_block)) : ElementA();
-              }
-
-              ComputeType compute_a_2(cast_if_scalar<ComputeType>(a_2));
-              ComputeType compute_b_2(cast_if_scalar<ComputeType>(b_2));
-
-              accum[i][j] = inner_product_op(compute_a_2, compute_b_2, accum[i][j]);
-            }
-          }
-        }
-      }
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
-
-          MatrixCoord coord = MatrixCoord(row, col);
-
-          if (row < M && col < N) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]) +
-              beta * ScalarType(tensor_c.at(coord)));
-          }
+  int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
+
+  // Element (i, j) of the symmetric matrix, read from the stored triangle only
+  auto load_symmetric = [&](int i, int j) {
+    CompareOp_w_diag compare_op_1;
+    CompareOp_wo_diag compare_op_2;
+    ElementA a = compare_op_1(i, j) ? tensor_a.at(MatrixCoord(i, j)) :
+                 (compare_op_2(j, i) ? tensor_a.at(MatrixCoord(j, i)) : ElementA());
+    return ComputeType(cast_if_scalar<ComputeType>(a));
+  };
+
+  auto load_general = [&](int i, int j) {
+    return ComputeType(cast_if_scalar<ComputeType>(tensor_b.at(MatrixCoord(i, j))));
+  };
+
+  auto tiles = [&](int) {
+    return std::make_pair(0, col_blocks);
+  };
+
+  auto k_range = [&](int, int) {
+    return std::make_pair(0, K);
+  };
+
+  auto epilogue = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+    ConvertOp convert_op;
+    for (int j = 0; j < detail::kBlas3Block; j++) {
+      for (int i = 0; i < detail::kBlas3Block; i++) {
+        int row = tile_row + i;
+        int col = tile_col + j;
+
+        MatrixCoord coord = MatrixCoord(row, col);
+
+        if (row < M && col < N) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]) +
+            beta * ScalarType(tensor_c.at(coord)));
         }
       }
     }
+  };
+
+  // A x B or B x A
+  if (SideModeA == SideMode::kLeft) {
+    detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+      M, N, load_symmetric, load_general, tiles, k_range, epilogue, initial_accum);
+  }
+  else {
+    detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+      M, N, load_general, load_symmetric, tiles, k_range, epilogue, initial_accum);
   }
 }
 
@@ -0,0 +1,117 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Computes fingerprints of blocks of elements in host memory.
+
+    The digests are defined in cutlass/util/tensor_fingerprint.h and match those computed on the
+    device by reference/device/tensor_fingerprint.h.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/numeric_size.h"
+#include "cutlass/subbyte_reference.h"
+#include "cutlass/util/host_thread_pool.h"
+#include "cutlass/util/tensor_fingerprint.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Number of words or elements digested by each task of the host thread pool
+static int64_t const kFingerprintGrain = int64_t(1) << 16;
+
+/// Digest of the raw bits of a block of `num_bits` bits
+inline uint64_t BlockFingerprintExact(void const *ptr, uint64_t num_bits) {
+
+  uint8_t const *bytes = static_cast<uint8_t const *>(ptr);
+  uint64_t words = (num_bits + 63) / 64;
+  uint64_t full_words = num_bits / 64;
+
+  std::atomic<uint64_t> digest(fingerprint_mix(num_bits));
+
+  cutlass::host_thread_pool().parallel_for(int64_t(words), [&](int64_t begin, int64_t end) {
+    uint64_t sum = 0;
+    for (int64_t w = begin; w < end; ++w) {
+      uint64_t value;
+      if (uint64_t(w) < full_words) {
+        std::memcpy(&value, bytes + w * 8, sizeof(value));
+      }
+      else {
+        value = fingerprint_load_word(bytes, uint64_t(w), num_bits);
+      }
+      sum += fingerprint_term(uint64_t(w), value);
+    }
+    digest.fetch_add(sum, std::memory_order_relaxed);
+  }, kFingerprintGrain);
+
+  return digest.load();
+}
+
+/// Computes the exact and quantized digests of a block of elements. Elements are rounded to
+/// `mantissa_bits` bits, and elements smaller in magnitude than `nonzero_floor` count as zero.
+template <typename Element>
+TensorFingerprint BlockFingerprint(
+  Element const *ptr,
+  size_t capacity,
+  int mantissa_bits,
+  double nonzero_floor = 0) {
+
+  TensorFingerprint fingerprint;
+  fingerprint.exact = BlockFingerprintExact(ptr, uint64_t(capacity) * uint64_t(sizeof_bits<Element>::value));
+
+  std::atomic<uint64_t> digest(fingerprint_mix(uint64_t(capacity)));
+
+  cutlass::host_thread_pool().parallel_for(int64_t(capacity), [&](int64_t begin, int64_t end) {
+    uint64_t sum = 0;
+    for (int64_t idx = begin; idx < end; ++idx) {
+      Element value = ReferenceFactory<Element>::get(ptr, idx);
+      sum += fingerprint_term(uint64_t(idx), FingerprintValue<Element>::quantize(value, mantissa_bits, nonzero_floor));
+    }
+    digest.fetch_add(sum, std::memory_order_relaxed);
+  }, kFingerprintGrain);
+
+  fingerprint.quantized = digest.load();
+  return fingerprint;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
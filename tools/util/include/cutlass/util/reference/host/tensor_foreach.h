@@ -32,6 +32,7 @@
 
 #include <stdexcept>
 #include "cutlass/cutlass.h"
+#include "cutlass/util/host_thread_pool.h"
 
 namespace cutlass  {
 namespace reference {
@@ -108,6 +109,50 @@ void TensorForEachLambda(Coord<Rank> extent, Func func) {
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 
+/// Number of coordinates visited by each task of TensorForEachParallel()
+static int64_t const kTensorForEachParallelGrain = int64_t(1) << 14;
+
+/// Iterates over the index space of a tensor on the host thread pool. `func` is shared by all
+/// threads and is called concurrently for distinct coordinates, so it must not depend on the
+/// order of iteration. Each task visits a contiguous range of coordinates with the last rank
+/// changing fastest.
+template <
+  typename Func,          ///< function applied to each point in a tensor's index space
+  int Rank>               ///< rank of index space
+void TensorForEachParallel(
+  Coord<Rank> extent,
+  Func func,
+  int64_t grain = kTensorForEachParallelGrain) {
+
+  int64_t count = 1;
+  for (int i = 0; i < Rank; ++i) {
+    count *= int64_t(extent.at(i));
+  }
+
+  cutlass::host_thread_pool().parallel_for(count, [&](int64_t begin, int64_t end) {
+
+    // Decompose the first linear index into coordinates, last rank fastest
+    Coord<Rank> coord;
+    int64_t index = begin;
+    for (int i = Rank - 1; i >= 0; --i) {
+      coord[i] = int(index % extent.at(i));
+      index /= extent.at(i);
+    }
+
+    for (int64_t linear = begin; linear < end; ++linear) {
+      func(coord);
+      for (int i = Rank - 1; i >= 0; --i) {
+        if (++coord[i] < extent.at(i)) {
+          break;
+        }
+        coord[i] = 0;
+      }
+    }
+  }, grain);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
 template <typename Element, typename Func>
 struct BlockForEach {
 
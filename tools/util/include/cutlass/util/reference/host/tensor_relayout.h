@@ -0,0 +1,427 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+    \brief Blocked, multithreaded conversion between tensor layouts on the host.
+
+    TensorRelayout() copies a tensor between any two layouts of the same rank (for example
+    TensorNCHW, TensorNHWC, TensorNCxHWx<> or TensorCxRSKx<>, or RowMajor and
+    ColumnMajorInterleaved<>), optionally converting elements and padding the destination.
+
+    The dimension with unit stride is found for each layout. When the two differ, the plane they
+    span is recursively bisected into small tiles (a cache-oblivious traversal), and each tile is
+    transposed through a local buffer so that both tensors are accessed along their contiguous
+    dimension. Offsets are advanced incrementally within the contiguous runs of each layout
+    instead of being evaluated per coordinate. Independent planes and panels of the tiled plane
+    are distributed across host threads.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/layout/matrix.h"
+#include "cutlass/layout/pitch_linear.h"
+#include "cutlass/layout/tensor.h"
+#include "cutlass/tensor_view.h"
+#include "cutlass/util/host_thread_pool.h"
+
+namespace cutlass {
+namespace reference {
+namespace host {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Number of consecutive elements along the unit-stride dimension of a layout that are adjacent
+/// in memory, counted from an index that is a multiple of it. Zero means the whole dimension is
+/// contiguous. The default of one makes no assumption and evaluates the layout for every element.
+template <typename Layout>
+struct LayoutContiguousRun {
+  static int const value = 1;
+};
+
+template <> struct LayoutContiguousRun<layout::RowMajor> { static int const value = 0; };
+template <> struct LayoutContiguousRun<layout::ColumnMajor> { static int const value = 0; };
+template <> struct LayoutContiguousRun<layout::PitchLinear> { static int const value = 0; };
+template <> struct LayoutContiguousRun<layout::TensorNHWC> { static int const value = 0; };
+template <> struct LayoutContiguousRun<layout::TensorNCHW> { static int const value = 0; };
+template <> struct LayoutContiguousRun<layout::TensorNDHWC> { static int const value = 0; };
+
+template <int Interleave>
+struct LayoutContiguousRun<layout::RowMajorInterleaved<Interleave>> { static int const value = Interleave; };
+
+template <int Interleave>
+struct LayoutContiguousRun<layout::ColumnMajorInterleaved<Interleave>> { static int const value = Interleave; };
+
+template <int Interleave>
+struct LayoutContiguousRun<layout::TensorNCxHWx<Interleave>> { static int const value = Interleave; };
+
+template <int Interleave>
+struct LayoutContiguousRun<layout::TensorCxRSKx<Interleave>> { static int const value = Interleave; };
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+/// Tiles of the transposed plane are at most this many elements along each dimension
+static int const kRelayoutTile = 32;
+
+/// Each work item covers a panel of this many tiles along the second dimension of the plane
+static int const kRelayoutPanelTiles = 8;
+
+/// Copies with fewer elements than this are performed on the calling thread
+static int64_t const kRelayoutParallelThreshold = int64_t(1) << 20;
+
+/// Walks a layout along one dimension, advancing the offset incrementally within contiguous runs
+template <typename Layout>
+struct RelayoutCursor {
+
+  using TensorCoord = typename Layout::TensorCoord;
+  using LongIndex = typename Layout::LongIndex;
+
+  Layout layout;
+  int dim;
+  int run;
+  TensorCoord coord;
+  LongIndex offset;
+
+  /// Steps remaining before the next run boundary
+  int remaining;
+
+  RelayoutCursor(Layout const &layout_, int dim_, int run_):
+    layout(layout_), dim(dim_), run(run_), coord(), offset(0), remaining(0) { }
+
+  void begin(TensorCoord const &start) {
+    coord = start;
+    offset = layout(coord);
+    remaining = (run > 0 ? run - int(coord[dim] % run) : -1);
+  }
+
+  void next() {
+    ++coord[dim];
+    if (--remaining == 0) {
+      offset = layout(coord);
+      remaining = run;
+    }
+    else {
+      ++offset;
+    }
+  }
+};
+
+/// Finds the dimension with unit stride and the length of its contiguous runs
+template <typename Layout>
+void relayout_unit_dim(Layout const &layout, int &dim, int &run) {
+
+  using TensorCoord = typename Layout::TensorCoord;
+  int const kRank = Layout::kRank;
+
+  TensorCoord origin;
+  auto base = layout(origin);
+
+  for (int i = kRank - 1; i >= 0; --i) {
+    TensorCoord unit;
+    unit[i] = 1;
+    if (layout(unit) - base == 1) {
+      dim = i;
+      run = LayoutContiguousRun<Layout>::value;
+      return;
+    }
+  }
+
+  dim = kRank - 1;
+  run = 1;
+}
+
+/// Calls func(begin, end) on contiguous ranges of [0, count) across the host thread pool
+template <typename Func>
+void relayout_parallel_for(int64_t count, int64_t elements, int num_threads, Func &&func) {
+
+  if (elements < kRelayoutParallelThreshold) {
+    func(int64_t(0), count);
+    return;
+  }
+
+  cutlass::host_thread_pool().parallel_for(count, func, 1, num_threads);
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Copies `src` into `dst`, converting each element with `convert`. Coordinates of `dst` outside
+/// the extent of `src` are filled with `pad`, so the destination may be larger than the source
+/// in any dimension (for example, channels padded to a multiple of the alignment).
+///
+/// When the destination stores elements narrower than a byte, the copy is performed on one thread
+/// since adjacent elements share a byte.
+template <
+  typename DstElement,
+  typename DstLayout,
+  typename SrcElement,
+  typename SrcLayout,
+  typename Convert
+>
+void TensorRelayout(
+  TensorView<DstElement, DstLayout> dst,
+  TensorView<SrcElement, SrcLayout> src,
+  Convert convert,
+  DstElement pad = DstElement(0),
+  int num_threads = 0) {
+
+  static_assert(DstLayout::kRank == SrcLayout::kRank, "Layouts must have the same rank");
+
+  using DstCoord = typename DstLayout::TensorCoord;
+  using SrcCoord = typename SrcLayout::TensorCoord;
+  using Index = typename DstLayout::Index;
+
+  int const kRank = DstLayout::kRank;
+  int const kTile = detail::kRelayoutTile;
+
+  DstCoord dst_extent = dst.extent();
+  SrcCoord src_extent = src.extent();
+
+  int64_t elements = 1;
+  for (int i = 0; i < kRank; ++i) {
+    if (dst_extent[i] <= 0) {
+      return;
+    }
+    elements *= dst_extent[i];
+  }
+
+  // Unit-stride dimensions of the two layouts span the plane that is transposed
+  int src_dim, src_run, dst_dim, dst_run;
+  detail::relayout_unit_dim(src.layout(), src_dim, src_run);
+  detail::relayout_unit_dim(dst.layout(), dst_dim, dst_run);
+
+  int const a = src_dim;
+  int b = dst_dim;
+
+  if (a == b) {
+    // Both layouts are contiguous along the same dimension; rows along it are copied directly and
+    // the next-largest dimension is tiled for locality
+    b = -1;
+    for (int i = 0; i < kRank; ++i) {
+      if (i != a && (b < 0 || dst_extent[i] > dst_extent[b])) {
+        b = i;
+      }
+    }
+  }
+
+  int64_t const extent_a = dst_extent[a];
+  int64_t const extent_b = (b >= 0 ? int64_t(dst_extent[b]) : int64_t(1));
+
+  // Outer coordinates are all dimensions other than a and b
+  int64_t outer_count = 1;
+  for (int i = 0; i < kRank; ++i) {
+    if (i != a && i != b) {
+      outer_count *= dst_extent[i];
+    }
+  }
+
+  // Work items are (outer coordinate, panel of the b dimension)
+  int64_t const panel_size = int64_t(kTile) * detail::kRelayoutPanelTiles;
+  int64_t const panels = (extent_b + panel_size - 1) / panel_size;
+
+  auto process = [&](int64_t item_begin, int64_t item_end) {
+
+    detail::RelayoutCursor<SrcLayout> src_cursor(src.layout(), a, src_run);
+    detail::RelayoutCursor<DstLayout> dst_cursor(dst.layout(), dst_dim, dst_run);
+
+    DstElement tile[detail::kRelayoutTile][detail::kRelayoutTile];
+
+    // True if the dimensions other than a and b of the current plane lie within the source
+    bool plane_in_source = false;
+
+    // Reads `count` source elements along a starting at `coord` and writes them to out[i * step]
+    auto read_row = [&](DstCoord const &coord, int count, DstElement *out, int step) {
+      if (src_run == 0) {
+        auto offset = src.layout()(SrcCoord(coord));
+        for (int i = 0; i < count; ++i) {
+          out[i * step] = convert(src.data(offset + i));
+        }
+      }
+      else {
+        src_cursor.begin(SrcCoord(coord));
+        for (int i = 0; i < count; ++i) {
+          out[i * step] = convert(src.data(src_cursor.offset));
+          if (i + 1 < count) {
+            src_cursor.next();
+          }
+        }
+      }
+    };
+
+    // Writes `count` elements in[i * step] along the destination's contiguous dimension
+    auto write_row = [&](DstCoord const &coord, int count, DstElement const *in, int step) {
+      if (dst_run == 0) {
+        auto offset = dst.layout()(coord);
+        for (int i = 0; i < count; ++i) {
+          dst.data(offset + i) = in[i * step];
+        }
+      }
+      else {
+        dst_cursor.begin(coord);
+        for (int i = 0; i < count; ++i) {
+          dst.data(dst_cursor.offset) = in[i * step];
+          if (i + 1 < count) {
+            dst_cursor.next();
+          }
+        }
+      }
+    };
+
+    // Copies the tile [a0, a1) x [b0, b1) of the plane at `base`
+    auto leaf = [&](DstCoord base, Index a0, Index a1, Index b0, Index b1) {
+
+      int const rows = int(b1 - b0);
+      int const columns = int(a1 - a0);
+      int const valid_columns = std::max(0, int(std::min<Index>(a1, Index(src_extent[a])) - a0));
+
+      // Read the tile along the source's contiguous dimension. When the destination is
+      // contiguous along the same dimension, the tile is stored transposed so rows stay contiguous.
+      bool const same_dim = (a == dst_dim);
+
+      for (int r = 0; r < rows; ++r) {
+        DstCoord coord = base;
+        if (b >= 0) {
+          coord[b] = b0 + r;
+        }
+        coord[a] = a0;
+
+        bool valid = plane_in_source && (b < 0 || coord[b] < src_extent[b]);
+        int count = valid ? valid_columns : 0;
+
+        DstElement *out = same_dim ? &tile[r][0] : &tile[0][r];
+        int step = same_dim ? 1 : detail::kRelayoutTile;
+
+        read_row(coord, count, out, step);
+        for (int i = count; i < columns; ++i) {
+          out[i * step] = pad;
+        }
+      }
+
+      // Write it along the destination's contiguous dimension
+      if (same_dim) {
+        for (int r = 0; r < rows; ++r) {
+          DstCoord coord = base;
+          if (b >= 0) {
+            coord[b] = b0 + r;
+          }
+          coord[a] = a0;
+          write_row(coord, columns, &tile[r][0], 1);
+        }
+      }
+      else {
+        for (int c = 0; c < columns; ++c) {
+          DstCoord coord = base;
+          coord[a] = a0 + c;
+          coord[b] = b0;
+          write_row(coord, rows, &tile[c][0], 1);
+        }
+      }
+    };
+
+    // Recursive bisection of the plane down to tiles. Split points are multiples of the tile
+    // size relative to the panel origin, so every leaf fits the tile buffer.
+    auto recurse = [&](auto &self, DstCoord const &base, Index a0, Index a1, Index b0, Index b1) -> void {
+      if (a1 - a0 <= kTile && b1 - b0 <= kTile) {
+        leaf(base, a0, a1, b0, b1);
+      }
+      else if (a1 - a0 >= b1 - b0) {
+        Index mid = a0 + ((a1 - a0) / 2 + kTile - 1) / kTile * kTile;
+        self(self, base, a0, mid, b0, b1);
+        self(self, base, mid, a1, b0, b1);
+      }
+      else {
+        Index mid = b0 + ((b1 - b0) / 2 + kTile - 1) / kTile * kTile;
+        self(self, base, a0, a1, b0, mid);
+        self(self, base, a0, a1, mid, b1);
+      }
+    };
+
+    for (int64_t item = item_begin; item < item_end; ++item) {
+
+      int64_t outer = item / panels;
+      int64_t panel = item % panels;
+
+      // Decompose the outer index into coordinates, last dimension fastest
+      DstCoord base;
+      for (int i = kRank - 1; i >= 0; --i) {
+        if (i != a && i != b) {
+          base[i] = Index(outer % dst_extent[i]);
+          outer /= dst_extent[i];
+        }
+      }
+
+      plane_in_source = true;
+      for (int i = 0; i < kRank; ++i) {
+        if (i != a && i != b && base[i] >= src_extent[i]) {
+          plane_in_source = false;
+        }
+      }
+
+      Index b0 = Index(panel * panel_size);
+      Index b1 = Index(std::min<int64_t>(extent_b, b0 + panel_size));
+
+      recurse(recurse, base, Index(0), Index(extent_a), b0, b1);
+    }
+  };
+
+  int threads = (sizeof_bits<DstElement>::value < 8 ? 1 : num_threads);
+  detail::relayout_parallel_for(outer_count * panels, elements, threads, process);
+}
+
+/// Copies `src` into `dst`, converting elements with a constructor. Coordinates of `dst`
+/// outside the extent of `src` are filled with `pad`.
+template <
+  typename DstElement,
+  typename DstLayout,
+  typename SrcElement,
+  typename SrcLayout
+>
+void TensorRelayout(
+  TensorView<DstElement, DstLayout> dst,
+  TensorView<SrcElement, SrcLayout> src,
+  DstElement pad = DstElement(0),
+  int num_threads = 0) {
+
+  TensorRelayout(dst, src, [](SrcElement const &x) { return DstElement(x); }, pad, num_threads);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace host
+} // namespace reference
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -43,6 +43,7 @@
 #include "cutlass/gemm/gemm.h"
 
 #include "cutlass/util/reference/host/gemm.h"
+#include "cutlass/util/reference/host/blas3_blocked.h"
 
 namespace cutlass {
 namespace reference {
@@ -93,81 +94,69 @@ void compute_trmm_complex(
   // Assuming correct k-dimension value is passed
   int const K = problem_size.k();
  
-  // Blocking necessary to speedup reference implementation
-  int const Mblock = 16;
-  int const Nblock = 16;
-
-  ConvertOp convert_op;
-  InnerProductOp inner_product_op;
-  CompareOp compare_op;
-  
-  for (int row_block = 0; row_block < M; row_block += Mblock) {
-    for (int col_block = 0; col_block < N; col_block += Nblock) {
-
-      ComputeType accum[Mblock][Nblock];
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          accum[i][j] = initial_accum;
-        }
-      }
-
-      for (int k_block = 0; k_block < K; ++k_block) {
-        for (int j = 0; j < Nblock; j++) {
-          for (int i = 0; i < Mblock; i++) {
-            int row = row_block + i;
-            int col = col_block + j;
-
-            if (row < M && col < N) {
-              ElementA a = ElementA();
-              ElementB b = ElementB();
-              
-              if (SideModeA == SideMode::kLeft) {
-                a = (compare_op(row, k_block)) ? 
-                              (tensor_a.at(MatrixCoord(row, k_block))) : ElementA(0);
-                if (row == k_block && DiagTypeA == DiagType::kUnit) {
-                  a = ElementA(1);
-                }
-                b = tensor_b.at(MatrixCoord(k_block, col));
-              } else if (SideModeA == SideMode::kRight) {
-                a = tensor_b.at(MatrixCoord(row, k_block));
-                b = (compare_op(k_block, col)) ? 
-                      tensor_a.at(MatrixCoord(k_block, col)) : ElementA(0);
-                if (k_block == col && DiagTypeA == DiagType::kUnit) {
-                  b = ElementA(1);
-                }
-              }
-
-              ComputeType a_ik = ComputeType(a);
-              ComputeType b_kj = ComputeType(b);
-              
-              // Conjugate, and hence hermitian, is only allowed for the triangular matrix
-              if (SideModeA == SideMode::kLeft && TransformA == ComplexTransform::kConjugate) {
-                a_ik = conj(a_ik);
-              } else if (SideModeA == SideMode::kRight && TransformA == ComplexTransform::kConjugate) {
-                b_kj = conj(b_kj);
-              }
-
-              accum[i][j] = inner_product_op(a_ik, b_kj,  accum[i][j]);
-            }
-          }
-        }
-      }
-
-      for (int j = 0; j < Nblock; j++) {
-        for (int i = 0; i < Mblock; i++) {
-          int row = row_block + i;
-          int col = col_block + j;
-
-          MatrixCoord coord = MatrixCoord(row, col);
-
-          if (row < M && col < N) {
-            tensor_d.at(coord) = convert_op(
-              alpha * ScalarType(accum[i][j]));
-          }
+  int const col_blocks = (N + detail::kBlas3Block - 1) / detail::kBlas3Block;
+
+  // Element (i, j) of the triangular matrix. Conjugate, and hence hermitian, is only allowed for
+  // the triangular matrix.
+  auto load_triangular = [&](int i, int j) {
+    CompareOp compare_op;
+    ElementA a = compare_op(i, j) ? tensor_a.at(MatrixCoord(i, j)) : ElementA(0);
+    if (i == j && DiagTypeA == DiagType::kUnit) {
+      a = ElementA(1);
+    }
+    ComputeType a_ij = ComputeType(a);
+    if (TransformA == ComplexTransform::kConjugate) {
+      a_ij = conj(a_ij);
+    }
+    return a_ij;
+  };
+
+  auto load_general = [&](int i, int j) {
+    return ComputeType(tensor_b.at(MatrixCoord(i, j)));
+  };
+
+  auto tiles = [&](int) {
+    return std::make_pair(0, col_blocks);
+  };
+
+  // Only the part of the reduction that meets the stored triangle is computed
+  auto k_range = [&](int row_block, int col_block) {
+    int const kBlock = detail::kBlas3Block;
+    if (SideModeA == SideMode::kLeft) {
+      return (FillModeA == FillMode::kLower) ?
+        std::make_pair(0, std::min(K, (row_block + 1) * kBlock)) :
+        std::make_pair(std::min(K, row_block * kBlock), K);
+    }
+    return (FillModeA == FillMode::kLower) ?
+      std::make_pair(std::min(K, col_block * kBlock), K) :
+      std::make_pair(0, std::min(K, (col_block + 1) * kBlock));
+  };
+
+  auto epilogue = [&](int tile_row, int tile_col, ComputeType const (&accum)[detail::kBlas3Block][detail::kBlas3Block]) {
+    ConvertOp convert_op;
+    for (int j = 0; j < detail::kBlas3Block; j++) {
+      for (int i = 0; i < detail::kBlas3Block; i++) {
+        int row = tile_row + i;
+        int col = tile_col + j;
+
+        MatrixCoord coord = MatrixCoord(row, col);
+
+        if (row < M && col < N) {
+          tensor_d.at(coord) = convert_op(
+            alpha * ScalarType(accum[i][j]));
         }
       }
     }
+  };
+
+  // A x B or B x A
+  if (SideModeA == SideMode::kLeft) {
+    detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+      M, N, load_triangular, load_general, tiles, k_range, epilogue, initial_accum);
+  }
+  else {
+    detail::blas3_blocked_product<ComputeType, InnerProductOp>(
+      M, N, load_general, load_triangular, tiles, k_range, epilogue, initial_accum);
   }
 }
 
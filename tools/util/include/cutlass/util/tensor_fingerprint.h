@@ -0,0 +1,209 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Digests of tensor contents used to detect changes in kernel outputs without a reference.
+
+    A fingerprint holds two 64-bit digests of a block of elements:
+
+      exact     - a digest of the raw bits of the block. Equal blocks always have equal digests.
+      quantized - a digest of each element rounded to a number of mantissa bits. Elements whose
+                  magnitude is below a floor count as zero, and all NaNs are alike. Values that
+                  differ by much less than the rounding step usually have equal digests. Values
+                  close to a rounding boundary may still differ, so a mismatch of only the
+                  quantized digest should be confirmed with a full comparison.
+
+    Each word or element is mixed with its index, and the mixed values are summed modulo 2^64.
+    The sum does not depend on the order of accumulation, so the host and device implementations
+    in reference/host/tensor_fingerprint.h and reference/device/tensor_fingerprint.h agree
+    regardless of how work is partitioned across threads.
+*/
+
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/complex.h"
+#include "cutlass/integer_subbyte.h"
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Exact and quantized digests of a block of elements
+struct TensorFingerprint {
+  uint64_t exact = 0;
+  uint64_t quantized = 0;
+
+  bool operator==(TensorFingerprint const &rhs) const {
+    return exact == rhs.exact && quantized == rhs.quantized;
+  }
+
+  bool operator!=(TensorFingerprint const &rhs) const {
+    return !(*this == rhs);
+  }
+};
+
+/// Largest number of mantissa bits kept by the quantized digest
+static int const kFingerprintMaxMantissaBits = 48;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// 64-bit finalizer of SplitMix64
+CUTLASS_HOST_DEVICE
+uint64_t fingerprint_mix(uint64_t x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ull;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebull;
+  x ^= x >> 31;
+  return x;
+}
+
+/// Contribution of `value` at position `index` to a digest
+CUTLASS_HOST_DEVICE
+uint64_t fingerprint_term(uint64_t index, uint64_t value) {
+  return fingerprint_mix(value ^ fingerprint_mix(index + 0x9e3779b97f4a7c15ull));
+}
+
+/// Rounds `x` to `mantissa_bits` bits of mantissa and packs sign, exponent and mantissa
+CUTLASS_HOST_DEVICE
+uint64_t fingerprint_quantize(double x, int mantissa_bits, double nonzero_floor) {
+
+  if (x != x) {
+    return 0x7ff8000000000000ull;
+  }
+
+  double magnitude = ::fabs(x);
+  uint64_t sign = (x < 0) ? (1ull << 62) : 0;
+
+  if (!(magnitude >= nonzero_floor) || magnitude == 0) {
+    return 0;
+  }
+
+  if (magnitude > 1.7976931348623157e308) {
+    return sign | 0x3fffffffffffffffull;
+  }
+
+  mantissa_bits = mantissa_bits < 1 ? 1 : (mantissa_bits > kFingerprintMaxMantissaBits ? kFingerprintMaxMantissaBits : mantissa_bits);
+
+  int exponent = 0;
+  double mantissa = ::frexp(magnitude, &exponent);
+  uint64_t q = uint64_t(::llround(::ldexp(mantissa, mantissa_bits)));
+
+  // Rounding up to the next power of two carries into the exponent
+  if (q == (1ull << mantissa_bits)) {
+    q >>= 1;
+    ++exponent;
+  }
+
+  return sign | (uint64_t(exponent + 2048) << 49) | q;
+}
+
+/// Loads word `word` of a block of `num_bits` bits in little-endian order. Bits past the end of
+/// the block are cleared, so padding of sub-byte elements does not affect the digest.
+CUTLASS_HOST_DEVICE
+uint64_t fingerprint_load_word(uint8_t const *bytes, uint64_t word, uint64_t num_bits) {
+  uint64_t valid_bits = num_bits - word * 64;
+  valid_bits = valid_bits < 64 ? valid_bits : 64;
+
+  uint64_t value = 0;
+  for (uint64_t i = 0; i < (valid_bits + 7) / 8; ++i) {
+    value |= uint64_t(bytes[word * 8 + i]) << (8 * i);
+  }
+  if (valid_bits < 64) {
+    value &= (1ull << valid_bits) - 1;
+  }
+  return value;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Maps an element to the 64-bit value entering the quantized digest. Integers are used exactly.
+template <typename Element, typename Enable = void>
+struct FingerprintValue {
+  CUTLASS_HOST_DEVICE
+  static uint64_t quantize(Element const &value, int mantissa_bits, double nonzero_floor) {
+    return fingerprint_quantize(double(float(value)), mantissa_bits, nonzero_floor);
+  }
+};
+
+template <>
+struct FingerprintValue<double> {
+  CUTLASS_HOST_DEVICE
+  static uint64_t quantize(double value, int mantissa_bits, double nonzero_floor) {
+    return fingerprint_quantize(value, mantissa_bits, nonzero_floor);
+  }
+};
+
+template <typename Element>
+struct FingerprintValue<Element, typename std::enable_if<std::is_integral<Element>::value>::type> {
+  CUTLASS_HOST_DEVICE
+  static uint64_t quantize(Element value, int, double) {
+    return uint64_t(int64_t(value));
+  }
+};
+
+template <int Bits, bool Signed>
+struct FingerprintValue<integer_subbyte<Bits, Signed>> {
+  CUTLASS_HOST_DEVICE
+  static uint64_t quantize(integer_subbyte<Bits, Signed> value, int, double) {
+    return uint64_t(int64_t(typename integer_subbyte<Bits, Signed>::xint_t(value)));
+  }
+};
+
+template <typename T>
+struct FingerprintValue<complex<T>> {
+  CUTLASS_HOST_DEVICE
+  static uint64_t quantize(complex<T> const &value, int mantissa_bits, double nonzero_floor) {
+    return fingerprint_mix(FingerprintValue<T>::quantize(value.real(), mantissa_bits, nonzero_floor)) +
+      FingerprintValue<T>::quantize(value.imag(), mantissa_bits, nonzero_floor);
+  }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Number of mantissa bits whose rounding step is no larger than a relative tolerance
+inline int fingerprint_mantissa_bits(double relative_tolerance) {
+  if (!(relative_tolerance > 0)) {
+    return kFingerprintMaxMantissaBits;
+  }
+  int bits = int(std::ceil(-std::log2(relative_tolerance)));
+  return bits < 1 ? 1 : (bits > kFingerprintMaxMantissaBits ? kFingerprintMaxMantissaBits : bits);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
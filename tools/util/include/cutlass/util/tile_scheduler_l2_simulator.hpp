@@ -0,0 +1,822 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+/*! \file
+  \brief Host-side L2 reuse simulator for the SM90 persistent and stream-K tile schedulers.
+
+  The simulator replays the tile visitation order produced by PersistentTileSchedulerSm90 and
+  PersistentTileSchedulerSm90StreamK for a given raster order and swizzle size. Index math is
+  shared with the device schedulers, so the replayed order is exactly the order a launched kernel
+  would follow. Each persistent CTA contributes one mainloop iteration per simulated step, and the
+  resulting operand tile accesses are fed through a set-associative, write-back L2 model that
+  reports the DRAM traffic of each candidate.
+
+  Typical use:
+
+    cutlass::TileSchedulerL2Simulator sim(problem, hw_info, l2_config);
+    auto results = sim.simulate_all();                 // one entry per (raster order, swizzle)
+    auto best    = sim.select_raster_order_and_swizzle();
+    arguments.scheduler.raster_order     = best.raster_order_option;
+    arguments.scheduler.max_swizzle_size = best.max_swizzle_size;
+
+  Selecting the raster order and swizzle from simulated traffic is opt-in: kernels continue to use
+  RasterOrderOptions::Heuristic unless the caller overrides the scheduler arguments.
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "cutlass/cutlass.h"
+#include "cutlass/gemm_coord.h"
+#include "cutlass/kernel_hardware_info.h"
+#include "cutlass/gemm/kernel/tile_scheduler_detail.hpp"
+#include "cutlass/gemm/kernel/tile_scheduler_params.h"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler.hpp"
+#include "cutlass/gemm/kernel/sm90_tile_scheduler_stream_k.hpp"
+
+namespace cutlass {
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Geometry of the modeled L2 cache
+struct L2CacheConfig {
+  /// Total capacity in bytes. Defaults to the 50 MiB L2 of H100 SXM.
+  int64_t capacity_bytes = int64_t(50) << 20;
+
+  /// Size of a cache line in bytes
+  int line_bytes = 128;
+
+  /// Number of ways in each set
+  int ways = 16;
+
+  int64_t num_sets() const {
+    return capacity_bytes / (int64_t(line_bytes) * ways);
+  }
+};
+
+/// Set-associative, write-allocate, write-back cache with LRU replacement
+class L2CacheModel {
+public:
+
+  struct Statistics {
+    uint64_t read_accesses = 0;
+    uint64_t write_accesses = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t dram_read_bytes = 0;
+    uint64_t dram_write_bytes = 0;
+
+    uint64_t dram_bytes() const {
+      return dram_read_bytes + dram_write_bytes;
+    }
+
+    double hit_rate() const {
+      uint64_t accesses = hits + misses;
+      return accesses ? double(hits) / double(accesses) : 0.0;
+    }
+  };
+
+private:
+
+  static constexpr uint64_t kInvalidTag = ~uint64_t(0);
+
+  L2CacheConfig config_;
+  int64_t num_sets_ = 0;
+
+  /// Tag, last-use stamp and dirty bit of each way, stored set-major
+  std::vector<uint64_t> tags_;
+  std::vector<uint64_t> stamps_;
+  std::vector<uint8_t> dirty_;
+
+  uint64_t clock_ = 0;
+  Statistics stats_;
+
+public:
+
+  explicit L2CacheModel(L2CacheConfig const &config = L2CacheConfig()): config_(config) {
+    num_sets_ = config_.num_sets();
+    if (config_.line_bytes <= 0 || config_.ways <= 0 || num_sets_ <= 0) {
+      throw std::invalid_argument("L2CacheModel: capacity must hold at least one set of lines");
+    }
+    reset();
+  }
+
+  L2CacheConfig const &config() const {
+    return config_;
+  }
+
+  Statistics const &statistics() const {
+    return stats_;
+  }
+
+  /// Invalidates all lines and clears statistics
+  void reset() {
+    size_t lines = size_t(num_sets_) * size_t(config_.ways);
+    tags_.assign(lines, kInvalidTag);
+    stamps_.assign(lines, 0);
+    dirty_.assign(lines, 0);
+    clock_ = 0;
+    stats_ = Statistics();
+  }
+
+  /// Accesses the line containing byte address `addr`. Returns true on a hit.
+  bool access(uint64_t addr, bool is_write = false) {
+    uint64_t line = addr / uint64_t(config_.line_bytes);
+    size_t set_begin = size_t(line % uint64_t(num_sets_)) * size_t(config_.ways);
+
+    ++clock_;
+    if (is_write) {
+      ++stats_.write_accesses;
+    }
+    else {
+      ++stats_.read_accesses;
+    }
+
+    size_t victim = set_begin;
+    for (size_t way = set_begin; way < set_begin + size_t(config_.ways); ++way) {
+      if (tags_[way] == line) {
+        stamps_[way] = clock_;
+        dirty_[way] |= uint8_t(is_write);
+        ++stats_.hits;
+        return true;
+      }
+      if (stamps_[way] < stamps_[victim]) {
+        victim = way;
+      }
+    }
+
+    ++stats_.misses;
+    if (tags_[victim] != kInvalidTag && dirty_[victim]) {
+      stats_.dram_write_bytes += uint64_t(config_.line_bytes);
+    }
+
+    // Full-line writes are allocated without fetching the line from DRAM
+    if (!is_write) {
+      stats_.dram_read_bytes += uint64_t(config_.line_bytes);
+    }
+
+    tags_[victim] = line;
+    stamps_[victim] = clock_;
+    dirty_[victim] = uint8_t(is_write);
+    return false;
+  }
+
+  /// Accesses every line overlapping the byte range [begin, end)
+  void access_range(uint64_t begin, uint64_t end, bool is_write = false) {
+    if (begin >= end) {
+      return;
+    }
+    uint64_t line_bytes = uint64_t(config_.line_bytes);
+    for (uint64_t line = begin / line_bytes; line <= (end - 1) / line_bytes; ++line) {
+      access(line * line_bytes, is_write);
+    }
+  }
+
+  /// Writes back all dirty lines so that output traffic is accounted for
+  void flush() {
+    for (size_t way = 0; way < tags_.size(); ++way) {
+      if (tags_[way] != kInvalidTag && dirty_[way]) {
+        stats_.dram_write_bytes += uint64_t(config_.line_bytes);
+        dirty_[way] = 0;
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Describes the GEMM whose tile visitation order is simulated
+struct L2SimulationProblem {
+  /// GEMM extents (M, N, K, batch)
+  gemm::BatchedGemmCoord problem_size{};
+
+  /// CTA tile shape (M, N, K)
+  gemm::GemmCoord tile_shape{128, 128, 64};
+
+  /// Cluster shape (M, N, 1)
+  gemm::GemmCoord cluster_shape{1, 1, 1};
+
+  /// Bytes per element of A, B, C (source) and D (destination). Setting the C
+  /// element size to zero models an epilogue that does not read a source tensor.
+  int element_bytes_a = 2;
+  int element_bytes_b = 2;
+  int element_bytes_c = 0;
+  int element_bytes_d = 2;
+
+  /// Bytes per accumulator element, used for stream-K and split-K partial tiles
+  int element_bytes_accumulator = 4;
+
+  /// A is MxK and B is NxK. True selects K as the contiguous mode (TN GEMM).
+  bool a_k_major = true;
+  bool b_k_major = true;
+
+  /// C and D are MxN. True selects N as the contiguous mode (row-major output).
+  bool d_n_major = true;
+};
+
+/// Tile scheduler whose visitation order is replayed
+enum class L2SimulationScheduler {
+  Persistent,     ///< PersistentTileSchedulerSm90
+  StreamK         ///< PersistentTileSchedulerSm90StreamK
+};
+
+/// Stream-K scheduler arguments used when replaying PersistentTileSchedulerSm90StreamK
+struct L2SimulationStreamKOptions {
+  int splits = 1;
+  gemm::kernel::detail::ReductionMode reduction_mode = gemm::kernel::detail::ReductionMode::Deterministic;
+  gemm::kernel::detail::DecompositionMode decomposition_mode = gemm::kernel::detail::DecompositionMode::Heuristic;
+};
+
+/// Raster order and swizzle setting evaluated by the simulator
+struct L2SimulationCandidate {
+  gemm::kernel::detail::RasterOrderOptions raster_order_option =
+    gemm::kernel::detail::RasterOrderOptions::Heuristic;
+  int max_swizzle_size = 1;
+};
+
+/// A contiguous range of mainloop iterations a CTA computes for one output tile
+struct L2SimulationWorkSegment {
+  int32_t m = 0;                  ///< CTA tile index along M
+  int32_t n = 0;                  ///< CTA tile index along N
+  int32_t l = 0;                  ///< Batch index
+  int32_t k_begin = 0;            ///< First K tile computed
+  int32_t k_count = 0;            ///< Number of K tiles computed
+  bool reads_partial = false;     ///< Accumulates onto a partial tile produced by a peer
+  bool writes_partial = false;    ///< Stores a partial tile for a peer to reduce
+  bool writes_output = false;     ///< Runs the epilogue for the output tile
+};
+
+/// Traffic report for a single candidate
+struct L2SimulationResult {
+  L2SimulationCandidate candidate;
+
+  /// Raster order and log2 swizzle actually selected by the scheduler parameters
+  gemm::kernel::detail::RasterOrder raster_order = gemm::kernel::detail::RasterOrder::AlongN;
+  int log_swizzle_size = 0;
+
+  /// Launched grid
+  dim3 grid{};
+
+  /// Number of work segments and mainloop steps replayed
+  uint64_t work_segments = 0;
+  uint64_t mainloop_steps = 0;
+
+  L2CacheModel::Statistics l2;
+
+  uint64_t dram_bytes() const {
+    return l2.dram_bytes();
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Replays SM90 tile scheduler visitation orders through an L2 cache model
+class TileSchedulerL2Simulator {
+public:
+
+  using RasterOrder = gemm::kernel::detail::RasterOrder;
+  using RasterOrderOptions = gemm::kernel::detail::RasterOrderOptions;
+  using ReductionMode = gemm::kernel::detail::ReductionMode;
+  using DecompositionMode = gemm::kernel::detail::DecompositionMode;
+
+  using PersistentParams = gemm::kernel::detail::PersistentTileSchedulerSm90Params;
+  using StreamKParams = gemm::kernel::detail::PersistentTileSchedulerSm90StreamKParams;
+
+  /// Only the static index math of the stream-K scheduler is used, which is independent of the
+  /// static tile and cluster shapes. Runtime shapes come from the scheduler parameters.
+  using StreamKScheduler = gemm::kernel::detail::PersistentTileSchedulerSm90StreamK<
+    cute::Shape<cute::_1, cute::_1, cute::_1>, cute::Shape<cute::_1, cute::_1, cute::_1>>;
+
+  /// Per-CTA sequence of work segments in execution order
+  using Visitation = std::vector<std::vector<L2SimulationWorkSegment>>;
+
+  using StreamKOptions = L2SimulationStreamKOptions;
+
+private:
+
+  L2SimulationProblem problem_;
+  KernelHardwareInfo hw_info_;
+  L2CacheConfig l2_config_;
+  L2SimulationScheduler scheduler_;
+  StreamKOptions stream_k_;
+
+public:
+
+  TileSchedulerL2Simulator(
+    L2SimulationProblem const &problem,
+    KernelHardwareInfo const &hw_info,
+    L2CacheConfig const &l2_config = L2CacheConfig(),
+    L2SimulationScheduler scheduler = L2SimulationScheduler::Persistent,
+    StreamKOptions const &stream_k = StreamKOptions()
+  ):
+    problem_(problem), hw_info_(hw_info), l2_config_(l2_config), scheduler_(scheduler), stream_k_(stream_k) {
+
+    if (hw_info_.sm_count <= 0) {
+      throw std::invalid_argument("TileSchedulerL2Simulator: KernelHardwareInfo::sm_count must be set");
+    }
+  }
+
+  L2SimulationProblem const &problem() const {
+    return problem_;
+  }
+
+  /// Number of K tiles in each output tile
+  int k_tiles_per_output_tile() const {
+    return (problem_.problem_size.k() + problem_.tile_shape.k() - 1) / problem_.tile_shape.k();
+  }
+
+  /// Default candidate set: both raster orders for every swizzle size the schedulers accept
+  static std::vector<L2SimulationCandidate> default_candidates() {
+    std::vector<L2SimulationCandidate> candidates;
+    for (int swizzle : {1, 2, 4, 8}) {
+      candidates.push_back({RasterOrderOptions::AlongM, swizzle});
+      candidates.push_back({RasterOrderOptions::AlongN, swizzle});
+    }
+    return candidates;
+  }
+
+  /// Replays the scheduler and returns the work each CTA of the launched grid performs
+  Visitation tile_visitation_order(L2SimulationCandidate const &candidate, L2SimulationResult *result = nullptr) const {
+    if (scheduler_ == L2SimulationScheduler::StreamK) {
+      return stream_k_visitation(candidate, result);
+    }
+    return persistent_visitation(candidate, result);
+  }
+
+  /// Simulates a single candidate
+  L2SimulationResult simulate(L2SimulationCandidate const &candidate) const {
+    L2SimulationResult result;
+    result.candidate = candidate;
+
+    Visitation visitation = tile_visitation_order(candidate, &result);
+
+    L2CacheModel l2(l2_config_);
+    replay(visitation, result.grid, l2, result);
+    l2.flush();
+    result.l2 = l2.statistics();
+    return result;
+  }
+
+  /// Simulates every candidate
+  std::vector<L2SimulationResult> simulate_all(
+    std::vector<L2SimulationCandidate> const &candidates = default_candidates()) const {
+
+    std::vector<L2SimulationResult> results;
+    results.reserve(candidates.size());
+    for (auto const &candidate : candidates) {
+      results.push_back(simulate(candidate));
+    }
+    return results;
+  }
+
+  /// Opt-in heuristic: returns the candidate with the least simulated DRAM traffic. Ties are
+  /// broken in favor of the smaller swizzle and then the candidate listed first.
+  L2SimulationCandidate select_raster_order_and_swizzle(
+    std::vector<L2SimulationCandidate> const &candidates = default_candidates()) const {
+
+    std::vector<L2SimulationResult> results = simulate_all(candidates);
+    if (results.empty()) {
+      return L2SimulationCandidate{};
+    }
+
+    auto best = std::min_element(results.begin(), results.end(),
+      [](L2SimulationResult const &lhs, L2SimulationResult const &rhs) {
+        if (lhs.dram_bytes() != rhs.dram_bytes()) {
+          return lhs.dram_bytes() < rhs.dram_bytes();
+        }
+        return lhs.candidate.max_swizzle_size < rhs.candidate.max_swizzle_size;
+      });
+    return best->candidate;
+  }
+
+  /// Prints one row per result
+  static void print_report(std::ostream &out, std::vector<L2SimulationResult> const &results) {
+    out << "raster_option,raster_order,max_swizzle,log_swizzle,grid_x,grid_y,segments,steps,"
+        << "l2_hit_rate,dram_read_MB,dram_write_MB,dram_total_MB\n";
+    for (auto const &r : results) {
+      out << to_string(r.candidate.raster_order_option) << ","
+          << (r.raster_order == RasterOrder::AlongM ? "along_m" : "along_n") << ","
+          << r.candidate.max_swizzle_size << ","
+          << r.log_swizzle_size << ","
+          << r.grid.x << "," << r.grid.y << ","
+          << r.work_segments << "," << r.mainloop_steps << ","
+          << std::fixed << std::setprecision(4) << r.l2.hit_rate() << ","
+          << std::setprecision(3)
+          << double(r.l2.dram_read_bytes) / 1.0e6 << ","
+          << double(r.l2.dram_write_bytes) / 1.0e6 << ","
+          << double(r.dram_bytes()) / 1.0e6 << "\n";
+    }
+  }
+
+  static char const *to_string(RasterOrderOptions option) {
+    switch (option) {
+      case RasterOrderOptions::AlongM: return "along_m";
+      case RasterOrderOptions::AlongN: return "along_n";
+      default: return "heuristic";
+    }
+  }
+
+private:
+
+  /// Linear index of a CTA as computed by the scheduler constructors
+  static uint64_t linear_cta_index(dim3 const &grid, uint32_t x, uint32_t y, RasterOrder raster_order) {
+    if (raster_order == RasterOrder::AlongN) {
+      return uint64_t(x) + uint64_t(y) * uint64_t(grid.x);
+    }
+    return uint64_t(x) * uint64_t(grid.y) + uint64_t(y);
+  }
+
+  /// CTAs are enumerated cluster by cluster so that replay can model TMA multicast
+  void for_each_cta(dim3 const &grid, std::function<void(uint32_t, uint32_t)> const &fn) const {
+    uint32_t cluster_m = uint32_t(problem_.cluster_shape.m());
+    uint32_t cluster_n = uint32_t(problem_.cluster_shape.n());
+    for (uint32_t cy = 0; cy < grid.y; cy += cluster_n) {
+      for (uint32_t cx = 0; cx < grid.x; cx += cluster_m) {
+        for (uint32_t y = cy; y < std::min(grid.y, cy + cluster_n); ++y) {
+          for (uint32_t x = cx; x < std::min(grid.x, cx + cluster_m); ++x) {
+            fn(x, y);
+          }
+        }
+      }
+    }
+  }
+
+  Visitation persistent_visitation(L2SimulationCandidate const &candidate, L2SimulationResult *result) const {
+    PersistentParams params;
+    params.initialize(
+      problem_.problem_size,
+      problem_.tile_shape,
+      problem_.cluster_shape,
+      hw_info_,
+      candidate.max_swizzle_size,
+      candidate.raster_order_option);
+
+    dim3 grid = PersistentParams::get_grid_shape(
+      problem_.problem_size,
+      problem_.tile_shape,
+      problem_.cluster_shape,
+      hw_info_,
+      candidate.max_swizzle_size,
+      candidate.raster_order_option);
+
+    if (result) {
+      result->raster_order = params.raster_order_;
+      result->log_swizzle_size = params.log_swizzle_size_;
+      result->grid = grid;
+    }
+
+    uint64_t total_grid_size = uint64_t(grid.x) * uint64_t(grid.y) * uint64_t(grid.z);
+    int k_tiles = k_tiles_per_output_tile();
+
+    Visitation visitation;
+    for_each_cta(grid, [&](uint32_t x, uint32_t y) {
+      std::vector<L2SimulationWorkSegment> segments;
+      uint64_t cta_m_in_cluster = x % uint32_t(problem_.cluster_shape.m());
+      uint64_t cta_n_in_cluster = y % uint32_t(problem_.cluster_shape.n());
+
+      for (uint64_t linear_idx = linear_cta_index(grid, x, y, params.raster_order_);
+           linear_idx < params.blocks_per_problem_;
+           linear_idx += total_grid_size) {
+
+        // Mirrors StaticPersistentTileScheduler::get_current_work_for_linear_idx()
+        uint64_t work_idx_l, remainder;
+        params.divmod_batch_(work_idx_l, remainder, linear_idx);
+        uint64_t blk_per_grid_dim = params.divmod_cluster_shape_minor_.divide(remainder);
+
+        auto [work_idx_m, work_idx_n] = gemm::kernel::detail::PersistentTileSchedulerSm90::get_work_idx_m_and_n(
+          blk_per_grid_dim,
+          params.divmod_cluster_shape_major_,
+          params.divmod_cluster_shape_minor_,
+          params.divmod_cluster_blk_major_,
+          params.log_swizzle_size_,
+          params.raster_order_,
+          cta_m_in_cluster,
+          cta_n_in_cluster);
+
+        L2SimulationWorkSegment segment;
+        segment.m = work_idx_m;
+        segment.n = work_idx_n;
+        segment.l = int32_t(work_idx_l);
+        segment.k_begin = 0;
+        segment.k_count = k_tiles;
+        segment.writes_output = true;
+        segments.push_back(segment);
+      }
+      visitation.push_back(std::move(segments));
+    });
+    return visitation;
+  }
+
+  Visitation stream_k_visitation(L2SimulationCandidate const &candidate, L2SimulationResult *result) const {
+    StreamKParams params;
+    params.initialize(
+      problem_.problem_size,
+      problem_.tile_shape,
+      problem_.cluster_shape,
+      hw_info_,
+      stream_k_.splits,
+      candidate.max_swizzle_size,
+      candidate.raster_order_option,
+      stream_k_.reduction_mode,
+      stream_k_.decomposition_mode,
+      /* workspace = */ nullptr);
+
+    dim3 grid = StreamKParams::get_grid_shape(
+      problem_.problem_size,
+      problem_.tile_shape,
+      problem_.cluster_shape,
+      hw_info_,
+      candidate.max_swizzle_size,
+      candidate.raster_order_option);
+
+    if (result) {
+      result->raster_order = params.raster_order_;
+      result->log_swizzle_size = params.log_swizzle_size_;
+      result->grid = grid;
+    }
+
+    uint64_t total_grid_size = uint64_t(grid.x) * uint64_t(grid.y) * uint64_t(grid.z);
+    uint32_t k_tiles = uint32_t(k_tiles_per_output_tile());
+
+    Visitation visitation;
+    for_each_cta(grid, [&](uint32_t x, uint32_t y) {
+      std::vector<L2SimulationWorkSegment> segments;
+      dim3 block_id_in_cluster(
+        x % uint32_t(problem_.cluster_shape.m()),
+        y % uint32_t(problem_.cluster_shape.n()),
+        0);
+
+      // Mirrors the work loop of the SM90 warp-specialized kernels
+      uint32_t unit_iter_start = 0;
+      uint64_t linear_idx = linear_cta_index(grid, x, y, params.raster_order_);
+      auto work = StreamKScheduler::get_current_work_for_linear_idx(
+        unit_iter_start, linear_idx, block_id_in_cluster, params);
+
+      while (work.is_valid()) {
+        if (!work.is_reduction_unit()) {
+          L2SimulationWorkSegment segment;
+          segment.m = work.M_idx;
+          segment.n = work.N_idx;
+          segment.l = work.L_idx;
+          segment.k_begin = work.K_idx;
+          segment.k_count = int32_t(work.k_tile_count);
+          segment.reads_partial = work.K_idx > 0;
+          segment.writes_partial = !work.is_final_split(k_tiles);
+          segment.writes_output = !segment.writes_partial;
+          segments.push_back(segment);
+        }
+
+        if (!StreamKScheduler::continue_current_work_for_linear_idx(
+              linear_idx, unit_iter_start, block_id_in_cluster, work, params)) {
+          linear_idx += total_grid_size;
+          work = StreamKScheduler::get_current_work_for_linear_idx(
+            unit_iter_start, linear_idx, block_id_in_cluster, params);
+        }
+      }
+      visitation.push_back(std::move(segments));
+    });
+    return visitation;
+  }
+
+  //
+  // Address generation
+  //
+
+  /// Accesses a 2-D block of a matrix stored with `ld` elements between consecutive outer indices
+  static void access_block(
+    L2CacheModel &l2,
+    uint64_t base,
+    int64_t outer_begin, int64_t outer_end,
+    int64_t inner_begin, int64_t inner_end,
+    int64_t ld,
+    int element_bytes,
+    bool is_write) {
+
+    if (inner_begin >= inner_end) {
+      return;
+    }
+    for (int64_t outer = outer_begin; outer < outer_end; ++outer) {
+      uint64_t row = base + uint64_t(outer * ld) * uint64_t(element_bytes);
+      l2.access_range(
+        row + uint64_t(inner_begin) * uint64_t(element_bytes),
+        row + uint64_t(inner_end) * uint64_t(element_bytes),
+        is_write);
+    }
+  }
+
+  struct AddressMap {
+    uint64_t a = 0;
+    uint64_t b = 0;
+    uint64_t c = 0;
+    uint64_t d = 0;
+    uint64_t workspace = 0;
+  };
+
+  static uint64_t align_up(uint64_t x) {
+    constexpr uint64_t kAlignment = uint64_t(1) << 21;
+    return (x + kAlignment - 1) / kAlignment * kAlignment;
+  }
+
+  AddressMap address_map() const {
+    uint64_t m = uint64_t(problem_.problem_size.m());
+    uint64_t n = uint64_t(problem_.problem_size.n());
+    uint64_t k = uint64_t(problem_.problem_size.k());
+    uint64_t l = uint64_t(problem_.problem_size.batch());
+
+    AddressMap map;
+    map.a = 0;
+    map.b = align_up(map.a + m * k * l * uint64_t(problem_.element_bytes_a));
+    map.c = align_up(map.b + n * k * l * uint64_t(problem_.element_bytes_b));
+    map.d = align_up(map.c + m * n * l * uint64_t(problem_.element_bytes_c));
+    map.workspace = align_up(map.d + m * n * l * uint64_t(problem_.element_bytes_d));
+    return map;
+  }
+
+  /// Accesses the K tile `k` of operand A (is_b = false) or B (is_b = true) for CTA tile `mn`
+  void access_operand(L2CacheModel &l2, AddressMap const &map, bool is_b, int32_t mn, int32_t l, int32_t k) const {
+    int64_t extent_mn = is_b ? problem_.problem_size.n() : problem_.problem_size.m();
+    int64_t extent_k = problem_.problem_size.k();
+    int64_t tile_mn = is_b ? problem_.tile_shape.n() : problem_.tile_shape.m();
+    int64_t tile_k = problem_.tile_shape.k();
+    int element_bytes = is_b ? problem_.element_bytes_b : problem_.element_bytes_a;
+    bool k_major = is_b ? problem_.b_k_major : problem_.a_k_major;
+
+    int64_t mn_begin = int64_t(mn) * tile_mn;
+    int64_t mn_end = std::min(mn_begin + tile_mn, extent_mn);
+    int64_t k_begin = int64_t(k) * tile_k;
+    int64_t k_end = std::min(k_begin + tile_k, extent_k);
+
+    // Tiles outside of the problem are predicated off by TMA and generate no traffic
+    if (mn_begin >= mn_end || k_begin >= k_end) {
+      return;
+    }
+
+    uint64_t base = (is_b ? map.b : map.a) + uint64_t(l) * uint64_t(extent_mn * extent_k) * uint64_t(element_bytes);
+    if (k_major) {
+      access_block(l2, base, mn_begin, mn_end, k_begin, k_end, extent_k, element_bytes, false);
+    }
+    else {
+      access_block(l2, base, k_begin, k_end, mn_begin, mn_end, extent_mn, element_bytes, false);
+    }
+  }
+
+  /// Accesses the MxN block of an output-shaped tensor
+  void access_output_tile(
+    L2CacheModel &l2, uint64_t base, int element_bytes, L2SimulationWorkSegment const &s, bool is_write) const {
+
+    if (element_bytes == 0) {
+      return;
+    }
+    int64_t extent_m = problem_.problem_size.m();
+    int64_t extent_n = problem_.problem_size.n();
+    int64_t m_begin = int64_t(s.m) * problem_.tile_shape.m();
+    int64_t m_end = std::min(m_begin + problem_.tile_shape.m(), extent_m);
+    int64_t n_begin = int64_t(s.n) * problem_.tile_shape.n();
+    int64_t n_end = std::min(n_begin + problem_.tile_shape.n(), extent_n);
+    if (m_begin >= m_end || n_begin >= n_end) {
+      return;
+    }
+
+    base += uint64_t(s.l) * uint64_t(extent_m * extent_n) * uint64_t(element_bytes);
+    if (problem_.d_n_major) {
+      access_block(l2, base, m_begin, m_end, n_begin, n_end, extent_n, element_bytes, is_write);
+    }
+    else {
+      access_block(l2, base, n_begin, n_end, m_begin, m_end, extent_m, element_bytes, is_write);
+    }
+  }
+
+  /// Accesses the partial accumulator tile of an output tile in the reduction workspace
+  void access_partial_tile(L2CacheModel &l2, AddressMap const &map, L2SimulationWorkSegment const &s, bool is_write) const {
+    int64_t tiles_m = (problem_.problem_size.m() + problem_.tile_shape.m() - 1) / problem_.tile_shape.m();
+    int64_t tiles_n = (problem_.problem_size.n() + problem_.tile_shape.n() - 1) / problem_.tile_shape.n();
+    uint64_t tile_bytes = uint64_t(problem_.tile_shape.m()) * uint64_t(problem_.tile_shape.n()) *
+                          uint64_t(problem_.element_bytes_accumulator);
+    uint64_t tile_idx = (uint64_t(s.l) * uint64_t(tiles_m) + uint64_t(s.m)) * uint64_t(tiles_n) + uint64_t(s.n);
+    uint64_t begin = map.workspace + tile_idx * tile_bytes;
+    l2.access_range(begin, begin + tile_bytes, is_write);
+  }
+
+  void run_epilogue(L2CacheModel &l2, AddressMap const &map, L2SimulationWorkSegment const &s) const {
+    if (s.reads_partial) {
+      access_partial_tile(l2, map, s, false);
+    }
+    if (s.writes_partial) {
+      access_partial_tile(l2, map, s, true);
+    }
+    if (s.writes_output) {
+      access_output_tile(l2, map.c, problem_.element_bytes_c, s, false);
+      access_output_tile(l2, map.d, problem_.element_bytes_d, s, true);
+    }
+  }
+
+  /// Interleaves the CTAs one mainloop iteration at a time. CTAs of the same cluster requesting
+  /// the same operand tile in a step are served by a single multicast load.
+  void replay(Visitation const &visitation, dim3 const &grid, L2CacheModel &l2, L2SimulationResult &result) const {
+    AddressMap map = address_map();
+
+    struct Cursor {
+      size_t segment = 0;
+      int32_t k = 0;
+    };
+    std::vector<Cursor> cursors(visitation.size());
+
+    size_t cluster_size = size_t(problem_.cluster_shape.m()) * size_t(problem_.cluster_shape.n());
+    cluster_size = std::max<size_t>(1, std::min(cluster_size, size_t(grid.x) * size_t(grid.y)));
+
+    for (auto const &segments : visitation) {
+      result.work_segments += segments.size();
+    }
+
+    // (l, mn, k) of operand tiles issued by the current cluster in the current step
+    std::vector<std::array<int32_t, 3>> issued_a, issued_b;
+
+    bool active = true;
+    while (active) {
+      active = false;
+      for (size_t cluster_begin = 0; cluster_begin < visitation.size(); cluster_begin += cluster_size) {
+        issued_a.clear();
+        issued_b.clear();
+        size_t cluster_end = std::min(visitation.size(), cluster_begin + cluster_size);
+
+        for (size_t cta = cluster_begin; cta < cluster_end; ++cta) {
+          auto const &segments = visitation[cta];
+          Cursor &cursor = cursors[cta];
+
+          // Skip segments that compute no K tiles (possible for empty stream-K splits)
+          while (cursor.segment < segments.size() && cursor.k >= segments[cursor.segment].k_count) {
+            run_epilogue(l2, map, segments[cursor.segment]);
+            ++cursor.segment;
+            cursor.k = 0;
+          }
+          if (cursor.segment == segments.size()) {
+            continue;
+          }
+          active = true;
+
+          L2SimulationWorkSegment const &s = segments[cursor.segment];
+          int32_t k = s.k_begin + cursor.k;
+
+          std::array<int32_t, 3> key_a{s.l, s.m, k};
+          if (std::find(issued_a.begin(), issued_a.end(), key_a) == issued_a.end()) {
+            issued_a.push_back(key_a);
+            access_operand(l2, map, false, s.m, s.l, k);
+          }
+          std::array<int32_t, 3> key_b{s.l, s.n, k};
+          if (std::find(issued_b.begin(), issued_b.end(), key_b) == issued_b.end()) {
+            issued_b.push_back(key_b);
+            access_operand(l2, map, true, s.n, s.l, k);
+          }
+
+          ++result.mainloop_steps;
+          if (++cursor.k == s.k_count) {
+            run_epilogue(l2, map, s);
+            ++cursor.segment;
+            cursor.k = 0;
+          }
+        }
+      }
+    }
+  }
+};
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
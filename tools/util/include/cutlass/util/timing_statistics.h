@@ -0,0 +1,273 @@
+/***************************************************************************************************
+ * Copyright (c) 2025 - 2025 NVIDIA CORPORATION & AFFILIATES. All rights reserved.
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ * list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of the copyright holder nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ * CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+ * OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ **************************************************************************************************/
+#pragma once
+
+/*! \file
+    \brief Summary statistics and adaptive stopping for per-iteration timing samples.
+
+    The classes here only consume durations, so they are independent of how samples are measured
+    (CUDA events, host clocks, or synthetic streams in tests).
+*/
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace cutlass {
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Parameters controlling outlier rejection and adaptive stopping
+struct TimingStatisticsOptions {
+
+  /// Samples whose modified z-score, 0.6745 * |x - median| / MAD, exceeds this threshold are
+  /// rejected as outliers. A value <= 0 disables rejection.
+  double outlier_threshold = 3.5;
+
+  /// Two-sided normal quantile of the confidence interval on the mean (1.96 ~ 95%)
+  double confidence_z = 1.96;
+
+  /// Sampling stops once the confidence interval half-width is within this fraction of the
+  /// mean. A value <= 0 disables adaptive stopping.
+  double relative_precision = 0.01;
+
+  /// Minimum number of samples before adaptive stopping is considered
+  int min_samples = 10;
+
+  /// Sampling always stops after this many samples. A value <= 0 means unbounded.
+  int max_samples = 0;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Summary of a set of timing samples. Durations share the unit of the samples.
+struct TimingStatistics {
+
+  /// Number of samples recorded
+  int samples = 0;
+
+  /// Number of samples rejected as outliers. Remaining statistics exclude these.
+  int outliers = 0;
+
+  double mean = 0;
+  double median = 0;
+  double p90 = 0;
+  double p99 = 0;
+  double min = 0;
+  double max = 0;
+  double stddev = 0;
+
+  /// Half-width of the confidence interval on the mean
+  double confidence_half_width = 0;
+
+  /// Number of samples retained after outlier rejection
+  int retained() const {
+    return samples - outliers;
+  }
+
+  /// Confidence interval half-width relative to the mean
+  double relative_half_width() const {
+    return mean > 0 ? confidence_half_width / mean : 0;
+  }
+
+  /// Computes statistics from a set of samples
+  static TimingStatistics compute(
+    std::vector<double> samples,
+    TimingStatisticsOptions const &options = TimingStatisticsOptions()) {
+
+    TimingStatistics stats;
+    stats.samples = int(samples.size());
+
+    if (samples.empty()) {
+      return stats;
+    }
+
+    std::sort(samples.begin(), samples.end());
+
+    if (options.outlier_threshold > 0 && samples.size() > 2) {
+
+      double median = percentile_sorted(samples, 50);
+
+      std::vector<double> deviations(samples.size());
+      for (size_t i = 0; i < samples.size(); ++i) {
+        deviations[i] = std::abs(samples[i] - median);
+      }
+      std::sort(deviations.begin(), deviations.end());
+      double mad = percentile_sorted(deviations, 50);
+
+      // With a zero MAD at least half the samples are identical; nothing is rejected so that
+      // a quantized timer cannot discard valid samples.
+      if (mad > 0) {
+        double limit = options.outlier_threshold * mad / 0.6745;
+        auto first = std::lower_bound(samples.begin(), samples.end(), median - limit);
+        auto last = std::upper_bound(samples.begin(), samples.end(), median + limit);
+        samples = std::vector<double>(first, last);
+      }
+    }
+
+    stats.outliers = stats.samples - int(samples.size());
+
+    double sum = 0;
+    for (double x : samples) {
+      sum += x;
+    }
+    stats.mean = sum / double(samples.size());
+
+    double sum_squares = 0;
+    for (double x : samples) {
+      sum_squares += (x - stats.mean) * (x - stats.mean);
+    }
+    stats.stddev = samples.size() > 1 ? std::sqrt(sum_squares / double(samples.size() - 1)) : 0;
+
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.median = percentile_sorted(samples, 50);
+    stats.p90 = percentile_sorted(samples, 90);
+    stats.p99 = percentile_sorted(samples, 99);
+    stats.confidence_half_width = options.confidence_z * stats.stddev / std::sqrt(double(samples.size()));
+
+    return stats;
+  }
+
+  /// Percentile of sorted data with linear interpolation between closest ranks
+  static double percentile_sorted(std::vector<double> const &sorted, double percent) {
+    if (sorted.empty()) {
+      return 0;
+    }
+    double rank = percent / 100.0 * double(sorted.size() - 1);
+    size_t lower = size_t(std::floor(rank));
+    size_t upper = std::min(lower + 1, sorted.size() - 1);
+    double fraction = rank - double(lower);
+    return sorted[lower] + fraction * (sorted[upper] - sorted[lower]);
+  }
+};
+
+inline std::ostream &operator<<(std::ostream &out, TimingStatistics const &stats) {
+  return out
+    << "samples: " << stats.samples
+    << ", outliers: " << stats.outliers
+    << ", mean: " << stats.mean
+    << ", median: " << stats.median
+    << ", p90: " << stats.p90
+    << ", p99: " << stats.p99
+    << ", stddev: " << stats.stddev
+    << ", ci: +/-" << stats.confidence_half_width;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// Accumulates timing samples and decides when enough have been collected
+class TimingSampler {
+public:
+
+  explicit TimingSampler(TimingStatisticsOptions const &options = TimingStatisticsOptions()):
+    options_(options), sum_(0), sum_squares_(0) { }
+
+  TimingStatisticsOptions const &options() const {
+    return options_;
+  }
+
+  void add_sample(double duration) {
+    samples_.push_back(duration);
+    sum_ += duration;
+    sum_squares_ += duration * duration;
+  }
+
+  template <typename Iterator>
+  void add_samples(Iterator begin, Iterator end) {
+    for (; begin != end; ++begin) {
+      add_sample(double(*begin));
+    }
+  }
+
+  int count() const {
+    return int(samples_.size());
+  }
+
+  std::vector<double> const &samples() const {
+    return samples_;
+  }
+
+  void reset() {
+    samples_.clear();
+    sum_ = 0;
+    sum_squares_ = 0;
+  }
+
+  /// Returns true once the confidence interval is tight enough or max_samples is reached.
+  ///
+  /// A running-moment test accepts well-behaved streams in O(1). Callers with many samples should
+  /// check once per batch, since a failing test falls back to the O(n log n) robust estimate.
+  bool converged() const {
+
+    int n = count();
+
+    if (options_.max_samples > 0 && n >= options_.max_samples) {
+      return true;
+    }
+
+    if (options_.relative_precision <= 0 || n < std::max(options_.min_samples, 2)) {
+      return false;
+    }
+
+    double mean = sum_ / n;
+    double variance = std::max(0.0, (sum_squares_ - n * mean * mean) / (n - 1));
+    double half_width = options_.confidence_z * std::sqrt(variance / n);
+
+    if (half_width <= options_.relative_precision * mean) {
+      return true;
+    }
+
+    // Outliers inflate the running variance; confirm against the robust estimate
+    TimingStatistics stats = statistics();
+    return stats.retained() >= options_.min_samples &&
+      stats.confidence_half_width <= options_.relative_precision * stats.mean;
+  }
+
+  TimingStatistics statistics() const {
+    return TimingStatistics::compute(samples_, options_);
+  }
+
+private:
+
+  TimingStatisticsOptions options_;
+  std::vector<double> samples_;
+  double sum_;
+  double sum_squares_;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+
+} // namespace cutlass
+
+////////////////////////////////////////////////////////////////////////////////////////////////////